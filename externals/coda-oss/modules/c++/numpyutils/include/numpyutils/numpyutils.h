@@ -183,6 +183,31 @@ T* getBuffer(PyObject* pyObject)
  */
 void verifyNewPyObject(PyObject* object);
 
+/*!
+ * Releases the GIL for the lifetime of the object, so other Python threads
+ * can run during long C++ calls (e.g. file reads).  No Python API calls
+ * may be made while it is in scope.
+ */
+class ScopedGILRelease
+{
+public:
+    ScopedGILRelease() :
+        mState(PyEval_SaveThread())
+    {
+    }
+
+    ~ScopedGILRelease()
+    {
+        PyEval_RestoreThread(mState);
+    }
+
+    ScopedGILRelease(const ScopedGILRelease&) = delete;
+    ScopedGILRelease& operator=(const ScopedGILRelease&) = delete;
+
+private:
+    PyThreadState* const mState;
+};
+
 }
 
 #endif
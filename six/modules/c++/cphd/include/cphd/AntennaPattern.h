@@ -0,0 +1,245 @@
+/* =========================================================================
+ * This file is part of cphd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * cphd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef __CPHD_ANTENNA_PATTERN_H__
+#define __CPHD_ANTENNA_PATTERN_H__
+
+#include <stddef.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <std/span>
+
+#include <cphd/Antenna.h>
+#include <cphd/Metadata.h>
+#include <cphd/PVPBlock.h>
+#include <cphd/SupportArray.h>
+#include <cphd/SupportBlock.h>
+
+namespace cphd
+{
+/*!
+ *  \class AntennaPatternEvaluator
+ *
+ *  \brief Evaluates a channel's antenna patterns toward the SRP for a range
+ *  of vectors
+ *
+ *  For each vector, the APC position and time (TxPos and TxTime, or RcvPos
+ *  and RcvTime) come from the PVPBlock, and the pointing direction is the
+ *  unit vector from the APC to SRPPos, expressed as direction cosines
+ *  (DCX, DCY) along the axes of the APC's AntCoordFrame at that time.
+ *  The pattern at frequency f is then:
+ *  - Array: the Array polynomials at (DCX - EB_DCX, DCY - EB_DCY), where the
+ *    electrical boresight is scaled by f_0 / f if EBFreqShift is set and the
+ *    argument is scaled by f / f_0 if MLFreqDilation is set.  GainBSPoly at
+ *    f - f_0 is added to the gain.
+ *  - Element: the Element polynomials at (DCX, DCY).
+ *  Gain (dB, relative to GainZero) and phase (cycles) are the sums of the
+ *  two.
+ *
+ *  If a pattern's GainPhaseArray support arrays have been loaded, the entry
+ *  nearest each vector's center frequency is bilinearly interpolated in
+ *  place of the matching polynomials.  Sampled patterns are only valid at
+ *  their own frequency, so neither frequency scaling nor GainBSPoly is
+ *  applied to them, and directions off the grid take the nearest edge.
+ *
+ *  Vectors are split across threads, and polynomials are evaluated with
+ *  Horner's method over blocks of points, innermost, so that the loops
+ *  vectorize.  The Metadata and PVPBlock must outlive the evaluator.
+ */
+class AntennaPatternEvaluator
+{
+public:
+    //! Which of a channel's antennas to evaluate
+    enum class Side
+    {
+        TRANSMIT,
+        RECEIVE
+    };
+
+    /*!
+     *  \param metadata Metadata with an Antenna block
+     *  \param pvpBlock PVPs of the signal arrays
+     *  \param numThreads Threads to use.  0 means one per core.
+     *
+     *  \throws except::Exception if there's no Antenna block
+     */
+    AntennaPatternEvaluator(const Metadata& metadata,
+                            const PVPBlock& pvpBlock,
+                            size_t numThreads = 0);
+
+    /*!
+     *  Reads every GainPhaseArray support array the antenna patterns refer to
+     *
+     *  \param supportBlock Support block of the CPHD
+     */
+    void loadGainPhaseArrays(const SupportBlock& supportBlock);
+
+    /*!
+     *  Sets the samples of a GainPhaseArray support array
+     *
+     *  \param id Support array identifier
+     *  \param data Row-major (gain, phase) pairs, numRows x numCols of them
+     *   as given by the Data block.  Rows are along X and columns along Y
+     *   of the AntGainPhase grid.
+     *
+     *  \throws except::Exception if the support array isn't an AntGainPhase
+     *   array or data is the wrong size
+     */
+    void setGainPhaseArray(const std::string& id, std::span<const float> data);
+
+    /*!
+     *  \func getDirectionCosines
+     *
+     *  \brief Direction cosines of the SRP in the antenna coordinate frame
+     *
+     *  \param channel 0-based channel number
+     *  \param side Antenna to use
+     *  \param firstVector First vector to evaluate
+     *  \param[out] dcx DCX of vectors [firstVector, firstVector + dcx.size())
+     *  \param[out] dcy DCY, the same size as dcx
+     *
+     *  \throws except::Exception if the channel has no antenna or the
+     *   vectors are out of range
+     */
+    void getDirectionCosines(size_t channel,
+                             Side side,
+                             size_t firstVector,
+                             std::span<double> dcx,
+                             std::span<double> dcy) const;
+
+    /*!
+     *  \func evaluate
+     *
+     *  \brief Evaluates the pattern at each vector's center frequency,
+     *  (FX1 + FX2) / 2
+     *
+     *  \param channel 0-based channel number
+     *  \param side Antenna to use
+     *  \param firstVector First vector to evaluate
+     *  \param[out] gain Gain (dB) of vectors
+     *   [firstVector, firstVector + gain.size())
+     *  \param[out] phase Phase (cycles), the same size as gain
+     *
+     *  \throws except::Exception if the channel has no antenna or the
+     *   vectors are out of range
+     */
+    void evaluate(size_t channel,
+                  Side side,
+                  size_t firstVector,
+                  std::span<double> gain,
+                  std::span<double> phase) const;
+
+    /*!
+     *  \func evaluateSamples
+     *
+     *  \brief Evaluates the pattern at every sample of FX domain vectors,
+     *  whose frequencies are SC0 + n * SCSS
+     *
+     *  \param channel 0-based channel number
+     *  \param side Antenna to use
+     *  \param firstVector First vector to evaluate
+     *  \param numVectors Number of vectors to evaluate
+     *  \param[out] gain Gain (dB), numVectors x numSamples
+     *  \param[out] phase Phase (cycles), numVectors x numSamples
+     *
+     *  \throws except::Exception if the domain isn't FX, the channel has no
+     *   antenna, the vectors are out of range or the outputs are the wrong
+     *   size
+     */
+    void evaluateSamples(size_t channel,
+                         Side side,
+                         size_t firstVector,
+                         size_t numVectors,
+                         std::span<float> gain,
+                         std::span<float> phase) const;
+
+private:
+    // Poly2D coefficients, flattened so they can be read without copies
+    struct Coefficients
+    {
+        size_t numX = 0;
+        size_t numY = 0;
+        std::vector<double> values;
+    };
+
+    struct Pattern
+    {
+        const AntPattern* antPattern = nullptr;
+        Coefficients arrayGain;
+        Coefficients arrayPhase;
+        Coefficients elementGain;
+        Coefficients elementPhase;
+        std::vector<double> gainBS;
+    };
+
+    struct Grid
+    {
+        const SupportArrayParameter* parameter = nullptr;
+        size_t numRows = 0;
+        size_t numCols = 0;
+        std::vector<float> values;
+    };
+
+    // What a channel's transmit or receive antenna points with
+    struct Source
+    {
+        const AntCoordFrame* acf = nullptr;
+        const Pattern* pattern = nullptr;
+    };
+
+    // Pointing of vectors [firstVector, firstVector + numVectors)
+    struct Geometry
+    {
+        explicit Geometry(size_t numVectors);
+
+        std::vector<double> dcx;
+        std::vector<double> dcy;
+        std::vector<double> ebx;
+        std::vector<double> eby;
+    };
+
+    Source getSource(size_t channel, Side side) const;
+    void checkVectors(size_t channel,
+                      size_t firstVector,
+                      size_t numVectors) const;
+    void getGeometry(const Source& source,
+                     size_t channel,
+                     Side side,
+                     size_t firstVector,
+                     Geometry& geometry) const;
+    void getGrids(const Pattern& pattern,
+                  double frequency,
+                  const Grid*& array,
+                  const Grid*& element) const;
+
+    const Metadata& mMetadata;
+    const PVPBlock& mPVPBlock;
+    const size_t mNumThreads;
+    std::unordered_map<std::string, Pattern> mPatterns;
+    std::unordered_map<std::string, Grid> mGrids;
+};
+}
+
+#endif
@@ -68,6 +68,9 @@ struct CPHDReader final
      *  \param numThreads Number of threads for parallelization
      *  \param schemaPaths (Optional) XML schemas for validation
      *  \param logger (Optional) Provide custom log
+     *
+     *  The file is read through a six::BatchInputStream, so the vectors
+     *  of a partial sample range are read as one batch.
      */
     // Provides access to wideband but doesn't read it
     CPHDReader(const std::string& fromFile,
@@ -98,6 +101,21 @@ struct CPHDReader final
         return mMetadata.data.getNumBytesPerSample();
     }
 
+    /*
+     *  \func readMany
+     *  \brief Read blocks of one or more channels in parallel
+     *
+     *  See Wideband::readMany(). Wideband and support reads either use
+     *  positional reads or share one lock on the stream, so channels may
+     *  also be read from several threads at once through getWideband() and
+     *  getSupportBlock().
+     */
+    void readMany(const std::vector<Wideband::ReadRequest>& requests,
+                  size_t numThreads) const
+    {
+        mWideband->readMany(requests, numThreads);
+    }
+
     /*
      *  \func getFileOffset
      *  \brief Calculate signal array offset in file
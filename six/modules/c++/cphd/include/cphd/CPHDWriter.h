@@ -272,6 +272,16 @@ struct CPHDWriter
      */
     void writeMetadata(const PVPBlock& pvpBlock);
 
+    /*
+     *  \func writeMetadata
+     *  \brief Writes the header, and metadata into the file, sizing the
+     *  PVP block from the metadata alone.
+     *
+     *  Pair this with the blocked writePVPData() when the PVP arrays are
+     *  too large to hold in a single PVPBlock.
+     */
+    void writeMetadata();
+
     /*
      *  \func writeSupportData
      *  \brief Writes the specified support Array to the file
@@ -325,6 +335,22 @@ struct CPHDWriter
      */
     void writePVPData(const PVPBlock& PVPBlock);
 
+    /*
+     *  \func writePVPData
+     *  \brief Writes a block of consecutive PVP sets of one channel
+     *
+     *  Blocks must be written in file order (every vector of channel 0,
+     *  then channel 1, ...). Padding is added before the first block.
+     *
+     *  \param pvpBlock A PVPBlock with a single PVP array holding the
+     *  vectors to write
+     *  \param channel The channel the vectors belong to
+     *  \param firstVector Index of the block's first vector in the channel
+     */
+    void writePVPData(const PVPBlock& pvpBlock,
+                      size_t channel,
+                      size_t firstVector);
+
     /*
      *  \func writeCPHDData
      *  \brief Writes a chunk of CPHD data to disk. To create a proper
@@ -352,6 +378,12 @@ struct CPHDWriter
         mStream->close();
     }
 
+    //! The metadata being written
+    const Metadata& getMetadata() const
+    {
+        return mMetadata;
+    }
+
 private:
     /*
      *  Write metadata helper
@@ -0,0 +1,228 @@
+/* =========================================================================
+ * This file is part of cphd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * cphd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef __CPHD_IMAGE_FORMATION_H__
+#define __CPHD_IMAGE_FORMATION_H__
+
+#include <stddef.h>
+
+#include <complex>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <std/span>
+
+#include <types/RowCol.h>
+#include <six/Enums.h>
+#include <six/sicd/ComplexData.h>
+#include <cphd/Metadata.h>
+#include <cphd/PVPBlock.h>
+#include <cphd/Types.h>
+#include <cphd/Wideband.h>
+
+namespace cphd
+{
+/*!
+ *  \class ImageFormer
+ *
+ *  \brief Reference processor that forms a SICD from one channel of FX
+ *  domain phase history
+ *
+ *  Each vector's samples are modelled as exp(j SGN 2 pi K . d) for a
+ *  scatterer at d from its SRP, with K = f (-uT - uR) / c and uT, uR the
+ *  unit vectors from the SRP toward the transmit and receive APCs.  The
+ *  image plane passes through the SCP, the SRP of the channel's reference
+ *  vector, with rows along the projection of the reference vector's K away
+ *  from the radar and columns along the ARP velocity.
+ *
+ *  Polar format processing interpolates each vector onto the range
+ *  frequencies of a rectangle inscribed in the polar annulus as blocks of
+ *  vectors are read, then interpolates each range frequency across vectors
+ *  and transforms both dimensions with six::FFT.  It assumes a fixed SRP.
+ *  Backprojection sums every vector's upsampled range profile into every
+ *  pixel, which is exact for any geometry but costs vectors x pixels, so it
+ *  is meant for small scenes.
+ *
+ *  Either way memory is bounded by one block of vectors, the output image
+ *  and, for PFA, the range-interpolated k-space; the whole phase history is
+ *  never held.  Work is split across threads with mt::run1D.  The Metadata
+ *  and PVPBlock must outlive the former.
+ */
+class ImageFormer
+{
+public:
+    //! Image formation algorithm
+    enum class Algorithm
+    {
+        PFA,
+        BACKPROJECTION
+    };
+
+    struct Options
+    {
+        Algorithm algorithm = Algorithm::PFA;
+
+        //! SLANT or GROUND
+        six::ComplexImagePlaneType imagePlane =
+                six::ComplexImagePlaneType::SLANT;
+
+        //! Output size.  0 means oversample times the signal array size.
+        types::RowCol<size_t> dims = types::RowCol<size_t>(0, 0);
+
+        //! Pixel spacing (m).  0 means one over oversample times the
+        //! processed bandwidth.
+        types::RowCol<double> sampleSpacing = types::RowCol<double>(0, 0);
+
+        //! Ratio of the sample rate to the processed bandwidth
+        double oversample = 1.5;
+
+        //! Vectors read at a time
+        size_t numVectorsPerBlock = 1024;
+
+        //! Threads to use.  0 means one per core.
+        size_t numThreads = 0;
+    };
+
+    /*!
+     *  Reads vectors [firstVector, firstVector + numVectors) of the channel
+     *  into data, numVectors x numSamples of them, scaled by AmpSF
+     */
+    using ReadVectors = std::function<void(
+            size_t firstVector,
+            size_t numVectors,
+            std::span<std::complex<float> > data)>;
+
+    /*!
+     *  \param metadata Metadata of an FX domain CPHD
+     *  \param pvpBlock PVPs of the signal arrays
+     *  \param channel 0-based channel to process
+     *  \param options Processing options
+     *
+     *  \throws except::Exception if the domain isn't FX, the channel doesn't
+     *   exist or the options are invalid
+     */
+    ImageFormer(const Metadata& metadata,
+                const PVPBlock& pvpBlock,
+                size_t channel,
+                const Options& options);
+
+    //! \return Rows and columns of the image
+    types::RowCol<size_t> getDims() const
+    {
+        return mDims;
+    }
+
+    /*!
+     *  \return SICD metadata of the image, with the Grid, ImageFormation,
+     *   PFA (for PFA) and derived SCPCOA and GeoData filled in
+     */
+    std::unique_ptr<six::sicd::ComplexData> getComplexData() const;
+
+    /*!
+     *  Forms the image
+     *
+     *  \param read Called for successive blocks of vectors
+     *  \param[out] image Row-major pixels, getDims().area() of them
+     *
+     *  \throws except::Exception if image is the wrong size
+     */
+    void form(const ReadVectors& read,
+              std::span<std::complex<float> > image) const;
+
+    /*!
+     *  Forms the image from the channel's signal array, applying AmpSF if
+     *  it's present
+     *
+     *  \throws except::Exception if the signal array is compressed
+     */
+    void form(const Wideband& wideband,
+              std::span<std::complex<float> > image) const;
+
+    /*!
+     *  Forms the image from the channel's signal array and writes it as a
+     *  SICD with six::sicd::SICDWriteControl
+     *
+     *  \param wideband Signal arrays of the CPHD
+     *  \param pathname SICD to write
+     *  \param schemaPaths Schema locations used to validate the XML
+     */
+    void write(const Wideband& wideband,
+               const std::string& pathname,
+               const std::vector<std::string>& schemaPaths) const;
+
+private:
+    // PVP-derived quantities of each vector of the channel
+    struct Vectors
+    {
+        std::vector<double> time;
+        std::vector<Vector3> txPos;
+        std::vector<Vector3> rcvPos;
+        std::vector<Vector3> srpPos;
+        std::vector<double> kRow;   // K / f along the row direction
+        std::vector<double> kCol;   // K / f along the column direction
+        std::vector<double> fx1;
+        std::vector<double> fx2;
+        std::vector<double> sc0;
+        std::vector<double> scss;
+    };
+
+    // Spatial frequency extent (cycles / m)
+    struct Support
+    {
+        double rowMin = 0.0;
+        double rowMax = 0.0;
+        double colMin = 0.0;
+        double colMax = 0.0;
+    };
+
+    void formPolar(const ReadVectors& read,
+                   std::span<std::complex<float> > image) const;
+    void formBackprojection(const ReadVectors& read,
+                            std::span<std::complex<float> > image) const;
+    void transform(std::span<std::complex<float> > image) const;
+
+    const Metadata& mMetadata;
+    const PVPBlock& mPVPBlock;
+    const size_t mChannel;
+    const Options mOptions;
+    const size_t mNumThreads;
+    size_t mNumVectors;
+    size_t mNumSamples;
+    double mSign;
+
+    Vector3 mSCP;
+    Vector3 mRowUnitVector;
+    Vector3 mColUnitVector;
+    double mReferenceTime;
+    Vectors mVectors;
+
+    // The inscribed rectangle for PFA, the bounding one for backprojection
+    Support mSupport;
+    types::RowCol<double> mKCenter;
+    types::RowCol<size_t> mDims;
+    types::RowCol<double> mSampleSpacing;
+};
+}
+
+#endif
@@ -223,8 +223,7 @@ struct PVPBlock
         {
             if(mData[channel][set].addedPVP.count(name) == 0)
             {
-                mData[channel][set].addedPVP[name] = six::Parameter();
-                mData[channel][set].addedPVP.find(name)->second.setValue(value);
+                mData[channel][set].addedPVP[name].setValue(value);
                 return;
             }
             throw except::Exception(Ctxt(
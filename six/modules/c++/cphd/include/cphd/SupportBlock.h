@@ -26,6 +26,7 @@
 #include <iostream>
 #include <string>
 #include <complex>
+#include <mutex>
 #include <unordered_map>
 
 #include <std/cstddef>
@@ -35,6 +36,7 @@
 #include <types/RowCol.h>
 #include <mem/ScopedArray.h>
 #include <mem/BufferView.h>
+#include <six/BatchInputStream.h>
 
 #include <cphd/Data.h>
 #include <cphd/Utilities.h>
@@ -76,13 +78,17 @@ struct SupportBlock final
      *  \param data Data section from CPHD
      *  \param startSupport CPHD header keyword "SUPPORT_BLOCK_BYTE_OFFSET"
      *  \param sizeSupport CPHD header keyword "SUPPORT_BLOCK_SIZE"
+     *  \param streamMutex (Optional) Lock held while seeking and reading
+     *  inStream; pass the same one to everything else that reads it
      */
     SupportBlock(std::shared_ptr<io::SeekableInputStream> inStream,
                  const cphd::Data& data,
                  int64_t startSupport,
-                 int64_t sizeSupport);
+                 int64_t sizeSupport,
+                 std::shared_ptr<std::mutex> streamMutex = nullptr);
     SupportBlock(std::shared_ptr<io::SeekableInputStream> inStream,
-        const cphd::Data& data, const FileHeader&);
+        const cphd::Data& data, const FileHeader&,
+        std::shared_ptr<std::mutex> streamMutex = nullptr);
 
     // Noncopyable
     SupportBlock(const SupportBlock&) = delete;
@@ -184,6 +190,8 @@ private:
     const int64_t mSupportOffset;       // offset in bytes to start of SupportBlock
     const size_t mSupportSize;             // total size in bytes of SupportBlock
     std::unordered_map<std::string,int64_t> mOffsets; // Offset to start of each support array
+    six::BatchInputStream* const mBatchStream; // mInStream, if it is one
+    const std::shared_ptr<std::mutex> mStreamMutex; // Guards seeks and reads of other streams
 
     friend std::ostream& operator<< (std::ostream& os, const SupportBlock& d);
 };
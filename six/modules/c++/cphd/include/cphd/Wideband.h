@@ -26,6 +26,8 @@
 #include <complex>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include <scene/sys_Conf.h>
 #include <cphd/MetadataBase.h>
@@ -34,6 +36,7 @@
 #include <io/SeekableStreams.h>
 #include <mem/BufferView.h>
 #include <mem/ScopedArray.h>
+#include <six/BatchInputStream.h>
 #include <sys/Conf.h>
 #include <gsl/gsl.h>
 #include <types/RowCol.h>
@@ -52,6 +55,17 @@ struct Wideband final
 {
     static const size_t ALL;
 
+    //! One block of a readMany() call
+    struct ReadRequest
+    {
+        size_t channel;
+        size_t firstVector;
+        size_t lastVector;  //!< Inclusive, or ALL
+        size_t firstSample;
+        size_t lastSample;  //!< Inclusive, or ALL
+        std::span<std::byte> data;  //!< At least getBytesRequiredForRead()
+    };
+
     /*!
      *  \func Wideband
      *
@@ -76,11 +90,14 @@ struct Wideband final
      *  \param metadata Metadata section of CPHD file
      *  \param startWB CPHD header keyword "cphd_BYTE_OFFSET"
      *  \param sizeWB CPHD header keyword "cphd_DATA_SIZE"
+     *  \param streamMutex (Optional) Lock held while seeking and reading
+     *  inStream; pass the same one to everything else that reads it
      */
     Wideband(std::shared_ptr<io::SeekableInputStream> inStream,
              const cphd::MetadataBase& metadata,
              int64_t startWB,
-             int64_t sizeWB);
+             int64_t sizeWB,
+             std::shared_ptr<std::mutex> streamMutex = nullptr);
 
     /*!
      *  \func getFileOffset
@@ -346,6 +363,31 @@ struct Wideband final
              buffer);
     }
 
+    /*!
+     *  \func readMany
+     *
+     *  \brief Read several blocks, possibly of different channels, at once
+     *
+     *  Every request is checked before anything is read. On a file opened
+     *  by pathname, the reads of all the requests are then queued together
+     *  on an io_uring so the device sees them all at once; without io_uring
+     *  they are split over numThreads threads of positional reads. Any
+     *  other stream is read one range at a time. Endian swapping of each
+     *  block is split over numThreads.
+     *
+     *  Like every read, this may be called from several threads at once.
+     *
+     *  \param requests Blocks to read, each into its own buffer
+     *  \param numThreads Number of threads to use for positional reads and
+     *  endian swapping
+     *
+     *  \throw except::Exception If any request is invalid or its buffer is
+     *  too small
+     *  \throw except::Exception If wideband data is compressed
+     */
+    void readMany(const std::vector<ReadRequest>& requests,
+                  size_t numThreads) const;
+
     /*!
      * Calculate the number of bytes required to read requested channel
      * Overload for simply requesting entire channel.
@@ -450,6 +492,24 @@ private:
      */
     void readImpl(size_t channel, void* data) const;
 
+    /*
+     *  Appends the file ranges of an already checked block to requests
+     */
+    void getRanges(size_t channel,
+                   size_t firstVector,
+                   size_t firstSample,
+                   const types::RowCol<size_t>& dims,
+                   void* data,
+                   std::vector<six::BatchInputStream::Request>& requests) const;
+
+    /*
+     *  Reads file ranges without disturbing other threads' reads: with
+     *  positional reads if the stream supports them, else one caller at a
+     *  time
+     */
+    void readRanges(
+            const std::vector<six::BatchInputStream::Request>& requests) const;
+
     /*
      *  Returns true if scale factor vector is all ones
      *  False otherwise.
@@ -470,6 +530,9 @@ private:
 
     std::vector<int64_t> mOffsets;  // Offset to start of each channel
 
+    six::BatchInputStream* const mBatchStream;  // mInStream, if it is one
+    const std::shared_ptr<std::mutex> mStreamMutex;  // Guards seeks and reads of other streams
+
     friend std::ostream& operator<<(std::ostream& os, const Wideband& d);
 };
 }
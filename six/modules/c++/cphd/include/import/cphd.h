@@ -37,6 +37,7 @@
 #include "cphd/ErrorParameters.h"
 #include "cphd/FileHeader.h"
 #include "cphd/Global.h"
+#include "cphd/ImageFormation.h"
 #include "cphd/MetadataBase.h"
 #include "cphd/Metadata.h"
 #include "cphd/ProductInfo.h"
@@ -0,0 +1,698 @@
+/* =========================================================================
+ * This file is part of cphd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * cphd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cphd/AntennaPattern.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <thread>
+#include <utility>
+
+#include <std/bit>
+
+#include <except/Exception.h>
+#include <mem/BufferView.h>
+#include <mt/Runnable1D.h>
+
+namespace
+{
+size_t getNumThreads(size_t numThreads)
+{
+    if (numThreads == 0)
+    {
+        numThreads = std::thread::hardware_concurrency();
+    }
+    return std::max<size_t>(numThreads, 1);
+}
+
+void checkSize(size_t expected, size_t actual, const std::string& what)
+{
+    if (expected != actual)
+    {
+        throw except::Exception(Ctxt(
+                "Expected " + std::to_string(expected) + " " + what +
+                " but got " + std::to_string(actual)));
+    }
+}
+
+template <typename T>
+const T& findById(const std::vector<T>& items,
+                  const std::string& id,
+                  const std::string& what)
+{
+    for (const T& item : items)
+    {
+        if (item.identifier == id)
+        {
+            return item;
+        }
+    }
+    throw except::Exception(Ctxt(what + " " + id + " was not found"));
+}
+
+void flatten(const cphd::Poly2D& poly,
+             size_t& numX,
+             size_t& numY,
+             std::vector<double>& values)
+{
+    if (poly.empty())
+    {
+        return;
+    }
+    numX = poly.orderX() + 1;
+    numY = poly.orderY() + 1;
+    values.resize(numX * numY);
+    for (size_t ii = 0; ii < numX; ++ii)
+    {
+        const cphd::Poly1D row = poly[ii];
+        for (size_t jj = 0; jj < numY; ++jj)
+        {
+            values[ii * numY + jj] = row[jj];
+        }
+    }
+}
+
+// Horner's method for all points at once: each coefficient is applied to
+// every point before the next, so the inner loops vectorize
+void horner(const std::vector<double>& coefs,
+            const double* x,
+            size_t size,
+            double* out)
+{
+    std::fill(out, out + size, 0.0);
+    for (size_t ii = coefs.size(); ii > 0; --ii)
+    {
+        const double coef = coefs[ii - 1];
+        for (size_t kk = 0; kk < size; ++kk)
+        {
+            out[kk] = out[kk] * x[kk] + coef;
+        }
+    }
+}
+
+void horner(size_t numX,
+            size_t numY,
+            const std::vector<double>& coefs,
+            const double* x,
+            const double* y,
+            size_t size,
+            double* scratch,
+            double* out)
+{
+    std::fill(out, out + size, 0.0);
+    for (size_t ii = numX; ii > 0; --ii)
+    {
+        const double* const row = &coefs[(ii - 1) * numY];
+        std::fill(scratch, scratch + size, 0.0);
+        for (size_t jj = numY; jj > 0; --jj)
+        {
+            const double coef = row[jj - 1];
+            for (size_t kk = 0; kk < size; ++kk)
+            {
+                scratch[kk] = scratch[kk] * y[kk] + coef;
+            }
+        }
+        for (size_t kk = 0; kk < size; ++kk)
+        {
+            out[kk] = out[kk] * x[kk] + scratch[kk];
+        }
+    }
+}
+
+// Index and fraction of a grid position, clamped to the grid
+void locate(double position, size_t size, size_t& index, double& fraction)
+{
+    const double last = static_cast<double>(size - 1);
+    position = std::min(std::max(position, 0.0), last);
+    index = std::min(static_cast<size_t>(position), size > 1 ? size - 2 : 0);
+    fraction = position - static_cast<double>(index);
+}
+
+void interpolate(const cphd::SupportArrayParameter& parameter,
+                 size_t numRows,
+                 size_t numCols,
+                 const float* values,
+                 double x,
+                 double y,
+                 double& gain,
+                 double& phase)
+{
+    size_t row;
+    size_t col;
+    double rowFraction;
+    double colFraction;
+    locate((x - parameter.x0) / parameter.xSS, numRows, row, rowFraction);
+    locate((y - parameter.y0) / parameter.ySS, numCols, col, colFraction);
+    const size_t nextRow = std::min(row + 1, numRows - 1);
+    const size_t nextCol = std::min(col + 1, numCols - 1);
+
+    const float* const p00 = values + 2 * (row * numCols + col);
+    const float* const p01 = values + 2 * (row * numCols + nextCol);
+    const float* const p10 = values + 2 * (nextRow * numCols + col);
+    const float* const p11 = values + 2 * (nextRow * numCols + nextCol);
+    const double w00 = (1.0 - rowFraction) * (1.0 - colFraction);
+    const double w01 = (1.0 - rowFraction) * colFraction;
+    const double w10 = rowFraction * (1.0 - colFraction);
+    const double w11 = rowFraction * colFraction;
+    gain = w00 * p00[0] + w01 * p01[0] + w10 * p10[0] + w11 * p11[0];
+    phase = w00 * p00[1] + w01 * p01[1] + w10 * p10[1] + w11 * p11[1];
+}
+
+bool isTrue(six::BooleanType value)
+{
+    return value == six::BooleanType::IS_TRUE;
+}
+}
+
+namespace cphd
+{
+AntennaPatternEvaluator::Geometry::Geometry(size_t numVectors) :
+    dcx(numVectors),
+    dcy(numVectors),
+    ebx(numVectors),
+    eby(numVectors)
+{
+}
+
+AntennaPatternEvaluator::AntennaPatternEvaluator(const Metadata& metadata,
+                                                 const PVPBlock& pvpBlock,
+                                                 size_t numThreads) :
+    mMetadata(metadata),
+    mPVPBlock(pvpBlock),
+    mNumThreads(getNumThreads(numThreads))
+{
+    if (!mMetadata.antenna.get())
+    {
+        throw except::Exception(Ctxt("Metadata has no Antenna block"));
+    }
+
+    for (const AntPattern& antPattern : mMetadata.antenna->antPattern)
+    {
+        Pattern& pattern = mPatterns[antPattern.identifier];
+        pattern.antPattern = &antPattern;
+        flatten(antPattern.array.gainPoly, pattern.arrayGain.numX,
+                pattern.arrayGain.numY, pattern.arrayGain.values);
+        flatten(antPattern.array.phasePoly, pattern.arrayPhase.numX,
+                pattern.arrayPhase.numY, pattern.arrayPhase.values);
+        flatten(antPattern.element.gainPoly, pattern.elementGain.numX,
+                pattern.elementGain.numY, pattern.elementGain.values);
+        flatten(antPattern.element.phasePoly, pattern.elementPhase.numX,
+                pattern.elementPhase.numY, pattern.elementPhase.values);
+        if (!antPattern.gainBSPoly.empty())
+        {
+            pattern.gainBS = antPattern.gainBSPoly.coeffs();
+        }
+    }
+}
+
+void AntennaPatternEvaluator::loadGainPhaseArrays(
+        const SupportBlock& supportBlock)
+{
+    for (const AntPattern& antPattern : mMetadata.antenna->antPattern)
+    {
+        for (const AntPattern::GainPhaseArray& entry :
+             antPattern.gainPhaseArray)
+        {
+            for (const std::string& id : {entry.arrayId, entry.elementId})
+            {
+                if (id.empty() || mGrids.count(id))
+                {
+                    continue;
+                }
+
+                const Data::SupportArray dims =
+                        mMetadata.data.getSupportArrayById(id);
+                checkSize(2 * sizeof(float), dims.bytesPerElement,
+                          "bytes per gain/phase sample");
+                std::vector<float> values(2 * dims.numRows * dims.numCols);
+                supportBlock.read(id, mNumThreads, mem::BufferView<sys::ubyte>(
+                        reinterpret_cast<sys::ubyte*>(values.data()),
+                        values.size() * sizeof(float)));
+
+                // The support block swaps each element as a whole, which
+                // also exchanges the gain and phase fields
+                if (std::endian::native == std::endian::little)
+                {
+                    for (size_t ii = 0; ii < values.size(); ii += 2)
+                    {
+                        std::swap(values[ii], values[ii + 1]);
+                    }
+                }
+                setGainPhaseArray(id, std::span<const float>(values.data(),
+                                                             values.size()));
+            }
+        }
+    }
+}
+
+void AntennaPatternEvaluator::setGainPhaseArray(const std::string& id,
+                                                std::span<const float> data)
+{
+    const SupportArrayParameter* parameter = nullptr;
+    if (mMetadata.supportArray.get())
+    {
+        for (const SupportArrayParameter& antGainPhase :
+             mMetadata.supportArray->antGainPhase)
+        {
+            if (std::to_string(antGainPhase.getIdentifier()) == id)
+            {
+                parameter = &antGainPhase;
+            }
+        }
+    }
+    if (!parameter)
+    {
+        throw except::Exception(Ctxt(
+                "Support array " + id + " isn't an AntGainPhase array"));
+    }
+
+    const Data::SupportArray dims = mMetadata.data.getSupportArrayById(id);
+    if (dims.numRows == 0 || dims.numCols == 0)
+    {
+        throw except::Exception(Ctxt("Support array " + id + " is empty"));
+    }
+    checkSize(2 * dims.numRows * dims.numCols, data.size(),
+              "gain/phase values");
+
+    Grid& grid = mGrids[id];
+    grid.parameter = parameter;
+    grid.numRows = dims.numRows;
+    grid.numCols = dims.numCols;
+    grid.values.assign(data.begin(), data.end());
+}
+
+AntennaPatternEvaluator::Source
+AntennaPatternEvaluator::getSource(size_t channel, Side side) const
+{
+    if (channel >= mMetadata.channel.parameters.size())
+    {
+        throw except::Exception(Ctxt(
+                "Channel " + std::to_string(channel) + " is out of range"));
+    }
+    const ChannelParameter& parameter = mMetadata.channel.parameters[channel];
+    if (!parameter.antenna.get())
+    {
+        throw except::Exception(Ctxt(
+                "Channel " + parameter.identifier + " has no antenna"));
+    }
+
+    const bool transmit = (side == Side::TRANSMIT);
+    const AntPhaseCenter& apc = findById(
+            mMetadata.antenna->antPhaseCenter,
+            transmit ? parameter.antenna->txAPCId :
+                       parameter.antenna->rcvAPCId,
+            "AntPhaseCenter");
+    const std::string& apatId = transmit ? parameter.antenna->txAPATId :
+                                           parameter.antenna->rcvAPATId;
+    const auto pattern = mPatterns.find(apatId);
+    if (pattern == mPatterns.end())
+    {
+        throw except::Exception(Ctxt(
+                "AntPattern " + apatId + " was not found"));
+    }
+
+    Source source;
+    source.acf = &findById(mMetadata.antenna->antCoordFrame, apc.acfId,
+                           "AntCoordFrame");
+    source.pattern = &pattern->second;
+    return source;
+}
+
+void AntennaPatternEvaluator::checkVectors(size_t channel,
+                                           size_t firstVector,
+                                           size_t numVectors) const
+{
+    const size_t channelVectors = mMetadata.data.getNumVectors(channel);
+    if (firstVector > channelVectors ||
+        numVectors > channelVectors - firstVector)
+    {
+        throw except::Exception(Ctxt(
+                "Vectors [" + std::to_string(firstVector) + ", " +
+                std::to_string(firstVector + numVectors) +
+                ") aren't in channel " + std::to_string(channel) +
+                ", which has " + std::to_string(channelVectors)));
+    }
+}
+
+void AntennaPatternEvaluator::getGeometry(const Source& source,
+                                          size_t channel,
+                                          Side side,
+                                          size_t firstVector,
+                                          Geometry& geometry) const
+{
+    const AntPattern& antPattern = *source.pattern->antPattern;
+    const bool transmit = (side == Side::TRANSMIT);
+    for (size_t ii = 0; ii < geometry.dcx.size(); ++ii)
+    {
+        const size_t vector = firstVector + ii;
+        const double time = transmit ? mPVPBlock.getTxTime(channel, vector) :
+                                       mPVPBlock.getRcvTime(channel, vector);
+        const Vector3 apcPos = transmit ? mPVPBlock.getTxPos(channel, vector) :
+                                          mPVPBlock.getRcvPos(channel, vector);
+        const Vector3 los = (mPVPBlock.getSRPPos(channel, vector) - apcPos).unit();
+        const Vector3 xAxis = source.acf->xAxisPoly(time).unit();
+        const Vector3 yAxis = source.acf->yAxisPoly(time).unit();
+
+        geometry.dcx[ii] = los.dot(xAxis);
+        geometry.dcy[ii] = los.dot(yAxis);
+        geometry.ebx[ii] = antPattern.eb.dcxPoly.empty() ?
+                0.0 : antPattern.eb.dcxPoly(time);
+        geometry.eby[ii] = antPattern.eb.dcyPoly.empty() ?
+                0.0 : antPattern.eb.dcyPoly(time);
+    }
+}
+
+void AntennaPatternEvaluator::getGrids(const Pattern& pattern,
+                                       double frequency,
+                                       const Grid*& array,
+                                       const Grid*& element) const
+{
+    array = nullptr;
+    element = nullptr;
+
+    const AntPattern::GainPhaseArray* nearest = nullptr;
+    double distance = std::numeric_limits<double>::infinity();
+    for (const AntPattern::GainPhaseArray& entry :
+         pattern.antPattern->gainPhaseArray)
+    {
+        if (std::abs(entry.freq - frequency) < distance)
+        {
+            nearest = &entry;
+            distance = std::abs(entry.freq - frequency);
+        }
+    }
+    if (nearest)
+    {
+        const auto arrayGrid = mGrids.find(nearest->arrayId);
+        if (arrayGrid != mGrids.end())
+        {
+            array = &arrayGrid->second;
+        }
+        const auto elementGrid = mGrids.find(nearest->elementId);
+        if (elementGrid != mGrids.end())
+        {
+            element = &elementGrid->second;
+        }
+    }
+}
+
+void AntennaPatternEvaluator::getDirectionCosines(size_t channel,
+                                                  Side side,
+                                                  size_t firstVector,
+                                                  std::span<double> dcx,
+                                                  std::span<double> dcy) const
+{
+    checkSize(dcx.size(), dcy.size(), "DCY values");
+    const Source source = getSource(channel, side);
+    checkVectors(channel, firstVector, dcx.size());
+
+    const size_t numVectors = dcx.size();
+    const size_t numBlocks = std::min(numVectors, 4 * mNumThreads);
+    mt::run1D(numBlocks, mNumThreads, [&](size_t block)
+    {
+        const size_t begin = numVectors * block / numBlocks;
+        const size_t end = numVectors * (block + 1) / numBlocks;
+        Geometry geometry(end - begin);
+        getGeometry(source, channel, side, firstVector + begin, geometry);
+        std::copy(geometry.dcx.begin(), geometry.dcx.end(),
+                  dcx.begin() + begin);
+        std::copy(geometry.dcy.begin(), geometry.dcy.end(),
+                  dcy.begin() + begin);
+    });
+}
+
+void AntennaPatternEvaluator::evaluate(size_t channel,
+                                       Side side,
+                                       size_t firstVector,
+                                       std::span<double> gain,
+                                       std::span<double> phase) const
+{
+    checkSize(gain.size(), phase.size(), "phase values");
+    const Source source = getSource(channel, side);
+    checkVectors(channel, firstVector, gain.size());
+
+    const Pattern& pattern = *source.pattern;
+    const AntPattern& antPattern = *pattern.antPattern;
+    const double f0 = antPattern.freqZero;
+    const bool freqShift = isTrue(antPattern.ebFreqShift);
+    const bool freqDilation = isTrue(antPattern.mlFreqDilation);
+
+    const size_t numVectors = gain.size();
+    const size_t numBlocks = std::min(numVectors, 4 * mNumThreads);
+    mt::run1D(numBlocks, mNumThreads, [&](size_t block)
+    {
+        const size_t begin = numVectors * block / numBlocks;
+        const size_t size = numVectors * (block + 1) / numBlocks - begin;
+        Geometry geometry(size);
+        getGeometry(source, channel, side, firstVector + begin, geometry);
+
+        std::vector<double> frequency(size);
+        std::vector<double> x(size);
+        std::vector<double> y(size);
+        for (size_t ii = 0; ii < size; ++ii)
+        {
+            const size_t vector = firstVector + begin + ii;
+            const double f = 0.5 * (mPVPBlock.getFx1(channel, vector) +
+                                    mPVPBlock.getFx2(channel, vector));
+            const double ebScale = freqShift ? f0 / f : 1.0;
+            const double scale = freqDilation ? f / f0 : 1.0;
+            frequency[ii] = f;
+            x[ii] = (geometry.dcx[ii] - geometry.ebx[ii] * ebScale) * scale;
+            y[ii] = (geometry.dcy[ii] - geometry.eby[ii] * ebScale) * scale;
+        }
+
+        std::vector<double> arrayGain(size);
+        std::vector<double> arrayPhase(size);
+        std::vector<double> elementGain(size);
+        std::vector<double> elementPhase(size);
+        std::vector<double> gainBS(size);
+        std::vector<double> scratch(size);
+        horner(pattern.arrayGain.numX, pattern.arrayGain.numY,
+               pattern.arrayGain.values, x.data(), y.data(), size,
+               scratch.data(), arrayGain.data());
+        horner(pattern.arrayPhase.numX, pattern.arrayPhase.numY,
+               pattern.arrayPhase.values, x.data(), y.data(), size,
+               scratch.data(), arrayPhase.data());
+        horner(pattern.elementGain.numX, pattern.elementGain.numY,
+               pattern.elementGain.values, geometry.dcx.data(),
+               geometry.dcy.data(), size, scratch.data(), elementGain.data());
+        horner(pattern.elementPhase.numX, pattern.elementPhase.numY,
+               pattern.elementPhase.values, geometry.dcx.data(),
+               geometry.dcy.data(), size, scratch.data(), elementPhase.data());
+        for (size_t ii = 0; ii < size; ++ii)
+        {
+            x[ii] = frequency[ii] - f0;
+        }
+        horner(pattern.gainBS, x.data(), size, gainBS.data());
+
+        if (!mGrids.empty())
+        {
+            for (size_t ii = 0; ii < size; ++ii)
+            {
+                const Grid* array;
+                const Grid* element;
+                getGrids(pattern, frequency[ii], array, element);
+                if (array)
+                {
+                    interpolate(*array->parameter, array->numRows,
+                                array->numCols, array->values.data(),
+                                geometry.dcx[ii] - geometry.ebx[ii],
+                                geometry.dcy[ii] - geometry.eby[ii],
+                                arrayGain[ii], arrayPhase[ii]);
+                    gainBS[ii] = 0.0;
+                }
+                if (element)
+                {
+                    interpolate(*element->parameter, element->numRows,
+                                element->numCols, element->values.data(),
+                                geometry.dcx[ii], geometry.dcy[ii],
+                                elementGain[ii], elementPhase[ii]);
+                }
+            }
+        }
+
+        for (size_t ii = 0; ii < size; ++ii)
+        {
+            gain[begin + ii] = arrayGain[ii] + gainBS[ii] + elementGain[ii];
+            phase[begin + ii] = arrayPhase[ii] + elementPhase[ii];
+        }
+    });
+}
+
+void AntennaPatternEvaluator::evaluateSamples(size_t channel,
+                                              Side side,
+                                              size_t firstVector,
+                                              size_t numVectors,
+                                              std::span<float> gain,
+                                              std::span<float> phase) const
+{
+    if (mMetadata.global.getDomainType() != DomainType::FX)
+    {
+        throw except::Exception(Ctxt(
+                "Sample frequencies are only known in the FX domain"));
+    }
+    const Source source = getSource(channel, side);
+    checkVectors(channel, firstVector, numVectors);
+    const size_t numSamples = mMetadata.data.getNumSamples(channel);
+    checkSize(numVectors * numSamples, gain.size(), "gain values");
+    checkSize(numVectors * numSamples, phase.size(), "phase values");
+
+    const Pattern& pattern = *source.pattern;
+    const AntPattern& antPattern = *pattern.antPattern;
+    const double f0 = antPattern.freqZero;
+    const bool freqShift = isTrue(antPattern.ebFreqShift);
+    const bool freqDilation = isTrue(antPattern.mlFreqDilation);
+
+    const size_t numBlocks = std::min(numVectors, 4 * mNumThreads);
+    mt::run1D(numBlocks, mNumThreads, [&](size_t block)
+    {
+        const size_t begin = numVectors * block / numBlocks;
+        const size_t size = numVectors * (block + 1) / numBlocks - begin;
+        Geometry geometry(size);
+        getGeometry(source, channel, side, firstVector + begin, geometry);
+
+        // The element pattern doesn't depend on frequency, and nor does the
+        // array pattern's argument unless the EB or mainlobe scale with it
+        std::vector<double> elementGain(size);
+        std::vector<double> elementPhase(size);
+        std::vector<double> fixedGain(size);
+        std::vector<double> fixedPhase(size);
+        std::vector<double> x(std::max(size, numSamples));
+        std::vector<double> y(x.size());
+        std::vector<double> scratch(x.size());
+        horner(pattern.elementGain.numX, pattern.elementGain.numY,
+               pattern.elementGain.values, geometry.dcx.data(),
+               geometry.dcy.data(), size, scratch.data(), elementGain.data());
+        horner(pattern.elementPhase.numX, pattern.elementPhase.numY,
+               pattern.elementPhase.values, geometry.dcx.data(),
+               geometry.dcy.data(), size, scratch.data(), elementPhase.data());
+        const bool fixed = !freqShift && !freqDilation;
+        if (fixed)
+        {
+            for (size_t ii = 0; ii < size; ++ii)
+            {
+                x[ii] = geometry.dcx[ii] - geometry.ebx[ii];
+                y[ii] = geometry.dcy[ii] - geometry.eby[ii];
+            }
+            horner(pattern.arrayGain.numX, pattern.arrayGain.numY,
+                   pattern.arrayGain.values, x.data(), y.data(), size,
+                   scratch.data(), fixedGain.data());
+            horner(pattern.arrayPhase.numX, pattern.arrayPhase.numY,
+                   pattern.arrayPhase.values, x.data(), y.data(), size,
+                   scratch.data(), fixedPhase.data());
+        }
+
+        std::vector<double> frequency(numSamples);
+        std::vector<double> arrayGain(numSamples);
+        std::vector<double> arrayPhase(numSamples);
+        std::vector<double> gainBS(numSamples);
+        for (size_t ii = 0; ii < size; ++ii)
+        {
+            const size_t vector = firstVector + begin + ii;
+            const double sc0 = mPVPBlock.getSC0(channel, vector);
+            const double scss = mPVPBlock.getSCSS(channel, vector);
+            for (size_t sample = 0; sample < numSamples; ++sample)
+            {
+                frequency[sample] = sc0 + sample * scss;
+            }
+
+            double elementGainII = elementGain[ii];
+            double elementPhaseII = elementPhase[ii];
+            const Grid* array = nullptr;
+            const Grid* element = nullptr;
+            if (!mGrids.empty())
+            {
+                getGrids(pattern,
+                         0.5 * (mPVPBlock.getFx1(channel, vector) +
+                                mPVPBlock.getFx2(channel, vector)),
+                         array, element);
+            }
+            if (element)
+            {
+                interpolate(*element->parameter, element->numRows,
+                            element->numCols, element->values.data(),
+                            geometry.dcx[ii], geometry.dcy[ii],
+                            elementGainII, elementPhaseII);
+            }
+
+            if (array)
+            {
+                double sampledGain;
+                double sampledPhase;
+                interpolate(*array->parameter, array->numRows,
+                            array->numCols, array->values.data(),
+                            geometry.dcx[ii] - geometry.ebx[ii],
+                            geometry.dcy[ii] - geometry.eby[ii],
+                            sampledGain, sampledPhase);
+                std::fill(arrayGain.begin(), arrayGain.end(), sampledGain);
+                std::fill(arrayPhase.begin(), arrayPhase.end(), sampledPhase);
+                std::fill(gainBS.begin(), gainBS.end(), 0.0);
+            }
+            else
+            {
+                if (fixed)
+                {
+                    std::fill(arrayGain.begin(), arrayGain.end(),
+                              fixedGain[ii]);
+                    std::fill(arrayPhase.begin(), arrayPhase.end(),
+                              fixedPhase[ii]);
+                }
+                else
+                {
+                    for (size_t sample = 0; sample < numSamples; ++sample)
+                    {
+                        const double f = frequency[sample];
+                        const double ebScale = freqShift ? f0 / f : 1.0;
+                        const double scale = freqDilation ? f / f0 : 1.0;
+                        x[sample] = (geometry.dcx[ii] -
+                                     geometry.ebx[ii] * ebScale) * scale;
+                        y[sample] = (geometry.dcy[ii] -
+                                     geometry.eby[ii] * ebScale) * scale;
+                    }
+                    horner(pattern.arrayGain.numX, pattern.arrayGain.numY,
+                           pattern.arrayGain.values, x.data(), y.data(),
+                           numSamples, scratch.data(), arrayGain.data());
+                    horner(pattern.arrayPhase.numX, pattern.arrayPhase.numY,
+                           pattern.arrayPhase.values, x.data(), y.data(),
+                           numSamples, scratch.data(), arrayPhase.data());
+                }
+                for (size_t sample = 0; sample < numSamples; ++sample)
+                {
+                    x[sample] = frequency[sample] - f0;
+                }
+                horner(pattern.gainBS, x.data(), numSamples, gainBS.data());
+            }
+
+            float* const gainOut = gain.data() + (begin + ii) * numSamples;
+            float* const phaseOut = phase.data() + (begin + ii) * numSamples;
+            for (size_t sample = 0; sample < numSamples; ++sample)
+            {
+                gainOut[sample] = static_cast<float>(
+                        arrayGain[sample] + gainBS[sample] + elementGainII);
+                phaseOut[sample] = static_cast<float>(
+                        arrayPhase[sample] + elementPhaseII);
+            }
+        }
+    });
+}
+}
@@ -23,6 +23,7 @@
 
 #include <std/memory>
 #include <algorithm>
+#include <mutex>
 
 #include <except/Exception.h>
 #include <io/StringStream.h>
@@ -32,6 +33,8 @@
 #include <xml/lite/MinidomParser.h>
 #include <gsl/gsl.h>
 
+#include <six/BatchInputStream.h>
+#include <six/Instrumentation.h>
 #include <six/XmlLite.h>
 #include <cphd/CPHDXMLControl.h>
 
@@ -50,7 +53,7 @@ CPHDReader::CPHDReader(const std::string& fromFile,
                        const std::vector<std::string>& schemaPaths,
                        std::shared_ptr<logging::Logger> logger)
 {
-    initialize(std::make_shared<io::FileInputStream>(fromFile),
+    initialize(std::make_shared<six::BatchInputStream>(fromFile),
         numThreads, logger, schemaPaths);
 }
 
@@ -59,6 +62,7 @@ void CPHDReader::initialize(std::shared_ptr<io::SeekableInputStream> inStream,
                             std::shared_ptr<logging::Logger> logger,
                             const std::vector<std::string>& schemaPaths_)
 {
+    SIX_SCOPED_TIMER("cphd::CPHDReader::load");
     mFileHeader.read(*inStream);
 
     // Read in the XML string
@@ -78,7 +82,10 @@ void CPHDReader::initialize(std::shared_ptr<io::SeekableInputStream> inStream,
         [](const std::string& s) { return s; });
     mMetadata = CPHDXMLControl(logger.get()).fromXML(xmlParser.getDocument(), schemaPaths);
 
-    mSupportBlock = std::make_unique<SupportBlock>(inStream, mMetadata.data, mFileHeader);
+    // The support and signal blocks seek the same stream, so they share
+    // one lock around each seek and read
+    auto streamMutex = std::make_shared<std::mutex>();
+    mSupportBlock = std::make_unique<SupportBlock>(inStream, mMetadata.data, mFileHeader, streamMutex);
 
     // Load the PVPBlock into memory
     mPVPBlock = PVPBlock(mMetadata);
@@ -86,6 +93,7 @@ void CPHDReader::initialize(std::shared_ptr<io::SeekableInputStream> inStream,
 
     // Setup for wideband reading
     mWideband = std::make_unique<Wideband>(inStream, mMetadata,
-        mFileHeader.getSignalBlockByteOffset(), mFileHeader.getSignalBlockSize());
+        mFileHeader.getSignalBlockByteOffset(), mFileHeader.getSignalBlockSize(),
+        streamMutex);
 }
 }
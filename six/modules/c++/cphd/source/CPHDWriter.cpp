@@ -298,6 +298,11 @@ void CPHDWriter::writeMetadata(const PVPBlock& pvpBlock)
         throw except::Exception(ostr.str());
     }
 
+    writeMetadata();
+}
+
+void CPHDWriter::writeMetadata()
+{
     const size_t numChannels = mMetadata.data.getNumChannels();
     size_t totalSupportSize = 0;
     size_t totalPVPSize = 0;
@@ -312,7 +317,8 @@ void CPHDWriter::writeMetadata(const PVPBlock& pvpBlock)
 
     for (size_t ii = 0; ii < numChannels; ++ii)
     {
-        totalPVPSize += pvpBlock.getPVPsize(ii);
+        totalPVPSize += mMetadata.data.getNumVectors(ii) *
+                mMetadata.data.getNumBytesPVPSet();
         totalCPHDSize += mMetadata.data.getNumVectors(ii) *
                 mMetadata.data.getNumSamples(ii) * mElementSize;
     }
@@ -345,6 +351,56 @@ void CPHDWriter::writePVPData(const PVPBlock& pvpBlock)
     }
 }
 
+void CPHDWriter::writePVPData(const PVPBlock& pvpBlock,
+                              size_t channel,
+                              size_t firstVector)
+{
+    if (pvpBlock.getNumBytesPVPSet() != mMetadata.data.getNumBytesPVPSet())
+    {
+        std::ostringstream ostr;
+        ostr << "Number of pvp block bytes in metadata: "
+             << mMetadata.data.getNumBytesPVPSet()
+             << " does not match calculated size of pvp block: "
+             << pvpBlock.getNumBytesPVPSet();
+        throw except::Exception(Ctxt(ostr.str()));
+    }
+
+    std::vector<std::byte> pvpData;
+    pvpBlock.getPVPdata(0, pvpData);
+    const size_t numBytesPVPSet = mMetadata.data.getNumBytesPVPSet();
+    const size_t numVectors = pvpData.size() / numBytesPVPSet;
+    if (channel >= mMetadata.data.getNumChannels() ||
+        firstVector + numVectors > mMetadata.data.getNumVectors(channel))
+    {
+        std::ostringstream ostr;
+        ostr << "Vectors [" << firstVector << ", "
+             << firstVector + numVectors << ") are out of range for channel "
+             << channel;
+        throw except::Exception(Ctxt(ostr.str()));
+    }
+
+    // Add padding
+    if (channel == 0 && firstVector == 0)
+    {
+        char zero = 0;
+        for (int64_t ii = 0; ii < mHeader.getPvpPadBytes(); ++ii)
+        {
+            mStream->write(&zero, 1);
+        }
+    }
+
+    int64_t offset = mHeader.getPvpBlockByteOffset();
+    for (size_t ii = 0; ii < channel; ++ii)
+    {
+        offset += mMetadata.data.getNumVectors(ii) * numBytesPVPSet;
+    }
+    offset += firstVector * numBytesPVPSet;
+    mStream->seek(offset, io::Seekable::START);
+
+    //! The vector based parameters are always 64 bit
+    (*mDataWriter)(pvpData.data(), pvpData.size() / 8, 8);
+}
+
 template <typename T>
 void CPHDWriter::writeCPHDData(const T* data,
                                size_t numElements,
@@ -0,0 +1,877 @@
+/* =========================================================================
+ * This file is part of cphd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * cphd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cphd/ImageFormation.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <thread>
+
+#include <except/Exception.h>
+#include <math/Constants.h>
+#include <math/poly/Fit.h>
+#include <mt/Runnable1D.h>
+#include <scene/EllipsoidModel.h>
+#include <scene/Utilities.h>
+#include <six/FFT.h>
+#include <six/Utilities.h>
+#include <six/sicd/SICDWriteControl.h>
+
+namespace
+{
+// Half the number of taps of the windowed sinc interpolator
+const ptrdiff_t KERNEL_HALF_WIDTH = 4;
+
+// Backprojection range profiles are upsampled this much so that linear
+// interpolation between their samples is accurate
+const size_t PROFILE_UPSAMPLE = 8;
+
+// Vectors whose range profiles are held at once during backprojection
+const size_t MIN_PROFILES_PER_PASS = 32;
+
+const double SPEED_OF_LIGHT = math::Constants::SPEED_OF_LIGHT_METERS_PER_SEC;
+
+size_t getNumThreads(size_t numThreads)
+{
+    if (numThreads == 0)
+    {
+        numThreads = std::thread::hardware_concurrency();
+    }
+    return std::max<size_t>(numThreads, 1);
+}
+
+size_t getSize(size_t requested, double oversample, size_t size)
+{
+    if (requested != 0)
+    {
+        return requested;
+    }
+    return static_cast<size_t>(std::ceil(oversample * size));
+}
+
+double getSpacing(double requested, double oversample, double bandwidth)
+{
+    if (requested > 0.0)
+    {
+        return requested;
+    }
+    return 1.0 / (oversample * bandwidth);
+}
+
+// Hann windowed sinc interpolation of data[0], data[stride], ... at a
+// fractional index.  Taps off either end count as zeros.
+std::complex<float> interpolate(const std::complex<float>* data,
+                                size_t size,
+                                size_t stride,
+                                double position)
+{
+    const double base = std::floor(position);
+    const double fraction = position - base;
+    const ptrdiff_t first = static_cast<ptrdiff_t>(base);
+
+    std::complex<double> sum(0.0, 0.0);
+    for (ptrdiff_t tap = 1 - KERNEL_HALF_WIDTH; tap <= KERNEL_HALF_WIDTH;
+         ++tap)
+    {
+        const ptrdiff_t index = first + tap;
+        if (index < 0 || index >= static_cast<ptrdiff_t>(size))
+        {
+            continue;
+        }
+
+        const double x = tap - fraction;
+        const double sinc = (x == 0.0) ?
+                1.0 : std::sin(M_PI * x) / (M_PI * x);
+        const double window =
+                0.5 * (1.0 + std::cos(M_PI * x / KERNEL_HALF_WIDTH));
+        sum += sinc * window *
+                std::complex<double>(data[static_cast<size_t>(index) * stride]);
+    }
+    return std::complex<float>(sum);
+}
+
+// Fractional index at which ascending values reach target, or -1 if
+// target is outside them
+double findPosition(const std::vector<double>& values, double target)
+{
+    if (target < values.front() || target > values.back())
+    {
+        return -1.0;
+    }
+    const size_t upper = std::max<size_t>(
+            std::upper_bound(values.begin(), values.end(), target) -
+                    values.begin(),
+            1);
+    if (upper == values.size())
+    {
+        return static_cast<double>(values.size() - 1);
+    }
+    const size_t lower = upper - 1;
+    return lower + (target - values[lower]) / (values[upper] - values[lower]);
+}
+
+// Spatial frequency grid index range [first, last] inside [min, max]
+void getIndices(double min, double max, double center, double spacing,
+                size_t size, size_t& first, size_t& last)
+{
+    const double middle = static_cast<double>(size / 2);
+    const double lower = std::ceil((min - center) / spacing + middle);
+    const double upper = std::min(std::floor((max - center) / spacing + middle),
+                                  static_cast<double>(size - 1));
+    if (upper < std::max(lower, 0.0))
+    {
+        first = 1;
+        last = 0;
+        return;
+    }
+    first = static_cast<size_t>(std::max(lower, 0.0));
+    last = static_cast<size_t>(upper);
+}
+
+bool isKnown(const cphd::PolarizationType& polarization)
+{
+    return polarization != cphd::PolarizationType::UNSPECIFIED &&
+           polarization != cphd::PolarizationType::NOT_SET;
+}
+
+six::DualPolarizationType getPolarization(const cphd::PolarizationType& tx,
+                                          const cphd::PolarizationType& rcv)
+{
+    if (!isKnown(tx) || !isKnown(rcv))
+    {
+        return six::DualPolarizationType::UNKNOWN;
+    }
+    return six::toType<six::DualPolarizationType>(
+            tx.toString() + ":" + rcv.toString());
+}
+
+six::PolyXYZ fitPositions(const std::vector<double>& time,
+                          const std::vector<cphd::Vector3>& txPos,
+                          const std::vector<cphd::Vector3>& rcvPos)
+{
+    const size_t size = time.size();
+    math::linear::Vector<double> t(size);
+    math::linear::Vector<double> x(size);
+    math::linear::Vector<double> y(size);
+    math::linear::Vector<double> z(size);
+    for (size_t ii = 0; ii < size; ++ii)
+    {
+        const cphd::Vector3 arp = (txPos[ii] + rcvPos[ii]) * 0.5;
+        t[ii] = time[ii];
+        x[ii] = arp[0];
+        y[ii] = arp[1];
+        z[ii] = arp[2];
+    }
+    return math::poly::fit(t, x, y, z, std::min<size_t>(5, size - 1));
+}
+
+six::Poly1D fitValues(const std::vector<double>& x,
+                      const std::vector<double>& y,
+                      size_t order)
+{
+    return math::poly::fit(x.size(), x.data(), y.data(),
+                           std::min(order, x.size() - 1));
+}
+}
+
+namespace cphd
+{
+ImageFormer::ImageFormer(const Metadata& metadata,
+                         const PVPBlock& pvpBlock,
+                         size_t channel,
+                         const Options& options) :
+    mMetadata(metadata),
+    mPVPBlock(pvpBlock),
+    mChannel(channel),
+    mOptions(options),
+    mNumThreads(getNumThreads(options.numThreads)),
+    mNumVectors(0),
+    mNumSamples(0),
+    mSign(metadata.global.sgn == PhaseSGN::PLUS_1 ? 1.0 : -1.0),
+    mReferenceTime(0.0)
+{
+    if (metadata.global.getDomainType() != DomainType::FX)
+    {
+        throw except::Exception(Ctxt(
+                "Image formation needs FX domain phase history"));
+    }
+    if (channel >= metadata.data.getNumChannels() ||
+        channel >= metadata.channel.parameters.size())
+    {
+        throw except::Exception(Ctxt(
+                "Channel " + std::to_string(channel) + " doesn't exist"));
+    }
+    if (options.imagePlane != six::ComplexImagePlaneType::SLANT &&
+        options.imagePlane != six::ComplexImagePlaneType::GROUND)
+    {
+        throw except::Exception(Ctxt(
+                "The image plane must be SLANT or GROUND"));
+    }
+    if (!(options.oversample >= 1.0))
+    {
+        throw except::Exception(Ctxt("Oversample must be at least 1"));
+    }
+    if (options.numVectorsPerBlock == 0)
+    {
+        throw except::Exception(Ctxt(
+                "Need at least one vector per block"));
+    }
+
+    mNumVectors = metadata.data.getNumVectors(channel);
+    mNumSamples = metadata.data.getNumSamples(channel);
+    if (mNumVectors < 2 || mNumSamples < 2)
+    {
+        throw except::Exception(Ctxt(
+                "Need at least two vectors of two samples to form an image"));
+    }
+
+    const size_t refVector = metadata.channel.parameters[channel].refVectorIndex;
+    if (refVector >= mNumVectors)
+    {
+        throw except::Exception(Ctxt(
+                "Reference vector " + std::to_string(refVector) +
+                " doesn't exist"));
+    }
+
+    mVectors.time.resize(mNumVectors);
+    mVectors.txPos.resize(mNumVectors);
+    mVectors.rcvPos.resize(mNumVectors);
+    mVectors.srpPos.resize(mNumVectors);
+    mVectors.kRow.resize(mNumVectors);
+    mVectors.kCol.resize(mNumVectors);
+    mVectors.fx1.resize(mNumVectors);
+    mVectors.fx2.resize(mNumVectors);
+    mVectors.sc0.resize(mNumVectors);
+    mVectors.scss.resize(mNumVectors);
+
+    std::vector<Vector3> kDirection(mNumVectors);
+    for (size_t ii = 0; ii < mNumVectors; ++ii)
+    {
+        mVectors.time[ii] = pvpBlock.getTxTime(channel, ii);
+        mVectors.txPos[ii] = pvpBlock.getTxPos(channel, ii);
+        mVectors.rcvPos[ii] = pvpBlock.getRcvPos(channel, ii);
+        mVectors.srpPos[ii] = pvpBlock.getSRPPos(channel, ii);
+        mVectors.fx1[ii] = pvpBlock.getFx1(channel, ii);
+        mVectors.fx2[ii] = pvpBlock.getFx2(channel, ii);
+        mVectors.sc0[ii] = pvpBlock.getSC0(channel, ii);
+        mVectors.scss[ii] = pvpBlock.getSCSS(channel, ii);
+
+        const Vector3& srp = mVectors.srpPos[ii];
+        kDirection[ii] = ((mVectors.txPos[ii] - srp).unit() +
+                          (mVectors.rcvPos[ii] - srp).unit()) * -1.0;
+    }
+
+    // Image plane
+    mSCP = mVectors.srpPos[refVector];
+    mReferenceTime = mVectors.time[refVector];
+    const Vector3& kReference = kDirection[refVector];
+    const Vector3 velocity = (pvpBlock.getTxVel(channel, refVector) +
+                              pvpBlock.getRcvVel(channel, refVector)) * 0.5;
+    Vector3 along = velocity;
+    if (options.imagePlane == six::ComplexImagePlaneType::SLANT)
+    {
+        mRowUnitVector = kReference.unit();
+    }
+    else
+    {
+        const Vector3 normal =
+                scene::WGS84EllipsoidModel().getNormalVector(mSCP);
+        mRowUnitVector = (kReference - normal * kReference.dot(normal)).unit();
+        along = velocity - normal * velocity.dot(normal);
+    }
+    mColUnitVector =
+            (along - mRowUnitVector * along.dot(mRowUnitVector)).unit();
+
+    for (size_t ii = 0; ii < mNumVectors; ++ii)
+    {
+        mVectors.kRow[ii] = kDirection[ii].dot(mRowUnitVector) / SPEED_OF_LIGHT;
+        mVectors.kCol[ii] = kDirection[ii].dot(mColUnitVector) / SPEED_OF_LIGHT;
+        if (!(mVectors.kRow[ii] > 0.0))
+        {
+            throw except::Exception(Ctxt(
+                    "Vector " + std::to_string(ii) +
+                    " looks away from the image's range direction"));
+        }
+    }
+
+    if (options.algorithm == Algorithm::PFA)
+    {
+        // The polar annulus must sweep monotonically in angle and be
+        // centered on one point
+        const double direction =
+                (mVectors.kCol.back() / mVectors.kRow.back() >
+                 mVectors.kCol.front() / mVectors.kRow.front()) ? 1.0 : -1.0;
+        for (size_t ii = 0; ii < mNumVectors; ++ii)
+        {
+            if ((mVectors.srpPos[ii] - mSCP).norm() > 1e-3)
+            {
+                throw except::Exception(Ctxt(
+                        "PFA needs a fixed SRP, but vector " +
+                        std::to_string(ii) + "'s differs"));
+            }
+            if (ii > 0 &&
+                !(direction * (mVectors.kCol[ii] / mVectors.kRow[ii]) >
+                  direction * (mVectors.kCol[ii - 1] / mVectors.kRow[ii - 1])))
+            {
+                throw except::Exception(Ctxt(
+                        "PFA needs the polar angle to change monotonically, "
+                        "but it doesn't at vector " + std::to_string(ii)));
+            }
+        }
+
+        // Every vector covers every range frequency of the rectangle, and
+        // every column of the rectangle lies between the first and last
+        // vectors at every range frequency
+        mSupport.rowMin = -std::numeric_limits<double>::max();
+        mSupport.rowMax = std::numeric_limits<double>::max();
+        double tanMin = std::numeric_limits<double>::max();
+        double tanMax = -std::numeric_limits<double>::max();
+        for (size_t ii = 0; ii < mNumVectors; ++ii)
+        {
+            const double kRow = mVectors.kRow[ii];
+            mSupport.rowMin = std::max(mSupport.rowMin, mVectors.fx1[ii] * kRow);
+            mSupport.rowMax = std::min(mSupport.rowMax, mVectors.fx2[ii] * kRow);
+            tanMin = std::min(tanMin, mVectors.kCol[ii] / kRow);
+            tanMax = std::max(tanMax, mVectors.kCol[ii] / kRow);
+        }
+        mSupport.colMin = tanMin *
+                (tanMin < 0.0 ? mSupport.rowMin : mSupport.rowMax);
+        mSupport.colMax = tanMax *
+                (tanMax > 0.0 ? mSupport.rowMin : mSupport.rowMax);
+    }
+    else
+    {
+        mSupport.rowMin = mSupport.colMin = std::numeric_limits<double>::max();
+        mSupport.rowMax = mSupport.colMax = -std::numeric_limits<double>::max();
+        for (size_t ii = 0; ii < mNumVectors; ++ii)
+        {
+            const double frequencies[] = {mVectors.fx1[ii], mVectors.fx2[ii]};
+            for (double frequency : frequencies)
+            {
+                const double kRow = frequency * mVectors.kRow[ii];
+                const double kCol = frequency * mVectors.kCol[ii];
+                mSupport.rowMin = std::min(mSupport.rowMin, kRow);
+                mSupport.rowMax = std::max(mSupport.rowMax, kRow);
+                mSupport.colMin = std::min(mSupport.colMin, kCol);
+                mSupport.colMax = std::max(mSupport.colMax, kCol);
+            }
+        }
+    }
+
+    const types::RowCol<double> bandwidth(mSupport.rowMax - mSupport.rowMin,
+                                          mSupport.colMax - mSupport.colMin);
+    if (!(bandwidth.row > 0.0) || !(bandwidth.col > 0.0))
+    {
+        throw except::Exception(Ctxt(
+                "The phase history has no usable spatial frequency support"));
+    }
+    mKCenter.row = 0.5 * (mSupport.rowMin + mSupport.rowMax);
+    mKCenter.col = 0.5 * (mSupport.colMin + mSupport.colMax);
+
+    mDims.row = getSize(options.dims.row, options.oversample, mNumSamples);
+    mDims.col = getSize(options.dims.col, options.oversample, mNumVectors);
+    mSampleSpacing.row = getSpacing(options.sampleSpacing.row,
+                                    options.oversample, bandwidth.row);
+    mSampleSpacing.col = getSpacing(options.sampleSpacing.col,
+                                    options.oversample, bandwidth.col);
+
+    // The sample rate has to cover the support or it aliases
+    if (bandwidth.row * mSampleSpacing.row > 1.0 + 1e-9 ||
+        bandwidth.col * mSampleSpacing.col > 1.0 + 1e-9)
+    {
+        throw except::Exception(Ctxt(
+                "The sample spacing is too coarse for the processed "
+                "bandwidth"));
+    }
+}
+
+std::unique_ptr<six::sicd::ComplexData> ImageFormer::getComplexData() const
+{
+    std::unique_ptr<six::sicd::ComplexData> data(
+            new six::sicd::ComplexData());
+    const bool isPFA = (mOptions.algorithm == Algorithm::PFA);
+
+    *data->collectionInformation = mMetadata.collectionID;
+
+    data->setPixelType(six::PixelType::RE32F_IM32F);
+    data->imageData->numRows = mDims.row;
+    data->imageData->numCols = mDims.col;
+    data->imageData->firstRow = 0;
+    data->imageData->firstCol = 0;
+    data->imageData->fullImage = six::RowColInt(mDims.row, mDims.col);
+    data->imageData->scpPixel = six::RowColInt(mDims.row / 2, mDims.col / 2);
+
+    data->geoData->scp.ecf = mSCP;
+    data->geoData->scp.llh = scene::Utilities::ecefToLatLon(mSCP);
+
+    six::sicd::Grid& grid = *data->grid;
+    grid.imagePlane = mOptions.imagePlane;
+    grid.type = isPFA ? six::ComplexImageGridType::RGAZIM :
+                        six::ComplexImageGridType::PLANE;
+    grid.timeCOAPoly = six::Poly2D(0, 0);
+    grid.timeCOAPoly[0][0] = mReferenceTime;
+
+    const six::FFTSign sign =
+            (mSign > 0.0) ? six::FFTSign::POS : six::FFTSign::NEG;
+    const Vector3 unitVectors[] = {mRowUnitVector, mColUnitVector};
+    const double spacings[] = {mSampleSpacing.row, mSampleSpacing.col};
+    const double centers[] = {mKCenter.row, mKCenter.col};
+    const double bandwidths[] = {mSupport.rowMax - mSupport.rowMin,
+                                 mSupport.colMax - mSupport.colMin};
+    six::sicd::DirectionParameters* const directions[] = {grid.row.get(),
+                                                          grid.col.get()};
+    for (size_t ii = 0; ii < 2; ++ii)
+    {
+        six::sicd::DirectionParameters& direction = *directions[ii];
+        direction.unitVector = unitVectors[ii];
+        direction.sampleSpacing = spacings[ii];
+        direction.impulseResponseBandwidth = bandwidths[ii];
+        // Uniform weighting's -3 dB width
+        direction.impulseResponseWidth = 0.886 / bandwidths[ii];
+        direction.sign = sign;
+        direction.kCenter = centers[ii];
+        direction.deltaK1 = -0.5 * bandwidths[ii];
+        direction.deltaK2 = 0.5 * bandwidths[ii];
+        direction.deltaKCOAPoly = six::Poly2D(0, 0);
+        direction.deltaKCOAPoly[0][0] = 0.0;
+        direction.weightType.reset(new six::sicd::WeightType());
+        direction.weightType->windowName = "UNIFORM";
+    }
+
+    data->timeline->collectStart = mMetadata.global.timeline.collectionStart;
+    data->timeline->collectDuration =
+            *std::max_element(mVectors.time.begin(), mVectors.time.end());
+
+    data->position->arpPoly =
+            fitPositions(mVectors.time, mVectors.txPos, mVectors.rcvPos);
+
+    const ChannelParameter& parameter = mMetadata.channel.parameters[mChannel];
+    const six::DualPolarizationType polarization =
+            getPolarization(parameter.polarization.txPol,
+                            parameter.polarization.rcvPol);
+    data->radarCollection->txFrequencyMin = mMetadata.global.fxBand.fxMin;
+    data->radarCollection->txFrequencyMax = mMetadata.global.fxBand.fxMax;
+    data->radarCollection->txPolarization =
+            isKnown(parameter.polarization.txPol) ?
+            six::toType<six::PolarizationSequenceType>(
+                    parameter.polarization.txPol.toString()) :
+            six::PolarizationSequenceType::UNKNOWN;
+    data->radarCollection->rcvChannels.resize(1);
+    data->radarCollection->rcvChannels[0].reset(
+            new six::sicd::ChannelParameters());
+    data->radarCollection->rcvChannels[0]->txRcvPolarization = polarization;
+
+    six::sicd::ImageFormation& formation = *data->imageFormation;
+    formation.rcvChannelProcessed.reset(new six::sicd::RcvChannelProcessed());
+    formation.rcvChannelProcessed->numChannelsProcessed = 1;
+    formation.rcvChannelProcessed->prfScaleFactor = 1.0;
+    formation.rcvChannelProcessed->channelIndex.push_back(1);
+    formation.txRcvPolarizationProc = polarization;
+    formation.imageFormationAlgorithm = isPFA ?
+            six::ImageFormationType::PFA : six::ImageFormationType::OTHER;
+    formation.tStartProc = mVectors.time.front();
+    formation.tEndProc = mVectors.time.back();
+    formation.txFrequencyProcMin =
+            *std::min_element(mVectors.fx1.begin(), mVectors.fx1.end());
+    formation.txFrequencyProcMax =
+            *std::max_element(mVectors.fx2.begin(), mVectors.fx2.end());
+    formation.slowTimeBeamCompensation = six::SlowTimeBeamCompensationType::NO;
+    formation.imageBeamCompensation = six::ImageBeamCompensationType::NO;
+    formation.azimuthAutofocus = six::AutofocusType::NO;
+    formation.rangeAutofocus = six::AutofocusType::NO;
+
+    data->scpcoa->scpTime = mReferenceTime;
+
+    if (isPFA)
+    {
+        // Polar angles are measured from the row direction toward the
+        // column direction, and the scale factor takes 2 f / c to the
+        // polar radius in the image plane
+        std::vector<double> angle(mNumVectors);
+        std::vector<double> scale(mNumVectors);
+        for (size_t ii = 0; ii < mNumVectors; ++ii)
+        {
+            angle[ii] = std::atan2(mVectors.kCol[ii], mVectors.kRow[ii]);
+            scale[ii] = std::hypot(mVectors.kRow[ii], mVectors.kCol[ii]) *
+                    SPEED_OF_LIGHT / 2.0;
+        }
+
+        data->pfa.reset(new six::sicd::PFA());
+        six::sicd::PFA& pfa = *data->pfa;
+        pfa.focusPlaneNormal =
+                scene::WGS84EllipsoidModel().getNormalVector(mSCP);
+        pfa.imagePlaneNormal =
+                math::linear::cross(mRowUnitVector, mColUnitVector).unit();
+        pfa.polarAngleRefTime = mReferenceTime;
+        pfa.polarAnglePoly = fitValues(mVectors.time, angle, 5);
+        pfa.spatialFrequencyScaleFactorPoly = fitValues(angle, scale, 2);
+        pfa.krg1 = mSupport.rowMin;
+        pfa.krg2 = mSupport.rowMax;
+        pfa.kaz1 = mSupport.colMin;
+        pfa.kaz2 = mSupport.colMax;
+    }
+
+    data->fillDerivedFields();
+    return data;
+}
+
+void ImageFormer::form(const ReadVectors& read,
+                       std::span<std::complex<float> > image) const
+{
+    if (image.size() != mDims.area())
+    {
+        throw except::Exception(Ctxt(
+                "Expected " + std::to_string(mDims.area()) +
+                " pixels but got " + std::to_string(image.size())));
+    }
+
+    if (mOptions.algorithm == Algorithm::PFA)
+    {
+        formPolar(read, image);
+    }
+    else
+    {
+        formBackprojection(read, image);
+    }
+}
+
+void ImageFormer::form(const Wideband& wideband,
+                       std::span<std::complex<float> > image) const
+{
+    if (mMetadata.data.isCompressed())
+    {
+        throw except::Exception(Ctxt(
+                "Image formation can't read compressed signal arrays"));
+    }
+
+    const size_t numVectorsPerBlock =
+            std::min(mOptions.numVectorsPerBlock, mNumVectors);
+    std::vector<std::byte> scratch(
+            numVectorsPerBlock * mNumSamples * wideband.getElementSize());
+    std::vector<double> scaleFactors;
+
+    const ReadVectors read = [&](size_t firstVector,
+                                 size_t numVectors,
+                                 std::span<std::complex<float> > data)
+    {
+        scaleFactors.assign(numVectors, 1.0);
+        if (mPVPBlock.hasAmpSF())
+        {
+            for (size_t ii = 0; ii < numVectors; ++ii)
+            {
+                scaleFactors[ii] =
+                        mPVPBlock.getAmpSF(mChannel, firstVector + ii);
+            }
+        }
+        wideband.read(mChannel,
+                      firstVector,
+                      firstVector + numVectors - 1,
+                      0,
+                      mNumSamples - 1,
+                      scaleFactors,
+                      mNumThreads,
+                      std::span<std::byte>(scratch.data(), scratch.size()),
+                      data);
+    };
+    form(read, image);
+}
+
+void ImageFormer::write(const Wideband& wideband,
+                        const std::string& pathname,
+                        const std::vector<std::string>& schemaPaths) const
+{
+    std::vector<std::complex<float> > image(mDims.area());
+    form(wideband, std::span<std::complex<float> >(image.data(), image.size()));
+
+    const std::unique_ptr<six::sicd::ComplexData> data = getComplexData();
+    six::sicd::SICDWriteControl writer(pathname, schemaPaths);
+    writer.initialize(*data);
+
+    // The image is discarded afterwards, so there's no need to swap it back
+    writer.save(image.data(),
+                types::RowCol<size_t>(0, 0),
+                mDims,
+                false /*restoreData*/);
+    writer.close();
+}
+
+void ImageFormer::formPolar(const ReadVectors& read,
+                            std::span<std::complex<float> > image) const
+{
+    const types::RowCol<double> kSpacing(
+            1.0 / (mDims.row * mSampleSpacing.row),
+            1.0 / (mDims.col * mSampleSpacing.col));
+    size_t firstRow = 0;
+    size_t lastRow = 0;
+    size_t firstCol = 0;
+    size_t lastCol = 0;
+    getIndices(mSupport.rowMin, mSupport.rowMax, mKCenter.row, kSpacing.row,
+               mDims.row, firstRow, lastRow);
+    getIndices(mSupport.colMin, mSupport.colMax, mKCenter.col, kSpacing.col,
+               mDims.col, firstCol, lastCol);
+    std::fill(image.begin(), image.end(), std::complex<float>(0.0f, 0.0f));
+    if (firstRow > lastRow || firstCol > lastCol)
+    {
+        return;
+    }
+
+    const size_t numRows = lastRow - firstRow + 1;
+    std::vector<double> kRows(numRows);
+    for (size_t ii = 0; ii < numRows; ++ii)
+    {
+        kRows[ii] = mKCenter.row + kSpacing.row *
+                (static_cast<double>(firstRow + ii) -
+                 static_cast<double>(mDims.row / 2));
+    }
+
+    // Range interpolate each vector onto the rectangle's range frequencies
+    // as it's read.  polar is vectors x range frequencies.
+    std::vector<std::complex<float> > polar(mNumVectors * numRows);
+    const size_t numVectorsPerBlock =
+            std::min(mOptions.numVectorsPerBlock, mNumVectors);
+    std::vector<std::complex<float> > block(numVectorsPerBlock * mNumSamples);
+    for (size_t first = 0; first < mNumVectors; first += numVectorsPerBlock)
+    {
+        const size_t count = std::min(numVectorsPerBlock, mNumVectors - first);
+        read(first, count,
+             std::span<std::complex<float> >(block.data(),
+                                             count * mNumSamples));
+
+        mt::run1D(count, mNumThreads, [&](size_t vector)
+        {
+            const size_t index = first + vector;
+            const std::complex<float>* const samples =
+                    &block[vector * mNumSamples];
+            std::complex<float>* const out = &polar[index * numRows];
+            const double kRow = mVectors.kRow[index];
+            const double sc0 = mVectors.sc0[index];
+            const double scss = mVectors.scss[index];
+            for (size_t ii = 0; ii < numRows; ++ii)
+            {
+                const double frequency = kRows[ii] / kRow;
+                out[ii] = interpolate(samples, mNumSamples, 1,
+                                      (frequency - sc0) / scss);
+            }
+        });
+    }
+
+    // Vectors ordered by increasing polar angle
+    std::vector<double> tangents(mNumVectors);
+    for (size_t ii = 0; ii < mNumVectors; ++ii)
+    {
+        tangents[ii] = mVectors.kCol[ii] / mVectors.kRow[ii];
+    }
+    const bool reversed = tangents.back() < tangents.front();
+    if (reversed)
+    {
+        std::reverse(tangents.begin(), tangents.end());
+    }
+
+    // Interpolate each range frequency across vectors onto the rectangle's
+    // column frequencies
+    mt::run1D(numRows, mNumThreads, [&](size_t row)
+    {
+        std::vector<std::complex<float> > across(mNumVectors);
+        for (size_t ii = 0; ii < mNumVectors; ++ii)
+        {
+            const size_t vector = reversed ? mNumVectors - 1 - ii : ii;
+            across[ii] = polar[vector * numRows + row];
+        }
+
+        std::complex<float>* const out =
+                &image[(firstRow + row) * mDims.col];
+        for (size_t col = firstCol; col <= lastCol; ++col)
+        {
+            const double kCol = mKCenter.col + kSpacing.col *
+                    (static_cast<double>(col) -
+                     static_cast<double>(mDims.col / 2));
+            const double position = findPosition(tangents, kCol / kRows[row]);
+            if (position >= 0.0)
+            {
+                out[col] = interpolate(across.data(), mNumVectors, 1,
+                                       position);
+            }
+        }
+    });
+
+    transform(image);
+}
+
+void ImageFormer::formBackprojection(
+        const ReadVectors& read,
+        std::span<std::complex<float> > image) const
+{
+    std::fill(image.begin(), image.end(), std::complex<float>(0.0f, 0.0f));
+
+    const six::FFT fft(six::FFT::nextPowerOfTwo(PROFILE_UPSAMPLE *
+                                                mNumSamples));
+    const size_t profileSize = fft.size();
+    const size_t offset = profileSize / 2 - mNumSamples / 2;
+    const six::FFTSign sign =
+            (mSign > 0.0) ? six::FFTSign::NEG : six::FFTSign::POS;
+    const double twoPi = 2.0 * M_PI;
+
+    const size_t numVectorsPerBlock =
+            std::min(mOptions.numVectorsPerBlock, mNumVectors);
+    const size_t numProfiles = std::min(
+            std::max(MIN_PROFILES_PER_PASS, mNumThreads), numVectorsPerBlock);
+    std::vector<std::complex<float> > block(numVectorsPerBlock * mNumSamples);
+    std::vector<std::complex<float> > profiles(numProfiles * profileSize);
+    std::vector<double> centerFrequency(numProfiles);
+    std::vector<double> srpRange(numProfiles);
+
+    for (size_t first = 0; first < mNumVectors; first += numVectorsPerBlock)
+    {
+        const size_t count = std::min(numVectorsPerBlock, mNumVectors - first);
+        read(first, count,
+             std::span<std::complex<float> >(block.data(),
+                                             count * mNumSamples));
+
+        for (size_t pass = 0; pass < count; pass += numProfiles)
+        {
+            const size_t passCount = std::min(numProfiles, count - pass);
+
+            // Upsampled range profiles, with the zero delay from the SRP in
+            // the middle and the carrier at the center frequency removed
+            mt::run1D(passCount, mNumThreads, [&](size_t ii)
+            {
+                const size_t index = first + pass + ii;
+                std::complex<float>* const profile =
+                        &profiles[ii * profileSize];
+                std::fill(profile, profile + profileSize,
+                          std::complex<float>(0.0f, 0.0f));
+                const std::complex<float>* const samples =
+                        &block[(pass + ii) * mNumSamples];
+                std::copy(samples, samples + mNumSamples, profile + offset);
+                fft.transformCentered(profile, sign);
+
+                const Vector3& srp = mVectors.srpPos[index];
+                centerFrequency[ii] = mVectors.sc0[index] +
+                        (mNumSamples / 2) * mVectors.scss[index];
+                srpRange[ii] = (mVectors.txPos[index] - srp).norm() +
+                        (mVectors.rcvPos[index] - srp).norm();
+            });
+
+            mt::run1D(mDims.row, mNumThreads, [&](size_t row)
+            {
+                const double x = mSampleSpacing.row *
+                        (static_cast<double>(row) -
+                         static_cast<double>(mDims.row / 2));
+                std::complex<float>* const out = &image[row * mDims.col];
+                for (size_t ii = 0; ii < passCount; ++ii)
+                {
+                    const size_t index = first + pass + ii;
+                    const Vector3& txPos = mVectors.txPos[index];
+                    const Vector3& rcvPos = mVectors.rcvPos[index];
+                    const std::complex<float>* const profile =
+                            &profiles[ii * profileSize];
+                    const double samplesPerDelay =
+                            profileSize * mVectors.scss[index];
+                    const double phasePerDelay =
+                            -mSign * twoPi * centerFrequency[ii];
+
+                    for (size_t col = 0; col < mDims.col; ++col)
+                    {
+                        const double y = mSampleSpacing.col *
+                                (static_cast<double>(col) -
+                                 static_cast<double>(mDims.col / 2));
+                        const Vector3 pixel = mSCP + mRowUnitVector * x +
+                                mColUnitVector * y;
+                        const double delay =
+                                ((txPos - pixel).norm() +
+                                 (rcvPos - pixel).norm() - srpRange[ii]) /
+                                SPEED_OF_LIGHT;
+
+                        const double position = delay * samplesPerDelay +
+                                static_cast<double>(profileSize / 2);
+                        if (position < 0.0 ||
+                            position >= static_cast<double>(profileSize - 1))
+                        {
+                            continue;
+                        }
+                        const size_t lower = static_cast<size_t>(position);
+                        const float fraction =
+                                static_cast<float>(position - lower);
+                        const std::complex<float> value =
+                                profile[lower] * (1.0f - fraction) +
+                                profile[lower + 1] * fraction;
+                        out[col] += value * std::complex<float>(
+                                std::polar(1.0, phasePerDelay * delay));
+                    }
+                }
+            });
+        }
+    }
+
+    // Remove the spatial frequency carrier so the image is at baseband like
+    // a PFA one
+    mt::run1D(mDims.row, mNumThreads, [&](size_t row)
+    {
+        const double x = mSampleSpacing.row *
+                (static_cast<double>(row) - static_cast<double>(mDims.row / 2));
+        std::complex<float>* const out = &image[row * mDims.col];
+        for (size_t col = 0; col < mDims.col; ++col)
+        {
+            const double y = mSampleSpacing.col *
+                    (static_cast<double>(col) -
+                     static_cast<double>(mDims.col / 2));
+            out[col] *= std::complex<float>(std::polar(
+                    1.0, mSign * twoPi * (mKCenter.row * x + mKCenter.col * y)));
+        }
+    });
+}
+
+void ImageFormer::transform(std::span<std::complex<float> > image) const
+{
+    // Image = sum of k-space exp(-SGN j 2 pi K . x)
+    const six::FFTSign sign =
+            (mSign > 0.0) ? six::FFTSign::NEG : six::FFTSign::POS;
+
+    const six::FFT rowFFT(mDims.col);
+    mt::run1D(mDims.row, mNumThreads, [&](size_t row)
+    {
+        rowFFT.transformCentered(&image[row * mDims.col], sign);
+    });
+
+    const six::FFT colFFT(mDims.row);
+    const size_t numBlocks = std::min(mDims.col, 4 * mNumThreads);
+    mt::run1D(numBlocks, mNumThreads, [&](size_t block)
+    {
+        const size_t begin = mDims.col * block / numBlocks;
+        const size_t end = mDims.col * (block + 1) / numBlocks;
+        std::vector<std::complex<float> > column(mDims.row);
+        for (size_t col = begin; col < end; ++col)
+        {
+            for (size_t row = 0; row < mDims.row; ++row)
+            {
+                column[row] = image[row * mDims.col + col];
+            }
+            colFFT.transformCentered(column.data(), sign);
+            for (size_t row = 0; row < mDims.row; ++row)
+            {
+                image[row * mDims.col + col] = column[row];
+            }
+        }
+    });
+}
+}
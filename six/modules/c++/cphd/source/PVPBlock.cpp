@@ -31,6 +31,7 @@
 
 #include <nitf/coda-oss.hpp>
 #include <six/Init.h>
+#include <six/Instrumentation.h>
 #include <sys/Conf.h>
 
 #include <cphd/Types.h>
@@ -189,113 +190,97 @@ void PVPBlock::PVPSet::write(const PVPBlock& pvpBlock, const Pvp& p, const sys::
         {
             float val;
             ::setData(input + it->second.getByteOffset(), val);
-            addedPVP[it->first] = six::Parameter();
-            addedPVP.find(it->first)->second.setValue(val);
+            addedPVP[it->first].setValue(val);
         }
         else if (it->second.getFormat() == "F8")
         {
             double val;
             ::setData(input + it->second.getByteOffset(), val);
-            addedPVP[it->first] = six::Parameter();
-            addedPVP.find(it->first)->second.setValue(val);
+            addedPVP[it->first].setValue(val);
         }
         else if (it->second.getFormat() == "U1")
         {
             std::uint8_t val;
             ::setData(input + it->second.getByteOffset(), val);
-            addedPVP[it->first] = six::Parameter();
-            addedPVP.find(it->first)->second.setValue(val);
+            addedPVP[it->first].setValue(val);
         }
         else if (it->second.getFormat() == "U2")
         {
             std::uint16_t val;
             ::setData(input + it->second.getByteOffset(), val);
-            addedPVP[it->first] = six::Parameter();
-            addedPVP.find(it->first)->second.setValue(val);
+            addedPVP[it->first].setValue(val);
         }
         else if (it->second.getFormat() == "U4")
         {
             std::uint32_t val;
             ::setData(input + it->second.getByteOffset(), val);
-            addedPVP[it->first] = six::Parameter();
-            addedPVP.find(it->first)->second.setValue(val);
+            addedPVP[it->first].setValue(val);
         }
         else if (it->second.getFormat() == "U8")
         {
             std::uint64_t val;
             ::setData(input + it->second.getByteOffset(), val);
-            addedPVP[it->first] = six::Parameter();
-            addedPVP.find(it->first)->second.setValue(val);
+            addedPVP[it->first].setValue(val);
         }
         else if (it->second.getFormat() == "I1")
         {
             std::int8_t val;
             ::setData(input + it->second.getByteOffset(), val);
-            addedPVP[it->first] = six::Parameter();
-            addedPVP.find(it->first)->second.setValue(val);
+            addedPVP[it->first].setValue(val);
         }
         else if (it->second.getFormat() == "I2")
         {
             std::int16_t val;
             ::setData(input + it->second.getByteOffset(), val);
-            addedPVP[it->first] = six::Parameter();
-            addedPVP.find(it->first)->second.setValue(val);
+            addedPVP[it->first].setValue(val);
         }
         else if (it->second.getFormat() == "I4")
         {
             std::int32_t val;
             ::setData(input + it->second.getByteOffset(), val);
-            addedPVP[it->first] = six::Parameter();
-            addedPVP.find(it->first)->second.setValue(val);
+            addedPVP[it->first].setValue(val);
         }
         else if (it->second.getFormat() == "I8")
         {
             std::int64_t val;
             ::setData(input + it->second.getByteOffset(), val);
-            addedPVP[it->first] = six::Parameter();
-            addedPVP.find(it->first)->second.setValue(val);
+            addedPVP[it->first].setValue(val);
         }
         else if (it->second.getFormat() == "CI2")
         {
             std::complex<std::int8_t> val;
             ::setData(input + it->second.getByteOffset(), val);
-            addedPVP[it->first] = six::Parameter();
-            addedPVP.find(it->first)->second.setValue(val);
+            addedPVP[it->first].setValue(val);
         }
         else if (it->second.getFormat() == "CI4")
         {
             std::complex<std::int16_t> val;
             ::setData(input + it->second.getByteOffset(), val);
-            addedPVP[it->first] = six::Parameter();
-            addedPVP.find(it->first)->second.setValue(val);
+            addedPVP[it->first].setValue(val);
         }
         else if (it->second.getFormat() == "CI8")
         {
             std::complex<std::int32_t> val;
             ::setData(input + it->second.getByteOffset(), val);
-            addedPVP[it->first] = six::Parameter();
-            addedPVP.find(it->first)->second.setValue(val);
+            addedPVP[it->first].setValue(val);
         }
         else if (it->second.getFormat() == "CI16")
         {
             std::complex<std::int64_t> val;
             ::setData(input + it->second.getByteOffset(), val);
-            addedPVP[it->first] = six::Parameter();
-            addedPVP.find(it->first)->second.setValue(val);
+            addedPVP[it->first].setValue(val);
         }
         else if (it->second.getFormat() == "CF8")
         {
             std::complex<float> val;
             ::setData(input + it->second.getByteOffset(), val);
-            addedPVP[it->first] = six::Parameter();
-            addedPVP.find(it->first)->second.setValue(val);
+            addedPVP[it->first].setValue(val);
         }
         else if (it->second.getFormat() == "CF16")
         {
             std::complex<double> val;
             ::setData(input + it->second.getByteOffset(), val);
-            addedPVP[it->first] = six::Parameter();
-            addedPVP.find(it->first)->second.setValue(val);
+            addedPVP[it->first].setValue(val);
         }
         else
         {
@@ -303,8 +288,7 @@ void PVPBlock::PVPSet::write(const PVPBlock& pvpBlock, const Pvp& p, const sys::
             std::string val;
             val.assign(reinterpret_cast<const char*>(pVal),
                        it->second.getByteSize());
-            addedPVP[it->first] = six::Parameter();
-            addedPVP.find(it->first)->second.setValue(val);
+            addedPVP[it->first].setValue(val);
         }
     }
 }
@@ -586,6 +570,8 @@ int64_t PVPBlock::load(io::SeekableInputStream& inStream,
                      int64_t sizePVP,
                      size_t numThreads)
 {
+    SIX_SCOPED_TIMER("cphd::PVPBlock::load");
+
     // Allocate the buffers
     size_t numBytesIn(0);
 
@@ -645,6 +631,7 @@ int64_t PVPBlock::load(io::SeekableInputStream& inStream,
             }
         }
     }
+    SIX_COUNT("cphd.pvpBytesRead", static_cast<uint64_t>(totalBytesRead));
     return totalBytesRead;
 }
 int64_t PVPBlock::load(io::SeekableInputStream& inStream, const FileHeader& fileHeader, size_t numThreads)
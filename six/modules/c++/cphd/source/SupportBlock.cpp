@@ -31,6 +31,7 @@
 #include <except/Exception.h>
 #include <io/FileInputStream.h>
 
+#include <six/BatchInputStream.h>
 #include <six/Init.h>
 
 #include <cphd/ByteSwap.h>
@@ -42,10 +43,12 @@ SupportBlock::SupportBlock(const std::string& pathname,
                            const cphd::Data& data,
                            int64_t startSupport,
                            int64_t sizeSupport) :
-    mInStream(std::make_shared<io::FileInputStream>(pathname)),
+    mInStream(std::make_shared<six::BatchInputStream>(pathname)),
     mData(data),
     mSupportOffset(startSupport),
-    mSupportSize(sizeSupport)
+    mSupportSize(sizeSupport),
+    mBatchStream(dynamic_cast<six::BatchInputStream*>(mInStream.get())),
+    mStreamMutex(std::make_shared<std::mutex>())
 {
     initialize();
 }
@@ -53,18 +56,23 @@ SupportBlock::SupportBlock(const std::string& pathname,
 SupportBlock::SupportBlock(std::shared_ptr<io::SeekableInputStream> inStream,
                            const cphd::Data& data,
                            int64_t startSupport,
-                           int64_t sizeSupport) :
+                           int64_t sizeSupport,
+                           std::shared_ptr<std::mutex> streamMutex) :
     mInStream(inStream),
     mData(data),
     mSupportOffset(startSupport),
-    mSupportSize(sizeSupport)
+    mSupportSize(sizeSupport),
+    mBatchStream(dynamic_cast<six::BatchInputStream*>(mInStream.get())),
+    mStreamMutex(streamMutex ? streamMutex : std::make_shared<std::mutex>())
 {
     initialize();
 }
 SupportBlock::SupportBlock(std::shared_ptr<io::SeekableInputStream> inStream,
-    const cphd::Data& data, const cphd::FileHeader& fileHeader):
+    const cphd::Data& data, const cphd::FileHeader& fileHeader,
+    std::shared_ptr<std::mutex> streamMutex):
     SupportBlock(inStream, data,
-        fileHeader.getSupportBlockByteOffset(), fileHeader.getSupportBlockSize())
+        fileHeader.getSupportBlockByteOffset(), fileHeader.getSupportBlockSize(),
+        streamMutex)
 {
     initialize();
 }
@@ -105,9 +113,18 @@ void SupportBlock::read(const std::string& id,
     // First to the start of the first support array we're going to read
     int64_t inOffset = getFileOffset(id);
     auto dataPtr = data.data;
-    mInStream->seek(inOffset, io::FileInputStream::START);
     size_t size = mData.getSupportArrayById(id).getSize();
-    mInStream->read(dataPtr, size);
+    if (mBatchStream)
+    {
+        // Positional read, so concurrent reads can't move each other
+        mBatchStream->readBatch({{inOffset, size, dataPtr}});
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lock(*mStreamMutex);
+        mInStream->seek(inOffset, io::FileInputStream::START);
+        mInStream->read(dataPtr, size);
+    }
 
     if ((std::endian::native == std::endian::little) && mData.getElementSize(id) > 1)
     {
@@ -20,6 +20,7 @@
  *
  */
 
+#include <algorithm>
 #include <limits>
 #include <sstream>
 #include <thread>
@@ -29,10 +30,13 @@
 #include <nitf/coda-oss.hpp>
 #include <except/Exception.h>
 #include <io/FileInputStream.h>
+#include <mt/Runnable1D.h>
 #include <mt/ThreadGroup.h>
 #include <mt/ThreadPlanner.h>
 
+#include <six/BatchInputStream.h>
 #include <six/Init.h>
+#include <six/Instrumentation.h>
 #include <cphd/ByteSwap.h>
 #include <cphd/Wideband.h>
 #include <cphd/FileHeader.h>
@@ -247,12 +251,14 @@ Wideband::Wideband(const std::string& pathname,
                    const cphd::MetadataBase& metadata,
                    int64_t startWB,
                    int64_t sizeWB) :
-    mInStream(std::make_shared<io::FileInputStream>(pathname)),
+    mInStream(std::make_shared<six::BatchInputStream>(pathname)),
     mMetadata(metadata),
     mWBOffset(startWB),
     mWBSize(sizeWB),
     mElementSize(mMetadata.getNumBytesPerSample()),
-    mOffsets(mMetadata.getNumChannels())
+    mOffsets(mMetadata.getNumChannels()),
+    mBatchStream(dynamic_cast<six::BatchInputStream*>(mInStream.get())),
+    mStreamMutex(std::make_shared<std::mutex>())
 {
     initialize();
 }
@@ -260,13 +266,16 @@ Wideband::Wideband(const std::string& pathname,
 Wideband::Wideband(std::shared_ptr<io::SeekableInputStream> inStream,
                    const cphd::MetadataBase& metadata,
                    int64_t startWB,
-                   int64_t sizeWB) :
+                   int64_t sizeWB,
+                   std::shared_ptr<std::mutex> streamMutex) :
     mInStream(inStream),
     mMetadata(metadata),
     mWBOffset(startWB),
     mWBSize(sizeWB),
     mElementSize(mMetadata.getNumBytesPerSample()),
-    mOffsets(mMetadata.getNumChannels())
+    mOffsets(mMetadata.getNumChannels()),
+    mBatchStream(dynamic_cast<six::BatchInputStream*>(mInStream.get())),
+    mStreamMutex(streamMutex ? streamMutex : std::make_shared<std::mutex>())
 {
     initialize();
 }
@@ -399,17 +408,14 @@ void Wideband::checkChannelInput(size_t channel) const
     }
 }
 
-void Wideband::readImpl(size_t channel,
-                        size_t firstVector,
-                        size_t lastVector,
-                        size_t firstSample,
-                        size_t lastSample,
-                        void* data) const
+void Wideband::getRanges(
+        size_t channel,
+        size_t firstVector,
+        size_t firstSample,
+        const types::RowCol<size_t>& dims,
+        void* data,
+        std::vector<six::BatchInputStream::Request>& requests) const
 {
-    types::RowCol<size_t> dims;
-    checkReadInputs(
-            channel, firstVector, lastVector, firstSample, lastSample, dims);
-
     // Compute the byte offset into this channel's wideband in the CPHD file
     // First to the start of the first pulse we're going to read
     int64_t inOffset = getFileOffset(channel, firstVector, firstSample);
@@ -417,9 +423,9 @@ void Wideband::readImpl(size_t channel,
     auto dataPtr = static_cast<std::byte*>(data);
     if (dims.col == mMetadata.getNumSamples(channel))
     {
-        // Life is easy - can do a single seek and read
-        mInStream->seek(inOffset, io::FileInputStream::START);
-        mInStream->read(dataPtr, dims.row * dims.col * mElementSize);
+        // Life is easy - can do a single read
+        requests.push_back({inOffset, dims.row * dims.col * mElementSize,
+                            dataPtr});
     }
     else
     {
@@ -428,26 +434,69 @@ void Wideband::readImpl(size_t channel,
         const size_t bytesPerVectorAOI = dims.col * mElementSize;
         const size_t bytesPerVectorFile =
                 mMetadata.getNumSamples(channel) * mElementSize;
-
         for (size_t row = 0; row < dims.row; ++row)
         {
-            mInStream->seek(inOffset, io::FileInputStream::START);
-            mInStream->read(dataPtr, bytesPerVectorAOI);
+            requests.push_back({inOffset, bytesPerVectorAOI, dataPtr});
             dataPtr += bytesPerVectorAOI;
             inOffset += bytesPerVectorFile;
         }
     }
 }
 
+void Wideband::readRanges(
+        const std::vector<six::BatchInputStream::Request>& requests) const
+{
+    SIX_SCOPED_TIMER("cphd::Wideband::read");
+#ifndef SIX_DISABLE_INSTRUMENTATION
+    if (six::Instrumentation::isEnabled())
+    {
+        uint64_t numBytes = 0;
+        for (const auto& request : requests)
+        {
+            numBytes += request.size;
+        }
+        six::Instrumentation::count("cphd.widebandReads", requests.size());
+        six::Instrumentation::count("cphd.widebandBytesRead", numBytes);
+    }
+#endif
+
+    if (mBatchStream)
+    {
+        // Positional reads, so there's no shared position to protect
+        mBatchStream->readBatch(requests);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(*mStreamMutex);
+    for (const auto& request : requests)
+    {
+        mInStream->seek(request.offset, io::FileInputStream::START);
+        mInStream->read(request.buffer, request.size);
+    }
+}
+
+void Wideband::readImpl(size_t channel,
+                        size_t firstVector,
+                        size_t lastVector,
+                        size_t firstSample,
+                        size_t lastSample,
+                        void* data) const
+{
+    types::RowCol<size_t> dims;
+    checkReadInputs(
+            channel, firstVector, lastVector, firstSample, lastSample, dims);
+
+    std::vector<six::BatchInputStream::Request> requests;
+    getRanges(channel, firstVector, firstSample, dims, data, requests);
+    readRanges(requests);
+}
+
 void Wideband::readImpl(size_t channel, void* data) const
 {
     // Compute the byte offset into this channel's wideband in the CPHD file
     // First to the start of the first pulse we're going to read
-    int64_t inOffset = getFileOffset(channel);
-
-    auto dataPtr = static_cast<std::byte*>(data);
-    mInStream->seek(inOffset, io::FileInputStream::START);
-    mInStream->read(dataPtr, getBytesRequiredForRead(channel));
+    const int64_t inOffset = getFileOffset(channel);
+    readRanges({{inOffset, getBytesRequiredForRead(channel), data}});
 }
 
 void Wideband::read(size_t channel,
@@ -489,6 +538,77 @@ void Wideband::read(size_t channel,
     }
 }
 
+void Wideband::readMany(const std::vector<ReadRequest>& requests,
+                        size_t numThreads) const
+{
+    // Check everything before reading anything
+    std::vector<types::RowCol<size_t> > dims(requests.size());
+    std::vector<six::BatchInputStream::Request> ranges;
+    for (size_t ii = 0; ii < requests.size(); ++ii)
+    {
+        const ReadRequest& request = requests[ii];
+        size_t lastVector = request.lastVector;
+        size_t lastSample = request.lastSample;
+        checkReadInputs(request.channel,
+                        request.firstVector,
+                        lastVector,
+                        request.firstSample,
+                        lastSample,
+                        dims[ii]);
+
+        const size_t minSize = dims[ii].area() * mElementSize;
+        if (request.data.size() < minSize)
+        {
+            std::ostringstream ostr;
+            ostr << "Request " << ii << " needs at least " << minSize
+                 << " bytes but only got " << request.data.size();
+            throw except::Exception(Ctxt(ostr.str()));
+        }
+
+        getRanges(request.channel,
+                  request.firstVector,
+                  request.firstSample,
+                  dims[ii],
+                  request.data.data(),
+                  ranges);
+    }
+
+    // One batch for every request. An io_uring already keeps the reads in
+    // flight together; other positional reads are split over numThreads.
+    const bool splitReads = (mBatchStream != nullptr) &&
+            (mBatchStream->getBackend() !=
+             six::BatchInputStream::Backend::IO_URING);
+    const size_t numBlocks = splitReads ?
+            std::min(ranges.size(), std::max<size_t>(numThreads, 1)) : 1;
+    if (numBlocks > 1)
+    {
+        mt::run1D(numBlocks, numBlocks, [&](size_t block)
+        {
+            const size_t begin = ranges.size() * block / numBlocks;
+            const size_t end = ranges.size() * (block + 1) / numBlocks;
+            readRanges(std::vector<six::BatchInputStream::Request>(
+                    ranges.begin() + begin, ranges.begin() + end));
+        });
+    }
+    else
+    {
+        readRanges(ranges);
+    }
+
+    // Byte swap to little endian if necessary
+    // Element size is half mElementSize because it's complex
+    if (shouldByteSwap())
+    {
+        for (size_t ii = 0; ii < requests.size(); ++ii)
+        {
+            cphd::byteSwap(requests[ii].data.data(),
+                           mElementSize / 2,
+                           dims[ii].area() * 2,
+                           numThreads);
+        }
+    }
+}
+
 size_t Wideband::getBytesRequiredForRead(size_t channel) const
 {
     if (mMetadata.isCompressed())
@@ -0,0 +1,318 @@
+/* =========================================================================
+ * This file is part of cphd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * cphd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cmath>
+#include <vector>
+
+#include <std/span>
+
+#include <cphd/AntennaPattern.h>
+#include <cphd/Metadata.h>
+#include <cphd/PVP.h>
+#include <cphd/PVPBlock.h>
+#include <cphd/TestDataGenerator.h>
+#include "TestCase.h"
+
+namespace
+{
+const size_t NUM_VECTORS = 9;
+const size_t NUM_SAMPLES = 6;
+const double F0 = 10.0e9;
+const cphd::Vector3 APC_POS(std::vector<double>{7.0e6, 1.0e3, -2.0e3});
+
+double getDCX(size_t vector)
+{
+    return -0.04 + 0.01 * vector;
+}
+
+double getDCY(size_t vector)
+{
+    return 0.03 - 0.005 * vector;
+}
+
+cphd::Vector3 constant(double x, double y, double z)
+{
+    return cphd::Vector3(std::vector<double>{x, y, z});
+}
+
+void setUp(cphd::Metadata& metadata,
+           std::unique_ptr<cphd::PVPBlock>& pvpBlock)
+{
+    metadata.global.domainType = cphd::DomainType::FX;
+    metadata.data.channels.push_back(
+            cphd::Data::Channel(NUM_VECTORS, NUM_SAMPLES));
+
+    cphd::ChannelParameter parameter;
+    parameter.identifier = "Channel";
+    parameter.antenna.reset(new cphd::ChannelParameter::Antenna());
+    parameter.antenna->txAPCId = "TxAPC";
+    parameter.antenna->txAPATId = "Pattern";
+    parameter.antenna->rcvAPCId = "TxAPC";
+    parameter.antenna->rcvAPATId = "Pattern";
+    metadata.channel.parameters.push_back(parameter);
+
+    // The ACF is rotated a quarter turn about Z: X is north and Y is west
+    metadata.antenna.reset(new cphd::Antenna());
+    cphd::AntCoordFrame acf;
+    acf.identifier = "ACF";
+    acf.xAxisPoly = cphd::PolyXYZ(std::vector<cphd::Vector3>{
+            constant(0.0, 1.0, 0.0)});
+    acf.yAxisPoly = cphd::PolyXYZ(std::vector<cphd::Vector3>{
+            constant(-1.0, 0.0, 0.0)});
+    metadata.antenna->antCoordFrame.push_back(acf);
+
+    cphd::AntPhaseCenter apc;
+    apc.identifier = "TxAPC";
+    apc.acfId = "ACF";
+    metadata.antenna->antPhaseCenter.push_back(apc);
+
+    cphd::AntPattern pattern;
+    pattern.identifier = "Pattern";
+    pattern.freqZero = F0;
+    pattern.ebFreqShift = six::BooleanType::IS_FALSE;
+    pattern.mlFreqDilation = six::BooleanType::IS_FALSE;
+    pattern.eb.dcxPoly = cphd::Poly1D(std::vector<double>{0.01, 0.002});
+    pattern.eb.dcyPoly = cphd::Poly1D(std::vector<double>{-0.005});
+    pattern.array.gainPoly = cphd::Poly2D(2, 2, std::vector<double>{
+            0.0, 0.0, -300.0, 0.0, 4.0, 0.0, -250.0, 0.0, 0.0});
+    pattern.array.phasePoly = cphd::Poly2D(1, 1, std::vector<double>{
+            0.0, 2.0, 1.5, 0.0});
+    pattern.element.gainPoly = cphd::Poly2D(1, 1, std::vector<double>{
+            -1.0, 0.5, 0.25, 3.0});
+    pattern.element.phasePoly = cphd::Poly2D(0, 0, std::vector<double>{0.1});
+    metadata.antenna->antPattern.push_back(pattern);
+
+    cphd::Pvp pvp;
+    cphd::setPVPXML(pvp);
+    pvpBlock.reset(new cphd::PVPBlock(1, {NUM_VECTORS}, pvp));
+    for (size_t vector = 0; vector < NUM_VECTORS; ++vector)
+    {
+        const double dcx = getDCX(vector);
+        const double dcy = getDCY(vector);
+        const double dcz = std::sqrt(1.0 - dcx * dcx - dcy * dcy);
+        const cphd::Vector3 los = constant(0.0, 1.0, 0.0) * dcx +
+                constant(-1.0, 0.0, 0.0) * dcy + constant(0.0, 0.0, 1.0) * dcz;
+
+        pvpBlock->setTxTime(0.1 * vector, 0, vector);
+        pvpBlock->setRcvTime(0.1 * vector + 0.01, 0, vector);
+        pvpBlock->setTxPos(APC_POS, 0, vector);
+        pvpBlock->setRcvPos(APC_POS, 0, vector);
+        pvpBlock->setSRPPos(APC_POS + los * 8.0e5, 0, vector);
+        pvpBlock->setFx1(F0 - 2.0e8 + 1.0e7 * vector, 0, vector);
+        pvpBlock->setFx2(F0 + 2.0e8 + 1.0e7 * vector, 0, vector);
+        pvpBlock->setSC0(F0 - 2.0e8, 0, vector);
+        pvpBlock->setSCSS(8.0e7, 0, vector);
+    }
+}
+
+// Straight from the polynomials, one point at a time
+void getExpected(const cphd::AntPattern& pattern,
+                 double time,
+                 double frequency,
+                 size_t vector,
+                 double& gain,
+                 double& phase)
+{
+    const double f0 = pattern.freqZero;
+    const double ebScale =
+            pattern.ebFreqShift == six::BooleanType::IS_TRUE ? f0 / frequency : 1.0;
+    const double scale =
+            pattern.mlFreqDilation == six::BooleanType::IS_TRUE ? frequency / f0 : 1.0;
+    const double x = (getDCX(vector) - pattern.eb.dcxPoly(time) * ebScale) * scale;
+    const double y = (getDCY(vector) - pattern.eb.dcyPoly(time) * ebScale) * scale;
+
+    gain = pattern.array.gainPoly(x, y) +
+            pattern.element.gainPoly(getDCX(vector), getDCY(vector));
+    if (!pattern.gainBSPoly.empty())
+    {
+        gain += pattern.gainBSPoly(frequency - f0);
+    }
+    phase = pattern.array.phasePoly(x, y) +
+            pattern.element.phasePoly(getDCX(vector), getDCY(vector));
+}
+}
+
+TEST_CASE(testDirectionCosines)
+{
+    cphd::Metadata metadata;
+    std::unique_ptr<cphd::PVPBlock> pvpBlock;
+    setUp(metadata, pvpBlock);
+
+    const cphd::AntennaPatternEvaluator evaluator(metadata, *pvpBlock, 3);
+    std::vector<double> dcx(NUM_VECTORS - 2);
+    std::vector<double> dcy(dcx.size());
+    evaluator.getDirectionCosines(
+            0, cphd::AntennaPatternEvaluator::Side::TRANSMIT, 2,
+            std::span<double>(dcx.data(), dcx.size()),
+            std::span<double>(dcy.data(), dcy.size()));
+    for (size_t ii = 0; ii < dcx.size(); ++ii)
+    {
+        TEST_ASSERT_ALMOST_EQ_EPS(dcx[ii], getDCX(ii + 2), 1e-9);
+        TEST_ASSERT_ALMOST_EQ_EPS(dcy[ii], getDCY(ii + 2), 1e-9);
+    }
+
+    // Past the last vector
+    TEST_EXCEPTION(evaluator.getDirectionCosines(
+            0, cphd::AntennaPatternEvaluator::Side::TRANSMIT, 3,
+            std::span<double>(dcx.data(), dcx.size()),
+            std::span<double>(dcy.data(), dcy.size())));
+    TEST_EXCEPTION(evaluator.getDirectionCosines(
+            1, cphd::AntennaPatternEvaluator::Side::TRANSMIT, 0,
+            std::span<double>(dcx.data(), 1),
+            std::span<double>(dcy.data(), 1)));
+}
+
+TEST_CASE(testEvaluate)
+{
+    cphd::Metadata metadata;
+    std::unique_ptr<cphd::PVPBlock> pvpBlock;
+    setUp(metadata, pvpBlock);
+    cphd::AntPattern& pattern = metadata.antenna->antPattern[0];
+
+    for (bool scaled : {false, true})
+    {
+        if (scaled)
+        {
+            pattern.ebFreqShift = six::BooleanType::IS_TRUE;
+            pattern.mlFreqDilation = six::BooleanType::IS_TRUE;
+            pattern.gainBSPoly = cphd::Poly1D(
+                    std::vector<double>{0.0, 1.0e-9, -2.0e-18});
+        }
+
+        const cphd::AntennaPatternEvaluator evaluator(metadata, *pvpBlock, 2);
+        std::vector<double> gain(NUM_VECTORS);
+        std::vector<double> phase(NUM_VECTORS);
+        evaluator.evaluate(0, cphd::AntennaPatternEvaluator::Side::RECEIVE, 0,
+                           std::span<double>(gain.data(), gain.size()),
+                           std::span<double>(phase.data(), phase.size()));
+        for (size_t vector = 0; vector < NUM_VECTORS; ++vector)
+        {
+            double expectedGain;
+            double expectedPhase;
+            getExpected(pattern, pvpBlock->getRcvTime(0, vector),
+                        F0 + 1.0e7 * vector, vector,
+                        expectedGain, expectedPhase);
+            TEST_ASSERT_ALMOST_EQ_EPS(gain[vector], expectedGain, 1e-9);
+            TEST_ASSERT_ALMOST_EQ_EPS(phase[vector], expectedPhase, 1e-9);
+        }
+
+        std::vector<float> sampleGain(NUM_VECTORS * NUM_SAMPLES);
+        std::vector<float> samplePhase(sampleGain.size());
+        evaluator.evaluateSamples(
+                0, cphd::AntennaPatternEvaluator::Side::TRANSMIT, 0,
+                NUM_VECTORS,
+                std::span<float>(sampleGain.data(), sampleGain.size()),
+                std::span<float>(samplePhase.data(), samplePhase.size()));
+        for (size_t vector = 0; vector < NUM_VECTORS; ++vector)
+        {
+            for (size_t sample = 0; sample < NUM_SAMPLES; ++sample)
+            {
+                double expectedGain;
+                double expectedPhase;
+                getExpected(pattern, pvpBlock->getTxTime(0, vector),
+                            F0 - 2.0e8 + 8.0e7 * sample, vector,
+                            expectedGain, expectedPhase);
+                const size_t index = vector * NUM_SAMPLES + sample;
+                TEST_ASSERT_ALMOST_EQ_EPS(sampleGain[index], expectedGain,
+                                          1e-5);
+                TEST_ASSERT_ALMOST_EQ_EPS(samplePhase[index], expectedPhase,
+                                          1e-5);
+            }
+        }
+
+        TEST_EXCEPTION(evaluator.evaluateSamples(
+                0, cphd::AntennaPatternEvaluator::Side::TRANSMIT, 0,
+                NUM_VECTORS - 1,
+                std::span<float>(sampleGain.data(), sampleGain.size()),
+                std::span<float>(samplePhase.data(), samplePhase.size())));
+    }
+}
+
+TEST_CASE(testGainPhaseArray)
+{
+    cphd::Metadata metadata;
+    std::unique_ptr<cphd::PVPBlock> pvpBlock;
+    setUp(metadata, pvpBlock);
+
+    // A 5 x 4 element pattern, linear in DCX and DCY so bilinear
+    // interpolation reproduces it
+    const size_t numRows = 5;
+    const size_t numCols = 4;
+    metadata.supportArray.reset(new cphd::SupportArray());
+    metadata.supportArray->antGainPhase.push_back(cphd::SupportArrayParameter(
+            "Gain=F4;Phase=F4;", 1, -0.05, -0.04, 0.025, 0.03));
+    metadata.data.setSupportArray("1", numRows, numCols, 8, 0);
+    cphd::AntPattern::GainPhaseArray entry;
+    entry.freq = F0;
+    entry.arrayId = "";
+    entry.elementId = "1";
+    metadata.antenna->antPattern[0].gainPhaseArray.push_back(entry);
+
+    std::vector<float> values;
+    for (size_t row = 0; row < numRows; ++row)
+    {
+        for (size_t col = 0; col < numCols; ++col)
+        {
+            const double x = -0.05 + 0.025 * row;
+            const double y = -0.04 + 0.03 * col;
+            values.push_back(static_cast<float>(2.0 + 10.0 * x - 20.0 * y));
+            values.push_back(static_cast<float>(0.25 * x + y));
+        }
+    }
+
+    cphd::AntennaPatternEvaluator evaluator(metadata, *pvpBlock, 4);
+    TEST_EXCEPTION(evaluator.setGainPhaseArray(
+            "1", std::span<const float>(values.data(), values.size() - 2)));
+    evaluator.setGainPhaseArray(
+            "1", std::span<const float>(values.data(), values.size()));
+
+    std::vector<double> gain(NUM_VECTORS);
+    std::vector<double> phase(NUM_VECTORS);
+    evaluator.evaluate(0, cphd::AntennaPatternEvaluator::Side::TRANSMIT, 0,
+                       std::span<double>(gain.data(), gain.size()),
+                       std::span<double>(phase.data(), phase.size()));
+
+    const cphd::AntPattern& pattern = metadata.antenna->antPattern[0];
+    for (size_t vector = 0; vector < NUM_VECTORS; ++vector)
+    {
+        const double time = pvpBlock->getTxTime(0, vector);
+        const double x = getDCX(vector);
+        const double y = getDCY(vector);
+        const double arrayX = x - pattern.eb.dcxPoly(time);
+        const double arrayY = y - pattern.eb.dcyPoly(time);
+        TEST_ASSERT_ALMOST_EQ_EPS(
+                gain[vector],
+                pattern.array.gainPoly(arrayX, arrayY) +
+                        2.0 + 10.0 * x - 20.0 * y,
+                1e-5);
+        TEST_ASSERT_ALMOST_EQ_EPS(
+                phase[vector],
+                pattern.array.phasePoly(arrayX, arrayY) + 0.25 * x + y,
+                1e-5);
+    }
+}
+
+TEST_MAIN(
+    TEST_CHECK(testDirectionCosines);
+    TEST_CHECK(testEvaluate);
+    TEST_CHECK(testGainPhaseArray);
+)
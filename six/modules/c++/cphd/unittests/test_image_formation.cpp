@@ -0,0 +1,269 @@
+/* =========================================================================
+ * This file is part of cphd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * cphd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#include <std/span>
+
+#include <math/Constants.h>
+#include <cphd/ImageFormation.h>
+#include <cphd/Metadata.h>
+#include <cphd/PVP.h>
+#include <cphd/PVPBlock.h>
+#include <cphd/TestDataGenerator.h>
+#include "TestCase.h"
+
+namespace
+{
+const size_t NUM_VECTORS = 48;
+const size_t NUM_SAMPLES = 32;
+const double FC = 10.0e9;
+const double BANDWIDTH = 1.5e8;
+const double SCSS = BANDWIDTH / NUM_SAMPLES;
+const double SPACING = 0.5;
+const size_t SIZE = 64;
+
+// Offset of the point target from the SCP, in pixels
+const ptrdiff_t TARGET_ROW = 10;
+const ptrdiff_t TARGET_COL = -6;
+
+cphd::Vector3 constant(double x, double y, double z)
+{
+    return cphd::Vector3(std::vector<double>{x, y, z});
+}
+
+const cphd::Vector3 SCP = constant(6378137.0, 0.0, 0.0);
+
+// A straight, level pass 10 km from the SCP at 45 degrees of graze
+cphd::Vector3 getAPC(size_t vector)
+{
+    const double along = -75.0 + 150.0 * vector / (NUM_VECTORS - 1);
+    return SCP + constant(7071.0, along, -7071.0);
+}
+
+void setUp(cphd::Metadata& metadata,
+           std::unique_ptr<cphd::PVPBlock>& pvpBlock)
+{
+    metadata.global.domainType = cphd::DomainType::FX;
+    metadata.global.sgn = cphd::PhaseSGN::MINUS_1;
+    metadata.global.fxBand.fxMin = FC - BANDWIDTH / 2;
+    metadata.global.fxBand.fxMax = FC + BANDWIDTH / 2;
+    metadata.data.channels.push_back(
+            cphd::Data::Channel(NUM_VECTORS, NUM_SAMPLES));
+
+    cphd::ChannelParameter parameter;
+    parameter.identifier = "Channel";
+    parameter.refVectorIndex = NUM_VECTORS / 2;
+    parameter.polarization.txPol = cphd::PolarizationType::V;
+    parameter.polarization.rcvPol = cphd::PolarizationType::V;
+    metadata.channel.parameters.push_back(parameter);
+
+    cphd::Pvp pvp;
+    cphd::setPVPXML(pvp);
+    pvpBlock.reset(new cphd::PVPBlock(1, {NUM_VECTORS}, pvp));
+    for (size_t vector = 0; vector < NUM_VECTORS; ++vector)
+    {
+        const double time = static_cast<double>(vector) / (NUM_VECTORS - 1);
+        pvpBlock->setTxTime(time, 0, vector);
+        pvpBlock->setRcvTime(time, 0, vector);
+        pvpBlock->setTxPos(getAPC(vector), 0, vector);
+        pvpBlock->setRcvPos(getAPC(vector), 0, vector);
+        pvpBlock->setTxVel(constant(0.0, 150.0, 0.0), 0, vector);
+        pvpBlock->setRcvVel(constant(0.0, 150.0, 0.0), 0, vector);
+        pvpBlock->setSRPPos(SCP, 0, vector);
+        pvpBlock->setFx1(FC - BANDWIDTH / 2, 0, vector);
+        pvpBlock->setFx2(FC + BANDWIDTH / 2, 0, vector);
+        pvpBlock->setSC0(FC - BANDWIDTH / 2, 0, vector);
+        pvpBlock->setSCSS(SCSS, 0, vector);
+    }
+}
+
+cphd::ImageFormer::Options getOptions(cphd::ImageFormer::Algorithm algorithm)
+{
+    cphd::ImageFormer::Options options;
+    options.algorithm = algorithm;
+    options.dims = types::RowCol<size_t>(SIZE, SIZE);
+    options.sampleSpacing = types::RowCol<double>(SPACING, SPACING);
+    options.numVectorsPerBlock = 10;
+    options.numThreads = 2;
+    return options;
+}
+
+// Phase history of a unit point target at target, exp(j SGN 2 pi f dTOA)
+std::vector<std::complex<float> > makePhaseHistory(const cphd::Vector3& target)
+{
+    const double c = math::Constants::SPEED_OF_LIGHT_METERS_PER_SEC;
+    std::vector<std::complex<float> > data(NUM_VECTORS * NUM_SAMPLES);
+    for (size_t vector = 0; vector < NUM_VECTORS; ++vector)
+    {
+        const cphd::Vector3 apc = getAPC(vector);
+        const double delay =
+                2.0 * ((apc - target).norm() - (apc - SCP).norm()) / c;
+        for (size_t sample = 0; sample < NUM_SAMPLES; ++sample)
+        {
+            const double frequency =
+                    FC - BANDWIDTH / 2 + sample * SCSS;
+            data[vector * NUM_SAMPLES + sample] = std::complex<float>(
+                    std::polar(1.0, -2.0 * M_PI * frequency * delay));
+        }
+    }
+    return data;
+}
+
+// Forms the image of a point target and returns the peak's index
+size_t formPeak(cphd::ImageFormer::Algorithm algorithm, float& peak)
+{
+    cphd::Metadata metadata;
+    std::unique_ptr<cphd::PVPBlock> pvpBlock;
+    setUp(metadata, pvpBlock);
+
+    const cphd::ImageFormer former(metadata, *pvpBlock, 0,
+                                   getOptions(algorithm));
+    const std::unique_ptr<six::sicd::ComplexData> data =
+            former.getComplexData();
+    const cphd::Vector3 target = SCP +
+            data->grid->row->unitVector * (TARGET_ROW * SPACING) +
+            data->grid->col->unitVector * (TARGET_COL * SPACING);
+    const std::vector<std::complex<float> > phaseHistory =
+            makePhaseHistory(target);
+
+    const cphd::ImageFormer::ReadVectors read =
+            [&](size_t firstVector,
+                size_t numVectors,
+                std::span<std::complex<float> > out)
+    {
+        std::copy(&phaseHistory[firstVector * NUM_SAMPLES],
+                  &phaseHistory[(firstVector + numVectors) * NUM_SAMPLES],
+                  out.data());
+    };
+
+    std::vector<std::complex<float> > image(former.getDims().area());
+    former.form(read, std::span<std::complex<float> >(image.data(),
+                                                      image.size()));
+
+    size_t peakIndex = 0;
+    peak = 0.0f;
+    for (size_t ii = 0; ii < image.size(); ++ii)
+    {
+        if (std::abs(image[ii]) > peak)
+        {
+            peak = std::abs(image[ii]);
+            peakIndex = ii;
+        }
+    }
+    return peakIndex;
+}
+}
+
+TEST_CASE(testPFAFocusesPointTarget)
+{
+    float peak = 0.0f;
+    const size_t index = formPeak(cphd::ImageFormer::Algorithm::PFA, peak);
+    TEST_ASSERT_EQ(index / SIZE, SIZE / 2 + TARGET_ROW);
+    TEST_ASSERT_EQ(index % SIZE, SIZE / 2 + TARGET_COL);
+    TEST_ASSERT_GREATER(peak, 0.0f);
+}
+
+TEST_CASE(testBackprojectionFocusesPointTarget)
+{
+    float peak = 0.0f;
+    const size_t index =
+            formPeak(cphd::ImageFormer::Algorithm::BACKPROJECTION, peak);
+    TEST_ASSERT_EQ(index / SIZE, SIZE / 2 + TARGET_ROW);
+    TEST_ASSERT_EQ(index % SIZE, SIZE / 2 + TARGET_COL);
+
+    // Every sample adds up in phase at the target
+    TEST_ASSERT_GREATER(peak, 0.9f * NUM_VECTORS * NUM_SAMPLES);
+}
+
+TEST_CASE(testComplexData)
+{
+    cphd::Metadata metadata;
+    std::unique_ptr<cphd::PVPBlock> pvpBlock;
+    setUp(metadata, pvpBlock);
+
+    const cphd::ImageFormer former(
+            metadata, *pvpBlock, 0,
+            getOptions(cphd::ImageFormer::Algorithm::PFA));
+    TEST_ASSERT_EQ(former.getDims().row, SIZE);
+    TEST_ASSERT_EQ(former.getDims().col, SIZE);
+
+    const std::unique_ptr<six::sicd::ComplexData> data =
+            former.getComplexData();
+    TEST_ASSERT_EQ(data->imageData->numRows, SIZE);
+    TEST_ASSERT_EQ(data->imageData->scpPixel.row, static_cast<ptrdiff_t>(SIZE / 2));
+    TEST_ASSERT_EQ(data->imageFormation->imageFormationAlgorithm,
+                   six::ImageFormationType::PFA);
+    TEST_ASSERT_EQ(data->imageFormation->txRcvPolarizationProc,
+                   six::DualPolarizationType::V_V);
+    TEST_ASSERT_EQ(data->grid->type, six::ComplexImageGridType::RGAZIM);
+    TEST_ASSERT_EQ(data->grid->row->sign, six::FFTSign::NEG);
+    TEST_ASSERT_ALMOST_EQ(data->grid->row->sampleSpacing, SPACING);
+
+    // 2 B / c of range bandwidth in the slant plane
+    const double c = math::Constants::SPEED_OF_LIGHT_METERS_PER_SEC;
+    TEST_ASSERT_LESSER(std::abs(data->grid->row->impulseResponseBandwidth -
+                                2.0 * BANDWIDTH / c),
+                       0.01);
+    TEST_ASSERT_LESSER(std::abs(data->grid->row->kCenter - 2.0 * FC / c), 1.0);
+    TEST_ASSERT_LESSER(data->pfa->krg1, data->pfa->krg2);
+    TEST_ASSERT_LESSER(data->pfa->kaz1, 0.0);
+    TEST_ASSERT_GREATER(data->pfa->kaz2, 0.0);
+
+    // The SCP is in the middle of the pass, broadside and 10 km away
+    TEST_ASSERT_LESSER(std::abs(data->scpcoa->slantRange - 1.0e4), 1.0);
+    TEST_ASSERT_LESSER(std::abs(data->scpcoa->grazeAngle - 45.0), 0.1);
+}
+
+TEST_CASE(testInvalidInputs)
+{
+    cphd::Metadata metadata;
+    std::unique_ptr<cphd::PVPBlock> pvpBlock;
+    setUp(metadata, pvpBlock);
+
+    const cphd::ImageFormer::Options options =
+            getOptions(cphd::ImageFormer::Algorithm::PFA);
+    TEST_EXCEPTION(cphd::ImageFormer(metadata, *pvpBlock, 1, options));
+
+    cphd::ImageFormer::Options coarse(options);
+    coarse.sampleSpacing.row = 2.0;
+    TEST_EXCEPTION(cphd::ImageFormer(metadata, *pvpBlock, 0, coarse));
+
+    const cphd::ImageFormer former(metadata, *pvpBlock, 0, options);
+    std::vector<std::complex<float> > image(SIZE);
+    const cphd::ImageFormer::ReadVectors read =
+            [](size_t, size_t, std::span<std::complex<float> >) {};
+    TEST_EXCEPTION(former.form(
+            read, std::span<std::complex<float> >(image.data(), image.size())));
+
+    metadata.global.domainType = cphd::DomainType::TOA;
+    TEST_EXCEPTION(cphd::ImageFormer(metadata, *pvpBlock, 0, options));
+}
+
+TEST_MAIN(
+    TEST_CHECK(testPFAFocusesPointTarget);
+    TEST_CHECK(testBackprojectionFocusesPointTarget);
+    TEST_CHECK(testComplexData);
+    TEST_CHECK(testInvalidInputs);
+    )
@@ -21,8 +21,18 @@
  */
 #include <cphd/Wideband.h>
 
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 #include <cphd/Metadata.h>
+#include <cphd/SupportBlock.h>
 #include <io/ByteStream.h>
+#include <io/FileOutputStream.h>
+#include <io/TempFile.h>
+#include <six/BatchInputStream.h>
 #include "TestCase.h"
 
 TEST_CASE(testReadCompressedChannel)
@@ -161,9 +171,195 @@ TEST_CASE(testCannotDoPartialReadOfCompressedChannel)
     TEST_EXCEPTION(wideband.getBytesRequiredForRead(0, 0, 0, 1, 1));
 }
 
+static std::span<std::byte> asSpan(std::vector<std::byte>& buffer)
+{
+    return std::span<std::byte>(buffer.data(), buffer.size());
+}
+
+TEST_CASE(testReadMany)
+{
+    cphd::Metadata metadata;
+    metadata.data.channels.resize(2);
+    for (auto& channel : metadata.data.channels)
+    {
+        channel.numSamples = 2;
+        channel.numVectors = 2;
+    }
+    metadata.data.signalArrayFormat = cphd::SignalArrayFormat::CI2;
+
+    auto input = std::make_shared<io::ByteStream>();
+    input->write("0A1B2C3D");
+    input->write("4E5F6G7H");
+    input->seek(0, io::Seekable::START);
+
+    const cphd::Wideband wideband(input, metadata, 0, 16);
+
+    std::vector<std::byte> first(4);
+    std::vector<std::byte> second(4);
+    std::vector<std::byte> third(8);
+    const std::vector<cphd::Wideband::ReadRequest> requests = {
+            {0, 0, cphd::Wideband::ALL, 1, 1, asSpan(first)},
+            {1, 1, 1, 0, cphd::Wideband::ALL, asSpan(second)},
+            {1, 0, cphd::Wideband::ALL, 0, cphd::Wideband::ALL,
+             asSpan(third)}};
+    wideband.readMany(requests, 1);
+    TEST_ASSERT_EQ(first[0], static_cast<std::byte>('1'));
+    TEST_ASSERT_EQ(first[1], static_cast<std::byte>('B'));
+    TEST_ASSERT_EQ(first[2], static_cast<std::byte>('3'));
+    TEST_ASSERT_EQ(first[3], static_cast<std::byte>('D'));
+    TEST_ASSERT_EQ(second[0], static_cast<std::byte>('6'));
+    TEST_ASSERT_EQ(second[3], static_cast<std::byte>('H'));
+    TEST_ASSERT_EQ(third[0], static_cast<std::byte>('4'));
+    TEST_ASSERT_EQ(third[7], static_cast<std::byte>('H'));
+
+    // Every request is checked before anything is read
+    std::vector<std::byte> small(2);
+    const std::vector<cphd::Wideband::ReadRequest> tooSmall = {
+            {0, 0, 0, 0, 0, asSpan(first)},
+            {1, 0, 0, 0, 1, asSpan(small)}};
+    TEST_EXCEPTION(wideband.readMany(tooSmall, 1));
+    const std::vector<cphd::Wideband::ReadRequest> badChannel = {
+            {2, 0, 0, 0, 0, asSpan(first)}};
+    TEST_EXCEPTION(wideband.readMany(badChannel, 1));
+
+    // One channel per thread on the same stream
+    std::vector<std::vector<std::byte> > channels(
+            2, std::vector<std::byte>(8));
+    std::vector<std::thread> threads;
+    for (size_t channel = 0; channel < channels.size(); ++channel)
+    {
+        threads.emplace_back([&, channel]()
+        {
+            for (size_t ii = 0; ii < 100; ++ii)
+            {
+                wideband.read(channel, 0, cphd::Wideband::ALL,
+                              0, cphd::Wideband::ALL, 1,
+                              asSpan(channels[channel]));
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    TEST_ASSERT_EQ(channels[0][0], static_cast<std::byte>('0'));
+    TEST_ASSERT_EQ(channels[0][7], static_cast<std::byte>('D'));
+    TEST_ASSERT_EQ(channels[1][0], static_cast<std::byte>('4'));
+    TEST_ASSERT_EQ(channels[1][7], static_cast<std::byte>('H'));
+}
+
+TEST_CASE(testReadManySynchronousThreads)
+{
+    cphd::Metadata metadata;
+    metadata.data.channels.resize(2);
+    for (auto& channel : metadata.data.channels)
+    {
+        channel.numSamples = 2;
+        channel.numVectors = 2;
+    }
+    metadata.data.signalArrayFormat = cphd::SignalArrayFormat::CI2;
+
+    io::TempFile tempfile;
+    {
+        io::FileOutputStream output(tempfile.pathname());
+        output.write("0A1B2C3D");
+        output.write("4E5F6G7H");
+        output.close();
+    }
+
+    // Without io_uring, the ranges are read by several threads
+    auto input = std::make_shared<six::BatchInputStream>(
+            tempfile.pathname(), six::BatchInputStream::Backend::SYNCHRONOUS);
+    const cphd::Wideband wideband(input, metadata, 0, 16);
+
+    std::vector<std::vector<std::byte> > blocks(4, std::vector<std::byte>(2));
+    std::vector<cphd::Wideband::ReadRequest> requests;
+    for (size_t ii = 0; ii < blocks.size(); ++ii)
+    {
+        requests.push_back({ii / 2, ii % 2, ii % 2, 1, 1, asSpan(blocks[ii])});
+    }
+    wideband.readMany(requests, 3);
+    TEST_ASSERT_EQ(blocks[0][0], static_cast<std::byte>('1'));
+    TEST_ASSERT_EQ(blocks[0][1], static_cast<std::byte>('B'));
+    TEST_ASSERT_EQ(blocks[1][0], static_cast<std::byte>('3'));
+    TEST_ASSERT_EQ(blocks[2][0], static_cast<std::byte>('5'));
+    TEST_ASSERT_EQ(blocks[3][0], static_cast<std::byte>('7'));
+    TEST_ASSERT_EQ(blocks[3][1], static_cast<std::byte>('H'));
+}
+
+TEST_CASE(testConcurrentSignalAndSupportReads)
+{
+    // The signal block followed by two 4x4 byte support arrays
+    cphd::Metadata metadata;
+    metadata.data.channels.resize(1);
+    metadata.data.channels[0].numSamples = 4;
+    metadata.data.channels[0].numVectors = 8;
+    metadata.data.signalArrayFormat = cphd::SignalArrayFormat::CI2;
+    metadata.data.setSupportArray("1.0", 4, 4, 1, 0);
+    metadata.data.setSupportArray("2.0", 4, 4, 1, 16);
+
+    const std::string signal = "0A1B2C3D4E5F6G7H8I9J0K1L2M3N4O5P"
+                               "6Q7R8S9T0U1V2W3X4Y5Z6a7b8c9d0e1f";
+    const std::string support = "abcdefghijklmnop"
+                                "qrstuvwxyzABCDEF";
+    auto input = std::make_shared<io::ByteStream>();
+    input->write(signal);
+    input->write(support);
+    input->seek(0, io::Seekable::START);
+
+    // Both blocks seek the same non-positional stream under one lock
+    auto streamMutex = std::make_shared<std::mutex>();
+    const cphd::Wideband wideband(input, metadata, 0, signal.size(),
+                                  streamMutex);
+    const cphd::SupportBlock supportBlock(input, metadata.data,
+                                          signal.size(), support.size(),
+                                          streamMutex);
+
+    bool signalMatches = true;
+    bool supportMatches = true;
+    std::thread signalThread([&]()
+    {
+        std::vector<std::byte> buffer(signal.size());
+        for (size_t ii = 0; ii < 200; ++ii)
+        {
+            wideband.read(0, 0, cphd::Wideband::ALL,
+                          0, cphd::Wideband::ALL, 1, asSpan(buffer));
+            signalMatches = signalMatches &&
+                    std::equal(buffer.begin(), buffer.end(), signal.begin(),
+                               [](std::byte lhs, char rhs)
+                               {
+                                   return lhs == static_cast<std::byte>(rhs);
+                               });
+        }
+    });
+    std::thread supportThread([&]()
+    {
+        std::vector<std::byte> buffer(16);
+        for (size_t ii = 0; ii < 200; ++ii)
+        {
+            supportBlock.read("2.0", 1, asSpan(buffer));
+            supportMatches = supportMatches &&
+                    std::equal(buffer.begin(), buffer.end(),
+                               support.begin() + 16,
+                               [](std::byte lhs, char rhs)
+                               {
+                                   return lhs == static_cast<std::byte>(rhs);
+                               });
+        }
+    });
+    signalThread.join();
+    supportThread.join();
+
+    TEST_ASSERT_TRUE(signalMatches);
+    TEST_ASSERT_TRUE(supportMatches);
+}
+
 TEST_MAIN(
     TEST_CHECK(testReadCompressedChannel);
     TEST_CHECK(testReadUncompressedChannel);
     TEST_CHECK(testReadChannelSubset);
     TEST_CHECK(testCannotDoPartialReadOfCompressedChannel);
+    TEST_CHECK(testReadMany);
+    TEST_CHECK(testReadManySynchronousThreads);
+    TEST_CHECK(testConcurrentSignalAndSupportReads);
     )
@@ -0,0 +1,199 @@
+/* =========================================================================
+ * This file is part of cphd03-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * cphd03-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef __CPHD03_CONVERTER_H__
+#define __CPHD03_CONVERTER_H__
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <scene/sys_Conf.h>
+#include <io/SeekableStreams.h>
+#include <cphd/CPHDWriter.h>
+#include <cphd/Metadata.h>
+#include <cphd03/FileHeader.h>
+#include <cphd03/Metadata.h>
+
+namespace cphd03
+{
+/*!
+ *  \class Converter
+ *  \brief Converts a CPHD 0.3 file to CPHD 1.0
+ *
+ *  The XML is translated to cphd::Metadata and the VBM is mapped onto
+ *  PVPs. TxVel and RcvVel, which CPHD 0.3 doesn't carry, are
+ *  differenced from the positions. The signal arrays are copied
+ *  verbatim: both versions store big endian samples, so no byte
+ *  swapping or promotion to a wider sample type happens.
+ *
+ *  Neither the VBM nor the wideband is ever held in memory as a whole.
+ *  Both are streamed a block of vectors at a time, so memory use is
+ *  bounded by Options::blockSize regardless of the size of the input.
+ *
+ *  Bistatic collections, frequencies relative to a RefFreqIndex and
+ *  the antenna block are not converted.
+ */
+class Converter
+{
+public:
+    struct Options
+    {
+        //! Most bytes of signal data held in memory at once
+        size_t blockSize = 64 * 1024 * 1024;
+
+        //! ReleaseInfo to use when the CPHD 0.3 XML doesn't have one
+        std::string releaseInfo;
+
+        //! Schemas to validate the CPHD 1.0 XML against
+        std::vector<std::string> schemaPaths;
+
+        //! Threads used to byte swap the PVPs, 0 means one per CPU
+        size_t numThreads = 0;
+    };
+
+    /*!
+     *  Reads the file header and XML and makes a pass through the VBM to
+     *  build the CPHD 1.0 metadata.
+     *
+     *  \param inStream The CPHD 0.3 file
+     *  \param options Conversion options
+     *
+     *  \throws except::Exception if the file can't be converted
+     */
+    Converter(std::shared_ptr<io::SeekableInputStream> inStream,
+              const Options& options);
+
+    Converter(const std::string& pathname, const Options& options);
+
+    Converter(const Converter&) = delete;
+    Converter& operator=(const Converter&) = delete;
+
+    //! The metadata of the CPHD 0.3 file
+    const Metadata& getInputMetadata() const
+    {
+        return mInputMetadata;
+    }
+
+    //! The metadata that will be written
+    const cphd::Metadata& getMetadata() const
+    {
+        return mMetadata;
+    }
+
+    /*!
+     *  Writes the CPHD 1.0 file
+     *
+     *  \param outStream Output stream, written sequentially
+     */
+    void write(std::shared_ptr<io::SeekableOutputStream> outStream) const;
+
+    void write(const std::string& pathname) const;
+
+    /*!
+     *  Converts a list of files, several at a time
+     *
+     *  Each file is converted by one thread, so peak memory is about
+     *  numThreads * options.blockSize.
+     *
+     *  \param inputPathnames CPHD 0.3 files
+     *  \param outputPathnames CPHD 1.0 files, one per input
+     *  \param options Conversion options
+     *  \param numThreads Files converted at once, 0 means one per CPU
+     *
+     *  \throws except::Exception if any file fails to convert, after
+     *  the rest have been converted
+     */
+    static void convert(const std::vector<std::string>& inputPathnames,
+                        const std::vector<std::string>& outputPathnames,
+                        const Options& options,
+                        size_t numThreads);
+
+private:
+    //! The parameters of one vector, in CPHD 1.0 terms
+    struct Vector
+    {
+        double txTime = 0.0;
+        cphd::Vector3 txPos;
+        cphd::Vector3 txVel;
+        double rcvTime = 0.0;
+        cphd::Vector3 rcvPos;
+        cphd::Vector3 rcvVel;
+        cphd::Vector3 srpPos;
+        double fx1 = 0.0;
+        double fx2 = 0.0;
+        double toa1 = 0.0;
+        double toa2 = 0.0;
+        double tdTropoSRP = 0.0;
+        double sc0 = 0.0;
+        double scss = 0.0;
+        double ampSF = 0.0;
+    };
+
+    //! What the metadata needs to know about a channel's vectors
+    struct ChannelSummary
+    {
+        double txTime1 = 0.0;
+        double txTime2 = 0.0;
+        double fxMin = 0.0;
+        double fxMax = 0.0;
+        double toaMin = 0.0;
+        double toaMax = 0.0;
+        bool fxFixed = true;
+        bool toaFixed = true;
+        bool srpFixed = true;
+        size_t refVectorIndex = 0;
+        Vector reference;
+    };
+
+    size_t getNumVectorsPerBlock(size_t channel) const;
+
+    int64_t getSignalOffset(size_t channel, size_t vector) const;
+
+    /*
+     *  Reads and maps vectors [firstVector, firstVector + numVectors)
+     *  of a channel, including the velocities, so one vector on either
+     *  side is read as well
+     */
+    void readVectors(size_t channel,
+                     size_t firstVector,
+                     size_t numVectors,
+                     std::vector<std::byte>& scratch,
+                     std::vector<Vector>& vectors) const;
+
+    ChannelSummary summarize(size_t channel) const;
+
+    void buildMetadata(const std::vector<ChannelSummary>& summaries);
+
+    void writePVPs(cphd::CPHDWriter& writer) const;
+
+    void writeSignal(io::SeekableOutputStream& outStream) const;
+
+    const std::shared_ptr<io::SeekableInputStream> mInStream;
+    const Options mOptions;
+    FileHeader mFileHeader;
+    Metadata mInputMetadata;
+    cphd::Metadata mMetadata;
+};
+}
+
+#endif
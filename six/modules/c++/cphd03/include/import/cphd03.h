@@ -27,6 +27,7 @@
 
 #include "cphd03/Antenna.h"
 #include "cphd03/Channel.h"
+#include "cphd03/Converter.h"
 #include "cphd03/CPHDReader.h"
 #include "cphd03/CPHDWriter.h"
 #include "cphd03/CPHDXMLControl.h"
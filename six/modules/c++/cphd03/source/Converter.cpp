@@ -0,0 +1,752 @@
+/* =========================================================================
+ * This file is part of cphd03-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * cphd03-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <cphd03/Converter.h>
+
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <std/bit>
+
+#include <except/Exception.h>
+#include <io/FileInputStream.h>
+#include <io/FileOutputStream.h>
+#include <logging/NullLogger.h>
+#include <mt/Runnable1D.h>
+#include <scene/EllipsoidModel.h>
+#include <scene/Utilities.h>
+#include <six/Init.h>
+#include <six/XmlLite.h>
+#include <six/sicd/GeoData.h>
+#include <six/sicd/Grid.h>
+#include <six/sicd/Position.h>
+#include <six/sicd/SCPCOA.h>
+#include <cphd/ByteSwap.h>
+#include <cphd03/CPHDXMLControl.h>
+
+#undef min
+#undef max
+
+namespace
+{
+double getDouble(const std::byte* data, int64_t offset)
+{
+    //! memcpy, as the VBM isn't necessarily 8 byte aligned
+    double value;
+    memcpy(&value, data + offset, sizeof(double));
+    return value;
+}
+
+cphd::Vector3 getVector3(const std::byte* data, int64_t offset)
+{
+    cphd::Vector3 value;
+    value[0] = getDouble(data, offset);
+    value[1] = getDouble(data, offset + sizeof(double));
+    value[2] = getDouble(data, offset + 2 * sizeof(double));
+    return value;
+}
+
+cphd::Vector3 getVelocity(const cphd::Vector3& before,
+                          const cphd::Vector3& after,
+                          double timeBefore,
+                          double timeAfter)
+{
+    const double dt = timeAfter - timeBefore;
+    if (!(dt > 0.0))
+    {
+        throw except::Exception(Ctxt(
+                "Vector times must increase to derive velocities"));
+    }
+    return (after - before) * (1.0 / dt);
+}
+
+cphd::Poly2D getConstant(double value)
+{
+    cphd::Poly2D poly(0, 0);
+    poly[0][0] = value;
+    return poly;
+}
+
+cphd::SignalArrayFormat getSignalArrayFormat(cphd::SampleType sampleType)
+{
+    switch (sampleType)
+    {
+    case cphd::SampleType::RE08I_IM08I:
+        return cphd::SignalArrayFormat::CI2;
+    case cphd::SampleType::RE16I_IM16I:
+        return cphd::SignalArrayFormat::CI4;
+    case cphd::SampleType::RE32F_IM32F:
+        return cphd::SignalArrayFormat::CF8;
+    default:
+        throw except::Exception(Ctxt(
+                "Invalid sample type: " + sampleType.toString()));
+    }
+}
+
+void read(io::SeekableInputStream& inStream,
+          int64_t offset,
+          std::vector<std::byte>& data)
+{
+    inStream.seek(offset, io::Seekable::START);
+    const ptrdiff_t bytesRead = inStream.read(data.data(), data.size());
+    if (bytesRead != static_cast<ptrdiff_t>(data.size()))
+    {
+        std::ostringstream oss;
+        oss << "EOF reached reading " << data.size() << " bytes at offset "
+            << offset;
+        throw except::Exception(Ctxt(oss.str()));
+    }
+}
+}
+
+namespace cphd03
+{
+Converter::Converter(std::shared_ptr<io::SeekableInputStream> inStream,
+                     const Options& options) :
+    mInStream(inStream),
+    mOptions(options)
+{
+    mFileHeader.read(*mInStream);
+
+    mInStream->seek(mFileHeader.getXMLoffset(), io::Seekable::START);
+    six::MinidomParser xmlParser;
+    xmlParser.preserveCharacterData(true);
+    xmlParser.parse(*mInStream, static_cast<int>(mFileHeader.getXMLsize()));
+
+    logging::NullLogger logger;
+    mInputMetadata = CPHDXMLControl(&logger).fromXML(xmlParser.getDocument());
+
+    const Global& global = mInputMetadata.global;
+    if (global.domainType != cphd::DomainType::FX &&
+        global.domainType != cphd::DomainType::TOA)
+    {
+        throw except::Exception(Ctxt(
+                "Invalid domain type: " + global.domainType.toString()));
+    }
+    if (!six::Init::isUndefined(global.refFrequencyIndex))
+    {
+        throw except::Exception(Ctxt(
+                "Frequencies relative to RefFreqIndex can't be converted"));
+    }
+    if (mInputMetadata.collectionInformation.collectType ==
+        six::CollectType::BISTATIC)
+    {
+        throw except::Exception(Ctxt(
+                "Bistatic collections can't be converted"));
+    }
+    if (mInputMetadata.channel.parameters.size() <
+        mInputMetadata.getNumChannels())
+    {
+        throw except::Exception(Ctxt(
+                "Every channel needs its ChannelParameters"));
+    }
+    if (mInputMetadata.data.getNumBytesVBP() % sizeof(double) != 0)
+    {
+        throw except::Exception(Ctxt(
+                "NumBytesVBP must be a multiple of 8"));
+    }
+
+    std::vector<ChannelSummary> summaries;
+    for (size_t ii = 0; ii < mInputMetadata.getNumChannels(); ++ii)
+    {
+        if (mInputMetadata.getNumVectors(ii) < 2)
+        {
+            throw except::Exception(Ctxt(
+                    "Every channel needs at least two vectors"));
+        }
+        summaries.push_back(summarize(ii));
+    }
+    buildMetadata(summaries);
+}
+
+Converter::Converter(const std::string& pathname, const Options& options) :
+    Converter(std::make_shared<io::FileInputStream>(pathname), options)
+{
+}
+
+size_t Converter::getNumVectorsPerBlock(size_t channel) const
+{
+    const size_t bytesPerVector =
+            mInputMetadata.getNumSamples(channel) *
+            mInputMetadata.getNumBytesPerSample() +
+            mInputMetadata.data.getNumBytesVBP() + sizeof(Vector) +
+            mMetadata.pvp.sizeInBytes();
+    return std::max<size_t>(mOptions.blockSize / bytesPerVector, 1);
+}
+
+int64_t Converter::getSignalOffset(size_t channel, size_t vector) const
+{
+    const size_t bytesPerSample = mInputMetadata.getNumBytesPerSample();
+    int64_t offset = mFileHeader.getCPHDoffset();
+    for (size_t ii = 0; ii < channel; ++ii)
+    {
+        offset += mInputMetadata.getNumVectors(ii) *
+                mInputMetadata.getNumSamples(ii) * bytesPerSample;
+    }
+    return offset + vector * mInputMetadata.getNumSamples(channel) *
+            bytesPerSample;
+}
+
+void Converter::readVectors(size_t channel,
+                            size_t firstVector,
+                            size_t numVectors,
+                            std::vector<std::byte>& scratch,
+                            std::vector<Vector>& vectors) const
+{
+    const size_t channelVectors = mInputMetadata.getNumVectors(channel);
+    const size_t begin = firstVector == 0 ? 0 : firstVector - 1;
+    const size_t end = std::min(firstVector + numVectors + 1, channelVectors);
+    const size_t numBytesVBP = mInputMetadata.data.getNumBytesVBP();
+
+    int64_t offset = mFileHeader.getVBMoffset();
+    for (size_t ii = 0; ii < channel; ++ii)
+    {
+        offset += mInputMetadata.getNumVectors(ii) * numBytesVBP;
+    }
+    scratch.resize((end - begin) * numBytesVBP);
+    read(*mInStream, offset + begin * numBytesVBP, scratch);
+
+    // The VBM is always big endian and all doubles
+    if (std::endian::native == std::endian::little)
+    {
+        cphd::byteSwap(scratch.data(), sizeof(double),
+                       scratch.size() / sizeof(double), 1);
+    }
+
+    const VectorParameters& vp = mInputMetadata.vectorParameters;
+    const ChannelParameters& parameters =
+            mInputMetadata.channel.parameters[channel];
+    const bool isFX = mInputMetadata.getDomainType() == cphd::DomainType::FX;
+    const double lastSample =
+            static_cast<double>(mInputMetadata.getNumSamples(channel) - 1);
+
+    vectors.resize(end - begin);
+    for (size_t ii = 0; ii < vectors.size(); ++ii)
+    {
+        const std::byte* const data = &scratch[ii * numBytesVBP];
+        Vector& vector = vectors[ii];
+        vector.txTime = getDouble(data, vp.txTimeOffset());
+        vector.txPos = getVector3(data, vp.txPosOffset());
+        vector.rcvTime = getDouble(data, vp.rcvTimeOffset());
+        vector.rcvPos = getVector3(data, vp.rcvPosOffset());
+        vector.srpPos = getVector3(data, vp.srpPosOffset());
+        vector.tdTropoSRP = vp.tropoSRPOffset() < 0 ?
+                0.0 : getDouble(data, vp.tropoSRPOffset());
+        vector.ampSF = vp.ampSFOffset() < 0 ?
+                1.0 : getDouble(data, vp.ampSFOffset());
+
+        if (isFX)
+        {
+            vector.sc0 = getDouble(data, vp.Fx0Offset());
+            vector.scss = getDouble(data, vp.FxSSOffset());
+            vector.fx1 = getDouble(data, vp.Fx1Offset());
+            vector.fx2 = getDouble(data, vp.Fx2Offset());
+            vector.toa1 = -parameters.toaSavedNom / 2;
+            vector.toa2 = parameters.toaSavedNom / 2;
+        }
+        else
+        {
+            vector.sc0 = getDouble(data, vp.deltaTOA0Offset());
+            vector.scss = getDouble(data, vp.toaSSOffset());
+            vector.fx1 = parameters.fxCtrNom - parameters.bwSavedNom / 2;
+            vector.fx2 = parameters.fxCtrNom + parameters.bwSavedNom / 2;
+            vector.toa1 = vector.sc0;
+            vector.toa2 = vector.sc0 + lastSample * vector.scss;
+        }
+    }
+
+    // Central differences, one sided at the ends of the channel
+    for (size_t ii = firstVector - begin;
+         ii < firstVector - begin + numVectors;
+         ++ii)
+    {
+        const Vector& before = vectors[ii == 0 ? 0 : ii - 1];
+        const Vector& after = vectors[std::min(ii + 1, vectors.size() - 1)];
+        vectors[ii].txVel = getVelocity(before.txPos, after.txPos,
+                                        before.txTime, after.txTime);
+        vectors[ii].rcvVel = getVelocity(before.rcvPos, after.rcvPos,
+                                         before.rcvTime, after.rcvTime);
+    }
+
+    vectors.erase(vectors.begin() + (firstVector - begin + numVectors),
+                  vectors.end());
+    vectors.erase(vectors.begin(),
+                  vectors.begin() + (firstVector - begin));
+}
+
+Converter::ChannelSummary Converter::summarize(size_t channel) const
+{
+    const size_t numVectors = mInputMetadata.getNumVectors(channel);
+    const size_t numVectorsPerBlock = getNumVectorsPerBlock(channel);
+
+    ChannelSummary summary;
+    summary.refVectorIndex = numVectors / 2;
+
+    Vector first;
+    std::vector<std::byte> scratch;
+    std::vector<Vector> vectors;
+    for (size_t block = 0; block < numVectors; block += numVectorsPerBlock)
+    {
+        const size_t count = std::min(numVectorsPerBlock, numVectors - block);
+        readVectors(channel, block, count, scratch, vectors);
+        if (block == 0)
+        {
+            first = vectors[0];
+            summary.txTime1 = first.txTime;
+            summary.txTime2 = first.txTime;
+            summary.fxMin = first.fx1;
+            summary.fxMax = first.fx2;
+            summary.toaMin = first.toa1;
+            summary.toaMax = first.toa2;
+        }
+
+        for (size_t ii = 0; ii < count; ++ii)
+        {
+            const Vector& vector = vectors[ii];
+            summary.txTime1 = std::min(summary.txTime1, vector.txTime);
+            summary.txTime2 = std::max(summary.txTime2, vector.txTime);
+            summary.fxMin = std::min(summary.fxMin, vector.fx1);
+            summary.fxMax = std::max(summary.fxMax, vector.fx2);
+            summary.toaMin = std::min(summary.toaMin, vector.toa1);
+            summary.toaMax = std::max(summary.toaMax, vector.toa2);
+            summary.fxFixed = summary.fxFixed &&
+                    vector.fx1 == first.fx1 && vector.fx2 == first.fx2;
+            summary.toaFixed = summary.toaFixed &&
+                    vector.toa1 == first.toa1 && vector.toa2 == first.toa2;
+            summary.srpFixed = summary.srpFixed &&
+                    vector.srpPos == first.srpPos;
+            if (block + ii == summary.refVectorIndex)
+            {
+                summary.reference = vector;
+            }
+        }
+    }
+    return summary;
+}
+
+void Converter::buildMetadata(const std::vector<ChannelSummary>& summaries)
+{
+    const Metadata& input = mInputMetadata;
+    const ChannelSummary& reference = summaries[0];
+    const Vector& refVector = reference.reference;
+
+    // CollectionID
+    mMetadata.collectionID = input.collectionInformation;
+    mMetadata.collectionID.collectType = six::CollectType::MONOSTATIC;
+    if (six::Init::isUndefined(mMetadata.collectionID.releaseInfo))
+    {
+        mMetadata.collectionID.releaseInfo = mOptions.releaseInfo;
+    }
+    if (six::Init::isUndefined(mMetadata.collectionID.releaseInfo))
+    {
+        throw except::Exception(Ctxt(
+                "The CPHD 0.3 XML has no ReleaseInfo and none was given"));
+    }
+
+    // Global
+    mMetadata.global.domainType = input.global.domainType;
+    mMetadata.global.sgn = input.global.phaseSGN;
+    mMetadata.global.timeline.collectionStart = input.global.collectStart;
+    mMetadata.global.timeline.txTime1 = reference.txTime1;
+    mMetadata.global.timeline.txTime2 = reference.txTime2;
+    mMetadata.global.fxBand.fxMin = reference.fxMin;
+    mMetadata.global.fxBand.fxMax = reference.fxMax;
+    mMetadata.global.toaSwath.toaMin = reference.toaMin;
+    mMetadata.global.toaSwath.toaMax = reference.toaMax;
+    for (const ChannelSummary& summary : summaries)
+    {
+        cphd::Timeline& timeline = mMetadata.global.timeline;
+        timeline.txTime1 = std::min(timeline.txTime1, summary.txTime1);
+        timeline.txTime2 = std::max(timeline.txTime2, summary.txTime2);
+        cphd::FxBand& fxBand = mMetadata.global.fxBand;
+        fxBand.fxMin = std::min(fxBand.fxMin, summary.fxMin);
+        fxBand.fxMax = std::max(fxBand.fxMax, summary.fxMax);
+        cphd::TOASwath& toaSwath = mMetadata.global.toaSwath;
+        toaSwath.toaMin = std::min(toaSwath.toaMin, summary.toaMin);
+        toaSwath.toaMax = std::max(toaSwath.toaMax, summary.toaMax);
+    }
+
+    // SceneCoordinates: the 0.3 image area plane when there is one,
+    // otherwise a plane tangent to the ellipsoid at the SRP with X
+    // pointing toward the ARP
+    const cphd::Vector3 arpPos = (refVector.txPos + refVector.rcvPos) * 0.5;
+    const cphd::Vector3 arpVel = (refVector.txVel + refVector.rcvVel) * 0.5;
+    cphd::SceneCoordinates& scene = mMetadata.sceneCoordinates;
+    scene.earthModel = cphd::EarthModelType::WGS_84;
+    scene.referenceSurface.planar.reset(new cphd::Planar());
+    cphd::Planar& planar = *scene.referenceSurface.planar;
+    const AreaPlane* const plane = input.global.imageArea.plane.get();
+    if (plane)
+    {
+        scene.iarp.ecf = plane->referencePoint.ecef;
+        planar.uIax = plane->xDirection.unitVector.unit();
+        planar.uIay = plane->yDirection.unitVector.unit();
+    }
+    else
+    {
+        scene.iarp.ecf = refVector.srpPos;
+        const cphd::Vector3 up =
+                ::scene::WGS84EllipsoidModel().getNormalVector(scene.iarp.ecf);
+        const cphd::Vector3 look = arpPos - scene.iarp.ecf;
+        planar.uIax = (look - up * look.dot(up)).unit();
+        planar.uIay = math::linear::cross(up, planar.uIax);
+    }
+    scene.iarp.llh = ::scene::Utilities::ecefToLatLon(scene.iarp.ecf);
+    const cphd::Vector3 uIaz = math::linear::cross(planar.uIax, planar.uIay);
+
+    const cphd::LatLonAltCorners& corners = input.global.imageArea.acpCorners;
+    for (size_t ii = 0; ii < cphd::LatLonAltCorners::NUM_CORNERS; ++ii)
+    {
+        const cphd::LatLonAlt& corner = corners.getCorner(ii);
+        scene.imageAreaCorners.getCorner(ii) =
+                cphd::LatLon(corner.getLat(), corner.getLon());
+
+        const cphd::Vector3 position =
+                ::scene::Utilities::latLonToECEF(corner) - scene.iarp.ecf;
+        const double x = position.dot(planar.uIax);
+        const double y = position.dot(planar.uIay);
+        if (ii == 0)
+        {
+            scene.imageArea.x1y1[0] = scene.imageArea.x2y2[0] = x;
+            scene.imageArea.x1y1[1] = scene.imageArea.x2y2[1] = y;
+        }
+        scene.imageArea.x1y1[0] = std::min(scene.imageArea.x1y1[0], x);
+        scene.imageArea.x1y1[1] = std::min(scene.imageArea.x1y1[1], y);
+        scene.imageArea.x2y2[0] = std::max(scene.imageArea.x2y2[0], x);
+        scene.imageArea.x2y2[1] = std::max(scene.imageArea.x2y2[1], y);
+    }
+
+    // PVP
+    cphd::Pvp& pvp = mMetadata.pvp;
+    pvp.append(pvp.txTime);
+    pvp.append(pvp.txPos);
+    pvp.append(pvp.txVel);
+    pvp.append(pvp.rcvTime);
+    pvp.append(pvp.rcvPos);
+    pvp.append(pvp.rcvVel);
+    pvp.append(pvp.srpPos);
+    pvp.append(pvp.aFDOP);
+    pvp.append(pvp.aFRR1);
+    pvp.append(pvp.aFRR2);
+    pvp.append(pvp.fx1);
+    pvp.append(pvp.fx2);
+    pvp.append(pvp.toa1);
+    pvp.append(pvp.toa2);
+    pvp.append(pvp.tdTropoSRP);
+    pvp.append(pvp.sc0);
+    pvp.append(pvp.scss);
+    if (input.vectorParameters.ampSFOffset() >= 0)
+    {
+        pvp.append(pvp.ampSF);
+    }
+
+    // Data
+    const size_t bytesPerSample = input.getNumBytesPerSample();
+    mMetadata.data.signalArrayFormat =
+            getSignalArrayFormat(input.data.getSampleType());
+    mMetadata.data.numBytesPVP = pvp.sizeInBytes();
+    size_t signalOffset = 0;
+    size_t pvpOffset = 0;
+    for (size_t ii = 0; ii < input.getNumChannels(); ++ii)
+    {
+        const size_t numVectors = input.getNumVectors(ii);
+        const size_t numSamples = input.getNumSamples(ii);
+        mMetadata.data.channels.push_back(cphd::Data::Channel(
+                numVectors, numSamples, signalOffset, pvpOffset));
+        mMetadata.data.channels.back().identifier =
+                "Channel_" + std::to_string(ii + 1);
+        signalOffset += numVectors * numSamples * bytesPerSample;
+        pvpOffset += numVectors * mMetadata.data.numBytesPVP;
+    }
+
+    // Dwell: the 0.3 polynomials are over the same image area plane
+    cphd::COD cod;
+    cod.identifier = "COD";
+    cphd::DwellTime dwellTime;
+    dwellTime.identifier = "DWELL";
+    if (plane && plane->dwellTime.get())
+    {
+        cod.codTimePoly = plane->dwellTime->codTimePoly;
+        dwellTime.dwellTimePoly = plane->dwellTime->dwellTimePoly;
+    }
+    else
+    {
+        cod.codTimePoly = getConstant(refVector.txTime);
+        dwellTime.dwellTimePoly = getConstant(
+                mMetadata.global.timeline.txTime2 -
+                mMetadata.global.timeline.txTime1);
+    }
+    mMetadata.dwell.cod.push_back(cod);
+    mMetadata.dwell.dtime.push_back(dwellTime);
+
+    // Channel
+    const cphd::ChannelParameter* first = nullptr;
+    mMetadata.channel.fxFixedCphd = six::BooleanType::IS_TRUE;
+    mMetadata.channel.toaFixedCphd = six::BooleanType::IS_TRUE;
+    mMetadata.channel.srpFixedCphd = six::BooleanType::IS_TRUE;
+    for (size_t ii = 0; ii < summaries.size(); ++ii)
+    {
+        const ChannelSummary& summary = summaries[ii];
+        cphd::ChannelParameter parameter;
+        parameter.identifier = mMetadata.data.channels[ii].identifier;
+        parameter.refVectorIndex = summary.refVectorIndex;
+        parameter.fxFixed = summary.fxFixed ?
+                six::BooleanType::IS_TRUE : six::BooleanType::IS_FALSE;
+        parameter.toaFixed = summary.toaFixed ?
+                six::BooleanType::IS_TRUE : six::BooleanType::IS_FALSE;
+        parameter.srpFixed = summary.srpFixed ?
+                six::BooleanType::IS_TRUE : six::BooleanType::IS_FALSE;
+        parameter.polarization.txPol = cphd::PolarizationType::UNSPECIFIED;
+        parameter.polarization.rcvPol = cphd::PolarizationType::UNSPECIFIED;
+        parameter.fxC = (summary.fxMin + summary.fxMax) / 2;
+        parameter.fxBW = summary.fxMax - summary.fxMin;
+        parameter.toaSaved = summary.toaMax - summary.toaMin;
+        parameter.dwellTimes.codId = cod.identifier;
+        parameter.dwellTimes.dwellId = dwellTime.identifier;
+        parameter.imageArea = scene.imageArea;
+        mMetadata.channel.parameters.push_back(parameter);
+
+        // The whole file is only fixed if every channel matches the first
+        const cphd::ChannelParameter& current =
+                mMetadata.channel.parameters.back();
+        if (!first)
+        {
+            first = &current;
+        }
+        if (!summary.fxFixed || current.fxC != first->fxC ||
+            current.fxBW != first->fxBW)
+        {
+            mMetadata.channel.fxFixedCphd = six::BooleanType::IS_FALSE;
+        }
+        if (!summary.toaFixed || current.toaSaved != first->toaSaved)
+        {
+            mMetadata.channel.toaFixedCphd = six::BooleanType::IS_FALSE;
+        }
+        if (!summary.srpFixed ||
+            summary.reference.srpPos != refVector.srpPos)
+        {
+            mMetadata.channel.srpFixedCphd = six::BooleanType::IS_FALSE;
+        }
+    }
+    mMetadata.channel.refChId = mMetadata.channel.parameters[0].identifier;
+
+    // ReferenceGeometry, at the first channel's reference vector
+    cphd::ReferenceGeometry& geometry = mMetadata.referenceGeometry;
+    const cphd::Vector3 srp = refVector.srpPos - scene.iarp.ecf;
+    geometry.srp.ecf = refVector.srpPos;
+    geometry.srp.iac[0] = srp.dot(planar.uIax);
+    geometry.srp.iac[1] = srp.dot(planar.uIay);
+    geometry.srp.iac[2] = srp.dot(uIaz);
+    geometry.referenceTime = refVector.txTime;
+    geometry.srpCODTime =
+            cod.codTimePoly(geometry.srp.iac[0], geometry.srp.iac[1]);
+    geometry.srpDwellTime =
+            dwellTime.dwellTimePoly(geometry.srp.iac[0], geometry.srp.iac[1]);
+
+    six::sicd::SCPCOA scpcoa;
+    scpcoa.scpTime = refVector.txTime;
+    scpcoa.arpPos = arpPos;
+    scpcoa.arpVel = arpVel;
+    six::sicd::GeoData geoData;
+    geoData.scp.ecf = refVector.srpPos;
+    scpcoa.fillDerivedFields(geoData, six::sicd::Grid(),
+                             six::sicd::Position());
+
+    geometry.monostatic.reset(new cphd::Monostatic());
+    cphd::Monostatic& monostatic = *geometry.monostatic;
+    monostatic.arpPos = arpPos;
+    monostatic.arpVel = arpVel;
+    monostatic.sideOfTrack = scpcoa.sideOfTrack;
+    monostatic.slantRange = scpcoa.slantRange;
+    monostatic.groundRange = scpcoa.groundRange;
+    monostatic.dopplerConeAngle = scpcoa.dopplerConeAngle;
+    monostatic.grazeAngle = scpcoa.grazeAngle;
+    monostatic.incidenceAngle = scpcoa.incidenceAngle;
+    monostatic.azimuthAngle = scpcoa.azimAngle;
+    monostatic.twistAngle = scpcoa.twistAngle;
+    monostatic.slopeAngle = scpcoa.slopeAngle;
+    monostatic.layoverAngle = scpcoa.layoverAngle;
+}
+
+void Converter::writePVPs(cphd::CPHDWriter& writer) const
+{
+    const double c = math::Constants::SPEED_OF_LIGHT_METERS_PER_SEC;
+    const bool haveAmpSF =
+            mInputMetadata.vectorParameters.ampSFOffset() >= 0;
+
+    std::vector<std::byte> scratch;
+    std::vector<Vector> vectors;
+    for (size_t channel = 0; channel < mInputMetadata.getNumChannels();
+         ++channel)
+    {
+        const size_t numVectors = mInputMetadata.getNumVectors(channel);
+        const size_t numVectorsPerBlock = getNumVectorsPerBlock(channel);
+        for (size_t block = 0; block < numVectors; block += numVectorsPerBlock)
+        {
+            const size_t count =
+                    std::min(numVectorsPerBlock, numVectors - block);
+            readVectors(channel, block, count, scratch, vectors);
+
+            cphd::PVPBlock pvpBlock(1, {count}, mMetadata.pvp);
+            for (size_t ii = 0; ii < count; ++ii)
+            {
+                const Vector& vector = vectors[ii];
+                pvpBlock.setTxTime(vector.txTime, 0, ii);
+                pvpBlock.setTxPos(vector.txPos, 0, ii);
+                pvpBlock.setTxVel(vector.txVel, 0, ii);
+                pvpBlock.setRcvTime(vector.rcvTime, 0, ii);
+                pvpBlock.setRcvPos(vector.rcvPos, 0, ii);
+                pvpBlock.setRcvVel(vector.rcvVel, 0, ii);
+                pvpBlock.setSRPPos(vector.srpPos, 0, ii);
+                pvpBlock.setFx1(vector.fx1, 0, ii);
+                pvpBlock.setFx2(vector.fx2, 0, ii);
+                pvpBlock.setTOA1(vector.toa1, 0, ii);
+                pvpBlock.setTOA2(vector.toa2, 0, ii);
+                pvpBlock.setTdTropoSRP(vector.tdTropoSRP, 0, ii);
+                pvpBlock.setSC0(vector.sc0, 0, ii);
+                pvpBlock.setSCSS(vector.scss, 0, ii);
+                if (haveAmpSF)
+                {
+                    pvpBlock.setAmpSF(vector.ampSF, 0, ii);
+                }
+
+                // Doppler and range rate scale factors from the SRP's
+                // range rates along the two legs
+                const double txRangeRate = vector.txVel.dot(
+                        (vector.txPos - vector.srpPos).unit());
+                const double rcvRangeRate = vector.rcvVel.dot(
+                        (vector.rcvPos - vector.srpPos).unit());
+                const double aFDOP = -(txRangeRate + rcvRangeRate) / c;
+                pvpBlock.setaFDOP(aFDOP, 0, ii);
+                pvpBlock.setaFRR1(1.0 + aFDOP, 0, ii);
+                pvpBlock.setaFRR2(1.0 + aFDOP, 0, ii);
+            }
+            writer.writePVPData(pvpBlock, channel, block);
+        }
+    }
+}
+
+void Converter::writeSignal(io::SeekableOutputStream& outStream) const
+{
+    const size_t bytesPerSample = mInputMetadata.getNumBytesPerSample();
+
+    std::vector<std::byte> scratch;
+    for (size_t channel = 0; channel < mInputMetadata.getNumChannels();
+         ++channel)
+    {
+        const size_t numVectors = mInputMetadata.getNumVectors(channel);
+        const size_t bytesPerVector =
+                mInputMetadata.getNumSamples(channel) * bytesPerSample;
+        const size_t numVectorsPerBlock = getNumVectorsPerBlock(channel);
+        for (size_t block = 0; block < numVectors; block += numVectorsPerBlock)
+        {
+            const size_t count =
+                    std::min(numVectorsPerBlock, numVectors - block);
+            scratch.resize(count * bytesPerVector);
+            read(*mInStream, getSignalOffset(channel, block), scratch);
+            outStream.write(scratch.data(), scratch.size());
+        }
+    }
+}
+
+void Converter::write(std::shared_ptr<io::SeekableOutputStream> outStream) const
+{
+    cphd::CPHDWriter writer(mMetadata, outStream, mOptions.schemaPaths,
+                            mOptions.numThreads);
+    writer.writeMetadata();
+    writePVPs(writer);
+
+    // The signal block follows the PVP block directly
+    writeSignal(*outStream);
+}
+
+void Converter::write(const std::string& pathname) const
+{
+    auto outStream = std::make_shared<io::FileOutputStream>(pathname);
+    write(outStream);
+    outStream->close();
+}
+
+void Converter::convert(const std::vector<std::string>& inputPathnames,
+                        const std::vector<std::string>& outputPathnames,
+                        const Options& options,
+                        size_t numThreads)
+{
+    if (inputPathnames.size() != outputPathnames.size())
+    {
+        throw except::Exception(Ctxt(
+                "Need one output pathname per input pathname"));
+    }
+    if (numThreads == 0)
+    {
+        numThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    numThreads = std::min(numThreads, inputPathnames.size());
+
+    // Files are very different sizes, so each thread takes the next
+    // file as it finishes one rather than a fixed share
+    Options fileOptions(options);
+    fileOptions.numThreads = 1;
+    std::atomic<size_t> next(0);
+    std::mutex mutex;
+    std::ostringstream errors;
+    size_t numFailed = 0;
+    mt::run1D(numThreads, numThreads, [&](size_t)
+    {
+        for (size_t ii = next++; ii < inputPathnames.size(); ii = next++)
+        {
+            std::string error;
+            try
+            {
+                Converter(inputPathnames[ii], fileOptions).write(
+                        outputPathnames[ii]);
+            }
+            catch (const except::Exception& ex)
+            {
+                error = ex.getMessage();
+            }
+            catch (const std::exception& ex)
+            {
+                error = ex.what();
+            }
+
+            if (!error.empty())
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                errors << "\n" << inputPathnames[ii] << ": " << error;
+                ++numFailed;
+            }
+        }
+    });
+
+    if (numFailed != 0)
+    {
+        std::ostringstream oss;
+        oss << numFailed << " of " << inputPathnames.size()
+            << " files failed to convert:" << errors.str();
+        throw except::Exception(Ctxt(oss.str()));
+    }
+}
+}
@@ -0,0 +1,126 @@
+/* =========================================================================
+ * This file is part of cphd03-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * cphd03-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <std/filesystem>
+
+#include <cli/ArgumentParser.h>
+#include <except/Exception.h>
+#include <sys/Path.h>
+#include <cphd03/Converter.h>
+
+namespace fs = std::filesystem;
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        // Parse the command line
+        cli::ArgumentParser parser;
+        parser.setDescription(
+                "Convert CPHD 0.3 files to CPHD 1.0. Each input is written "
+                "to the output directory under the same filename.");
+        parser.addArgument("-t --threads",
+                           "Number of files to convert at once",
+                           cli::STORE,
+                           "threads",
+                           "NUM")->setDefault(std::thread::hardware_concurrency());
+        parser.addArgument("-b --block-size",
+                           "Most bytes of signal data per file held in memory",
+                           cli::STORE,
+                           "blockSize",
+                           "BYTES")->setDefault(64 * 1024 * 1024);
+        parser.addArgument("-r --release-info",
+                           "ReleaseInfo for files whose XML lacks one",
+                           cli::STORE,
+                           "releaseInfo",
+                           "STRING")->setDefault("");
+        parser.addArgument("-s --schema",
+                           "CPHD 1.0 schema to validate the XML against",
+                           cli::STORE,
+                           "schema",
+                           "XSD", 0, 10);
+        parser.addArgument("output", "Output directory", cli::STORE,
+                           "output", "DIR", 1, 1);
+        parser.addArgument("input", "Input pathnames", cli::STORE, "input",
+                           "CPHD", 1);
+        const std::unique_ptr<cli::Results> options(parser.parse(argc, argv));
+        const fs::path outDir(options->get<std::string>("output"));
+        const size_t numThreads(options->get<size_t>("threads"));
+
+        cphd03::Converter::Options converterOptions;
+        converterOptions.blockSize = options->get<size_t>("blockSize");
+        converterOptions.releaseInfo =
+                options->get<std::string>("releaseInfo");
+        if (options->hasValue("schema"))
+        {
+            const cli::Value* value = options->getValue("schema");
+            for (size_t ii = 0; ii < value->size(); ++ii)
+            {
+                converterOptions.schemaPaths.push_back(
+                        value->get<std::string>(ii));
+            }
+        }
+
+        std::vector<std::string> inPathnames;
+        std::vector<std::string> outPathnames;
+        const cli::Value* value = options->getValue("input");
+        for (size_t ii = 0; ii < value->size(); ++ii)
+        {
+            inPathnames.push_back(value->get<std::string>(ii));
+            outPathnames.push_back(
+                    (outDir / fs::path(inPathnames.back()).filename()).string());
+            if (sys::Path::absolutePath(inPathnames.back()) ==
+                sys::Path::absolutePath(outPathnames.back()))
+            {
+                throw except::Exception(Ctxt(
+                        "Output would overwrite " + inPathnames.back()));
+            }
+        }
+
+        cphd03::Converter::convert(inPathnames, outPathnames,
+                                   converterOptions, numThreads);
+        std::cout << "Converted " << inPathnames.size() << " files\n";
+        return 0;
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return 1;
+    }
+    catch (const except::Exception& ex)
+    {
+        std::cerr << ex.toString() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cerr << "Unknown exception\n";
+        return 1;
+    }
+}
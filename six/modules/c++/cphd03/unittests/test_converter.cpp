@@ -0,0 +1,303 @@
+/* =========================================================================
+ * This file is part of cphd03-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * cphd03-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cmath>
+#include <complex>
+#include <string>
+#include <vector>
+
+#include <std/filesystem>
+
+#include <cphd/CPHDReader.h>
+#include <cphd/Wideband.h>
+#include <cphd03/CPHDReader.h>
+#include <cphd03/CPHDWriter.h>
+#include <cphd03/Converter.h>
+#include "TestCase.h"
+
+namespace
+{
+const char* INPUT_NAME = "temp_converter.cphd03";
+const char* OUTPUT_NAME = "temp_converter.cphd";
+const size_t NUM_CHANNELS = 2;
+const size_t NUM_VECTORS = 20;
+const size_t NUM_SAMPLES = 16;
+const double FC = 10.0e9;
+const double BANDWIDTH = 1.6e8;
+
+cphd::Vector3 constant(double x, double y, double z)
+{
+    return cphd::Vector3(std::vector<double>{x, y, z});
+}
+
+const cphd::Vector3 SRP = constant(6378137.0, 0.0, 0.0);
+const cphd::Vector3 VELOCITY = constant(0.0, 150.0, 10.0);
+
+double getTime(size_t vector)
+{
+    return 0.01 * vector;
+}
+
+cphd::Vector3 getAPC(size_t vector)
+{
+    return SRP + constant(7071.0, -75.0, -7071.0) + VELOCITY * getTime(vector);
+}
+
+cphd03::Metadata makeMetadata(cphd::DomainType domainType)
+{
+    cphd03::Metadata metadata;
+    metadata.collectionInformation.collectorName = "Collector";
+    metadata.collectionInformation.coreName = "Core";
+    metadata.collectionInformation.collectType = six::CollectType::MONOSTATIC;
+    metadata.collectionInformation.radarMode = six::RadarModeType::SPOTLIGHT;
+    metadata.collectionInformation.setClassificationLevel("UNCLASSIFIED");
+
+    metadata.data.sampleType = cphd::SampleType::RE16I_IM16I;
+    metadata.data.numCPHDChannels = NUM_CHANNELS;
+    for (size_t ii = 0; ii < NUM_CHANNELS; ++ii)
+    {
+        metadata.data.arraySize.push_back(
+                cphd03::ArraySize(NUM_VECTORS, NUM_SAMPLES));
+
+        cphd03::ChannelParameters parameters;
+        parameters.srpIndex = 0;
+        parameters.nomTOARateSF = 1.0;
+        parameters.fxCtrNom = FC;
+        parameters.bwSavedNom = BANDWIDTH;
+        parameters.toaSavedNom = 1.0e-6;
+        metadata.channel.parameters.push_back(parameters);
+    }
+
+    metadata.global.domainType = domainType;
+    metadata.global.phaseSGN = cphd::PhaseSGN::MINUS_1;
+    metadata.global.collectStart = six::DateTime(1.0e9);
+    metadata.global.collectDuration = getTime(NUM_VECTORS - 1);
+    metadata.global.txTime1 = 0.0;
+    metadata.global.txTime2 = getTime(NUM_VECTORS - 1);
+    const double corners[4][2] = {{0.001, -0.001}, {0.001, 0.001},
+                                  {-0.001, 0.001}, {-0.001, -0.001}};
+    for (size_t ii = 0; ii < cphd::LatLonAltCorners::NUM_CORNERS; ++ii)
+    {
+        cphd::LatLonAlt& corner =
+                metadata.global.imageArea.acpCorners.getCorner(ii);
+        corner.setLat(corners[ii][0]);
+        corner.setLon(corners[ii][1]);
+        corner.setAlt(0.0);
+    }
+
+    metadata.srp.srpType = cphd::SRPType::FIXEDPT;
+    metadata.srp.numSRPs = 1;
+    metadata.srp.srpPT.push_back(SRP);
+
+    metadata.vectorParameters.ampSF = 8;
+    if (domainType == cphd::DomainType::FX)
+    {
+        metadata.vectorParameters.fxParameters.reset(
+                new cphd03::FxParameters());
+        metadata.vectorParameters.fxParameters->Fx0 = 8;
+        metadata.vectorParameters.fxParameters->FxSS = 8;
+        metadata.vectorParameters.fxParameters->Fx1 = 8;
+        metadata.vectorParameters.fxParameters->Fx2 = 8;
+        metadata.data.numBytesVBP = 8 + 24 + 8 + 24 + 24 + 8 + 32;
+    }
+    else
+    {
+        metadata.vectorParameters.toaParameters.reset(
+                new cphd03::TOAParameters());
+        metadata.vectorParameters.toaParameters->deltaTOA0 = 8;
+        metadata.vectorParameters.toaParameters->toaSS = 8;
+        metadata.data.numBytesVBP = 8 + 24 + 8 + 24 + 24 + 8 + 16;
+    }
+    return metadata;
+}
+
+// Writes a CPHD 0.3 file and returns its signal data
+std::vector<std::complex<int16_t> > writeInput(
+        const cphd03::Metadata& metadata)
+{
+    cphd03::VBM vbm(metadata.data, metadata.vectorParameters);
+    for (size_t channel = 0; channel < NUM_CHANNELS; ++channel)
+    {
+        for (size_t vector = 0; vector < NUM_VECTORS; ++vector)
+        {
+            vbm.setTxTime(getTime(vector), channel, vector);
+            vbm.setTxPos(getAPC(vector), channel, vector);
+            vbm.setRcvTime(getTime(vector), channel, vector);
+            vbm.setRcvPos(getAPC(vector), channel, vector);
+            vbm.setSRPPos(SRP, channel, vector);
+            vbm.setAmpSF(1.0 + vector, channel, vector);
+            if (metadata.global.domainType == cphd::DomainType::FX)
+            {
+                vbm.setFx0(FC - BANDWIDTH / 2, channel, vector);
+                vbm.setFxSS(BANDWIDTH / NUM_SAMPLES, channel, vector);
+                vbm.setFx1(FC - BANDWIDTH / 2, channel, vector);
+                vbm.setFx2(FC + BANDWIDTH / 2, channel, vector);
+            }
+            else
+            {
+                vbm.setDeltaTOA0(-1.0e-6 + 1.0e-9 * vector, channel, vector);
+                vbm.setTOASS(1.0e-7, channel, vector);
+            }
+        }
+    }
+
+    std::vector<std::complex<int16_t> > data(
+            NUM_CHANNELS * NUM_VECTORS * NUM_SAMPLES);
+    for (size_t ii = 0; ii < data.size(); ++ii)
+    {
+        data[ii] = std::complex<int16_t>(static_cast<int16_t>(ii),
+                                         static_cast<int16_t>(-3 * ii));
+    }
+
+    cphd03::CPHDWriter writer(metadata, INPUT_NAME, 1);
+    writer.writeMetadata(vbm);
+    for (size_t channel = 0; channel < NUM_CHANNELS; ++channel)
+    {
+        writer.writeCPHDData(&data[channel * NUM_VECTORS * NUM_SAMPLES],
+                             NUM_VECTORS * NUM_SAMPLES);
+    }
+    return data;
+}
+
+cphd03::Converter::Options getOptions()
+{
+    cphd03::Converter::Options options;
+    options.releaseInfo = "UNRESTRICTED";
+
+    // A few vectors per block, so blocks and channels don't line up
+    options.blockSize = 3 * NUM_SAMPLES * 4 + 1000;
+    options.numThreads = 1;
+    return options;
+}
+
+void testConversion(const std::string& testName, cphd::DomainType domainType)
+{
+    const std::vector<std::complex<int16_t> > data =
+            writeInput(makeMetadata(domainType));
+    cphd03::Converter(INPUT_NAME, getOptions()).write(OUTPUT_NAME);
+
+    const cphd::CPHDReader reader(OUTPUT_NAME, 1);
+    const cphd::Metadata& metadata = reader.getMetadata();
+    TEST_ASSERT_EQ(metadata.data.signalArrayFormat,
+                   cphd::SignalArrayFormat::CI4);
+    TEST_ASSERT_EQ(metadata.global.domainType, domainType);
+    TEST_ASSERT_EQ(metadata.collectionID.releaseInfo, "UNRESTRICTED");
+    TEST_ASSERT_EQ(reader.getNumChannels(), NUM_CHANNELS);
+    TEST_ASSERT_EQ(metadata.channel.parameters[0].refVectorIndex,
+                   NUM_VECTORS / 2);
+    TEST_ASSERT_EQ(metadata.channel.fxFixedCphd, six::BooleanType::IS_TRUE);
+    TEST_ASSERT_TRUE(metadata.referenceGeometry.monostatic.get() != nullptr);
+    TEST_ASSERT_LESSER(
+            std::abs(metadata.referenceGeometry.monostatic->slantRange -
+                     (getAPC(NUM_VECTORS / 2) - SRP).norm()), 1.0e-3);
+
+    const cphd::PVPBlock& pvpBlock = reader.getPVPBlock();
+    for (size_t channel = 0; channel < NUM_CHANNELS; ++channel)
+    {
+        TEST_ASSERT_EQ(reader.getNumVectors(channel), NUM_VECTORS);
+        TEST_ASSERT_EQ(reader.getNumSamples(channel), NUM_SAMPLES);
+        for (size_t vector = 0; vector < NUM_VECTORS; ++vector)
+        {
+            TEST_ASSERT_EQ(pvpBlock.getTxTime(channel, vector),
+                           getTime(vector));
+            TEST_ASSERT_EQ(pvpBlock.getRcvPos(channel, vector),
+                           getAPC(vector));
+            TEST_ASSERT_LESSER(
+                    (pvpBlock.getTxVel(channel, vector) - VELOCITY).norm(),
+                    1.0e-6);
+            TEST_ASSERT_EQ(pvpBlock.getAmpSF(channel, vector), 1.0 + vector);
+            TEST_ASSERT_EQ(pvpBlock.getFx1(channel, vector),
+                           FC - BANDWIDTH / 2);
+            TEST_ASSERT_EQ(pvpBlock.getFx2(channel, vector),
+                           FC + BANDWIDTH / 2);
+            TEST_ASSERT_LESSER(pvpBlock.getaFDOP(channel, vector), 0.0);
+        }
+
+        // Same samples, still 16 bit
+        const std::unique_ptr<std::byte[]> signal = reader.getWideband().read(
+                channel, 0, cphd::Wideband::ALL, 0, cphd::Wideband::ALL, 1);
+        const std::complex<int16_t>* const samples =
+                reinterpret_cast<const std::complex<int16_t>*>(signal.get());
+        for (size_t ii = 0; ii < NUM_VECTORS * NUM_SAMPLES; ++ii)
+        {
+            TEST_ASSERT_EQ(samples[ii],
+                           data[channel * NUM_VECTORS * NUM_SAMPLES + ii]);
+        }
+    }
+}
+}
+
+TEST_CASE(testConvertFX)
+{
+    testConversion(testName, cphd::DomainType::FX);
+}
+
+TEST_CASE(testConvertTOA)
+{
+    testConversion(testName, cphd::DomainType::TOA);
+}
+
+TEST_CASE(testConvertMany)
+{
+    writeInput(makeMetadata(cphd::DomainType::FX));
+    const std::vector<std::string> inputs(3, INPUT_NAME);
+    const std::vector<std::string> outputs = {
+            "temp_converter_0.cphd", "temp_converter_1.cphd",
+            "temp_converter_2.cphd"};
+    cphd03::Converter::convert(inputs, outputs, getOptions(), 2);
+    for (const std::string& output : outputs)
+    {
+        TEST_ASSERT_EQ(std::filesystem::file_size(output),
+                       std::filesystem::file_size(outputs[0]));
+        std::filesystem::remove(output);
+    }
+
+    // Failures are reported after the rest of the files are converted
+    const std::vector<std::string> missing = {"missing.cphd03", INPUT_NAME};
+    TEST_EXCEPTION(cphd03::Converter::convert(missing, outputs, getOptions(),
+                                              2));
+    TEST_ASSERT_TRUE(std::filesystem::exists(outputs[1]));
+    std::filesystem::remove(outputs[1]);
+}
+
+TEST_CASE(testUnsupported)
+{
+    cphd03::Metadata metadata = makeMetadata(cphd::DomainType::FX);
+    metadata.collectionInformation.collectType = six::CollectType::BISTATIC;
+    writeInput(metadata);
+    TEST_EXCEPTION(cphd03::Converter(INPUT_NAME, getOptions()));
+
+    metadata.collectionInformation.collectType = six::CollectType::MONOSTATIC;
+    writeInput(metadata);
+    cphd03::Converter::Options options(getOptions());
+    options.releaseInfo.clear();
+    TEST_EXCEPTION(cphd03::Converter(INPUT_NAME, options));
+}
+
+TEST_MAIN(
+    TEST_CHECK(testConvertFX);
+    TEST_CHECK(testConvertTOA);
+    TEST_CHECK(testConvertMany);
+    TEST_CHECK(testUnsupported);
+    std::filesystem::remove(INPUT_NAME);
+    std::filesystem::remove(OUTPUT_NAME);
+    )
@@ -25,12 +25,14 @@
 #include <scene/AdjustableParams.h>
 #include <scene/CoordinateTransform.h>
 #include <scene/ECEFToLLATransform.h>
+#include <scene/ElevationSource.h>
 #include <scene/EllipsoidModel.h>
 #include <scene/Errors.h>
 #include <scene/FrameType.h>
 #include <scene/LLAToECEFTransform.h>
 #include <scene/LocalCoordinateTransform.h>
 #include <scene/GridECEFTransform.h>
+#include <scene/GridElevationSource.h>
 #include <scene/SceneGeometry.h>
 #include <scene/GridGeometry.h>
 #include <scene/Types.h>
@@ -55,6 +55,19 @@ struct ECEFToLLATransform : public CoordinateTransform
      */
     LatLonAlt transform(const Vector3& ecef) const;
 
+    /**
+     * This function transforms many Vector3s to LatLonAlts at once.  Rather
+     * than iterating, it uses the closed-form solution from Vermeille,
+     * "An analytical method to transform geocentric into geodetic
+     * coordinates" (J. Geodesy, 2011), which agrees with the single-point
+     * transform() to well under a millimetre.  Points within ~43 km of the
+     * Earth's centre fall back to the single-point transform().
+     *
+     * @param ecef  The ecef coordinates to transform
+     * @param lla   The LatLonAlts; must be the same size as ecef
+     */
+    void transform(std::span<const Vector3> ecef, std::span<LatLonAlt> lla) const;
+
 private:
     static double computeLongitude(const Vector3& ecef);
     double computeAltitude(const Vector3& ecef, double latitude) const;
@@ -0,0 +1,93 @@
+/* =========================================================================
+ * This file is part of scene-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * scene-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef __SCENE_ELEVATION_SOURCE_H__
+#define __SCENE_ELEVATION_SOURCE_H__
+
+#include <std/span>
+
+#include <scene/Types.h>
+
+namespace scene
+{
+/*!
+ * \class ElevationSource
+ * \brief Terrain heights for ProjectionModel::imageToScene()
+ *
+ * Heights are in meters above the WGS-84 ellipsoid (HAE).  Implementations
+ * must be safe to call from multiple threads at once, since the batch
+ * projection methods share one source across threads.
+ */
+class ElevationSource
+{
+public:
+    virtual ~ElevationSource();
+
+    /*!
+     * \param latLon Position in degrees
+     *
+     * \return Terrain height (meters HAE) at latLon
+     *
+     * \throw except::Exception if latLon is outside of the source's coverage
+     */
+    virtual double getHeight(const LatLon& latLon) const = 0;
+
+    /*!
+     * getHeight() for callers that can do without a height.  The default
+     * implementation catches getHeight()'s exception; sources where that's
+     * common (e.g. a grid with voids) should override it.
+     *
+     * \param latLon Position in degrees
+     *
+     * \return Terrain height (meters HAE) at latLon, or NaN if the source
+     * has no height there
+     */
+    virtual double findHeight(const LatLon& latLon) const;
+
+    /*!
+     * getHeight() for many points.  The default implementation just loops;
+     * sources with per-lookup overhead should override it.
+     *
+     * \param latLons Positions in degrees
+     * \param[out] heights One height (meters HAE) per position
+     *
+     * \throw except::Exception if the sizes don't match or any position is
+     * outside of the source's coverage
+     */
+    virtual void getHeights(std::span<const LatLon> latLons,
+                            std::span<double> heights) const;
+
+    //! \return Lower bound on the heights (meters HAE) in the source
+    virtual double getMinHeight() const = 0;
+
+    //! \return Upper bound on the heights (meters HAE) in the source
+    virtual double getMaxHeight() const = 0;
+
+    /*!
+     * \return Nominal horizontal distance (meters) between independent
+     * heights.  imageToScene() steps along the R/Rdot contour at roughly
+     * this spacing so it doesn't step over terrain features.
+     */
+    virtual double getPostSpacing() const = 0;
+};
+}
+
+#endif
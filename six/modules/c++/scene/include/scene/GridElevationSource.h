@@ -0,0 +1,229 @@
+/* =========================================================================
+ * This file is part of scene-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * scene-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef __SCENE_GRID_ELEVATION_SOURCE_H__
+#define __SCENE_GRID_ELEVATION_SOURCE_H__
+
+#include <stddef.h>
+
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <sys/Conf.h>
+#include <sys/File.h>
+#include <scene/ElevationSource.h>
+
+namespace scene
+{
+/*!
+ * \class GridElevationSource
+ * \brief ElevationSource backed by a local file of elevation posts on a
+ * regular lat/lon grid (a raw binary grid or a GeoTIFF)
+ *
+ * Heights are bilinearly interpolated between the four surrounding posts.
+ * Posts are read from disk a square tile at a time and kept in a
+ * least-recently-used cache whose size is bounded, so arbitrarily large
+ * DEMs can be used with a fixed amount of memory.
+ *
+ * Post values are taken to be heights above the WGS-84 ellipsoid; a DEM
+ * referenced to a geoid (e.g. DTED or SRTM) needs to be converted first.
+ */
+class GridElevationSource : public ElevationSource
+{
+public:
+    //! Binary type of the posts in the file
+    enum class SampleType
+    {
+        INT16,
+        FLOAT32,
+        FLOAT64
+    };
+
+    //! Layout of a raw grid on disk
+    struct GridInfo
+    {
+        //! Number of posts in latitude and longitude
+        size_t numRows = 0;
+        size_t numCols = 0;
+
+        //! Position (degrees) of the post at row 0, column 0
+        LatLon origin = LatLon(0.0);
+
+        /*!
+         * Degrees between posts.  The latitude of post (row, col) is
+         * origin.lat + row * spacing.lat, so north-up grids have a negative
+         * latitude spacing.
+         */
+        LatLon spacing = LatLon(0.0);
+
+        SampleType sampleType = SampleType::FLOAT32;
+        bool bigEndian = false;
+
+        //! Byte offset of the first post in the file
+        sys::Off_T headerBytes = 0;
+
+        /*!
+         * Posts with this value are voids and are left out of the
+         * interpolation.  NaN posts are always treated as voids.
+         */
+        double noDataValue = std::numeric_limits<double>::quiet_NaN();
+
+        /*!
+         * Range (meters HAE) of the posts, used to bracket the terrain in
+         * imageToScene().  A tighter range means fewer steps there.  Left
+         * as NaN, the range of heights on Earth is assumed
+         * (MIN_TERRAIN_HEIGHT to MAX_TERRAIN_HEIGHT).
+         */
+        double minHeight = std::numeric_limits<double>::quiet_NaN();
+        double maxHeight = std::numeric_limits<double>::quiet_NaN();
+    };
+
+    //! Height range (meters HAE) assumed when the grid doesn't give one
+    static constexpr double MIN_TERRAIN_HEIGHT = -500.0;
+    static constexpr double MAX_TERRAIN_HEIGHT = 9000.0;
+
+    static const size_t DEFAULT_TILE_SIZE = 256;
+    static const size_t DEFAULT_CACHE_BYTES = 64 * 1024 * 1024;
+
+    /*!
+     * Opens a headerless, row-major grid of posts.  Nothing is read until
+     * a height is asked for.
+     *
+     * \param pathname Grid file
+     * \param info Layout of the grid in the file
+     * \param maxCacheBytes Upper bound on the memory used for cached posts.
+     * At least one tile is always cached.
+     * \param tileSize Number of posts along each side of a cached tile
+     */
+    GridElevationSource(const std::string& pathname,
+                        const GridInfo& info,
+                        size_t maxCacheBytes = DEFAULT_CACHE_BYTES,
+                        size_t tileSize = DEFAULT_TILE_SIZE);
+
+    /*!
+     * Opens a single-band, uncompressed, stripped GeoTIFF in geographic
+     * (lat/lon) coordinates.  The georeferencing comes from the
+     * ModelTiepoint and ModelPixelScale tags; both PixelIsArea and
+     * PixelIsPoint rasters are handled.  The height range comes from the
+     * SMinSampleValue and SMaxSampleValue tags, if present.
+     *
+     * \throw except::Exception if the file isn't a GeoTIFF in a supported
+     * layout
+     */
+    static std::unique_ptr<GridElevationSource>
+    fromGeoTIFF(const std::string& pathname,
+                size_t maxCacheBytes = DEFAULT_CACHE_BYTES,
+                size_t tileSize = DEFAULT_TILE_SIZE);
+
+    virtual double getHeight(const LatLon& latLon) const;
+
+    virtual double findHeight(const LatLon& latLon) const;
+
+    virtual void getHeights(std::span<const LatLon> latLons,
+                            std::span<double> heights) const;
+
+    virtual double getMinHeight() const
+    {
+        return mMinHeight;
+    }
+
+    virtual double getMaxHeight() const
+    {
+        return mMaxHeight;
+    }
+
+    virtual double getPostSpacing() const
+    {
+        return mPostSpacing;
+    }
+
+    const GridInfo& getGridInfo() const
+    {
+        return mInfo;
+    }
+
+    //! \return Maximum number of tiles held in the cache
+    size_t getMaxNumCachedTiles() const
+    {
+        return mMaxNumTiles;
+    }
+
+    //! \return Number of tiles currently in the cache
+    size_t getNumCachedTiles() const;
+
+    //! \return Number of tiles read from disk so far
+    size_t getNumTileReads() const;
+
+private:
+    typedef std::vector<double> Tile;
+
+    GridElevationSource(const std::string& pathname,
+                        const GridInfo& info,
+                        const std::vector<sys::Off_T>& rowOffsets,
+                        size_t maxCacheBytes,
+                        size_t tileSize);
+
+    void initialize(size_t maxCacheBytes);
+
+    static size_t getElementSize(SampleType sampleType);
+
+    void readPosts(size_t row, size_t col, size_t numPosts,
+                   double* posts) const;
+
+    std::shared_ptr<const Tile> getTile(size_t tileIndex) const;
+
+    // Fractional post position of latLon; false if it's off the grid
+    bool getGridPosition(const LatLon& latLon, double& row,
+                         double& col) const;
+
+    // NaN if latLon is off the grid or only has voids around it
+    double interpolate(const LatLon& latLon,
+                       std::shared_ptr<const Tile>& lastTile,
+                       size_t& lastTileIndex) const;
+
+    [[noreturn]] void throwNoHeight(const LatLon& latLon) const;
+
+    GridInfo mInfo;
+    std::vector<sys::Off_T> mRowOffsets;
+    size_t mTileSize;
+    size_t mNumTileCols;
+    size_t mMaxNumTiles;
+    double mMinHeight;
+    double mMaxHeight;
+    double mPostSpacing;
+
+    // Guards everything below; the file position is shared state too
+    mutable std::mutex mMutex;
+    mutable sys::File mFile;
+    mutable std::list<size_t> mLRU;
+    mutable std::unordered_map<size_t,
+            std::pair<std::shared_ptr<const Tile>,
+                      std::list<size_t>::iterator> > mTiles;
+    mutable size_t mNumTileReads;
+};
+}
+
+#endif
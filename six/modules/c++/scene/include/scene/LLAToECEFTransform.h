@@ -55,6 +55,15 @@ struct LLAToECEFTransform : public CoordinateTransform
      * @return      A Vector3
      */
     Vector3 transform(const LatLonAlt& lla) const;
+
+    /**
+     * This function transforms many LatLonAlts to Vector3s at once, with
+     * the ellipsoid constants computed just once.
+     *
+     * @param lla   The lla coordinates to transform
+     * @param ecef  The Vector3s; must be the same size as lla
+     */
+    void transform(std::span<const LatLonAlt> lla, std::span<Vector3> ecef) const;
 private:
 
     double computeRadius(const LatLonAlt& lla) const;
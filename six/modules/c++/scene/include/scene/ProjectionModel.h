@@ -31,6 +31,7 @@
 #include <scene/GridECEFTransform.h>
 #include <scene/AdjustableParams.h>
 #include <scene/Errors.h>
+#include <scene/ElevationSource.h>
 
 namespace scene
 {
@@ -92,7 +93,20 @@ public:
                                 const types::RowCol<double>& imageGridPoint,
                                 double* r,
                                 double* rDot) const = 0;
-        
+
+    /*!
+     *  Partials of the R/Rdot contour from computeContour() w.r.t. the
+     *  image grid point: rows are R and Rdot, columns are row and col.
+     *  These are total derivatives, so they include the change in timeCOA
+     *  (and so ARP position and velocity) across the image.
+     *
+     *  Sub-classes should override this with the analytic partials of
+     *  their contour; the default uses finite differences of
+     *  computeContour().
+     */
+    virtual math::linear::MatrixMxN<2, 2>
+    computeContourPartials(const types::RowCol<double>& imageGridPoint) const;
+
     /*!
      *  Calculations for section 5.2 in SICD Image Projections:
      *  R/Rdot Contour Ground Plane Intersection
@@ -207,81 +221,208 @@ public:
                          double heightThreshold = 1.0,
                          size_t maxNumIters = 3) const;
 
+    /*!
+     *  sceneToImage() for many points.  The points are independent, so
+     *  they're split across threads.
+     *
+     *  \param scenePoints Scene (ground) points in 3-space
+     *  \param[out] imageGridPoints One image point per scene point
+     *  \param numThreads Number of threads to use; 0 means one per core
+     *
+     *  \throw except::Exception if the sizes don't match or any point
+     *  fails to converge
+     */
+    void sceneToImage(std::span<const Vector3> scenePoints,
+                      std::span<types::RowCol<double> > imageGridPoints,
+                      size_t numThreads = 0) const;
+
+    /*!
+     *  imageToScene() onto a constant height surface, for many points.
+     *  Each point has its own height (e.g. from a DEM).
+     *
+     *  \param imageGridPoints Points (meters) in the image surface
+     *  \param heights Surface height (meters) above the WGS-84 reference
+     *  ellipsoid for each image point
+     *  \param[out] scenePoints One scene point per image point
+     *  \param numThreads Number of threads to use; 0 means one per core
+     *
+     *  \throw except::Exception if the sizes don't match
+     */
+    void imageToScene(std::span<const types::RowCol<double> > imageGridPoints,
+                      std::span<const double> heights,
+                      std::span<Vector3> scenePoints,
+                      size_t numThreads = 0) const;
+
+    /*!
+     * Projects an image point onto the terrain described by elevation.
+     *
+     * The R/Rdot contour is computed once.  Starting at the top of the
+     * terrain's height range, the contour's intersection with successively
+     * lower constant height surfaces is found (each starting from the
+     * previous one, so it's cheap) until the intersection is at or below
+     * the terrain.  The steps are about one post apart on the ground, so the
+     * first crossing from the sensor's side is found rather than one hidden
+     * behind it.  Steps where the elevation source has no height (off its
+     * coverage or in a void) are skipped.  The crossing is then refined by
+     * regula falsi on (height - terrain height).
+     *
+     *  \param imageGridPoint A point (meters) in the image surface
+     *  (continuous)
+     *  \param elevation Terrain heights
+     *  \param delta Delta values to apply for the adjustable parameters
+     *  \param heightThreshold Height threshold (meters) for convergence,
+     *  both onto each constant height surface and onto the terrain.  Must be
+     *  positive.
+     *  \param maxNumIters Maximum number of refinement iterations once the
+     *  terrain crossing has been bracketed
+     *
+     *  \return A scene (ground) point in 3 space on the terrain
+     *
+     *  \throw except::Exception if the crossing can't be found within the
+     *  elevation source's coverage
+     */
+    Vector3 imageToScene(const types::RowCol<double>& imageGridPoint,
+                         const ElevationSource& elevation,
+                         const AdjustableParams& delta = AdjustableParams(),
+                         double heightThreshold = 1.0,
+                         size_t maxNumIters = 10) const;
+
+    /*!
+     *  imageToScene() onto terrain, for many points.  Points that can't
+     *  be projected don't stop the others.
+     *
+     *  \param imageGridPoints Points (meters) in the image surface
+     *  \param elevation Terrain heights
+     *  \param[out] scenePoints One scene point per image point, or all NaNs
+     *  for an image point whose terrain crossing can't be found
+     *  \param numThreads Number of threads to use; 0 means one per core
+     *
+     *  \throw except::Exception if the sizes don't match
+     */
+    void imageToScene(std::span<const types::RowCol<double> > imageGridPoints,
+                      const ElevationSource& elevation,
+                      std::span<Vector3> scenePoints,
+                      size_t numThreads = 0) const;
+
+    /*
+     * The partials below come in two flavors.  Without a delta, they are
+     * computed analytically: the scene point is the solution of the R/Rdot
+     * contour equations (plus the height equation for imageToScene()), so
+     * its derivatives follow from the implicit function theorem and the
+     * contour's own partials (see computeContourPartials()).  This costs a
+     * couple of small linear solves instead of re-running the iterative
+     * projection for every column.  With a delta, they are computed by
+     * forward finite differences as before.
+     */
+
+    math::linear::MatrixMxN<2, 2> slantToImagePartials(
+            const types::RowCol<double>& imageGridPoint) const;
     math::linear::MatrixMxN<2, 2> slantToImagePartials(
             const types::RowCol<double>& imageGridPoint,
-            double delta = 0.0001) const;
+            double delta) const;
 
     /*!
      * Computes sensor partials for imageToScene()
      * Provides a Jacobian matrix of form [ARP-RIC, Vel-RIC, Rbias]
      */
+    math::linear::MatrixMxN<3, 7> imageToSceneSensorPartials(
+            const types::RowCol<double>& imageGridPoint,
+            double height,
+            const Vector3& scenePoint) const;
     math::linear::MatrixMxN<3, 7> imageToSceneSensorPartials(
             const types::RowCol<double>& imageGridPoint,
             double height,
             const Vector3& scenePoint,
-            double delta = 0.0001) const;
+            double delta) const;
 
     // Same as above but computes scene point via imageToScene()
+    math::linear::MatrixMxN<3, 7> imageToSceneSensorPartials(
+            const types::RowCol<double>& imageGridPoint,
+            double height) const;
     math::linear::MatrixMxN<3, 7> imageToSceneSensorPartials(
             const types::RowCol<double>& imageGridPoint,
             double height,
-            double delta = 0.0001) const;
+            double delta) const;
 
     /*
      * Computes partials for imageToScene() (row and col)
      */
+    math::linear::MatrixMxN<3, 2> imageToScenePartials(
+            const types::RowCol<double>& imageGridPoint,
+            double height,
+            const Vector3& scenePoint) const;
     math::linear::MatrixMxN<3, 2> imageToScenePartials(
             const types::RowCol<double>& imageGridPoint,
             double height,
             const Vector3& scenePoint,
-            double delta = 0.0001) const;
+            double delta) const;
 
     // Same as above but computes scene point via imageToScene()
+    math::linear::MatrixMxN<3, 2> imageToScenePartials(
+            const types::RowCol<double>& imageGridPoint,
+            double height) const;
     math::linear::MatrixMxN<3, 2> imageToScenePartials(
             const types::RowCol<double>& imageGridPoint,
             double height,
-            double delta = 0.0001) const;
+            double delta) const;
 
     /*
      * Computes partial derivative for imageToScene() w.r.t. height
      */
+    math::linear::MatrixMxN<3, 1> imageToSceneHeightPartial(
+            const types::RowCol<double>& imageGridPoint,
+            double height,
+            const Vector3& scenePoint) const;
     math::linear::MatrixMxN<3, 1> imageToSceneHeightPartial(
             const types::RowCol<double>& imageGridPoint,
             double height,
             const Vector3& scenePoint,
-            double delta = 0.0001) const;
+            double delta) const;
 
     // Same as above but computes scene point via imageToScene()
+    math::linear::MatrixMxN<3, 1> imageToSceneHeightPartial(
+            const types::RowCol<double>& imageGridPoint,
+            double height) const;
     math::linear::MatrixMxN<3, 1> imageToSceneHeightPartial(
             const types::RowCol<double>& imageGridPoint,
             double height,
-            double delta = 0.0001) const;
+            double delta) const;
 
     /*
      * Computes sensor partials for sceneToImage()
      */
+    math::linear::MatrixMxN<2, 7> sceneToImageSensorPartials(
+            const Vector3& scenePoint,
+            const types::RowCol<double>& imageGridPoint) const;
     math::linear::MatrixMxN<2, 7> sceneToImageSensorPartials(
             const Vector3& scenePoint,
             const types::RowCol<double>& imageGridPoint,
-            double delta = 0.0001) const;
+            double delta) const;
 
     // Same as above but computes image grid point via sceneToImage()
+    math::linear::MatrixMxN<2, 7> sceneToImageSensorPartials(
+            const Vector3& scenePoint) const;
     math::linear::MatrixMxN<2,7,double> sceneToImageSensorPartials(
             const Vector3& scenePoint,
-            double delta = 0.0001) const;
+            double delta) const;
 
     /*!
      * Computes partials for sceneToImage() (row and col)
      */
+    math::linear::MatrixMxN<2, 3> sceneToImagePartials(
+            const Vector3& scenePoint,
+            const types::RowCol<double>& imageGridPoint) const;
     math::linear::MatrixMxN<2, 3> sceneToImagePartials(
             const Vector3& scenePoint,
             const types::RowCol<double>& imageGridPoint,
-            double delta = 0.0001) const;
+            double delta) const;
 
     // Same as above but computes image grid point via sceneToImage()
+    math::linear::MatrixMxN<2, 3> sceneToImagePartials(
+            const Vector3& scenePoint) const;
     math::linear::MatrixMxN<2, 3> sceneToImagePartials(
             const Vector3& scenePoint,
-            double delta = 0.0001) const;
+            double delta) const;
 
     /*!
      * Provides sensor error covariance matrix with tropo and iono errors
@@ -348,6 +489,65 @@ protected:
             double earthInitialSpin,
             const types::RowCol<double>& imageGridPoint) const;
 
+    //! Partials of timeCOA w.r.t. the image grid point (row and col)
+    types::RowCol<double> computeImageTimePartials(
+            const types::RowCol<double>& imageGridPoint) const;
+
+    //! ARP acceleration at the given time
+    Vector3 computeARPAcceleration(double time) const;
+
+    /*
+     * Partials of the two contour equations
+     *    |ARP - P| - R = 0
+     *    VARP . (ARP - P) / |ARP - P| - Rdot = 0
+     * w.r.t. the scene point P, the image grid point and the adjustable
+     * parameters, evaluated at a scene point on the contour.  These are the
+     * building blocks for the analytic partials.
+     */
+    void computeContourEquationPartials(
+            const types::RowCol<double>& imageGridPoint,
+            const Vector3& scenePoint,
+            math::linear::MatrixMxN<2, 3>& scenePartials,
+            math::linear::MatrixMxN<2, 2>& imagePartials,
+            math::linear::MatrixMxN<2, 7>& sensorPartials) const;
+
+    /*
+     * Inverse of the Jacobian of the contour and constant height equations
+     * w.r.t. the scene point, for the imageToScene() partials
+     */
+    math::linear::MatrixMxN<3, 3> getInverseSceneJacobian(
+            const Vector3& scenePoint,
+            const math::linear::MatrixMxN<2, 3>& scenePartials) const;
+
+    /*
+     * Steps 2-7 of imageToScene() onto a constant height surface: projects
+     * the (already adjusted) contour onto the surface, starting from the
+     * given ground plane.  The closer the plane is to the answer, the fewer
+     * iterations this takes.
+     */
+    Vector3 contourToConstantHeight(double r,
+                                    double rDot,
+                                    const Vector3& arpCOA,
+                                    const Vector3& velCOA,
+                                    double height,
+                                    Vector3 groundRefPoint,
+                                    Vector3 groundPlaneNormal,
+                                    double heightThreshold,
+                                    size_t maxNumIters,
+                                    LatLonAlt* oLatLonAlt = nullptr) const;
+
+    /*
+     * imageToScene() onto terrain, with the (already validated) height
+     * threshold.  Returns false rather than throwing if the terrain
+     * crossing can't be found.
+     */
+    bool contourToTerrain(const types::RowCol<double>& imageGridPoint,
+                          const ElevationSource& elevation,
+                          const AdjustableParams& delta,
+                          double heightThreshold,
+                          size_t maxNumIters,
+                          Vector3& scenePoint) const;
+
     void imageToSceneAdjustment(const AdjustableParams& delta,
                                 double timeCOA,
                                 double& r,
@@ -413,6 +613,9 @@ public:
                                 double* r,
                                 double* rDot) const;
 
+    virtual math::linear::MatrixMxN<2, 2>
+    computeContourPartials(const types::RowCol<double>& imageGridPoint) const;
+
 private:
     math::poly::OneD<double> mPolarAnglePoly;
     math::poly::OneD<double> mPolarAnglePolyPrime;
@@ -442,6 +645,9 @@ public:
                                 double* r,
                                 double* rDot) const;
 
+    virtual math::linear::MatrixMxN<2, 2>
+    computeContourPartials(const types::RowCol<double>& imageGridPoint) const;
+
 private:
     math::poly::OneD<double> mTimeCAPoly;
     math::poly::TwoD<double> mDSRFPoly;
@@ -466,6 +672,9 @@ public:
                                 const types::RowCol<double>& imageGridPoint,
                                 double* r,
                                 double* rDot) const;
+
+    virtual math::linear::MatrixMxN<2, 2>
+    computeContourPartials(const types::RowCol<double>& imageGridPoint) const;
 };
 
 typedef PlaneProjectionModel XRGYCRProjectionModel;
@@ -491,6 +700,9 @@ public:
                                 double* r,
                                 double* rDot) const;
 
+    virtual math::linear::MatrixMxN<2, 2>
+    computeContourPartials(const types::RowCol<double>& imageGridPoint) const;
+
     virtual Vector3 imageGridToECEF(const types::RowCol<double> gridPt) const;
 
 };
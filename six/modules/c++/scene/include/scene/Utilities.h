@@ -41,6 +41,7 @@ struct Utilities
      */
     static Vector3 latLonToECEF(LatLonAlt latLon);
     static Vector3 latLonToECEF(LatLon latLon);
+    static void latLonToECEF(std::span<const LatLonAlt> latLons, std::span<Vector3> ecef);
 
     /*!
      *  Convert a vector representing an ECEF coordinate
@@ -52,6 +53,7 @@ struct Utilities
      */
     static LatLonAlt ecefToLatLon(Vector3 vec);
     static LatLonAlt ecefToLatLon(const GeographicGridECEFTransform&, size_t row, size_t col);
+    static void ecefToLatLon(std::span<const Vector3> vecs, std::span<LatLonAlt> latLons);
 
     /*!
      *  Remaps angles into [0:360]
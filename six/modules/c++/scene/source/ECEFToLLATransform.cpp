@@ -20,6 +20,9 @@
  *
  */
 #include "scene/ECEFToLLATransform.h"
+
+#include <string>
+
 #include <math/Utilities.h>
 
 scene::ECEFToLLATransform::ECEFToLLATransform(const EllipsoidModel *initVals)
@@ -69,6 +72,57 @@ scene::ECEFToLLATransform::transform(const Vector3& ecef) const
    return lla;
 }
 
+void scene::ECEFToLLATransform::transform(std::span<const Vector3> ecef,
+                                          std::span<LatLonAlt> lla) const
+{
+    if (ecef.size() != lla.size())
+    {
+        throw except::Exception(Ctxt("Have " + std::to_string(ecef.size()) +
+                                     " ECEF points but room for " +
+                                     std::to_string(lla.size()) + " LLAs"));
+    }
+
+    const double a = model->getEquatorialRadius();
+    const double f = model->calculateFlattening();
+    const double e2 = f * (2.0 - f);
+    const double e4 = e2 * e2;
+    const double invA2 = 1.0 / math::square(a);
+    const double qScale = (1.0 - e2) * invA2;
+
+    // The closed form breaks down inside the evolute of the ellipse, which
+    // lies within a * e^2 / (1 - e^2) (about 43 km) of the centre.
+    const double minRadiusSquared = math::square(a * e2 / (1.0 - e2));
+
+    for (size_t ii = 0; ii < ecef.size(); ++ii)
+    {
+        const double x = ecef[ii][0];
+        const double y = ecef[ii][1];
+        const double z = ecef[ii][2];
+        const double w2 = x * x + y * y;
+        if (w2 + z * z <= minRadiusSquared)
+        {
+            lla[ii] = transform(ecef[ii]);
+            continue;
+        }
+
+        const double p = w2 * invA2;
+        const double q = qScale * z * z;
+        const double r = (p + q - e4) / 6.0;
+        const double s = e4 * p * q / (4.0 * r * r * r);
+        const double t = std::cbrt(1.0 + s + std::sqrt(s * (2.0 + s)));
+        const double u = r * (1.0 + t + 1.0 / t);
+        const double v = std::sqrt(u * u + e4 * q);
+        const double w = e2 * (u + v - q) / (2.0 * v);
+        const double k = std::sqrt(u + v + w * w) - w;
+        const double d = k * std::sqrt(w2) / (k + e2);
+        const double distance = std::sqrt(d * d + z * z);
+
+        lla[ii].setLatRadians(2.0 * std::atan2(z, d + distance));
+        lla[ii].setLonRadians(std::atan2(y, x));
+        lla[ii].setAlt((k + e2 - 1.0) / k * distance);
+    }
+}
+
 double scene::ECEFToLLATransform::computeLongitude(const Vector3& ecef)
 {
     double longitude = 0;
@@ -0,0 +1,62 @@
+/* =========================================================================
+ * This file is part of scene-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * scene-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <scene/ElevationSource.h>
+
+#include <limits>
+#include <string>
+
+#include <except/Exception.h>
+
+namespace scene
+{
+ElevationSource::~ElevationSource()
+{
+}
+
+double ElevationSource::findHeight(const LatLon& latLon) const
+{
+    try
+    {
+        return getHeight(latLon);
+    }
+    catch (const except::Exception&)
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+}
+
+void ElevationSource::getHeights(std::span<const LatLon> latLons,
+                                 std::span<double> heights) const
+{
+    if (heights.size() != latLons.size())
+    {
+        throw except::Exception(Ctxt(
+                "Expected " + std::to_string(latLons.size()) +
+                " heights but got " + std::to_string(heights.size())));
+    }
+
+    for (size_t ii = 0; ii < latLons.size(); ++ii)
+    {
+        heights[ii] = getHeight(latLons[ii]);
+    }
+}
+}
@@ -0,0 +1,553 @@
+/* =========================================================================
+ * This file is part of scene-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * scene-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <scene/GridElevationSource.h>
+
+#include <string.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <except/Exception.h>
+#include <math/Constants.h>
+#include <str/Manip.h>
+#include <tiff/TiffFileReader.h>
+#include <tiff/GenericType.h>
+#include <scene/EllipsoidModel.h>
+
+namespace
+{
+double getValue(const tiff::IFDEntry& entry, size_t index)
+{
+    const std::vector<tiff::TypeInterface*>& values = entry.getValues();
+    if (index >= values.size())
+    {
+        throw except::Exception(Ctxt(
+                "TIFF tag " + entry.getName() + " has only " +
+                std::to_string(values.size()) + " values"));
+    }
+
+    // Matches what tiff::TypeFactory creates for each type
+    const tiff::TypeInterface* const value = values[index];
+    switch (entry.getType())
+    {
+    case tiff::Const::Type::BYTE:
+    case tiff::Const::Type::UNDEFINED:
+        return *static_cast<const tiff::GenericType<unsigned char>*>(value);
+    case tiff::Const::Type::SHORT:
+        return *static_cast<const tiff::GenericType<unsigned short>*>(value);
+    case tiff::Const::Type::SSHORT:
+        return *static_cast<const tiff::GenericType<short>*>(value);
+    case tiff::Const::Type::LONG:
+    case tiff::Const::Type::SLONG:
+        return *static_cast<const tiff::GenericType<sys::Uint32_T>*>(value);
+    case tiff::Const::Type::FLOAT:
+        return *static_cast<const tiff::GenericType<float>*>(value);
+    case tiff::Const::Type::DOUBLE:
+        return *static_cast<const tiff::GenericType<double>*>(value);
+    default:
+        throw except::Exception(Ctxt(
+                "TIFF tag " + entry.getName() + " is not numeric"));
+    }
+}
+
+const tiff::IFDEntry& getEntry(const tiff::IFD& ifd, const char* name)
+{
+    const tiff::IFDEntry* const entry = ifd[name];
+    if (entry == nullptr)
+    {
+        throw except::Exception(Ctxt(
+                std::string("GeoTIFF is missing the ") + name + " tag"));
+    }
+    return *entry;
+}
+
+double getValue(const tiff::IFD& ifd, const char* name, double defaultValue)
+{
+    const tiff::IFDEntry* const entry = ifd[name];
+    return entry ? getValue(*entry, 0) : defaultValue;
+}
+
+// GeoKey IDs and values from the GeoTIFF spec
+const size_t GT_MODEL_TYPE_GEO_KEY = 1024;
+const size_t GT_RASTER_TYPE_GEO_KEY = 1025;
+const size_t MODEL_TYPE_GEOGRAPHIC = 2;
+const size_t RASTER_PIXEL_IS_POINT = 2;
+
+size_t getGeoKey(const tiff::IFD& ifd, size_t key, size_t defaultValue)
+{
+    const tiff::IFDEntry* const entry = ifd["GeoKeyDirectoryTag"];
+    if (entry == nullptr)
+    {
+        return defaultValue;
+    }
+
+    // Header is (version, revision, minor revision, number of keys)
+    // followed by (key ID, tag location, count, value) for each key.  Keys
+    // with a tag location of 0 store their value inline.
+    const size_t numKeys = static_cast<size_t>(getValue(*entry, 3));
+    for (size_t ii = 0; ii < numKeys; ++ii)
+    {
+        const size_t offset = 4 * (ii + 1);
+        if (static_cast<size_t>(getValue(*entry, offset)) == key &&
+            getValue(*entry, offset + 1) == 0)
+        {
+            return static_cast<size_t>(getValue(*entry, offset + 3));
+        }
+    }
+    return defaultValue;
+}
+
+bool isVoid(double value, double noDataValue)
+{
+    return std::isnan(value) || value == noDataValue;
+}
+}
+
+namespace scene
+{
+const size_t GridElevationSource::DEFAULT_TILE_SIZE;
+const size_t GridElevationSource::DEFAULT_CACHE_BYTES;
+constexpr double GridElevationSource::MIN_TERRAIN_HEIGHT;
+constexpr double GridElevationSource::MAX_TERRAIN_HEIGHT;
+
+GridElevationSource::GridElevationSource(const std::string& pathname,
+                                         const GridInfo& info,
+                                         size_t maxCacheBytes,
+                                         size_t tileSize) :
+    mInfo(info),
+    mRowOffsets(info.numRows),
+    mTileSize(tileSize),
+    mFile(pathname)
+{
+    for (size_t row = 0; row < mRowOffsets.size(); ++row)
+    {
+        mRowOffsets[row] = mInfo.headerBytes + static_cast<sys::Off_T>(
+                row * mInfo.numCols * getElementSize(mInfo.sampleType));
+    }
+
+    initialize(maxCacheBytes);
+}
+
+GridElevationSource::GridElevationSource(
+        const std::string& pathname,
+        const GridInfo& info,
+        const std::vector<sys::Off_T>& rowOffsets,
+        size_t maxCacheBytes,
+        size_t tileSize) :
+    mInfo(info),
+    mRowOffsets(rowOffsets),
+    mTileSize(tileSize),
+    mFile(pathname)
+{
+    initialize(maxCacheBytes);
+}
+
+std::unique_ptr<GridElevationSource>
+GridElevationSource::fromGeoTIFF(const std::string& pathname,
+                                 size_t maxCacheBytes,
+                                 size_t tileSize)
+{
+    tiff::FileReader reader(pathname);
+    if (reader.getImageCount() == 0)
+    {
+        throw except::Exception(Ctxt(pathname + " has no images"));
+    }
+    const tiff::IFD& ifd = *reader[0]->getIFD();
+
+    GridInfo info;
+    info.numRows = ifd.getImageLength();
+    info.numCols = ifd.getImageWidth();
+
+    if (getValue(ifd, "Compression", 1) != 1)
+    {
+        throw except::Exception(Ctxt("Compressed GeoTIFFs are not supported"));
+    }
+    if (getValue(ifd, "SamplesPerPixel", 1) != 1)
+    {
+        throw except::Exception(Ctxt("GeoTIFF must have a single band"));
+    }
+
+    const double bitsPerSample = getValue(ifd, "BitsPerSample", 1);
+    const double sampleFormat = getValue(
+            ifd, "SampleFormat", tiff::Const::SampleFormatType::UNSIGNED_INT);
+    if (sampleFormat == tiff::Const::SampleFormatType::SIGNED_INT &&
+        bitsPerSample == 16)
+    {
+        info.sampleType = SampleType::INT16;
+    }
+    else if (sampleFormat == tiff::Const::SampleFormatType::IEEE_FLOAT &&
+             bitsPerSample == 32)
+    {
+        info.sampleType = SampleType::FLOAT32;
+    }
+    else if (sampleFormat == tiff::Const::SampleFormatType::IEEE_FLOAT &&
+             bitsPerSample == 64)
+    {
+        info.sampleType = SampleType::FLOAT64;
+    }
+    else
+    {
+        throw except::Exception(Ctxt(
+                "GeoTIFF posts must be 16-bit integers or 32/64-bit floats"));
+    }
+
+    if (ifd["TileOffsets"] != nullptr)
+    {
+        throw except::Exception(Ctxt("Tiled GeoTIFFs are not supported"));
+    }
+
+    // Rows are contiguous within a strip
+    const tiff::IFDEntry& stripOffsets = getEntry(ifd, "StripOffsets");
+    const size_t rowsPerStrip = static_cast<size_t>(
+            getValue(ifd, "RowsPerStrip", static_cast<double>(info.numRows)));
+    if (rowsPerStrip == 0)
+    {
+        throw except::Exception(Ctxt("GeoTIFF has no rows per strip"));
+    }
+
+    const size_t elementSize = getElementSize(info.sampleType);
+    std::vector<sys::Off_T> rowOffsets(info.numRows);
+    for (size_t row = 0; row < info.numRows; ++row)
+    {
+        rowOffsets[row] = static_cast<sys::Off_T>(
+                getValue(stripOffsets, row / rowsPerStrip) +
+                (row % rowsPerStrip) * info.numCols * elementSize);
+    }
+
+    // The TIFF header starts with "II" (little endian) or "MM" (big endian)
+    char byteOrder[2];
+    sys::File(pathname).readInto(byteOrder, sizeof(byteOrder));
+    info.bigEndian = (byteOrder[0] == 'M');
+
+    if (getGeoKey(ifd, GT_MODEL_TYPE_GEO_KEY, MODEL_TYPE_GEOGRAPHIC) !=
+        MODEL_TYPE_GEOGRAPHIC)
+    {
+        throw except::Exception(Ctxt(
+                "Only geographic (lat/lon) GeoTIFFs are supported"));
+    }
+
+    // Tiepoint is (I, J, K, X, Y, Z) tying raster (I, J) to lon/lat (X, Y)
+    const tiff::IFDEntry& scale = getEntry(ifd, "ModelPixelScaleTag");
+    const tiff::IFDEntry& tiepoint = getEntry(ifd, "ModelTiepointTag");
+    const double scaleX = getValue(scale, 0);
+    const double scaleY = getValue(scale, 1);
+    const double tieI = getValue(tiepoint, 0);
+    const double tieJ = getValue(tiepoint, 1);
+    const double tieX = getValue(tiepoint, 3);
+    const double tieY = getValue(tiepoint, 4);
+
+    // For PixelIsArea rasters, raster coordinates refer to the pixel's
+    // corner, so the post sits half a pixel in
+    const double postOffset = getGeoKey(ifd, GT_RASTER_TYPE_GEO_KEY, 1) ==
+            RASTER_PIXEL_IS_POINT ? 0.0 : 0.5;
+    info.origin = LatLon(tieY - (postOffset - tieJ) * scaleY,
+                         tieX + (postOffset - tieI) * scaleX);
+    info.spacing = LatLon(-scaleY, scaleX);
+
+    const tiff::IFDEntry* const minSample = ifd["SMinSampleValue"];
+    const tiff::IFDEntry* const maxSample = ifd["SMaxSampleValue"];
+    if (minSample != nullptr && maxSample != nullptr)
+    {
+        info.minHeight = getValue(*minSample, 0);
+        info.maxHeight = getValue(*maxSample, 0);
+    }
+
+    return std::unique_ptr<GridElevationSource>(new GridElevationSource(
+            pathname, info, rowOffsets, maxCacheBytes, tileSize));
+}
+
+void GridElevationSource::initialize(size_t maxCacheBytes)
+{
+    if (mInfo.numRows < 2 || mInfo.numCols < 2)
+    {
+        throw except::Exception(Ctxt(
+                "Elevation grid must be at least 2x2 posts"));
+    }
+    if (mInfo.spacing.getLat() == 0 || mInfo.spacing.getLon() == 0)
+    {
+        throw except::Exception(Ctxt("Elevation post spacing must be nonzero"));
+    }
+    if (mTileSize == 0)
+    {
+        throw except::Exception(Ctxt("Tile size must be positive"));
+    }
+
+    mNumTileCols = (mInfo.numCols + mTileSize - 1) / mTileSize;
+    mMaxNumTiles = std::max<size_t>(
+            maxCacheBytes / (mTileSize * mTileSize * sizeof(double)), 1);
+    mNumTileReads = 0;
+
+    // The range only has to bracket the terrain for imageToScene(), so it
+    // isn't worth reading the whole file to tighten it
+    const bool hasMinHeight = !std::isnan(mInfo.minHeight);
+    const bool hasMaxHeight = !std::isnan(mInfo.maxHeight);
+    if (hasMinHeight != hasMaxHeight)
+    {
+        throw except::Exception(Ctxt(
+                "Elevation grid needs both a minimum and maximum height"));
+    }
+    mMinHeight = hasMinHeight ? mInfo.minHeight : MIN_TERRAIN_HEIGHT;
+    mMaxHeight = hasMaxHeight ? mInfo.maxHeight : MAX_TERRAIN_HEIGHT;
+    if (mMinHeight > mMaxHeight)
+    {
+        throw except::Exception(Ctxt(
+                "Elevation grid minimum height is above its maximum height"));
+    }
+
+    const double metersPerDegree =
+            WGS84EllipsoidModel::EQUATORIAL_RADIUS_METERS *
+            math::Constants::DEGREES_TO_RADIANS;
+    const double centerLat = mInfo.origin.getLat() +
+            mInfo.spacing.getLat() * (mInfo.numRows - 1) / 2.0;
+    const double latSpacing = std::abs(mInfo.spacing.getLat()) *
+            metersPerDegree;
+    const double lonSpacing = std::abs(mInfo.spacing.getLon()) *
+            metersPerDegree *
+            std::cos(centerLat * math::Constants::DEGREES_TO_RADIANS);
+    mPostSpacing = lonSpacing > 0 ? std::min(latSpacing, lonSpacing) :
+            latSpacing;
+}
+
+size_t GridElevationSource::getElementSize(SampleType sampleType)
+{
+    switch (sampleType)
+    {
+    case SampleType::INT16:
+        return 2;
+    case SampleType::FLOAT32:
+        return 4;
+    case SampleType::FLOAT64:
+        return 8;
+    }
+    throw except::Exception(Ctxt("Invalid sample type"));
+}
+
+void GridElevationSource::readPosts(size_t row, size_t col, size_t numPosts,
+                                    double* posts) const
+{
+    const size_t elementSize = getElementSize(mInfo.sampleType);
+    std::vector<sys::byte> buffer(numPosts * elementSize);
+    mFile.seekTo(mRowOffsets[row] + static_cast<sys::Off_T>(col * elementSize),
+                 sys::File::FROM_START);
+    mFile.readInto(buffer.data(), buffer.size());
+
+    if (mInfo.bigEndian != sys::isBigEndianSystem())
+    {
+        sys::byteSwap(buffer.data(), static_cast<unsigned short>(elementSize),
+                      numPosts);
+    }
+
+    for (size_t ii = 0; ii < numPosts; ++ii)
+    {
+        const sys::byte* const element = &buffer[ii * elementSize];
+        double post = 0.0;
+        switch (mInfo.sampleType)
+        {
+        case SampleType::INT16:
+        {
+            int16_t value;
+            memcpy(&value, element, sizeof(value));
+            post = value;
+            break;
+        }
+        case SampleType::FLOAT32:
+        {
+            float value;
+            memcpy(&value, element, sizeof(value));
+            post = value;
+            break;
+        }
+        case SampleType::FLOAT64:
+            memcpy(&post, element, sizeof(post));
+            break;
+        }
+
+        posts[ii] = isVoid(post, mInfo.noDataValue) ?
+                std::numeric_limits<double>::quiet_NaN() : post;
+    }
+}
+
+std::shared_ptr<const GridElevationSource::Tile>
+GridElevationSource::getTile(size_t tileIndex) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    auto iter = mTiles.find(tileIndex);
+    if (iter != mTiles.end())
+    {
+        mLRU.splice(mLRU.begin(), mLRU, iter->second.second);
+        return iter->second.first;
+    }
+
+    // Tiles are always mTileSize x mTileSize; the parts of edge tiles that
+    // hang off the grid are never looked at
+    const size_t firstRow = (tileIndex / mNumTileCols) * mTileSize;
+    const size_t firstCol = (tileIndex % mNumTileCols) * mTileSize;
+    const size_t numRows = std::min(mTileSize, mInfo.numRows - firstRow);
+    const size_t numCols = std::min(mTileSize, mInfo.numCols - firstCol);
+    std::shared_ptr<Tile> tile(new Tile(mTileSize * mTileSize));
+    for (size_t row = 0; row < numRows; ++row)
+    {
+        readPosts(firstRow + row, firstCol, numCols,
+                  tile->data() + row * mTileSize);
+    }
+    ++mNumTileReads;
+
+    if (mTiles.size() >= mMaxNumTiles)
+    {
+        mTiles.erase(mLRU.back());
+        mLRU.pop_back();
+    }
+    mLRU.push_front(tileIndex);
+    mTiles[tileIndex] = std::make_pair(tile, mLRU.begin());
+    return tile;
+}
+
+bool GridElevationSource::getGridPosition(const LatLon& latLon,
+                                          double& row, double& col) const
+{
+    row = (latLon.getLat() - mInfo.origin.getLat()) / mInfo.spacing.getLat();
+    col = (latLon.getLon() - mInfo.origin.getLon()) / mInfo.spacing.getLon();
+
+    // Allow for roundoff right at the edges of the grid
+    const double tolerance = 1e-9;
+    return row >= -tolerance && row <= mInfo.numRows - 1 + tolerance &&
+            col >= -tolerance && col <= mInfo.numCols - 1 + tolerance;
+}
+
+double GridElevationSource::interpolate(
+        const LatLon& latLon,
+        std::shared_ptr<const Tile>& lastTile,
+        size_t& lastTileIndex) const
+{
+    double row, col;
+    if (!getGridPosition(latLon, row, col))
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    const size_t row0 = std::min(static_cast<size_t>(std::max(row, 0.0)),
+                                 mInfo.numRows - 2);
+    const size_t col0 = std::min(static_cast<size_t>(std::max(col, 0.0)),
+                                 mInfo.numCols - 2);
+    const double rowFrac = std::min(std::max(row - row0, 0.0), 1.0);
+    const double colFrac = std::min(std::max(col - col0, 0.0), 1.0);
+
+    // Voids are left out and the remaining weights renormalized
+    double sum = 0.0;
+    double sumWeights = 0.0;
+    for (size_t ii = 0; ii < 2; ++ii)
+    {
+        for (size_t jj = 0; jj < 2; ++jj)
+        {
+            const size_t postRow = row0 + ii;
+            const size_t postCol = col0 + jj;
+            const size_t tileIndex = (postRow / mTileSize) * mNumTileCols +
+                    postCol / mTileSize;
+            if (!lastTile || tileIndex != lastTileIndex)
+            {
+                lastTile = getTile(tileIndex);
+                lastTileIndex = tileIndex;
+            }
+
+            const double post = (*lastTile)[(postRow % mTileSize) * mTileSize +
+                                            postCol % mTileSize];
+            const double weight = (ii ? rowFrac : 1.0 - rowFrac) *
+                    (jj ? colFrac : 1.0 - colFrac);
+            if (!std::isnan(post) && weight > 0)
+            {
+                sum += weight * post;
+                sumWeights += weight;
+            }
+        }
+    }
+
+    return sumWeights > 0 ? sum / sumWeights :
+            std::numeric_limits<double>::quiet_NaN();
+}
+
+void GridElevationSource::throwNoHeight(const LatLon& latLon) const
+{
+    const std::string position = "(" + str::toString(latLon.getLat()) +
+            ", " + str::toString(latLon.getLon()) + ")";
+    double row, col;
+    if (!getGridPosition(latLon, row, col))
+    {
+        throw except::Exception(Ctxt(
+                "Position " + position + " is outside of the elevation grid"));
+    }
+    throw except::Exception(Ctxt("No elevation data at " + position));
+}
+
+double GridElevationSource::getHeight(const LatLon& latLon) const
+{
+    const double height = findHeight(latLon);
+    if (std::isnan(height))
+    {
+        throwNoHeight(latLon);
+    }
+    return height;
+}
+
+double GridElevationSource::findHeight(const LatLon& latLon) const
+{
+    std::shared_ptr<const Tile> lastTile;
+    size_t lastTileIndex = 0;
+    return interpolate(latLon, lastTile, lastTileIndex);
+}
+
+void GridElevationSource::getHeights(std::span<const LatLon> latLons,
+                                     std::span<double> heights) const
+{
+    if (heights.size() != latLons.size())
+    {
+        throw except::Exception(Ctxt(
+                "Expected " + std::to_string(latLons.size()) +
+                " heights but got " + std::to_string(heights.size())));
+    }
+
+    // Nearby points usually share a tile, so hang onto the last one rather
+    // than going through the (locked) cache every time
+    std::shared_ptr<const Tile> lastTile;
+    size_t lastTileIndex = 0;
+    for (size_t ii = 0; ii < latLons.size(); ++ii)
+    {
+        heights[ii] = interpolate(latLons[ii], lastTile, lastTileIndex);
+        if (std::isnan(heights[ii]))
+        {
+            throwNoHeight(latLons[ii]);
+        }
+    }
+}
+
+size_t GridElevationSource::getNumCachedTiles() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mTiles.size();
+}
+
+size_t GridElevationSource::getNumTileReads() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mNumTileReads;
+}
+}
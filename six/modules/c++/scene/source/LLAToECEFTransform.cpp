@@ -20,6 +20,9 @@
  *
  */
 #include "scene/LLAToECEFTransform.h"
+
+#include <string>
+
 #include <math/Utilities.h>
 
 scene::LLAToECEFTransform::LLAToECEFTransform(const EllipsoidModel *initVals)
@@ -75,6 +78,43 @@ scene::Vector3 scene::LLAToECEFTransform::transform(const LatLonAlt& lla) const
     return ecef;
 }
 
+void scene::LLAToECEFTransform::transform(std::span<const LatLonAlt> lla,
+                                          std::span<Vector3> ecef) const
+{
+    if (lla.size() != ecef.size())
+    {
+        throw except::Exception(Ctxt("Have " + std::to_string(lla.size()) +
+                                     " LLAs but room for " +
+                                     std::to_string(ecef.size()) + " ECEF points"));
+    }
+
+    const double a = model->getEquatorialRadius();
+    const double f = model->calculateFlattening();
+    const double e2 = f * (2.0 - f);
+
+    for (size_t ii = 0; ii < lla.size(); ++ii)
+    {
+        const double lat = lla[ii].getLatRadians();
+        const double lon = lla[ii].getLonRadians();
+        if (std::abs(lat) > M_PI / 2 || std::abs(lon) > M_PI)
+        {
+            ecef[ii] = transform(lla[ii]); // throws
+        }
+
+        double sinlat, coslat;
+        math::SinCos(lat, sinlat, coslat);
+        double sinlon, coslon;
+        math::SinCos(lon, sinlon, coslon);
+
+        // prime vertical radius of curvature
+        const double n = a / std::sqrt(1.0 - e2 * sinlat * sinlat);
+        const double alt = lla[ii].getAlt();
+        ecef[ii][0] = (n + alt) * coslat * coslon;
+        ecef[ii][1] = (n + alt) * coslat * sinlon;
+        ecef[ii][2] = (n * (1.0 - e2) + alt) * sinlat;
+    }
+}
+
 double scene::LLAToECEFTransform::computeRadius(const LatLonAlt& lla) const
 {
     const double f = model->calculateFlattening();
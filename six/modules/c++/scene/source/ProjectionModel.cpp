@@ -22,10 +22,17 @@
 #include "scene/ProjectionModel.h"
 
 #include <assert.h>
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <string>
+#include <thread>
 
+#include <mt/Runnable1D.h>
+
+#include <math/Constants.h>
 #include <math/Utilities.h>
+#include <str/Manip.h>
 #include "scene/ECEFToLLATransform.h"
 #include "scene/Utilities.h"
 
@@ -67,6 +74,99 @@ PolyType verboseDerivative(const PolyType& polynomial, const std::string& name)
     }
     return polynomial.derivative();
 }
+
+size_t getNumThreads(size_t numThreads)
+{
+    return (numThreads == 0) ? std::thread::hardware_concurrency() :
+            numThreads;
+}
+
+// Derivative of v / |v| given the derivative of v
+scene::Vector3 unitVectorDerivative(const scene::Vector3& v,
+                                    const scene::Vector3& dv)
+{
+    const double norm = v.norm();
+    const scene::Vector3 unit = v / norm;
+    return (dv - unit * unit.dot(dv)) / norm;
+}
+
+// Time derivative of ProjectionModel::getRICtoECEFTransformMatrix(0.0, ...)
+math::linear::MatrixMxN<3, 3> getRICtoECEFTransformDerivative(
+        const scene::Vector3& rARP,
+        const scene::Vector3& vARP,
+        const scene::Vector3& aARP)
+{
+    scene::Vector3 radial = rARP;
+    radial.normalize();
+    const scene::Vector3 dRadial = unitVectorDerivative(rARP, vARP);
+
+    const scene::Vector3 normal = math::linear::cross(rARP, vARP);
+    scene::Vector3 crossTrack = normal;
+    crossTrack.normalize();
+    const scene::Vector3 dCrossTrack =
+            unitVectorDerivative(normal, math::linear::cross(rARP, aARP));
+
+    const scene::Vector3 dInTrack =
+            math::linear::cross(dCrossTrack, radial) +
+            math::linear::cross(crossTrack, dRadial);
+
+    math::linear::MatrixMxN<3, 3> derivative;
+    derivative.col(0, dRadial.matrix());
+    derivative.col(1, dInTrack.matrix());
+    derivative.col(2, dCrossTrack.matrix());
+    return derivative;
+}
+
+// Slant plane range, azimuth and normal unit vectors at the ARP
+void computeSlantPlaneVectors(const scene::Vector3& rARP,
+                              const scene::Vector3& vARP,
+                              const scene::Vector3& scp,
+                              int lookDir,
+                              scene::Vector3& slantRange,
+                              scene::Vector3& slantAzimuth,
+                              scene::Vector3& slantNormal)
+{
+    slantRange = scp - rARP;
+    slantRange.normalize();
+    slantNormal = math::linear::cross(vARP, slantRange) * lookDir;
+    slantNormal.normalize();
+    slantAzimuth = math::linear::cross(slantNormal, slantRange);
+    slantAzimuth.normalize();
+}
+
+/*
+ * Partials of R = |ARP - G| and Rdot = VARP . (ARP - G) / R w.r.t. row and
+ * col, for contours measured from the image grid point G itself.  The ARP
+ * moves with timeCOA; gridPartials are the partials of G.
+ */
+math::linear::MatrixMxN<2, 2> computePointContourPartials(
+        const scene::Vector3& arpCOA,
+        const scene::Vector3& velCOA,
+        const scene::Vector3& accCOA,
+        const scene::Vector3& gridPoint,
+        const types::RowCol<double>& timePartials,
+        const scene::Vector3& gridRowPartial,
+        const scene::Vector3& gridColPartial)
+{
+    const scene::Vector3 vec = arpCOA - gridPoint;
+    const double r = vec.norm();
+    const scene::Vector3 unit = vec / r;
+    const double rDot = velCOA.dot(unit);
+
+    const double dTime[] = { timePartials.row, timePartials.col };
+    const scene::Vector3* dGrid[] = { &gridRowPartial, &gridColPartial };
+
+    math::linear::MatrixMxN<2, 2> partials(0.0);
+    for (size_t ii = 0; ii < 2; ++ii)
+    {
+        const scene::Vector3 dVec = velCOA * dTime[ii] - *dGrid[ii];
+        const double dR = unit.dot(dVec);
+        partials(0, ii) = dR;
+        partials(1, ii) = accCOA.dot(unit) * dTime[ii] +
+                (velCOA.dot(dVec) - rDot * dR) / r;
+    }
+    return partials;
+}
 }
 
 namespace scene
@@ -280,9 +380,9 @@ Vector3 ProjectionModel::imageToScene(
     //    section 5.1 for details)
     const ECEFToLLATransform ecefToLatLon;
     const LatLonAlt scpLatLon = ecefToLatLon.transform(mSCP);
-    Vector3 groundPlaneNormal = computeUnitVector(scpLatLon);
+    const Vector3 groundPlaneNormal = computeUnitVector(scpLatLon);
 
-    Vector3 groundRefPoint =
+    const Vector3 groundRefPoint =
             mSCP + (height - scpLatLon.getAlt()) * groundPlaneNormal;
 
     // Compute contour just once
@@ -297,6 +397,24 @@ Vector3 ProjectionModel::imageToScene(
     // Adjustable parameters do not affect Rdot
     imageToSceneAdjustment(delta, timeCOA, r, arpCOA, velCOA);
 
+    return contourToConstantHeight(r, rDot, arpCOA, velCOA, height,
+                                   groundRefPoint, groundPlaneNormal,
+                                   heightThreshold, maxNumIters);
+}
+
+Vector3 ProjectionModel::contourToConstantHeight(
+        double r,
+        double rDot,
+        const Vector3& arpCOA,
+        const Vector3& velCOA,
+        double height,
+        Vector3 groundRefPoint,
+        Vector3 groundPlaneNormal,
+        double heightThreshold,
+        size_t maxNumIters,
+        LatLonAlt* oLatLonAlt) const
+{
+    const ECEFToLLATransform ecefToLatLon;
     Vector3 gppECEF{};
     Vector3 uUP{};
     double deltaHeight(std::numeric_limits<double>::max());
@@ -359,9 +477,260 @@ Vector3 ProjectionModel::imageToScene(
     // 7. Assign surface point SPP position by adjusting its height to be on
     //    the HAE surface
     const LatLonAlt SPP(SLP.getLat(), SLP.getLon(), height);
+    if (oLatLonAlt != nullptr)
+    {
+        *oLatLonAlt = SPP;
+    }
     return scene::Utilities::latLonToECEF(SPP);
 }
 
+void ProjectionModel::sceneToImage(
+        std::span<const Vector3> scenePoints,
+        std::span<types::RowCol<double> > imageGridPoints,
+        size_t numThreads) const
+{
+    if (imageGridPoints.size() != scenePoints.size())
+    {
+        throw except::Exception(Ctxt(
+                "Expected " + std::to_string(scenePoints.size()) +
+                " image points but got " +
+                std::to_string(imageGridPoints.size())));
+    }
+
+    mt::run1D(scenePoints.size(), getNumThreads(numThreads),
+              [&](size_t ii)
+              {
+                  imageGridPoints[ii] = sceneToImage(scenePoints[ii]);
+              });
+}
+
+void ProjectionModel::imageToScene(
+        std::span<const types::RowCol<double> > imageGridPoints,
+        std::span<const double> heights,
+        std::span<Vector3> scenePoints,
+        size_t numThreads) const
+{
+    if (heights.size() != imageGridPoints.size() ||
+        scenePoints.size() != imageGridPoints.size())
+    {
+        throw except::Exception(Ctxt(
+                "Expected " + std::to_string(imageGridPoints.size()) +
+                " heights and scene points but got " +
+                std::to_string(heights.size()) + " and " +
+                std::to_string(scenePoints.size())));
+    }
+
+    mt::run1D(imageGridPoints.size(), getNumThreads(numThreads),
+              [&](size_t ii)
+              {
+                  scenePoints[ii] = imageToScene(imageGridPoints[ii],
+                                                 heights[ii]);
+              });
+}
+
+Vector3 ProjectionModel::imageToScene(
+        const types::RowCol<double>& imageGridPoint,
+        const ElevationSource& elevation,
+        const AdjustableParams& delta,
+        double heightThreshold,
+        size_t maxNumIters) const
+{
+    if (heightThreshold <= 0)
+    {
+        throw except::Exception(Ctxt("Height threshold must be positive"));
+    }
+
+    Vector3 scenePoint;
+    if (!contourToTerrain(imageGridPoint, elevation, delta, heightThreshold,
+                          maxNumIters, scenePoint))
+    {
+        throw except::Exception(Ctxt(
+                "Image point (" + str::toString(imageGridPoint.row) + ", " +
+                str::toString(imageGridPoint.col) +
+                ") doesn't reach the terrain within the elevation source's "
+                "coverage"));
+    }
+    return scenePoint;
+}
+
+bool ProjectionModel::contourToTerrain(
+        const types::RowCol<double>& imageGridPoint,
+        const ElevationSource& elevation,
+        const AdjustableParams& delta,
+        double heightThreshold,
+        size_t maxNumIters,
+        Vector3& scenePoint) const
+{
+    const double timeCOA = mTimeCOAPoly(imageGridPoint.row,
+                                        imageGridPoint.col);
+    Vector3 arpCOA = mARPPoly(timeCOA);
+    Vector3 velCOA = mARPVelPoly(timeCOA);
+    double r{}, rDot{};
+    computeContour(arpCOA, velCOA, timeCOA, imageGridPoint, &r, &rDot);
+    imageToSceneAdjustment(delta, timeCOA, r, arpCOA, velCOA);
+
+    // Size the steps from how far the contour moves across the full height
+    // range
+    const ECEFToLLATransform ecefToLatLon;
+    const LatLonAlt scpLatLon = ecefToLatLon.transform(mSCP);
+    const Vector3 scpNormal = computeUnitVector(scpLatLon);
+    const size_t maxNumHeightIters = 3;
+    const double maxHeight = elevation.getMaxHeight();
+    const double minHeight = elevation.getMinHeight();
+    const Vector3 bottom = contourToConstantHeight(
+            r, rDot, arpCOA, velCOA, minHeight,
+            mSCP + (minHeight - scpLatLon.getAlt()) * scpNormal, scpNormal,
+            heightThreshold, maxNumHeightIters);
+
+    // Each constant height projection starts from the ground plane tangent
+    // to the previous one, which usually converges in a single iteration.
+    // Returns how far above the terrain the projection is, or NaN where the
+    // elevation source has no height.
+    LatLonAlt latLonAlt = scpLatLon;
+    scenePoint = mSCP;
+    auto project = [&](double height)
+    {
+        const Vector3 groundPlaneNormal = computeUnitVector(latLonAlt);
+        const Vector3 groundRefPoint = scenePoint +
+                (height - latLonAlt.getAlt()) * groundPlaneNormal;
+        scenePoint = contourToConstantHeight(r, rDot, arpCOA, velCOA, height,
+                                             groundRefPoint,
+                                             groundPlaneNormal,
+                                             heightThreshold,
+                                             maxNumHeightIters,
+                                             &latLonAlt);
+        return height - elevation.findHeight(
+                LatLon(latLonAlt.getLat(), latLonAlt.getLon()));
+    };
+
+    double upperHeight = maxHeight;
+    double upperOffset = project(upperHeight);
+    if (upperOffset <= heightThreshold)
+    {
+        return true;
+    }
+
+    const double maxNumSteps = 10000;
+    const double numSteps = std::min(std::max(std::ceil(
+            (scenePoint - bottom).norm() / elevation.getPostSpacing()), 1.0),
+            maxNumSteps);
+    const double stepSize = (maxHeight - minHeight) / numSteps;
+
+    // March down until we're at or under the terrain.  Steps with no
+    // terrain under them (off the source's coverage, or in a void) are
+    // skipped, so the crossing is bracketed by the nearest steps that do
+    // have terrain.
+    bool haveUpper = !std::isnan(upperOffset);
+    double lowerHeight = upperHeight;
+    double lowerOffset = upperOffset;
+    for (size_t step = 1; step <= numSteps; ++step)
+    {
+        lowerHeight = step == numSteps ? minHeight : maxHeight - step * stepSize;
+        lowerOffset = project(lowerHeight);
+        if (std::isnan(lowerOffset))
+        {
+            continue;
+        }
+        if (lowerOffset <= 0)
+        {
+            break;
+        }
+        if (lowerOffset <= heightThreshold)
+        {
+            return true;
+        }
+        upperHeight = lowerHeight;
+        upperOffset = lowerOffset;
+        haveUpper = true;
+    }
+    if (std::isnan(lowerOffset))
+    {
+        return false;
+    }
+    if (lowerOffset > 0 || -lowerOffset <= heightThreshold)
+    {
+        return true;
+    }
+    if (!haveUpper)
+    {
+        // Already under the terrain the first time there was any, so the
+        // crossing is somewhere without heights
+        return false;
+    }
+
+    // Illinois flavor of regula falsi: halve the weight of an endpoint that
+    // sticks so convergence stays superlinear
+    int lastSide = 0;
+    for (size_t iter = 0; iter < maxNumIters; ++iter)
+    {
+        const double height = (upperHeight * lowerOffset -
+                               lowerHeight * upperOffset) /
+                (lowerOffset - upperOffset);
+        const double offset = project(height);
+        if (std::isnan(offset))
+        {
+            return false;
+        }
+        if (std::abs(offset) <= heightThreshold)
+        {
+            break;
+        }
+
+        if (offset > 0)
+        {
+            upperHeight = height;
+            upperOffset = offset;
+            if (lastSide > 0)
+            {
+                lowerOffset /= 2;
+            }
+            lastSide = 1;
+        }
+        else
+        {
+            lowerHeight = height;
+            lowerOffset = offset;
+            if (lastSide < 0)
+            {
+                upperOffset /= 2;
+            }
+            lastSide = -1;
+        }
+    }
+
+    return true;
+}
+
+void ProjectionModel::imageToScene(
+        std::span<const types::RowCol<double> > imageGridPoints,
+        const ElevationSource& elevation,
+        std::span<Vector3> scenePoints,
+        size_t numThreads) const
+{
+    if (scenePoints.size() != imageGridPoints.size())
+    {
+        throw except::Exception(Ctxt(
+                "Expected " + std::to_string(imageGridPoints.size()) +
+                " scene points but got " +
+                std::to_string(scenePoints.size())));
+    }
+
+    // A point that misses the terrain is NaN rather than an exception, so
+    // it doesn't lose the rest of the batch.  The height threshold and
+    // number of iterations are imageToScene()'s defaults.
+    const Vector3 missed(std::numeric_limits<double>::quiet_NaN());
+    mt::run1D(imageGridPoints.size(), getNumThreads(numThreads),
+              [&](size_t ii)
+              {
+                  if (!contourToTerrain(imageGridPoints[ii], elevation,
+                                        AdjustableParams(), 1.0, 10,
+                                        scenePoints[ii]))
+                  {
+                      scenePoints[ii] = missed;
+                  }
+              });
+}
+
 void ProjectionModel::imageToSceneAdjustment(const AdjustableParams& delta,
                                              double timeCOA,
                                              double& r,
@@ -415,6 +784,150 @@ void ProjectionModel::imageToSceneAdjustment(const AdjustableParams& delta,
             delta[AdjustableParams::RANGE_BIAS];
 }
 
+types::RowCol<double> ProjectionModel::computeImageTimePartials(
+        const types::RowCol<double>& imageGridPoint) const
+{
+    return types::RowCol<double>(
+            mTimeCOAPoly.derivativeX()(imageGridPoint.row, imageGridPoint.col),
+            mTimeCOAPoly.derivativeY()(imageGridPoint.row, imageGridPoint.col));
+}
+
+Vector3 ProjectionModel::computeARPAcceleration(double time) const
+{
+    return mARPVelPoly.derivative()(time);
+}
+
+math::linear::MatrixMxN<2, 2> ProjectionModel::computeContourPartials(
+        const types::RowCol<double>& imageGridPoint) const
+{
+    const auto contour = [this](const types::RowCol<double>& pt,
+                                double& r, double& rDot)
+    {
+        const double timeCOA = mTimeCOAPoly(pt.row, pt.col);
+        computeContour(mARPPoly(timeCOA), mARPVelPoly(timeCOA), timeCOA, pt,
+                       &r, &rDot);
+    };
+
+    constexpr double delta = 0.0001;
+    double r, rDot;
+    contour(imageGridPoint, r, rDot);
+
+    math::linear::MatrixMxN<2, 2> partials(0.0);
+    double rDelta, rDotDelta;
+    contour(types::RowCol<double>(imageGridPoint.row + delta,
+                                  imageGridPoint.col), rDelta, rDotDelta);
+    partials(0, 0) = (rDelta - r) / delta;
+    partials(1, 0) = (rDotDelta - rDot) / delta;
+    contour(types::RowCol<double>(imageGridPoint.row,
+                                  imageGridPoint.col + delta), rDelta, rDotDelta);
+    partials(0, 1) = (rDelta - r) / delta;
+    partials(1, 1) = (rDotDelta - rDot) / delta;
+    return partials;
+}
+
+void ProjectionModel::computeContourEquationPartials(
+        const types::RowCol<double>& imageGridPoint,
+        const Vector3& scenePoint,
+        math::linear::MatrixMxN<2, 3>& scenePartials,
+        math::linear::MatrixMxN<2, 2>& imagePartials,
+        math::linear::MatrixMxN<2, 7>& sensorPartials) const
+{
+    const double timeCOA = mTimeCOAPoly(imageGridPoint.row,
+                                        imageGridPoint.col);
+    const Vector3 rARP = mARPPoly(timeCOA);
+    const Vector3 vARP = mARPVelPoly(timeCOA);
+    const Vector3 aARP = computeARPAcceleration(timeCOA);
+
+    // The current adjustable parameters move the ARP (and its velocity)
+    // along RIC_ECF axes that turn with time
+    Vector3 arpCOA = rARP;
+    Vector3 velCOA = vARP;
+    double rangeBias = 0.0;
+    imageToSceneAdjustment(AdjustableParams(), timeCOA, rangeBias,
+                           arpCOA, velCOA);
+    const math::linear::MatrixMxN<3, 3> dRicEcfToEcef =
+            getRICtoECEFTransformDerivative(rARP, vARP, aARP);
+    const Vector3 arpRate = vARP + Vector3(
+            dRicEcfToEcef * mAdjustableParams.getARPVector().matrix());
+    const Vector3 velRate = aARP + Vector3(
+            dRicEcfToEcef * mAdjustableParams.getARPVelocityVector().matrix());
+
+    // Frame the deltas to the adjustable parameters are in
+    math::linear::MatrixMxN<3, 3> deltaToEcef;
+    switch (mErrors.mFrameType.mValue)
+    {
+    case FrameType::RIC_ECF:
+        deltaToEcef = getRICtoECEFTransformMatrix(0.0, timeCOA);
+        break;
+    case FrameType::RIC_ECI:
+        deltaToEcef = getRICtoECEFTransformMatrix(EARTH_ROTATION_RATE,
+                                                  timeCOA);
+        break;
+    case FrameType::ECF:
+        deltaToEcef = math::linear::identityMatrix<3, double>();
+        break;
+    case FrameType::NOT_SET:
+    default:
+        throw except::Exception(Ctxt(
+                "Reference Frame for error parameters undefined"));
+    }
+
+    const Vector3 vec = arpCOA - scenePoint;
+    const double range = vec.norm();
+    const Vector3 unit = vec / range;
+    // Partial of Rdot w.r.t. the ARP position
+    const Vector3 perp = (velCOA - unit * velCOA.dot(unit)) / range;
+
+    for (size_t ii = 0; ii < 3; ++ii)
+    {
+        scenePartials(0, ii) = -unit[ii];
+        scenePartials(1, ii) = -perp[ii];
+    }
+
+    const math::linear::MatrixMxN<2, 2> contourPartials =
+            computeContourPartials(imageGridPoint);
+    const types::RowCol<double> timePartials =
+            computeImageTimePartials(imageGridPoint);
+    const double dRangeDt = unit.dot(arpRate);
+    const double dRangeRateDt = perp.dot(arpRate) + unit.dot(velRate);
+    const double dTime[] = { timePartials.row, timePartials.col };
+    for (size_t ii = 0; ii < 2; ++ii)
+    {
+        imagePartials(0, ii) = dRangeDt * dTime[ii] - contourPartials(0, ii);
+        imagePartials(1, ii) =
+                dRangeRateDt * dTime[ii] - contourPartials(1, ii);
+    }
+
+    const Vector3 unitDelta = deltaToEcef.transpose() * unit.matrix();
+    const Vector3 perpDelta = deltaToEcef.transpose() * perp.matrix();
+    sensorPartials = math::linear::MatrixMxN<2, 7>(0.0);
+    for (size_t ii = 0; ii < 3; ++ii)
+    {
+        sensorPartials(0, AdjustableParams::ARP_RADIAL + ii) = unitDelta[ii];
+        sensorPartials(1, AdjustableParams::ARP_RADIAL + ii) = perpDelta[ii];
+        sensorPartials(1, AdjustableParams::ARP_VEL_RADIAL + ii) =
+                unitDelta[ii];
+    }
+    sensorPartials(0, AdjustableParams::RANGE_BIAS) = -1.0;
+}
+
+math::linear::MatrixMxN<3, 3> ProjectionModel::getInverseSceneJacobian(
+        const Vector3& scenePoint,
+        const math::linear::MatrixMxN<2, 3>& scenePartials) const
+{
+    // The gradient of height above the ellipsoid is the geodetic up vector
+    const LatLonAlt lla = ECEFToLLATransform().transform(scenePoint);
+    const Vector3 up = computeUnitVector(lla);
+
+    math::linear::MatrixMxN<3, 3> jacobian(0.0);
+    jacobian.addInPlace(scenePartials, 0, 0);
+    for (size_t ii = 0; ii < 3; ++ii)
+    {
+        jacobian(2, ii) = up[ii];
+    }
+    return math::linear::inverse(jacobian);
+}
+
 math::linear::MatrixMxN<3, 3> ProjectionModel::getRICtoECEFTransformMatrix(
         double earthInitialSpin,
         double timeCOA) const
@@ -459,12 +972,9 @@ math::linear::MatrixMxN<2, 2> ProjectionModel::slantToImagePartials(
             mTimeCOAPoly(imageGridPoint.row, imageGridPoint.col);
     const Vector3 rARP = mARPPoly(timeCOA);
     const Vector3 vARP = mARPVelPoly(timeCOA);
-    Vector3 slantRange = mSCP - rARP;
-    slantRange.normalize();
-    Vector3 slantNormal = math::linear::cross(vARP, slantRange) * mLookDir;
-    slantNormal.normalize();
-    Vector3 slantAzimuth = math::linear::cross(slantNormal, slantRange);
-    slantAzimuth.normalize();
+    Vector3 slantRange, slantAzimuth, slantNormal;
+    computeSlantPlaneVectors(rARP, vARP, mSCP, mLookDir,
+                             slantRange, slantAzimuth, slantNormal);
 
     // Second, map image grid point to the slant plane and compute finite differences
     const Vector3 refPoint = imageToScene(imageGridPoint, mSCP, slantNormal);
@@ -626,6 +1136,137 @@ math::linear::MatrixMxN<2, 3> ProjectionModel::sceneToImagePartials(
     return sceneToImagePartials(scenePoint, imagePt, delta);
 }
 
+math::linear::MatrixMxN<2, 2> ProjectionModel::slantToImagePartials(
+        const types::RowCol<double>& imageGridPoint) const
+{
+    const double timeCOA =
+            mTimeCOAPoly(imageGridPoint.row, imageGridPoint.col);
+    Vector3 slantRange, slantAzimuth, slantNormal;
+    computeSlantPlaneVectors(mARPPoly(timeCOA), mARPVelPoly(timeCOA), mSCP,
+                             mLookDir, slantRange, slantAzimuth, slantNormal);
+
+    const Vector3 refPoint = imageToScene(imageGridPoint, mSCP, slantNormal);
+    math::linear::MatrixMxN<3, 2> slantToScene;
+    slantToScene.col(0, slantRange.matrix());
+    slantToScene.col(1, slantAzimuth.matrix());
+    return sceneToImagePartials(refPoint, imageGridPoint) * slantToScene;
+}
+
+math::linear::MatrixMxN<3, 7> ProjectionModel::imageToSceneSensorPartials(
+        const types::RowCol<double>& imageGridPoint,
+        double /*height*/,
+        const Vector3& scenePoint) const
+{
+    math::linear::MatrixMxN<2, 3> scenePartials;
+    math::linear::MatrixMxN<2, 2> imagePartials;
+    math::linear::MatrixMxN<2, 7> sensorPartials;
+    computeContourEquationPartials(imageGridPoint, scenePoint, scenePartials,
+                                   imagePartials, sensorPartials);
+
+    // The height equation doesn't depend on the sensor
+    math::linear::MatrixMxN<3, 7> equationPartials(0.0);
+    equationPartials.addInPlace(sensorPartials, 0, 0);
+    return -1.0 * (getInverseSceneJacobian(scenePoint, scenePartials) *
+                   equationPartials);
+}
+
+math::linear::MatrixMxN<3, 7> ProjectionModel::imageToSceneSensorPartials(
+        const types::RowCol<double>& imageGridPoint,
+        double height) const
+{
+    const Vector3 scenePt = imageToScene(imageGridPoint, height);
+    return imageToSceneSensorPartials(imageGridPoint, height, scenePt);
+}
+
+math::linear::MatrixMxN<3, 2> ProjectionModel::imageToScenePartials(
+        const types::RowCol<double>& imageGridPoint,
+        double /*height*/,
+        const Vector3& scenePoint) const
+{
+    math::linear::MatrixMxN<2, 3> scenePartials;
+    math::linear::MatrixMxN<2, 2> imagePartials;
+    math::linear::MatrixMxN<2, 7> sensorPartials;
+    computeContourEquationPartials(imageGridPoint, scenePoint, scenePartials,
+                                   imagePartials, sensorPartials);
+
+    math::linear::MatrixMxN<3, 2> equationPartials(0.0);
+    equationPartials.addInPlace(imagePartials, 0, 0);
+    return -1.0 * (getInverseSceneJacobian(scenePoint, scenePartials) *
+                   equationPartials);
+}
+
+math::linear::MatrixMxN<3, 2> ProjectionModel::imageToScenePartials(
+        const types::RowCol<double>& imageGridPoint,
+        double height) const
+{
+    const Vector3 scenePt = imageToScene(imageGridPoint, height);
+    return imageToScenePartials(imageGridPoint, height, scenePt);
+}
+
+math::linear::MatrixMxN<3, 1> ProjectionModel::imageToSceneHeightPartial(
+        const types::RowCol<double>& imageGridPoint,
+        double /*height*/,
+        const Vector3& scenePoint) const
+{
+    math::linear::MatrixMxN<2, 3> scenePartials;
+    math::linear::MatrixMxN<2, 2> imagePartials;
+    math::linear::MatrixMxN<2, 7> sensorPartials;
+    computeContourEquationPartials(imageGridPoint, scenePoint, scenePartials,
+                                   imagePartials, sensorPartials);
+
+    // Only the height equation depends on the height
+    math::linear::MatrixMxN<3, 1> equationPartials(0.0);
+    equationPartials(2, 0) = 1.0;
+    return getInverseSceneJacobian(scenePoint, scenePartials) *
+            equationPartials;
+}
+
+math::linear::MatrixMxN<3, 1> ProjectionModel::imageToSceneHeightPartial(
+        const types::RowCol<double>& imageGridPoint,
+        double height) const
+{
+    const Vector3 scenePt = imageToScene(imageGridPoint, height);
+    return imageToSceneHeightPartial(imageGridPoint, height, scenePt);
+}
+
+math::linear::MatrixMxN<2, 7> ProjectionModel::sceneToImageSensorPartials(
+        const Vector3& scenePoint,
+        const types::RowCol<double>& imageGridPoint) const
+{
+    math::linear::MatrixMxN<2, 3> scenePartials;
+    math::linear::MatrixMxN<2, 2> imagePartials;
+    math::linear::MatrixMxN<2, 7> sensorPartials;
+    computeContourEquationPartials(imageGridPoint, scenePoint, scenePartials,
+                                   imagePartials, sensorPartials);
+    return -1.0 * (math::linear::inverse(imagePartials) * sensorPartials);
+}
+
+math::linear::MatrixMxN<2, 7> ProjectionModel::sceneToImageSensorPartials(
+        const Vector3& scenePoint) const
+{
+    const types::RowCol<double> imagePt = sceneToImage(scenePoint);
+    return sceneToImageSensorPartials(scenePoint, imagePt);
+}
+
+math::linear::MatrixMxN<2, 3> ProjectionModel::sceneToImagePartials(
+        const Vector3& scenePoint,
+        const types::RowCol<double>& imageGridPoint) const
+{
+    math::linear::MatrixMxN<2, 3> scenePartials;
+    math::linear::MatrixMxN<2, 2> imagePartials;
+    math::linear::MatrixMxN<2, 7> sensorPartials;
+    computeContourEquationPartials(imageGridPoint, scenePoint, scenePartials,
+                                   imagePartials, sensorPartials);
+    return -1.0 * (math::linear::inverse(imagePartials) * scenePartials);
+}
+
+math::linear::MatrixMxN<2, 3> ProjectionModel::sceneToImagePartials(
+        const Vector3& scenePoint) const
+{
+    const types::RowCol<double> imagePt = sceneToImage(scenePoint);
+    return sceneToImagePartials(scenePoint, imagePt);
+}
+
 math::linear::MatrixMxN<7, 7> ProjectionModel::getErrorCovariance(
         const Vector3& scenePoint,
         double timeCOA) const
@@ -861,6 +1502,76 @@ computeContour(const Vector3& arpCOA,
 
 }
 
+math::linear::MatrixMxN<2, 2> RangeAzimProjectionModel::
+computeContourPartials(const types::RowCol<double>& imageGridPoint) const
+{
+    const double timeCOA = mTimeCOAPoly(imageGridPoint.row,
+                                        imageGridPoint.col);
+    const types::RowCol<double> timePartials =
+            computeImageTimePartials(imageGridPoint);
+    const Vector3 arpCOA = mARPPoly(timeCOA);
+    const Vector3 velCOA = mARPVelPoly(timeCOA);
+    const Vector3 accCOA = computeARPAcceleration(timeCOA);
+
+    const double thetaCOA = mPolarAnglePoly(timeCOA);
+    const double dThetaDt = mPolarAnglePolyPrime(timeCOA);
+    const double d2ThetaDt2 = mPolarAnglePolyPrime.derivative()(timeCOA);
+
+    const double ksf = mKSFPoly(thetaCOA);
+    const double dKSFDTheta = mKSFPolyPrime(thetaCOA);
+    const double d2KSFDTheta2 = mKSFPolyPrime.derivative()(thetaCOA);
+
+    double sinTheta, cosTheta;
+    math::SinCos(thetaCOA, sinTheta, cosTheta);
+
+    const double slopeRadial =
+        imageGridPoint.row * cosTheta +
+        imageGridPoint.col * sinTheta;
+
+    const double slopeCrossRadial =
+        -imageGridPoint.row * sinTheta +
+        imageGridPoint.col * cosTheta;
+
+    const double dDrDTheta = dKSFDTheta * slopeRadial + ksf * slopeCrossRadial;
+
+    // Range and range rate to the SCP
+    const Vector3 vec = arpCOA - mSCP;
+    const double r = vec.norm();
+    const Vector3 unit = vec / r;
+    const double rDot = velCOA.dot(unit);
+    const double dRDotDt =
+            accCOA.dot(unit) + (velCOA.dot(velCOA) - rDot * rDot) / r;
+
+    const double dTime[] = { timePartials.row, timePartials.col };
+    // Partials of slopeRadial and slopeCrossRadial at fixed theta
+    const double dSlopeRadial[] = { cosTheta, sinTheta };
+    const double dSlopeCrossRadial[] = { -sinTheta, cosTheta };
+
+    math::linear::MatrixMxN<2, 2> partials(0.0);
+    for (size_t ii = 0; ii < 2; ++ii)
+    {
+        const double dTheta = dThetaDt * dTime[ii];
+        const double totalSlopeRadial =
+                dSlopeRadial[ii] + slopeCrossRadial * dTheta;
+        const double totalSlopeCrossRadial =
+                dSlopeCrossRadial[ii] - slopeRadial * dTheta;
+
+        const double dDR = dKSFDTheta * dTheta * slopeRadial +
+                ksf * totalSlopeRadial;
+        const double dDDrDTheta =
+                d2KSFDTheta2 * dTheta * slopeRadial +
+                dKSFDTheta * totalSlopeRadial +
+                dKSFDTheta * dTheta * slopeCrossRadial +
+                ksf * totalSlopeCrossRadial;
+        const double dDRDot = dDDrDTheta * dThetaDt +
+                dDrDTheta * d2ThetaDt2 * dTime[ii];
+
+        partials(0, ii) = rDot * dTime[ii] + dDR;
+        partials(1, ii) = dRDotDt * dTime[ii] + dDRDot;
+    }
+    return partials;
+}
+
 
 RangeZeroProjectionModel::
 RangeZeroProjectionModel(const math::poly::OneD<double>& timeCAPoly,
@@ -918,6 +1629,54 @@ computeContour(const Vector3& /*arpCOA*/,
     *rDot = dsrf / (*r) * t * velocityMagCA;
 }
 
+math::linear::MatrixMxN<2, 2> RangeZeroProjectionModel::
+computeContourPartials(const types::RowCol<double>& imageGridPoint) const
+{
+    const double timeCOA = mTimeCOAPoly(imageGridPoint.row,
+                                        imageGridPoint.col);
+    const types::RowCol<double> timePartials =
+            computeImageTimePartials(imageGridPoint);
+
+    const double timeCA = mTimeCAPoly(imageGridPoint.col);
+    const double dTimeCADCol = mTimeCAPoly.derivative()(imageGridPoint.col);
+    const double deltaTimeCOA = timeCOA - timeCA;
+
+    const Vector3 velCA = mARPVelPoly(timeCA);
+    const double velocityMagCA = velCA.norm();
+    const double dVelocityMagCADCol =
+            velCA.dot(computeARPAcceleration(timeCA)) / velocityMagCA *
+            dTimeCADCol;
+
+    const double t = deltaTimeCOA * velocityMagCA;
+    const double dsrf = mDSRFPoly(imageGridPoint.row, imageGridPoint.col);
+    const double rangeCA = mRangeCA + imageGridPoint.row;
+
+    const double r = sqrt(rangeCA * rangeCA + dsrf * (t * t));
+    const double rDot = dsrf / r * t * velocityMagCA;
+
+    const double dRangeCA[] = { 1.0, 0.0 };
+    const double dDSRF[] = {
+        mDSRFPoly.derivativeX()(imageGridPoint.row, imageGridPoint.col),
+        mDSRFPoly.derivativeY()(imageGridPoint.row, imageGridPoint.col) };
+    const double dVelocityMagCA[] = { 0.0, dVelocityMagCADCol };
+    const double dDeltaTimeCOA[] = { timePartials.row,
+                                     timePartials.col - dTimeCADCol };
+
+    math::linear::MatrixMxN<2, 2> partials(0.0);
+    for (size_t ii = 0; ii < 2; ++ii)
+    {
+        const double dT = dDeltaTimeCOA[ii] * velocityMagCA +
+                deltaTimeCOA * dVelocityMagCA[ii];
+        const double dR = (rangeCA * dRangeCA[ii] +
+                0.5 * dDSRF[ii] * t * t + dsrf * t * dT) / r;
+        partials(0, ii) = dR;
+        partials(1, ii) = (dDSRF[ii] * t * velocityMagCA +
+                dsrf * dT * velocityMagCA +
+                dsrf * t * dVelocityMagCA[ii]) / r - rDot * dR / r;
+    }
+    return partials;
+}
+
 PlaneProjectionModel::
 PlaneProjectionModel(const Vector3& slantPlaneNormal,
                      const Vector3& imagePlaneRowVector,
@@ -955,6 +1714,20 @@ computeContour(const Vector3& arpCOA,
     *rDot = velCOA.dot(vec) / *r;
 }
 
+math::linear::MatrixMxN<2, 2> PlaneProjectionModel::
+computeContourPartials(const types::RowCol<double>& imageGridPoint) const
+{
+    const double timeCOA = mTimeCOAPoly(imageGridPoint.row,
+                                        imageGridPoint.col);
+    return computePointContourPartials(mARPPoly(timeCOA),
+                                       mARPVelPoly(timeCOA),
+                                       computeARPAcceleration(timeCOA),
+                                       imageGridToECEF(imageGridPoint),
+                                       computeImageTimePartials(imageGridPoint),
+                                       mImagePlaneRowVector,
+                                       mImagePlaneColVector);
+}
+
 GeodeticProjectionModel::GeodeticProjectionModel(
         const Vector3& slantPlaneNormal,
         const Vector3& scp,
@@ -1004,6 +1777,54 @@ computeContour(const Vector3& arpCOA,
     *rDot = velCOA.dot(vec) / *r;
 }
 
+math::linear::MatrixMxN<2, 2> GeodeticProjectionModel::
+computeContourPartials(const types::RowCol<double>& imageGridPoint) const
+{
+    const double timeCOA = mTimeCOAPoly(imageGridPoint.row,
+                                        imageGridPoint.col);
+
+    // Rows are arc seconds of latitude (increasing south), columns arc
+    // seconds of longitude; scale the partials of the ECEF position w.r.t.
+    // latitude and longitude by the meridian and prime vertical radii
+    const LatLonAlt refPt = Utilities::ecefToLatLon(mSCP);
+    const LatLonAlt lla(refPt.getLat() - imageGridPoint.row / 3600.0,
+                        refPt.getLon() + imageGridPoint.col / 3600.0,
+                        refPt.getAlt());
+    const double a = WGS84EllipsoidModel::EQUATORIAL_RADIUS_METERS;
+    const double b = WGS84EllipsoidModel::POLAR_RADIUS_METERS;
+    const double e2 = 1.0 - (b * b) / (a * a);
+
+    double sinLat, cosLat;
+    math::SinCos(lla.getLatRadians(), sinLat, cosLat);
+    double sinLon, cosLon;
+    math::SinCos(lla.getLonRadians(), sinLon, cosLon);
+
+    const double w = 1.0 - e2 * sinLat * sinLat;
+    const double primeVertical = a / sqrt(w);
+    const double meridian = primeVertical * (1.0 - e2) / w;
+    const double arcSecond = math::Constants::DEGREES_TO_RADIANS / 3600.0;
+
+    Vector3 gridRowPartial;
+    const double rowScale = -(meridian + lla.getAlt()) * arcSecond;
+    gridRowPartial[0] = -sinLat * cosLon * rowScale;
+    gridRowPartial[1] = -sinLat * sinLon * rowScale;
+    gridRowPartial[2] = cosLat * rowScale;
+
+    Vector3 gridColPartial;
+    const double colScale = (primeVertical + lla.getAlt()) * cosLat * arcSecond;
+    gridColPartial[0] = -sinLon * colScale;
+    gridColPartial[1] = cosLon * colScale;
+    gridColPartial[2] = 0.0;
+
+    return computePointContourPartials(mARPPoly(timeCOA),
+                                       mARPVelPoly(timeCOA),
+                                       computeARPAcceleration(timeCOA),
+                                       Utilities::latLonToECEF(lla),
+                                       computeImageTimePartials(imageGridPoint),
+                                       gridRowPartial,
+                                       gridColPartial);
+}
+
 Vector3 GeodeticProjectionModel::imageGridToECEF(
         const types::RowCol<double> gridPt) const
 {
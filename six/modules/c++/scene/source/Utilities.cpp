@@ -44,12 +44,22 @@ Vector3 Utilities::latLonToECEF(LatLon latLon)
     const scene::LatLonAlt lla(latLon.getLat(), latLon.getLon());
     return latLonToECEF(lla);
 }
+void Utilities::latLonToECEF(std::span<const LatLonAlt> latLons, std::span<Vector3> ecef)
+{
+    scene::LLAToECEFTransform toECEF;
+    toECEF.transform(latLons, ecef);
+}
 
 LatLonAlt Utilities::ecefToLatLon(Vector3 vec)
 {
     scene::ECEFToLLATransform toLLA;
     return toLLA.transform(vec);
 }
+void Utilities::ecefToLatLon(std::span<const Vector3> vecs, std::span<LatLonAlt> latLons)
+{
+    scene::ECEFToLLATransform toLLA;
+    toLLA.transform(vecs, latLons);
+}
 
 LatLonAlt Utilities::ecefToLatLon(const GeographicGridECEFTransform& gridTransform, size_t row, size_t col)
 {
@@ -0,0 +1,148 @@
+/* =========================================================================
+ * This file is part of scene-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * scene-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <math.h>
+
+#include <vector>
+#include <random>
+#include <algorithm>
+
+#include <scene/ECEFToLLATransform.h>
+#include <scene/LLAToECEFTransform.h>
+#include <scene/Utilities.h>
+
+#include "TestCase.h"
+
+static std::vector<scene::LatLonAlt> makeLatLons()
+{
+    std::vector<scene::LatLonAlt> retval;
+
+    // Poles, the equator and the antimeridian are where the iterative
+    // transform's atan() fixups matter
+    retval.emplace_back(90.0, 0.0, 0.0);
+    retval.emplace_back(-90.0, 45.0, 100.0);
+    retval.emplace_back(0.0, 0.0, 0.0);
+    retval.emplace_back(0.0, 179.999, -100.0);
+    retval.emplace_back(45.0, -179.999, 10000.0);
+
+    // From the Dead Sea to well above LEO
+    std::mt19937 generator(31);
+    std::uniform_real_distribution<double> lat(-90.0, 90.0);
+    std::uniform_real_distribution<double> lon(-180.0, 180.0);
+    std::uniform_real_distribution<double> alt(-500.0, 2.0e6);
+    for (size_t ii = 0; ii < 10000; ++ii)
+    {
+        retval.emplace_back(lat(generator), lon(generator), alt(generator));
+    }
+    return retval;
+}
+
+template<typename T>
+static std::span<const T> as_cspan(const std::vector<T>& v)
+{
+    return std::span<const T>(v.data(), v.size());
+}
+template<typename T>
+static std::span<T> as_span(std::vector<T>& v)
+{
+    return std::span<T>(v.data(), v.size());
+}
+
+TEST_CASE(testLLAToECEF)
+{
+    const auto latLons = makeLatLons();
+    std::vector<scene::Vector3> ecef(latLons.size());
+    const scene::LLAToECEFTransform toECEF;
+    toECEF.transform(as_cspan(latLons), as_span(ecef));
+
+    double maxError = 0.0;
+    for (size_t ii = 0; ii < latLons.size(); ++ii)
+    {
+        const auto expected = toECEF.transform(latLons[ii]);
+        maxError = std::max(maxError, (ecef[ii] - expected).norm());
+    }
+    TEST_ASSERT_LESSER(maxError, 1.0e-6); // metres
+}
+
+TEST_CASE(testECEFToLLA)
+{
+    const auto latLons = makeLatLons();
+    std::vector<scene::Vector3> ecef(latLons.size());
+    scene::Utilities::latLonToECEF(as_cspan(latLons), as_span(ecef));
+
+    std::vector<scene::LatLonAlt> results(ecef.size());
+    const scene::ECEFToLLATransform toLLA;
+    toLLA.transform(as_cspan(ecef), as_span(results));
+
+    // Compare against the iterative transform as a distance on the
+    // ground, so a difference in longitude near the poles doesn't count
+    // for more than it is.
+    const scene::LLAToECEFTransform toECEF;
+    double maxError = 0.0;
+    double maxAltError = 0.0;
+    for (size_t ii = 0; ii < ecef.size(); ++ii)
+    {
+        const auto expected = toLLA.transform(ecef[ii]);
+        const scene::LatLonAlt result(results[ii].getLat(), results[ii].getLon(), expected.getAlt());
+        maxError = std::max(maxError, (toECEF.transform(result) - toECEF.transform(expected)).norm());
+        maxAltError = std::max(maxAltError, std::abs(results[ii].getAlt() - expected.getAlt()));
+
+        // ... and against where the point came from
+        maxError = std::max(maxError, (toECEF.transform(results[ii]) - ecef[ii]).norm());
+    }
+    TEST_ASSERT_LESSER(maxError, 1.0e-4); // metres
+    TEST_ASSERT_LESSER(maxAltError, 1.0e-4);
+}
+
+TEST_CASE(testNearCentre)
+{
+    // Inside the evolute the batch transform falls back to the iterative one
+    const scene::ECEFToLLATransform toLLA;
+    std::vector<scene::Vector3> ecef(1);
+    ecef[0][0] = 1000.0;
+    ecef[0][1] = 2000.0;
+    ecef[0][2] = -3000.0;
+    std::vector<scene::LatLonAlt> results(1);
+    toLLA.transform(as_cspan(ecef), as_span(results));
+    const auto expected = toLLA.transform(ecef[0]);
+    TEST_ASSERT_EQ(results[0].getLat(), expected.getLat());
+    TEST_ASSERT_EQ(results[0].getLon(), expected.getLon());
+    TEST_ASSERT_EQ(results[0].getAlt(), expected.getAlt());
+}
+
+TEST_CASE(testErrors)
+{
+    std::vector<scene::Vector3> ecef(2);
+    std::vector<scene::LatLonAlt> latLons(3);
+    TEST_EXCEPTION(scene::Utilities::ecefToLatLon(as_cspan(ecef), as_span(latLons)));
+    TEST_EXCEPTION(scene::Utilities::latLonToECEF(as_cspan(latLons), as_span(ecef)));
+
+    latLons.resize(2);
+    latLons[1].setLat(91.0);
+    TEST_EXCEPTION(scene::Utilities::latLonToECEF(as_cspan(latLons), as_span(ecef)));
+}
+
+TEST_MAIN(
+    TEST_CHECK(testLLAToECEF);
+    TEST_CHECK(testECEFToLLA);
+    TEST_CHECK(testNearCentre);
+    TEST_CHECK(testErrors);
+    )
@@ -0,0 +1,565 @@
+/* =========================================================================
+ * This file is part of scene-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * scene-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <math.h>
+#include <stdint.h>
+
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+#include <std/span>
+
+#include <io/FileOutputStream.h>
+#include <io/TempFile.h>
+#include <sys/Conf.h>
+#include <tiff/TiffFileWriter.h>
+#include <tiff/TypeFactory.h>
+#include <scene/ECEFToLLATransform.h>
+#include <scene/GridElevationSource.h>
+#include <scene/ProjectionModel.h>
+#include <scene/Utilities.h>
+
+#include "TestCase.h"
+
+// 0.1 x 0.1 degree DEM around (30, -100), posts 0.001 degrees apart
+static const size_t NUM_POSTS = 101;
+static const double NORTH = 30.05;
+static const double WEST = -100.05;
+static const double SPACING = 0.001;
+
+// Brackets terrain() with or without the hills
+static const double MIN_HEIGHT = -20.0;
+static const double MAX_HEIGHT = 220.0;
+
+// Rolling hills; a plane when hills is false so bilinear interpolation is
+// exact
+static double terrain(double lat, double lon, bool hills = true)
+{
+    const double plane = 100.0 + 400.0 * (lat - 30.0) + 300.0 * (lon + 100.0);
+    return hills ? plane + 80.0 * sin(lat * 300.0) * cos(lon * 200.0) : plane;
+}
+
+static scene::GridElevationSource::GridInfo getGridInfo()
+{
+    scene::GridElevationSource::GridInfo info;
+    info.numRows = info.numCols = NUM_POSTS;
+    info.origin = scene::LatLon(NORTH, WEST);
+    info.spacing = scene::LatLon(-SPACING, SPACING);
+    info.minHeight = MIN_HEIGHT;
+    info.maxHeight = MAX_HEIGHT;
+    return info;
+}
+
+static std::vector<float> makePosts(bool hills)
+{
+    std::vector<float> posts(NUM_POSTS * NUM_POSTS);
+    for (size_t row = 0; row < NUM_POSTS; ++row)
+    {
+        for (size_t col = 0; col < NUM_POSTS; ++col)
+        {
+            posts[row * NUM_POSTS + col] = static_cast<float>(terrain(
+                    NORTH - row * SPACING, WEST + col * SPACING, hills));
+        }
+    }
+    return posts;
+}
+
+template<typename T>
+static void writeGrid(const std::string& pathname, std::vector<T> posts,
+                      bool bigEndian)
+{
+    if (bigEndian != sys::isBigEndianSystem())
+    {
+        sys::byteSwap(posts.data(), sizeof(T), posts.size());
+    }
+    io::FileOutputStream(pathname).write(
+            reinterpret_cast<const sys::byte*>(posts.data()),
+            posts.size() * sizeof(T));
+}
+
+static void writeGeoTIFF(const std::string& pathname,
+                         const std::vector<float>& posts,
+                         bool pixelIsPoint)
+{
+    tiff::FileWriter writer(pathname);
+    writer.writeHeader();
+    tiff::ImageWriter* const imageWriter = writer.addImage();
+    tiff::IFD* const ifd = imageWriter->getIFD();
+
+    ifd->addEntry(tiff::KnownTags::IMAGE_WIDTH,
+                  static_cast<sys::Uint32_T>(NUM_POSTS));
+    ifd->addEntry(tiff::KnownTags::IMAGE_LENGTH,
+                  static_cast<sys::Uint32_T>(NUM_POSTS));
+    ifd->addEntry(tiff::KnownTags::COMPRESSION, static_cast<unsigned short>(
+            tiff::Const::CompressionType::NO_COMPRESSION));
+    ifd->addEntry(tiff::KnownTags::PHOTOMETRIC_INTERPRETATION,
+                  static_cast<unsigned short>(1));
+    // SamplesPerPixel defaults to 1; setting it would make
+    // tiff::ImageWriter insist on 8 bits per sample
+    ifd->addEntry(tiff::KnownTags::BITS_PER_SAMPLE,
+                  static_cast<unsigned short>(32));
+    ifd->addEntry(tiff::KnownTags::SAMPLE_FORMAT, static_cast<unsigned short>(
+            tiff::Const::SampleFormatType::IEEE_FLOAT));
+
+    // Raster (0, 0) ties to the first post, or to the corner half a pixel
+    // up and left of it for PixelIsArea
+    const double halfPixel = pixelIsPoint ? 0.0 : SPACING / 2;
+    ifd->addEntry("ModelPixelScaleTag");
+    for (double value : { SPACING, SPACING, 0.0 })
+    {
+        ifd->addEntryValue("ModelPixelScaleTag", value);
+    }
+    ifd->addEntry("ModelTiepointTag");
+    for (double value : { 0.0, 0.0, 0.0, WEST - halfPixel, NORTH + halfPixel,
+                          0.0 })
+    {
+        ifd->addEntryValue("ModelTiepointTag", value);
+    }
+    const tiff::IFDEntry minSample(340, tiff::Const::Type::DOUBLE,
+                                   "SMinSampleValue");
+    ifd->addEntry(&minSample);
+    ifd->addEntryValue("SMinSampleValue", MIN_HEIGHT);
+    const tiff::IFDEntry maxSample(341, tiff::Const::Type::DOUBLE,
+                                   "SMaxSampleValue");
+    ifd->addEntry(&maxSample);
+    ifd->addEntryValue("SMaxSampleValue", MAX_HEIGHT);
+    ifd->addEntry("GeoKeyDirectoryTag");
+    for (unsigned short value : { 1, 1, 0, 2,
+                                  1024, 0, 1, 2,
+                                  1025, 0, 1, pixelIsPoint ? 2 : 1 })
+    {
+        ifd->addEntryValue("GeoKeyDirectoryTag", value);
+    }
+
+    imageWriter->putData(reinterpret_cast<const unsigned char*>(posts.data()),
+                         static_cast<sys::Uint32_T>(posts.size()));
+    imageWriter->writeIFD();
+    writer.close();
+}
+
+TEST_CASE(testInterpolation)
+{
+    const io::TempFile tempfile;
+    writeGrid(tempfile.pathname(), makePosts(false), false);
+    const scene::GridElevationSource elevation(tempfile.pathname(),
+                                               getGridInfo());
+
+    TEST_ASSERT_EQ(elevation.getMinHeight(), MIN_HEIGHT);
+    TEST_ASSERT_EQ(elevation.getMaxHeight(), MAX_HEIGHT);
+    TEST_ASSERT_ALMOST_EQ_EPS(elevation.getPostSpacing(),
+                              SPACING * 111319.49 * cos(30.0 * M_PI / 180),
+                              1.0);
+
+    // The terrain is a plane, so bilinear interpolation is exact (up to
+    // the posts being floats)
+    std::vector<scene::LatLon> latLons;
+    for (double lat = NORTH - 0.1; lat <= NORTH; lat += 0.00737)
+    {
+        for (double lon = WEST; lon <= WEST + 0.1; lon += 0.00913)
+        {
+            latLons.push_back(scene::LatLon(lat, lon));
+            TEST_ASSERT_ALMOST_EQ_EPS(elevation.getHeight(latLons.back()),
+                                      terrain(lat, lon, false), 1e-3);
+        }
+    }
+    latLons.push_back(scene::LatLon(NORTH, WEST));
+    latLons.push_back(scene::LatLon(NORTH - 0.1, WEST + 0.1));
+
+    std::vector<double> heights(latLons.size());
+    elevation.getHeights(
+            std::span<const scene::LatLon>(latLons.data(), latLons.size()),
+            std::span<double>(heights.data(), heights.size()));
+    for (size_t ii = 0; ii < latLons.size(); ++ii)
+    {
+        TEST_ASSERT_EQ(heights[ii], elevation.getHeight(latLons[ii]));
+    }
+
+    TEST_EXCEPTION(elevation.getHeight(scene::LatLon(NORTH + 0.001, WEST)));
+    TEST_EXCEPTION(elevation.getHeight(scene::LatLon(30.0, WEST - 0.001)));
+    TEST_ASSERT(std::isnan(elevation.findHeight(
+            scene::LatLon(NORTH + 0.001, WEST))));
+    TEST_ASSERT_EQ(elevation.findHeight(latLons[0]),
+                   elevation.getHeight(latLons[0]));
+    TEST_EXCEPTION(elevation.getHeights(
+            std::span<const scene::LatLon>(latLons.data(), latLons.size()),
+            std::span<double>(heights.data(), heights.size() - 1)));
+}
+
+TEST_CASE(testCache)
+{
+    const io::TempFile tempfile;
+    writeGrid(tempfile.pathname(), makePosts(true), false);
+
+    // Room for two 16x16 tiles
+    const scene::GridElevationSource elevation(
+            tempfile.pathname(), getGridInfo(), 2 * 16 * 16 * sizeof(double),
+            16);
+    TEST_ASSERT_EQ(elevation.getMaxNumCachedTiles(), static_cast<size_t>(2));
+    TEST_ASSERT_EQ(elevation.getNumCachedTiles(), static_cast<size_t>(0));
+
+    // Posts within a tile only read it once
+    for (size_t ii = 0; ii < 10; ++ii)
+    {
+        const double lat = NORTH - (1 + ii) * SPACING;
+        const double lon = WEST + (1 + ii) * SPACING;
+        TEST_ASSERT_ALMOST_EQ_EPS(elevation.getHeight(scene::LatLon(lat, lon)),
+                                  terrain(lat, lon), 1e-3);
+    }
+    TEST_ASSERT_EQ(elevation.getNumTileReads(), static_cast<size_t>(1));
+
+    // Sweeping the whole grid never holds more than two tiles, and the
+    // values are the same whichever tile they come from
+    for (size_t row = 0; row < NUM_POSTS; row += 3)
+    {
+        for (size_t col = 0; col < NUM_POSTS; col += 5)
+        {
+            const double lat = NORTH - row * SPACING;
+            const double lon = WEST + col * SPACING;
+            TEST_ASSERT_ALMOST_EQ_EPS(
+                    elevation.getHeight(scene::LatLon(lat, lon)),
+                    terrain(lat, lon), 1e-3);
+        }
+    }
+    TEST_ASSERT_EQ(elevation.getNumCachedTiles(), static_cast<size_t>(2));
+    TEST_ASSERT(elevation.getNumTileReads() > 7 * 7);
+
+    // The most recently used tile is still cached
+    const size_t numReads = elevation.getNumTileReads();
+    elevation.getHeight(scene::LatLon(NORTH - 0.1, WEST + 0.1));
+    TEST_ASSERT_EQ(elevation.getNumTileReads(), numReads);
+}
+
+TEST_CASE(testHeightRange)
+{
+    const io::TempFile tempfile;
+    writeGrid(tempfile.pathname(), makePosts(true), false);
+
+    // Opening the grid doesn't read it
+    scene::GridElevationSource::GridInfo info = getGridInfo();
+    const scene::GridElevationSource elevation(tempfile.pathname(), info);
+    TEST_ASSERT_EQ(elevation.getNumTileReads(), static_cast<size_t>(0));
+
+    // Without a range, anything on Earth is covered
+    info.minHeight = info.maxHeight =
+            std::numeric_limits<double>::quiet_NaN();
+    const scene::GridElevationSource unbounded(tempfile.pathname(), info);
+    TEST_ASSERT_EQ(unbounded.getMinHeight(),
+                   scene::GridElevationSource::MIN_TERRAIN_HEIGHT);
+    TEST_ASSERT_EQ(unbounded.getMaxHeight(),
+                   scene::GridElevationSource::MAX_TERRAIN_HEIGHT);
+    TEST_ASSERT_EQ(unbounded.getNumTileReads(), static_cast<size_t>(0));
+
+    info.minHeight = MIN_HEIGHT;
+    TEST_EXCEPTION(scene::GridElevationSource(tempfile.pathname(), info));
+    info.maxHeight = MIN_HEIGHT - 1;
+    TEST_EXCEPTION(scene::GridElevationSource(tempfile.pathname(), info));
+}
+
+TEST_CASE(testVoids)
+{
+    // Big endian 16-bit posts with a void
+    const std::vector<float> floats = makePosts(false);
+    std::vector<int16_t> posts(floats.begin(), floats.end());
+    const size_t voidRow = 10;
+    const size_t voidCol = 20;
+    posts[voidRow * NUM_POSTS + voidCol] = -32767;
+    for (size_t row = 70; row <= 71; ++row)
+    {
+        for (size_t col = 70; col <= 71; ++col)
+        {
+            posts[row * NUM_POSTS + col] = -32767;
+        }
+    }
+
+    const io::TempFile tempfile;
+    writeGrid(tempfile.pathname(), posts, true);
+    scene::GridElevationSource::GridInfo info = getGridInfo();
+    info.sampleType = scene::GridElevationSource::SampleType::INT16;
+    info.bigEndian = true;
+    info.noDataValue = -32767;
+    const scene::GridElevationSource elevation(tempfile.pathname(), info);
+
+    // Away from the void, it's plain bilinear interpolation
+    const double lat = NORTH - 50.5 * SPACING;
+    const double lon = WEST + 60.25 * SPACING;
+    const size_t row = 50;
+    const size_t col = 60;
+    const double expected =
+            0.5 * 0.75 * posts[row * NUM_POSTS + col] +
+            0.5 * 0.25 * posts[row * NUM_POSTS + col + 1] +
+            0.5 * 0.75 * posts[(row + 1) * NUM_POSTS + col] +
+            0.5 * 0.25 * posts[(row + 1) * NUM_POSTS + col + 1];
+    TEST_ASSERT_ALMOST_EQ_EPS(elevation.getHeight(scene::LatLon(lat, lon)),
+                              expected, 1e-9);
+
+    // Next to the void, the remaining posts are used
+    const double voidLat = NORTH - (voidRow + 0.5) * SPACING;
+    const double voidLon = WEST + (voidCol - 0.5) * SPACING;
+    const double expectedVoid = (posts[voidRow * NUM_POSTS + voidCol - 1] +
+                                 posts[(voidRow + 1) * NUM_POSTS + voidCol - 1] +
+                                 posts[(voidRow + 1) * NUM_POSTS + voidCol]) /
+            3.0;
+    TEST_ASSERT_ALMOST_EQ_EPS(
+            elevation.getHeight(scene::LatLon(voidLat, voidLon)),
+            expectedVoid, 1e-9);
+
+    // ... but inside a cell that's all voids there's nothing to go on
+    const scene::LatLon allVoids(NORTH - 70.5 * SPACING,
+                                 WEST + 70.5 * SPACING);
+    TEST_EXCEPTION(elevation.getHeight(allVoids));
+    TEST_ASSERT(std::isnan(elevation.findHeight(allVoids)));
+}
+
+TEST_CASE(testGeoTIFF)
+{
+    const std::vector<float> posts = makePosts(true);
+    const io::TempFile rawFile;
+    writeGrid(rawFile.pathname(), posts, false);
+    const scene::GridElevationSource raw(rawFile.pathname(), getGridInfo());
+
+    for (bool pixelIsPoint : { false, true })
+    {
+        const io::TempFile tiffFile;
+        writeGeoTIFF(tiffFile.pathname(), posts, pixelIsPoint);
+        const std::unique_ptr<scene::GridElevationSource> geoTIFF =
+                scene::GridElevationSource::fromGeoTIFF(tiffFile.pathname());
+
+        const scene::GridElevationSource::GridInfo& info =
+                geoTIFF->getGridInfo();
+        TEST_ASSERT_EQ(info.numRows, NUM_POSTS);
+        TEST_ASSERT_EQ(info.numCols, NUM_POSTS);
+        TEST_ASSERT_ALMOST_EQ_EPS(info.origin.getLat(), NORTH, 1e-12);
+        TEST_ASSERT_ALMOST_EQ_EPS(info.origin.getLon(), WEST, 1e-12);
+        TEST_ASSERT_ALMOST_EQ_EPS(info.spacing.getLat(), -SPACING, 1e-15);
+        TEST_ASSERT_ALMOST_EQ_EPS(info.spacing.getLon(), SPACING, 1e-15);
+        TEST_ASSERT_EQ(geoTIFF->getMinHeight(), MIN_HEIGHT);
+        TEST_ASSERT_EQ(geoTIFF->getMaxHeight(), MAX_HEIGHT);
+
+        for (double lat = NORTH - 0.1; lat <= NORTH; lat += 0.0137)
+        {
+            for (double lon = WEST; lon <= WEST + 0.1; lon += 0.0091)
+            {
+                const scene::LatLon latLon(lat, lon);
+                TEST_ASSERT_ALMOST_EQ_EPS(geoTIFF->getHeight(latLon),
+                                          raw.getHeight(latLon), 1e-9);
+            }
+        }
+    }
+}
+
+// A right-looking collection heading north, SCP 500km down and 300km east
+static std::unique_ptr<scene::ProjectionModel> makeModel()
+{
+    const scene::LatLonAlt scpLLA(30.0, -100.0, 100.0);
+    const scene::Vector3 scp = scene::Utilities::latLonToECEF(scpLLA);
+
+    const double lat = scpLLA.getLatRadians();
+    const double lon = scpLLA.getLonRadians();
+    scene::Vector3 up;
+    up[0] = cos(lat) * cos(lon);
+    up[1] = cos(lat) * sin(lon);
+    up[2] = sin(lat);
+    scene::Vector3 east;
+    east[0] = -sin(lon);
+    east[1] = cos(lon);
+    east[2] = 0.0;
+    const scene::Vector3 north = math::linear::cross(up, east);
+
+    const scene::Vector3 arp = scp + 500.0e3 * up - 300.0e3 * east;
+    const scene::Vector3 vel = 7000.0 * north;
+    math::poly::OneD<scene::Vector3> arpPoly(1);
+    arpPoly[0] = arp;
+    arpPoly[1] = vel;
+
+    scene::Vector3 rowVector = scp - arp;
+    rowVector.normalize();
+    scene::Vector3 colVector = vel - rowVector * vel.dot(rowVector);
+    colVector.normalize();
+    const scene::Vector3 slantNormal =
+            math::linear::cross(rowVector, colVector);
+
+    math::poly::TwoD<double> timeCOAPoly(1, 1);
+    timeCOAPoly[0][1] = 1.0 / 7000.0;
+    return std::unique_ptr<scene::ProjectionModel>(
+            new scene::PlaneProjectionModel(slantNormal, rowVector, colVector,
+                                            scp, arpPoly, timeCOAPoly, -1));
+}
+
+static std::vector<types::RowCol<double> > makeImagePoints()
+{
+    std::vector<types::RowCol<double> > imagePoints;
+    for (double row = -2000; row <= 2000; row += 400)
+    {
+        for (double col = -2000; col <= 2000; col += 400)
+        {
+            imagePoints.push_back(types::RowCol<double>(row, col));
+        }
+    }
+    return imagePoints;
+}
+
+TEST_CASE(testImageToSceneFlat)
+{
+    // Constant height terrain is the same as a constant height projection
+    const double height = 123.0;
+    const io::TempFile tempfile;
+    writeGrid(tempfile.pathname(),
+              std::vector<float>(NUM_POSTS * NUM_POSTS,
+                                 static_cast<float>(height)),
+              false);
+    scene::GridElevationSource::GridInfo info = getGridInfo();
+    info.minHeight = info.maxHeight = height;
+    const scene::GridElevationSource elevation(tempfile.pathname(), info);
+
+    const std::unique_ptr<scene::ProjectionModel> model = makeModel();
+    for (const types::RowCol<double>& imagePoint : makeImagePoints())
+    {
+        const scene::Vector3 expected =
+                model->imageToScene(imagePoint, height);
+        const scene::Vector3 actual =
+                model->imageToScene(imagePoint, elevation);
+        TEST_ASSERT_LESSER((actual - expected).norm(), 1e-6);
+    }
+}
+
+TEST_CASE(testImageToSceneTerrain)
+{
+    const io::TempFile tempfile;
+    writeGrid(tempfile.pathname(), makePosts(true), false);
+    const scene::GridElevationSource elevation(tempfile.pathname(),
+                                               getGridInfo(), 1024 * 1024, 32);
+
+    const std::unique_ptr<scene::ProjectionModel> model = makeModel();
+    const std::vector<types::RowCol<double> > imagePoints = makeImagePoints();
+    const scene::ECEFToLLATransform ecefToLatLon;
+    const double heightThreshold = 0.01;
+    std::vector<scene::Vector3> scenePoints(imagePoints.size());
+    for (size_t ii = 0; ii < imagePoints.size(); ++ii)
+    {
+        scenePoints[ii] = model->imageToScene(imagePoints[ii], elevation,
+                                              scene::AdjustableParams(),
+                                              heightThreshold);
+
+        // On the terrain ...
+        const scene::LatLonAlt lla = ecefToLatLon.transform(scenePoints[ii]);
+        TEST_ASSERT_LESSER(std::abs(lla.getAlt() - elevation.getHeight(
+                scene::LatLon(lla.getLat(), lla.getLon()))),
+                heightThreshold);
+
+        // ... and on the contour
+        const types::RowCol<double> imagePoint =
+                model->sceneToImage(scenePoints[ii]);
+        TEST_ASSERT_LESSER(std::abs(imagePoint.row - imagePoints[ii].row),
+                           1e-3);
+        TEST_ASSERT_LESSER(std::abs(imagePoint.col - imagePoints[ii].col),
+                           1e-3);
+    }
+
+    for (size_t numThreads : { 1, 4, 0 })
+    {
+        std::vector<scene::Vector3> batch(imagePoints.size());
+        model->imageToScene(
+                std::span<const types::RowCol<double> >(imagePoints.data(),
+                                                        imagePoints.size()),
+                elevation,
+                std::span<scene::Vector3>(batch.data(), batch.size()),
+                numThreads);
+        for (size_t ii = 0; ii < batch.size(); ++ii)
+        {
+            const scene::Vector3 expected =
+                    model->imageToScene(imagePoints[ii], elevation);
+            TEST_ASSERT_EQ((batch[ii] - expected).norm(), 0.0);
+        }
+    }
+
+    // Off the DEM
+    const types::RowCol<double> offDEM(20000, 0);
+    TEST_EXCEPTION(model->imageToScene(offDEM, elevation));
+
+    // ... only loses that point from a batch
+    std::vector<types::RowCol<double> > withMiss(imagePoints);
+    withMiss.insert(withMiss.begin() + withMiss.size() / 2, offDEM);
+    std::vector<scene::Vector3> batch(withMiss.size());
+    model->imageToScene(
+            std::span<const types::RowCol<double> >(withMiss.data(),
+                                                    withMiss.size()),
+            elevation, std::span<scene::Vector3>(batch.data(), batch.size()));
+    for (size_t ii = 0; ii < batch.size(); ++ii)
+    {
+        if (withMiss[ii].row == offDEM.row)
+        {
+            TEST_ASSERT(std::isnan(batch[ii][0]));
+            TEST_ASSERT(std::isnan(batch[ii][1]));
+            TEST_ASSERT(std::isnan(batch[ii][2]));
+        }
+        else
+        {
+            TEST_ASSERT_EQ((batch[ii] -
+                            model->imageToScene(withMiss[ii], elevation)).norm(),
+                           0.0);
+        }
+    }
+}
+
+TEST_CASE(testImageToSceneUnbounded)
+{
+    // Without a height range the march starts far above the DEM, where the
+    // contour is off of it
+    const io::TempFile tempfile;
+    writeGrid(tempfile.pathname(), makePosts(true), false);
+    scene::GridElevationSource::GridInfo info = getGridInfo();
+    info.minHeight = info.maxHeight =
+            std::numeric_limits<double>::quiet_NaN();
+    const scene::GridElevationSource unbounded(tempfile.pathname(), info);
+    const scene::GridElevationSource bounded(tempfile.pathname(),
+                                             getGridInfo());
+
+    const std::unique_ptr<scene::ProjectionModel> model = makeModel();
+    const scene::ECEFToLLATransform ecefToLatLon;
+    const double heightThreshold = 0.01;
+    for (const types::RowCol<double>& imagePoint : makeImagePoints())
+    {
+        const scene::LatLonAlt top = ecefToLatLon.transform(
+                model->imageToScene(imagePoint, unbounded.getMaxHeight()));
+        TEST_ASSERT(std::isnan(unbounded.findHeight(
+                scene::LatLon(top.getLat(), top.getLon()))));
+
+        const scene::Vector3 scenePoint = model->imageToScene(
+                imagePoint, unbounded, scene::AdjustableParams(),
+                heightThreshold);
+        const scene::LatLonAlt lla = ecefToLatLon.transform(scenePoint);
+        TEST_ASSERT_LESSER(std::abs(lla.getAlt() - bounded.getHeight(
+                scene::LatLon(lla.getLat(), lla.getLon()))),
+                heightThreshold);
+    }
+}
+
+TEST_MAIN(
+    TEST_CHECK(testInterpolation);
+    TEST_CHECK(testCache);
+    TEST_CHECK(testHeightRange);
+    TEST_CHECK(testVoids);
+    TEST_CHECK(testGeoTIFF);
+    TEST_CHECK(testImageToSceneFlat);
+    TEST_CHECK(testImageToSceneTerrain);
+    TEST_CHECK(testImageToSceneUnbounded);
+    )
@@ -0,0 +1,356 @@
+/* =========================================================================
+ * This file is part of scene-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * scene-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <math.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <std/span>
+
+#include <scene/ProjectionModel.h>
+#include <scene/Utilities.h>
+
+#include "TestCase.h"
+
+// A right-looking collection heading north, SCP 500km down and 300km east
+struct Geometry final
+{
+    scene::Vector3 scp;
+    scene::Vector3 slantNormal;
+    scene::Vector3 rowVector;
+    scene::Vector3 colVector;
+    math::poly::OneD<scene::Vector3> arpPoly;
+    double rangeCA = 0.0;
+    int lookDir = -1;
+
+    Geometry() : arpPoly(2)
+    {
+        const scene::LatLonAlt scpLLA(30.0, -100.0, 100.0);
+        scp = scene::Utilities::latLonToECEF(scpLLA);
+
+        const double lat = scpLLA.getLatRadians();
+        const double lon = scpLLA.getLonRadians();
+        scene::Vector3 up;
+        up[0] = cos(lat) * cos(lon);
+        up[1] = cos(lat) * sin(lon);
+        up[2] = sin(lat);
+        scene::Vector3 east;
+        east[0] = -sin(lon);
+        east[1] = cos(lon);
+        east[2] = 0.0;
+        const scene::Vector3 north = math::linear::cross(up, east);
+
+        const scene::Vector3 arp = scp + 500.0e3 * up - 300.0e3 * east;
+        const scene::Vector3 vel = 7000.0 * north;
+        arpPoly[0] = arp;
+        arpPoly[1] = vel;
+        arpPoly[2] = -4.0 * up + 0.25 * east;
+        rangeCA = (arp - scp).norm();
+
+        rowVector = scp - arp;
+        rowVector.normalize();
+        colVector = vel - rowVector * vel.dot(rowVector);
+        colVector.normalize();
+        slantNormal = math::linear::cross(rowVector, colVector);
+    }
+};
+
+static math::poly::TwoD<double> makePoly(double c00, double c10, double c01,
+                                         double c11)
+{
+    math::poly::TwoD<double> retval(1, 1);
+    retval[0][0] = c00;
+    retval[1][0] = c10;
+    retval[0][1] = c01;
+    retval[1][1] = c11;
+    return retval;
+}
+
+static std::unique_ptr<scene::ProjectionModel> makePlaneModel()
+{
+    const Geometry geom;
+    return std::unique_ptr<scene::ProjectionModel>(
+            new scene::PlaneProjectionModel(
+                    geom.slantNormal, geom.rowVector, geom.colVector,
+                    geom.scp, geom.arpPoly,
+                    makePoly(0.002, 1.0e-7, 1.0 / 7000.0, 1.0e-9),
+                    geom.lookDir));
+}
+
+static std::unique_ptr<scene::ProjectionModel> makeRangeAzimModel()
+{
+    const Geometry geom;
+    std::vector<double> polarAngle{ 0.0, -0.012, 1.0e-4 };
+    std::vector<double> ksf{ 1.0, 0.01, 0.05 };
+    return std::unique_ptr<scene::ProjectionModel>(
+            new scene::RangeAzimProjectionModel(
+                    math::poly::OneD<double>(polarAngle),
+                    math::poly::OneD<double>(ksf),
+                    geom.slantNormal, geom.rowVector, geom.colVector,
+                    geom.scp, geom.arpPoly,
+                    makePoly(0.002, 1.0e-6, 2.0e-6, 1.0e-9),
+                    geom.lookDir));
+}
+
+static std::unique_ptr<scene::ProjectionModel> makeRangeZeroModel()
+{
+    const Geometry geom;
+    std::vector<double> timeCA{ 0.0, 1.0 / 7000.0, 1.0e-9 };
+    return std::unique_ptr<scene::ProjectionModel>(
+            new scene::RangeZeroProjectionModel(
+                    math::poly::OneD<double>(timeCA),
+                    makePoly(1.0, 1.0e-6, 1.0e-6, 1.0e-10),
+                    geom.rangeCA,
+                    geom.slantNormal, geom.rowVector, geom.colVector,
+                    geom.scp, geom.arpPoly,
+                    makePoly(0.01, 1.0e-6, 1.0 / 7000.0, 1.0e-9),
+                    geom.lookDir));
+}
+
+static std::unique_ptr<scene::ProjectionModel> makeGeodeticModel()
+{
+    const Geometry geom;
+    return std::unique_ptr<scene::ProjectionModel>(
+            new scene::GeodeticProjectionModel(
+                    geom.slantNormal, geom.scp, geom.arpPoly,
+                    makePoly(0.002, -1.0e-4, 1.0e-4, 1.0e-7),
+                    geom.lookDir));
+}
+
+// Largest difference relative to the largest finite-difference partial
+template<size_t M, size_t N>
+static double relativeError(const math::linear::MatrixMxN<M, N>& analytic,
+                            const math::linear::MatrixMxN<M, N>& finiteDiff)
+{
+    double maxDiff = 0.0;
+    double maxValue = 0.0;
+    for (size_t ii = 0; ii < M; ++ii)
+    {
+        for (size_t jj = 0; jj < N; ++jj)
+        {
+            maxDiff = std::max(maxDiff,
+                               std::abs(analytic(ii, jj) - finiteDiff(ii, jj)));
+            maxValue = std::max(maxValue, std::abs(finiteDiff(ii, jj)));
+        }
+    }
+    return maxDiff / maxValue;
+}
+
+static void checkPartials(const std::string& testName,
+                          const scene::ProjectionModel& model,
+                          const types::RowCol<double>& imagePt)
+{
+    // Finite differences of the iterative projections carry their
+    // convergence error divided by the step, so don't make it too small
+    const double delta = 0.01;
+    const double height = 100.0;
+    const double tolerance = 1.0e-4;
+
+    const scene::Vector3 scenePt = model.imageToScene(imagePt, height);
+    TEST_ASSERT_LESSER(
+            relativeError(model.imageToScenePartials(imagePt, height, scenePt),
+                          model.imageToScenePartials(imagePt, height, scenePt,
+                                                     delta)),
+            tolerance);
+    TEST_ASSERT_LESSER(
+            relativeError(model.imageToSceneSensorPartials(imagePt, height,
+                                                           scenePt),
+                          model.imageToSceneSensorPartials(imagePt, height,
+                                                           scenePt, delta)),
+            tolerance);
+    TEST_ASSERT_LESSER(
+            relativeError(model.imageToSceneHeightPartial(imagePt, height,
+                                                          scenePt),
+                          model.imageToSceneHeightPartial(imagePt, height,
+                                                          scenePt, delta)),
+            tolerance);
+
+    const types::RowCol<double> sceneImagePt = model.sceneToImage(scenePt);
+    TEST_ASSERT_LESSER(
+            relativeError(model.sceneToImagePartials(scenePt, sceneImagePt),
+                          model.sceneToImagePartials(scenePt, sceneImagePt,
+                                                     delta)),
+            tolerance);
+    TEST_ASSERT_LESSER(
+            relativeError(model.sceneToImageSensorPartials(scenePt,
+                                                           sceneImagePt),
+                          model.sceneToImageSensorPartials(scenePt,
+                                                           sceneImagePt,
+                                                           delta)),
+            tolerance);
+    TEST_ASSERT_LESSER(
+            relativeError(model.slantToImagePartials(imagePt),
+                          model.slantToImagePartials(imagePt, delta)),
+            tolerance);
+}
+
+static void checkModel(const std::string& testName,
+                       scene::ProjectionModel& model,
+                       double imageScale)
+{
+    const std::vector<types::RowCol<double> > imagePts{
+        types::RowCol<double>(0.0, 0.0),
+        types::RowCol<double>(150.0 * imageScale, -200.0 * imageScale),
+        types::RowCol<double>(-300.0 * imageScale, 250.0 * imageScale) };
+
+    for (const auto& imagePt : imagePts)
+    {
+        checkPartials(testName, model, imagePt);
+    }
+
+    // Adjustable parameters rotate with the RIC frame across the image
+    scene::AdjustableParams& params = model.getAdjustableParams();
+    params.mParams[scene::AdjustableParams::ARP_RADIAL] = 20.0;
+    params.mParams[scene::AdjustableParams::ARP_IN_TRACK] = -15.0;
+    params.mParams[scene::AdjustableParams::ARP_VEL_CROSS_TRACK] = 0.5;
+    params.mParams[scene::AdjustableParams::RANGE_BIAS] = 3.0;
+    for (const auto frameType : { scene::FrameType::RIC_ECF,
+                                  scene::FrameType::RIC_ECI,
+                                  scene::FrameType::ECF })
+    {
+        model.getErrors().mFrameType = frameType;
+        for (const auto& imagePt : imagePts)
+        {
+            checkPartials(testName, model, imagePt);
+        }
+    }
+}
+
+TEST_CASE(testPlane)
+{
+    checkModel(testName, *makePlaneModel(), 1.0);
+}
+
+TEST_CASE(testRangeAzim)
+{
+    checkModel(testName, *makeRangeAzimModel(), 1.0);
+}
+
+TEST_CASE(testRangeZero)
+{
+    checkModel(testName, *makeRangeZeroModel(), 1.0);
+}
+
+TEST_CASE(testGeodetic)
+{
+    // Image coordinates are arc seconds
+    checkModel(testName, *makeGeodeticModel(), 0.03);
+}
+
+TEST_CASE(testContourPartials)
+{
+    // The analytic contour partials against finite differences of
+    // computeContour()
+    const std::unique_ptr<scene::ProjectionModel> models[] = {
+        makePlaneModel(), makeRangeAzimModel(), makeRangeZeroModel() };
+    const types::RowCol<double> imagePt(-120.0, 80.0);
+    for (const auto& model : models)
+    {
+        const math::linear::MatrixMxN<2, 2> analytic =
+                model->computeContourPartials(imagePt);
+
+        double r, rDot, rDelta, rDotDelta;
+        const double delta = 0.001;
+        const auto contour = [&](const types::RowCol<double>& pt,
+                                 double& r_, double& rDot_)
+        {
+            const double timeCOA = model->computeImageTime(pt);
+            model->computeContour(model->computeARPPosition(timeCOA),
+                                  model->computeARPVelocity(timeCOA),
+                                  timeCOA, pt, &r_, &rDot_);
+        };
+        contour(imagePt, r, rDot);
+        contour(types::RowCol<double>(imagePt.row + delta, imagePt.col),
+                rDelta, rDotDelta);
+        TEST_ASSERT_ALMOST_EQ_EPS(analytic(0, 0), (rDelta - r) / delta, 1.0e-5);
+        TEST_ASSERT_ALMOST_EQ_EPS(analytic(1, 0), (rDotDelta - rDot) / delta, 1.0e-5);
+        contour(types::RowCol<double>(imagePt.row, imagePt.col + delta),
+                rDelta, rDotDelta);
+        TEST_ASSERT_ALMOST_EQ_EPS(analytic(0, 1), (rDelta - r) / delta, 1.0e-5);
+        TEST_ASSERT_ALMOST_EQ_EPS(analytic(1, 1), (rDotDelta - rDot) / delta, 1.0e-5);
+    }
+}
+
+TEST_CASE(testBatch)
+{
+    const std::unique_ptr<scene::ProjectionModel> models[] = {
+        makePlaneModel(), makeRangeAzimModel(), makeRangeZeroModel() };
+
+    // A small DEM-like grid
+    std::vector<types::RowCol<double> > imagePts;
+    std::vector<double> heights;
+    for (double row = -500.0; row <= 500.0; row += 50.0)
+    {
+        for (double col = -500.0; col <= 500.0; col += 50.0)
+        {
+            imagePts.emplace_back(row, col);
+            heights.push_back(100.0 + 0.1 * row - 0.05 * col);
+        }
+    }
+    const std::span<const types::RowCol<double> > imageSpan(imagePts.data(),
+                                                            imagePts.size());
+    const std::span<const double> heightSpan(heights.data(), heights.size());
+
+    for (const auto& model : models)
+    {
+        for (const size_t numThreads : { 1, 4, 0 })
+        {
+            std::vector<scene::Vector3> scenePts(imagePts.size());
+            model->imageToScene(imageSpan, heightSpan,
+                                std::span<scene::Vector3>(scenePts.data(),
+                                                          scenePts.size()),
+                                numThreads);
+
+            std::vector<types::RowCol<double> > roundTrip(imagePts.size());
+            model->sceneToImage(
+                    std::span<const scene::Vector3>(scenePts.data(),
+                                                    scenePts.size()),
+                    std::span<types::RowCol<double> >(roundTrip.data(),
+                                                      roundTrip.size()),
+                    numThreads);
+
+            for (size_t ii = 0; ii < imagePts.size(); ++ii)
+            {
+                TEST_ASSERT(scenePts[ii] ==
+                            model->imageToScene(imagePts[ii], heights[ii]));
+                TEST_ASSERT_ALMOST_EQ_EPS(roundTrip[ii].row, imagePts[ii].row,
+                                          1.0e-5);
+                TEST_ASSERT_ALMOST_EQ_EPS(roundTrip[ii].col, imagePts[ii].col,
+                                          1.0e-5);
+            }
+        }
+    }
+
+    std::vector<scene::Vector3> tooFew(imagePts.size() - 1);
+    TEST_EXCEPTION(models[0]->imageToScene(
+            imageSpan, heightSpan,
+            std::span<scene::Vector3>(tooFew.data(), tooFew.size())));
+}
+
+TEST_MAIN(
+    TEST_CHECK(testPlane);
+    TEST_CHECK(testRangeAzim);
+    TEST_CHECK(testRangeZero);
+    TEST_CHECK(testGeodetic);
+    TEST_CHECK(testContourPartials);
+    TEST_CHECK(testBatch);
+    )
@@ -36,12 +36,15 @@
 #include "six/sicd/Grid.h"
 #include "six/sicd/ImageData.h"
 #include "six/sicd/ImageFormation.h"
+#include "six/sicd/MeshInterpolator.h"
 #include "six/sicd/PFA.h"
 #include "six/sicd/Position.h"
 #include "six/sicd/RadarCollection.h"
+#include "six/sicd/RadiometricCalibrator.h"
 #include "six/sicd/RgAzComp.h"
 #include "six/sicd/SICDMesh.h"
 #include "six/sicd/SCPCOA.h"
+#include "six/sicd/SpectralProcessor.h"
 #include "six/sicd/Utilities.h"
 #include "six/sicd/NITFReadComplexXMLControl.h"
 
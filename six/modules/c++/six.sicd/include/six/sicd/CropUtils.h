@@ -25,8 +25,12 @@
 
 #include <string>
 #include <vector>
+#include <memory>
+#include <mutex>
 
 #include <scene/Types.h>
+#include <scene/SceneGeometry.h>
+#include <scene/ProjectionModel.h>
 #include <six/NITFReadControl.h>
 #include <six/sicd/ComplexData.h>
 
@@ -130,6 +134,114 @@ mem::auto_ptr<six::sicd::ComplexData>
 cropMetaData(const six::sicd::ComplexData& complexData,
              const types::RowCol<size_t>& aoiOffset,
              const types::RowCol<size_t>& aoiDims);
+
+/*!
+ * \struct CropRequest
+ * \brief A single AOI to cut from a SICD and where to write it
+ */
+struct CropRequest final
+{
+    CropRequest() = default;
+    CropRequest(const types::RowCol<size_t>& aoiOffset,
+                const types::RowCol<size_t>& aoiDims,
+                const std::string& outPathname) :
+        aoiOffset(aoiOffset),
+        aoiDims(aoiDims),
+        outPathname(outPathname)
+    {
+    }
+
+    //! Upper left corner of AOI
+    types::RowCol<size_t> aoiOffset;
+
+    //! Size of AOI
+    types::RowCol<size_t> aoiDims;
+
+    //! Output cropped SICD pathname
+    std::string outPathname;
+};
+
+/*!
+ * \class StreamingCropper
+ * \brief Cuts any number of AOIs out of one already-loaded SICD
+ *
+ * Unlike the cropSICD() functions, which read the whole AOI into memory and
+ * then write it, this streams each AOI through two band buffers of
+ * numRowsPerBand rows: the next band is read while the current one is written
+ * via SICDWriteControl.  Pixels are copied in the file's own pixel type, so
+ * nothing is converted to complex<float> and back.
+ *
+ * The scene geometry and projection model are built once, so cutting many
+ * chips from the same image only pays for the metadata update of each chip.
+ * Multiple crops may run concurrently; reads from the shared reader are
+ * serialized internally, while each crop writes its own output file.
+ *
+ * NITFReadControl::load() must be called prior to constructing this, and the
+ * reader must not be used by anyone else while a crop is in progress.
+ */
+class StreamingCropper final
+{
+public:
+    //! Default number of rows read and written at a time
+    static const size_t DEFAULT_NUM_ROWS_PER_BAND = 256;
+
+    /*!
+     * Constructor
+     *
+     * \param reader Loaded reader for the input SICD
+     * \param schemaPaths Schema paths to use for writing
+     * \param numRowsPerBand Number of rows in each band buffer.  Memory use
+     * per crop is two bands of the AOI's width.
+     */
+    StreamingCropper(six::NITFReadControl& reader,
+                     const std::vector<std::string>& schemaPaths,
+                     size_t numRowsPerBand = DEFAULT_NUM_ROWS_PER_BAND);
+
+    StreamingCropper(const StreamingCropper&) = delete;
+    StreamingCropper& operator=(const StreamingCropper&) = delete;
+
+    /*!
+     * Creates a single cropped SICD, updating the metadata as appropriate
+     *
+     * \param aoiOffset Upper left corner of AOI
+     * \param aoiDims Size of AOI
+     * \param outPathname Output cropped SICD pathname
+     */
+    void crop(const types::RowCol<size_t>& aoiOffset,
+              const types::RowCol<size_t>& aoiDims,
+              const std::string& outPathname);
+
+    /*!
+     * Creates one cropped SICD per request.  All AOIs are bounds-checked
+     * before any output is written.
+     *
+     * \param requests AOIs to crop
+     * \param numThreads Number of crops to run at once.  If 0, uses the
+     * number of hardware threads.
+     */
+    void crop(const std::vector<CropRequest>& requests,
+              size_t numThreads = 0);
+
+    //! \return The complex data of the input SICD
+    const ComplexData& getComplexData() const
+    {
+        return *mData;
+    }
+
+private:
+    void checkAOI(const types::RowCol<size_t>& aoiOffset,
+                  const types::RowCol<size_t>& aoiDims) const;
+
+    six::NITFReadControl& mReader;
+    const std::vector<std::string> mSchemaPaths;
+    const size_t mNumRowsPerBand;
+    const ComplexData* mData;
+    std::unique_ptr<const scene::SceneGeometry> mGeom;
+    std::unique_ptr<const scene::ProjectionModel> mProjection;
+
+    // NITFReadControl is not reentrant
+    std::mutex mReadMutex;
+};
 }
 }
 
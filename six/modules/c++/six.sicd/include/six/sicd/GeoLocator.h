@@ -23,6 +23,8 @@
 #ifndef __SIX_SICD_GEOLOCATOR_H__
 #define __SIX_SICD_GEOLOCATOR_H__
 
+#include <std/span>
+
 #include <scene/GridECEFTransform.h>
 #include <scene/ECEFToLLATransform.h>
 #include <six/sicd/ComplexData.h>
@@ -55,6 +57,14 @@ public:
      */
     LatLonAlt geolocate(const RowColDouble& rowCol) const;
 
+    /*!
+     * Find the locations of many SICD pixels in the output plane
+     * \param rowCols Pixel locations in SICD
+     * \param llas Corresponding locations in output plane; must be the
+     * same size as rowCols
+     */
+    void geolocate(std::span<const RowColDouble> rowCols, std::span<LatLonAlt> llas) const;
+
 private:
     scene::PlanarGridECEFTransform buildTransformer(
             const ComplexData& complexData, bool shadowsDown) const;
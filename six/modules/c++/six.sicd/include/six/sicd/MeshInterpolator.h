@@ -0,0 +1,189 @@
+/* =========================================================================
+ * This file is part of six.sicd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six.sicd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef __SIX_SICD_MESH_INTERPOLATOR_H__
+#define __SIX_SICD_MESH_INTERPOLATOR_H__
+
+#include <stddef.h>
+
+#include <limits>
+#include <vector>
+
+#include <std/span>
+
+#include <types/RowCol.h>
+#include <six/sicd/ComplexData.h>
+#include <six/sicd/SICDMesh.h>
+
+namespace six
+{
+namespace sicd
+{
+/*!
+ * \class MeshInterpolator
+ * \brief Bilinearly interpolates fields of a PlanarCoordinateMesh
+ *
+ * The mesh nodes are (x, y) distances from the SCP in meters, the same
+ * coordinates as ComplexData::pixelToImagePoint().  A field is one value
+ * per node, in the mesh's row-major order, such as
+ * NoiseMesh::getCombinedNoise() or one of ScalarMesh::getScalars().
+ *
+ * The cell structure of the mesh is worked out once at construction:
+ * - If x only changes from mesh row to mesh row and y only from column to
+ *   column (a rectilinear mesh), each axis is searched on its own.  Over a
+ *   grid of points, the search is done once per output row and column,
+ *   and each output row is a blend of two mesh rows followed by a
+ *   gather, which the compiler vectorizes.
+ * - Otherwise the cells are bucketed on a regular grid over the mesh's
+ *   extent, and each point is located by inverting the bilinear map of
+ *   the cells in its bucket.  Over a grid, the previous point's cell is
+ *   tried first.
+ *
+ * Points outside the mesh get the fill value.  Interpolation is thread
+ * safe, and the batch calls split their points over numThreads (0 means
+ * one per core).
+ */
+class MeshInterpolator
+{
+public:
+    /*!
+     * \param mesh Mesh to interpolate.  Its node positions are copied.
+     * \param fillValue Value for points outside the mesh
+     *
+     * \throw except::Exception if the mesh has fewer than 2 rows or
+     * columns of nodes, or its x and y don't match its dimensions
+     */
+    explicit MeshInterpolator(
+            const PlanarCoordinateMesh& mesh,
+            double fillValue = std::numeric_limits<double>::quiet_NaN());
+
+    //! \return True if the fast, separable lookup is used
+    bool isRectilinear() const
+    {
+        return mRectilinear;
+    }
+
+    types::RowCol<size_t> getMeshDims() const
+    {
+        return mMeshDims;
+    }
+
+    double getFillValue() const
+    {
+        return mFillValue;
+    }
+
+    //! \return field interpolated at (x, y)
+    double interpolate(std::span<const double> field,
+                       double x,
+                       double y) const;
+
+    /*!
+     * Interpolates field at each point (x[ii], y[ii])
+     *
+     * \param[out] output One value per point
+     */
+    void interpolate(std::span<const double> field,
+                     std::span<const double> x,
+                     std::span<const double> y,
+                     std::span<double> output,
+                     size_t numThreads = 0) const;
+
+    /*!
+     * Interpolates field over a regular grid.  Row ii, column jj of output
+     * is at (start.row + ii * step.row, start.col + jj * step.col).
+     *
+     * \param[out] output Row-major values, dims.area() of them
+     */
+    void interpolateGrid(std::span<const double> field,
+                         const types::RowCol<double>& start,
+                         const types::RowCol<double>& step,
+                         const types::RowCol<size_t>& dims,
+                         std::span<double> output,
+                         size_t numThreads = 0) const;
+
+    /*!
+     * The mesh coordinates of a SICD's pixels, for interpolateGrid():
+     * pixel (row, col) is at start + (row, col) * step
+     */
+    static void getPixelGrid(const ComplexData& complexData,
+                             types::RowCol<double>& start,
+                             types::RowCol<double>& step);
+
+private:
+    static const size_t NO_CELL;
+
+    // A located point: the cell's first node, and where in the cell
+    struct Location
+    {
+        size_t node;
+        double u;  // Toward the next mesh row
+        double v;  // Toward the next mesh column
+    };
+
+    void checkField(std::span<const double> field) const;
+
+    double blend(std::span<const double> field,
+                 const Location& location) const;
+
+    // Rectilinear meshes: index of the axis interval holding value, or
+    // NO_CELL, and the fraction of the way across it
+    static size_t locateOnAxis(const std::vector<double>& axis,
+                               bool ascending,
+                               double value,
+                               double& fraction);
+
+    // Other meshes
+    void buildBuckets();
+    bool isInCell(size_t cell, double x, double y, Location& location) const;
+    bool locate(double x, double y, size_t& hint, Location& location) const;
+
+    void interpolateGridRectilinear(std::span<const double> field,
+                                    const types::RowCol<double>& start,
+                                    const types::RowCol<double>& step,
+                                    const types::RowCol<size_t>& dims,
+                                    double* output,
+                                    size_t numThreads) const;
+
+    types::RowCol<size_t> mMeshDims;
+    double mFillValue;
+    std::vector<double> mX;
+    std::vector<double> mY;
+
+    bool mRectilinear;
+    std::vector<double> mRowX;  // x of each mesh row
+    std::vector<double> mColY;  // y of each mesh column
+    bool mRowXAscending;
+    bool mColYAscending;
+
+    // Cells overlapping bucket b are mBucketCells[mBucketStart[b]] up to
+    // mBucketCells[mBucketStart[b + 1]]
+    types::RowCol<size_t> mNumBuckets;
+    types::RowCol<double> mBucketOrigin;
+    types::RowCol<double> mBucketSize;
+    std::vector<size_t> mBucketStart;
+    std::vector<size_t> mBucketCells;
+};
+}
+}
+
+#endif
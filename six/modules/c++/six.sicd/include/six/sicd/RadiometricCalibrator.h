@@ -0,0 +1,195 @@
+/* =========================================================================
+ * This file is part of six.sicd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six.sicd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef __SIX_SICD_RADIOMETRIC_CALIBRATOR_H__
+#define __SIX_SICD_RADIOMETRIC_CALIBRATOR_H__
+
+#include <stddef.h>
+
+#include <complex>
+#include <functional>
+#include <vector>
+
+#include <std/span>
+
+#include <types/RowCol.h>
+#include <six/NITFReadControl.h>
+#include <six/Types.h>
+#include <six/sicd/ComplexData.h>
+
+namespace six
+{
+namespace sicd
+{
+/*!
+ * \class RadiometricCalibrator
+ * \brief Applies a SICD's Radiometric parameters to its pixels
+ *
+ * Each output pixel is
+ *
+ *     SF(xrow, ycol) * (|pixel|^2 - N(xrow, ycol))
+ *
+ * where SF is the scale factor polynomial of the chosen calibration (1 for
+ * POWER), N is the absolute noise power from NoiseLevel.NoisePoly when
+ * noise is subtracted (0 otherwise), and (xrow, ycol) is the pixel's
+ * distance in meters from the SCP.  Noise subtracted values aren't clipped,
+ * so they may be negative.
+ *
+ * The polynomials are evaluated over each row by first collapsing them to
+ * a polynomial in ycol, then evaluating that with Horner's method across
+ * the row, which the compiler vectorizes.  This is O(order) per pixel
+ * rather than the O(order^2) of Poly2D::operator(), and matches it to
+ * rounding.
+ */
+class RadiometricCalibrator
+{
+public:
+    static const size_t DEFAULT_MAX_MEMORY_BYTES = 256 * 1024 * 1024;
+
+    enum class Calibration
+    {
+        POWER,       //!< |pixel|^2
+        RCS,         //!< Radiometric.RCSSFPoly
+        SIGMA_ZERO,  //!< Radiometric.SigmaZeroSFPoly
+        BETA_ZERO,   //!< Radiometric.BetaZeroSFPoly
+        GAMMA_ZERO   //!< Radiometric.GammaZeroSFPoly
+    };
+
+    struct Options
+    {
+        Calibration calibration = Calibration::SIGMA_ZERO;
+
+        //! Subtract the noise power before scaling
+        bool subtractNoise = false;
+
+        /*!
+         * Upper bound on the pixel buffers used by calibrate() on a
+         * reader.  At least one row is always processed at a time.
+         */
+        size_t maxMemoryBytes = DEFAULT_MAX_MEMORY_BYTES;
+
+        //! Threads used for calibration.  0 means one per core.
+        size_t numThreads = 0;
+    };
+
+    /*!
+     * Receives each calibrated band: numRows rows of the SICD starting at
+     * startRow, row-major
+     */
+    typedef std::function<void(size_t startRow,
+                               size_t numRows,
+                               std::span<const float> band)> BandSink;
+
+    /*!
+     * \param complexData Metadata of the SICD to calibrate.  Only the
+     * polynomials and geometry needed are copied out of it.
+     * \param options Processing options
+     *
+     * \throw except::Exception if the SICD has no Radiometric parameters,
+     * the polynomial for the calibration is missing, or noise is to be
+     * subtracted and the SICD doesn't give an ABSOLUTE noise polynomial
+     */
+    RadiometricCalibrator(const ComplexData& complexData,
+                          const Options& options);
+    explicit RadiometricCalibrator(const ComplexData& complexData);
+
+    /*!
+     * Calibrates a block of pixels
+     *
+     * \param pixels Block of the SICD, row-major
+     * \param offset Row and column of the block's first pixel in the SICD
+     * \param numCols Columns in the block
+     * \param[out] output Calibrated block, the same size as pixels
+     */
+    void calibrate(std::span<const std::complex<float> > pixels,
+                   const types::RowCol<size_t>& offset,
+                   size_t numCols,
+                   std::span<float> output) const;
+
+    /*!
+     * Streams a whole SICD through the calibration in bands of rows.  The
+     * next band is read in the background while the current one is
+     * calibrated and handed to sink, so the reader is only ever used by
+     * one thread at a time.
+     *
+     * \param reader Reader that has loaded the SICD described by the
+     * ComplexData given to the constructor
+     * \param sink Receives each band in order
+     */
+    void calibrate(NITFReadControl& reader, const BandSink& sink) const;
+
+    //! \return Number of rows calibrate() on a reader handles at a time
+    size_t getNumRowsPerBand() const;
+
+    /*!
+     * Evaluates poly over a regular grid.  Row ii, column jj of output is
+     * poly(start.row + ii * step.row, start.col + jj * step.col).
+     *
+     * \param[out] output Row-major values, dims.area() of them
+     */
+    static void evaluateGrid(const Poly2D& poly,
+                             const types::RowCol<double>& start,
+                             const types::RowCol<double>& step,
+                             const types::RowCol<size_t>& dims,
+                             std::span<double> output);
+
+private:
+    // Poly2D coefficients, row-major by power of x; empty if unused
+    struct Polynomial
+    {
+        size_t numX = 0;
+        size_t numY = 0;
+        std::vector<double> coefficients;
+    };
+
+    static Polynomial flatten(const Poly2D& poly);
+
+    /*
+     * Evaluates poly at (x, y0 + jj * dy) for jj in [0, numCols).  scratch
+     * holds poly.numY values.
+     */
+    static void evaluateRow(const Polynomial& poly,
+                            double x,
+                            double y0,
+                            double dy,
+                            size_t numCols,
+                            double* scratch,
+                            double* output);
+
+    void calibrateRows(const std::complex<float>* pixels,
+                       const types::RowCol<size_t>& offset,
+                       const types::RowCol<size_t>& dims,
+                       float* output) const;
+
+    Options mOptions;
+    Polynomial mScaleFactor;  // Empty for POWER
+    Polynomial mNoise;  // dB; empty unless noise is subtracted
+    types::RowCol<size_t> mImageDims;
+
+    // Pixel (0, 0) of the SICD in meters from the SCP, and the spacing
+    types::RowCol<double> mOrigin;
+    types::RowCol<double> mSampleSpacing;
+};
+}
+}
+
+#endif
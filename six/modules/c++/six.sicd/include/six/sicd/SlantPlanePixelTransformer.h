@@ -25,6 +25,7 @@
 
 #include <string>
 #include <vector>
+#include <std/span>
 
 #include <types/RowCol.h>
 #include <scene/Types.h>
@@ -77,6 +78,15 @@ public:
      */
     scene::LatLonAlt toLLA(const types::RowCol<double>& pixel) const;
 
+    /*!
+     *  \fn toLLA
+     *  \param pixels - Slant Plane pixels with (row,col) indices
+     *  \param llas   - Ground plane locations in LLA; must be the same
+     *                  size as pixels
+     */
+    void toLLA(std::span<const types::RowCol<double>> pixels,
+               std::span<scene::LatLonAlt> llas) const;
+
     /*!
      *  \fn toLatLon
      *  \param pixel - Slant Plane pixel with (row,col) index
@@ -0,0 +1,184 @@
+/* =========================================================================
+ * This file is part of six.sicd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six.sicd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef __SIX_SICD_SPECTRAL_PROCESSOR_H__
+#define __SIX_SICD_SPECTRAL_PROCESSOR_H__
+
+#include <stddef.h>
+
+#include <complex>
+#include <vector>
+
+#include <six/Enums.h>
+#include <six/sicd/ComplexData.h>
+#include <six/sicd/Grid.h>
+
+namespace six
+{
+namespace sicd
+{
+/*!
+ * \class SpectralProcessor
+ * \brief Filters a SICD in the spatial frequency domain of one dimension
+ *
+ * Each line of the image along the chosen dimension (each column for ROW,
+ * each row for COL) is transformed to spatial frequency with the Grid's
+ * FFT sign, filtered, and transformed back.  The support of the image in
+ * that dimension is ImpRespBW wide, centered on DeltaKCOAPoly evaluated at
+ * the middle of the image; a spatially varying DeltaKCOA is not followed.
+ * The Grid's weights are sampled evenly across that support.
+ *
+ * Lines are processed in tiles, across threads.  For ROW, each tile of
+ * columns is transposed into contiguous lines on the way in and back on
+ * the way out, so the image is always read and written a row at a time.
+ *
+ * Every operation updates a copy of the ComplexData to describe its
+ * output.  Only the Grid and ImageData are changed; in particular,
+ * splitting the columns into sub-apertures does not adjust TimeCOAPoly or
+ * the collection times.
+ */
+class SpectralProcessor
+{
+public:
+    enum class Dimension
+    {
+        ROW,  //!< Along increasing row, i.e. Grid.Row
+        COL   //!< Along increasing column, i.e. Grid.Col
+    };
+
+    //! Weights computed from a WeightType have this many samples
+    static const size_t NUM_WEIGHTS = 512;
+
+    /*!
+     * \param numThreads Threads to use.  0 means one per core.
+     */
+    explicit SpectralProcessor(size_t numThreads = 0);
+
+    /*!
+     * Removes the weighting from dimension, leaving it UNIFORM
+     *
+     * \throw except::Exception if the current weighting is not known
+     */
+    void deweight(ComplexImageResult& image, Dimension dimension) const;
+
+    /*!
+     * Replaces the weighting of dimension.  Support where the current
+     * weight is under 0.1% of its peak can't be recovered and is zeroed;
+     * spectrum outside the support is left alone.
+     *
+     * \param image Image to filter in place, and its metadata
+     * \param dimension Dimension to reweight
+     * \param weightType New WgtType
+     * \param weights New WgtFunct.  If empty, it's computed from
+     * weightType (NUM_WEIGHTS samples), which must then be UNIFORM,
+     * HAMMING, HANNING or KAISER.
+     *
+     * \throw except::Exception if either weighting is not known
+     */
+    void applyWeights(ComplexImageResult& image,
+                      Dimension dimension,
+                      const WeightType& weightType,
+                      const std::vector<double>& weights =
+                              std::vector<double>()) const;
+
+    /*!
+     * Splits the support of dimension into numParts equal, adjacent bands,
+     * lowest spatial frequency first: sub-apertures for COL, sub-bands for
+     * ROW.  Each output is the full size of the input, so the parts stay
+     * registered to it, and keeps its share of the weighting.
+     */
+    std::vector<ComplexImageResult> split(const ComplexImage& image,
+                                          Dimension dimension,
+                                          size_t numParts) const;
+
+    /*!
+     * Upsamples dimension by an integer factor by zero-padding its
+     * spectrum.  Pixel (row, col) of the input is pixel (row, col) *
+     * factor of the output, which has factor times the first row or column,
+     * SCP pixel and valid data, and 1 / factor the sample spacing.
+     */
+    ComplexImageResult upsample(const ComplexImage& image,
+                                Dimension dimension,
+                                size_t factor) const;
+
+    /*!
+     * \return The WgtFunct of direction, or computed from its WgtType
+     * (NUM_WEIGHTS samples) if it has none.  UNIFORM gives {1, 1}.
+     *
+     * \throw except::Exception if neither describes the weighting
+     */
+    static std::vector<double> getWeights(const DirectionParameters& direction);
+
+    /*!
+     * \return Half-power width of the impulse response of a spectrum
+     * weighted by weights across bandwidth
+     */
+    static double getImpulseResponseWidth(const std::vector<double>& weights,
+                                          double bandwidth);
+
+private:
+    // Where each bin of a line's spectrum lies in the support
+    struct Support
+    {
+        size_t length;           // Samples per line
+        double binSpacing;       // Spatial frequency between bins
+        double center;           // Support center, relative to bin 0
+        double bandwidth;
+        FFTSign sign;
+    };
+
+    static DirectionParameters& getDirection(ComplexData& data,
+                                             Dimension dimension);
+    static const DirectionParameters& getDirection(const ComplexData& data,
+                                                   Dimension dimension);
+    static Support getSupport(const ComplexImage& image, Dimension dimension);
+
+    // Offset of each bin from the support center, wrapped to within half a
+    // sample rate
+    static std::vector<double> getOffsets(const Support& support);
+
+    // weights, sampled across [-bandwidth / 2, bandwidth / 2], at offset
+    static double interpolateWeight(const std::vector<double>& weights,
+                                    double bandwidth,
+                                    double offset);
+
+    /*
+     * Transforms each line of input along dimension, scales its spectrum
+     * by gains[ii] (one per bin) and transforms it back into outputs[ii],
+     * whose lines are outputLength long.  When outputLength exceeds the
+     * input's, the spectrum is zero-padded around the highest frequencies.
+     * An output may be the input.
+     */
+    void filter(const std::complex<float>* input,
+                const types::RowCol<size_t>& dims,
+                Dimension dimension,
+                FFTSign sign,
+                const std::vector<std::vector<float> >& gains,
+                size_t outputLength,
+                const std::vector<std::complex<float>*>& outputs) const;
+
+    size_t mNumThreads;
+};
+}
+}
+
+#endif
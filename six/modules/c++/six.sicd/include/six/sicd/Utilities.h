@@ -459,6 +459,30 @@ public:
             logging::Logger* logger = nullptr);
     static std::u8string toXMLString(const ComplexData&,
         const std::vector<std::filesystem::path>*, logging::Logger* pLogger = nullptr);
+
+    /*
+     * Converts 'data' to six::binary (see six/BinaryXML.h), which is much
+     * faster to pass around and parse than XML.
+     *
+     * \param data Representation of SICD data
+     * \param logger Logger.  If NULL, no logger will be used.
+     *
+     * \return six::binary representation of 'data'
+     */
+    static std::vector<std::byte> toBinary(const ComplexData& data,
+        logging::Logger* pLogger = nullptr);
+
+    /*
+     * Converts the output of toBinary() back into a ComplexData object.
+     *
+     * \param bytes six::binary representation of SICD data
+     * \param pSchemaPaths Schema path(s) to validate against; may be NULL
+     * \param logger Logger.  If NULL, no logger will be used.
+     *
+     * \return Data representation of 'bytes'
+     */
+    static std::unique_ptr<ComplexData> parseDataFromBinary(std::span<const std::byte> bytes,
+        const std::vector<std::filesystem::path>* pSchemaPaths, logging::Logger* pLogger = nullptr);
     /*!
      * Create a fake SICD that's populated enough for
      * general testing code to run without throwing exceptions
@@ -25,6 +25,7 @@
 #include <six/sicd/ComplexXMLParser.h>
 #include <six/sicd/ComplexDataBuilder.h>
 #include <six/Utilities.h>
+#include <six/CharConv.h>
 
 
 namespace
@@ -954,7 +955,7 @@ void ComplexXMLParser::parseImageDataFromXML(
             xml::lite::Attributes atts = ampXML->getAttributes();
             if (atts.contains("index"))
             {
-                int index = str::toType<int>(atts.getValue("index"));
+                int index = six::charconv::toType<int>(atts.getValue("index"));
                 if (index < 0 || index > 255)
                 {
                     log()->warn(Ctxt(
@@ -24,6 +24,7 @@
 #include <memory>
 #include <algorithm>
 #include <string>
+#include <thread>
 #include <std/span>
 #include <std/cstddef>
 
@@ -31,8 +32,12 @@
 #include <except/Exception.h>
 #include <str/Convert.h>
 #include <mem/ScopedArray.h>
+#include <sys/Runnable.h>
+#include <mt/ThreadGroup.h>
+#include <mt/ThreadPlanner.h>
 #include <six/NITFWriteControl.h>
 #include <six/sicd/Utilities.h>
+#include <six/sicd/SICDWriteControl.h>
 #include <six/sicd/SlantPlanePixelTransformer.h>
 
 #undef min
@@ -88,14 +93,24 @@ six::sicd::ComplexData* const updateMetadata(
     return aoiData;
 }
 
-void cropSICD(six::NITFReadControl& reader,
-              const std::vector<std::string>& schemaPaths_,
-              const six::sicd::ComplexData& data,
-              const scene::SceneGeometry& geom,
-              const scene::ProjectionModel& projection,
+const six::sicd::ComplexData& getComplexData(six::NITFReadControl& reader)
+{
+    // Make sure it's a SICD
+    const auto container = reader.getContainer();
+
+    const six::Data* const dataPtr = container->getData(0);
+    if (container->getDataType() != six::DataType::COMPLEX ||
+        dataPtr->getDataType() != six::DataType::COMPLEX)
+    {
+        throw except::Exception(Ctxt("Input is not a SICD"));
+    }
+
+    return *dynamic_cast<const six::sicd::ComplexData*>(dataPtr);
+}
+
+void checkAOI(const six::sicd::ComplexData& data,
               const types::RowCol<size_t>& aoiOffset,
-              const types::RowCol<size_t>& aoiDims,
-              const std::string& outPathname)
+              const types::RowCol<size_t>& aoiDims)
 {
     // Make sure the AOI is in bounds
     const auto origDims = getExtent(data);
@@ -110,27 +125,158 @@ void cropSICD(six::NITFReadControl& reader,
     {
         throw except::Exception(Ctxt("AOI must be non-empty"));
     }
+}
 
-    // Read in the AOI
-    //const size_t numBytesPerPixel(data.getNumBytesPerPixel());
-    six::Region region;
-    setOffset(region, aoiOffset);
-    setDims(region, aoiDims);
-    const auto buffer = region.setComplexBuffer(origDims.area());
-    reader.interleaved(region, 0);
+class ReadBandRunnable final : public sys::Runnable
+{
+public:
+    ReadBandRunnable(six::NITFReadControl& reader,
+                     std::mutex& readMutex,
+                     const types::RowCol<size_t>& offset,
+                     const types::RowCol<size_t>& dims,
+                     std::byte* buffer) :
+        mReader(reader),
+        mReadMutex(readMutex),
+        mOffset(offset),
+        mDims(dims),
+        mBuffer(buffer)
+    {
+    }
 
-    std::unique_ptr<six::Data> aoiData(updateMetadata(
+    void run() override
+    {
+        six::Region region;
+        setOffset(region, mOffset);
+        setDims(region, mDims);
+        region.setBuffer(mBuffer);
+
+        std::lock_guard<std::mutex> lock(mReadMutex);
+        mReader.interleaved(region, 0);
+    }
+
+private:
+    six::NITFReadControl& mReader;
+    std::mutex& mReadMutex;
+    const types::RowCol<size_t> mOffset;
+    const types::RowCol<size_t> mDims;
+    std::byte* const mBuffer;
+};
+
+/*
+ * Copies the AOI to a new SICD a band of rows at a time.  While one band is
+ * being written, the next one is read on another thread.  Pixels stay in the
+ * input's pixel type the whole way through.
+ */
+void streamAOI(six::NITFReadControl& reader,
+               std::mutex& readMutex,
+               const std::vector<std::string>& schemaPaths,
+               const six::sicd::ComplexData& aoiData,
+               const types::RowCol<size_t>& aoiOffset,
+               const types::RowCol<size_t>& aoiDims,
+               const std::string& outPathname,
+               size_t numRowsPerBand)
+{
+    numRowsPerBand = std::max<size_t>(std::min(numRowsPerBand, aoiDims.row), 1);
+    const size_t numBytesPerRow =
+            aoiDims.col * aoiData.getNumBytesPerPixel();
+
+    std::vector<std::byte> buffers[2];
+    buffers[0].resize(numRowsPerBand * numBytesPerRow);
+    buffers[1].resize(numRowsPerBand * numBytesPerRow);
+
+    six::sicd::SICDWriteControl writer(outPathname, schemaPaths);
+    writer.initialize(aoiData);
+
+    auto bandDims = [&](size_t startRow)
+    {
+        return types::RowCol<size_t>(
+                std::min(numRowsPerBand, aoiDims.row - startRow),
+                aoiDims.col);
+    };
+
+    // Prime the pipeline with the first band
+    ReadBandRunnable(reader, readMutex, aoiOffset, bandDims(0),
+                     buffers[0].data()).run();
+
+    for (size_t startRow = 0, band = 0;
+         startRow < aoiDims.row;
+         startRow += numRowsPerBand, ++band)
+    {
+        std::vector<std::byte>& current(buffers[band % 2]);
+        const size_t nextStartRow = startRow + numRowsPerBand;
+
+        mt::ThreadGroup reads;
+        if (nextStartRow < aoiDims.row)
+        {
+            const types::RowCol<size_t> nextOffset(
+                    aoiOffset.row + nextStartRow, aoiOffset.col);
+            reads.createThread(std::unique_ptr<sys::Runnable>(
+                    new ReadBandRunnable(reader, readMutex, nextOffset,
+                                         bandDims(nextStartRow),
+                                         buffers[(band + 1) % 2].data())));
+        }
+
+        // The band is overwritten by the next read, so there's no need to
+        // swap it back after writing
+        writer.save(current.data(),
+                    types::RowCol<size_t>(startRow, 0),
+                    bandDims(startRow),
+                    false /*restoreData*/);
+        reads.joinAll();
+    }
+
+    writer.close();
+}
+
+void cropSICD(six::NITFReadControl& reader,
+              const std::vector<std::string>& schemaPaths,
+              const six::sicd::ComplexData& data,
+              const scene::SceneGeometry& geom,
+              const scene::ProjectionModel& projection,
+              const types::RowCol<size_t>& aoiOffset,
+              const types::RowCol<size_t>& aoiDims,
+              const std::string& outPathname)
+{
+    checkAOI(data, aoiOffset, aoiDims);
+
+    std::unique_ptr<six::sicd::ComplexData> aoiData(updateMetadata(
             data, geom,  projection,
             aoiOffset, aoiDims));
 
     // Write the AOI SICD out
-    six::NITFWriteControl writer(std::move(aoiData));
-    const std::span<const std::complex<float>> image(buffer.get(), origDims.area());
-    std::vector<std::filesystem::path> schemaPaths;
-    std::transform(schemaPaths_.begin(), schemaPaths_.end(), std::back_inserter(schemaPaths), [](const std::string& s) { return s; });
-    writer.save_image(image, outPathname, schemaPaths);
+    std::mutex readMutex;
+    streamAOI(reader, readMutex, schemaPaths, *aoiData, aoiOffset, aoiDims,
+              outPathname,
+              six::sicd::StreamingCropper::DEFAULT_NUM_ROWS_PER_BAND);
 }
 
+class CropRunnable final : public sys::Runnable
+{
+public:
+    CropRunnable(six::sicd::StreamingCropper& cropper,
+                 const six::sicd::CropRequest* requests,
+                 size_t numRequests) :
+        mCropper(cropper),
+        mRequests(requests),
+        mNumRequests(numRequests)
+    {
+    }
+
+    void run() override
+    {
+        for (size_t ii = 0; ii < mNumRequests; ++ii)
+        {
+            const six::sicd::CropRequest& request(mRequests[ii]);
+            mCropper.crop(request.aoiOffset, request.aoiDims,
+                          request.outPathname);
+        }
+    }
+
+private:
+    six::sicd::StreamingCropper& mCropper;
+    const six::sicd::CropRequest* const mRequests;
+    const size_t mNumRequests;
+};
 }
 
 namespace six
@@ -177,29 +323,8 @@ void cropSICD(six::NITFReadControl& reader,
               const types::RowCol<size_t>& aoiDims,
               const std::string& outPathname)
 {
-    // Make sure it's a SICD
-    const auto container = reader.getContainer();
-
-    const six::Data* const dataPtr = container->getData(0);
-    if (container->getDataType() != six::DataType::COMPLEX ||
-        dataPtr->getDataType() != six::DataType::COMPLEX)
-    {
-        throw except::Exception(Ctxt("Input is not a SICD"));
-    }
-
-    const ComplexData* const data =
-        dynamic_cast<const ComplexData*>(dataPtr);
-
-    // Build up the geometry info
-    std::unique_ptr<const scene::SceneGeometry> geom(
-            six::sicd::Utilities::getSceneGeometry(data));
-
-    std::unique_ptr<const scene::ProjectionModel> projection(
-            six::sicd::Utilities::getProjectionModel(data, geom.get()));
-
-    // Actually do the cropping
-    ::cropSICD(reader, schemaPaths, *data, *geom, *projection,
-               aoiOffset, aoiDims, outPathname);
+    StreamingCropper(reader, schemaPaths).crop(aoiOffset, aoiDims,
+                                               outPathname);
 }
 
 void cropSICD(const std::string& inPathname,
@@ -334,5 +459,75 @@ void cropSICD(six::NITFReadControl& reader,
     cropSICD(reader, schemaPaths, ecefCorners, outPathname,
              trimCornersIfNeeded);
 }
+
+const size_t StreamingCropper::DEFAULT_NUM_ROWS_PER_BAND;
+
+StreamingCropper::StreamingCropper(six::NITFReadControl& reader,
+                                   const std::vector<std::string>& schemaPaths,
+                                   size_t numRowsPerBand) :
+    mReader(reader),
+    mSchemaPaths(schemaPaths),
+    mNumRowsPerBand(numRowsPerBand),
+    mData(&::getComplexData(reader)),
+    mGeom(six::sicd::Utilities::getSceneGeometry(mData)),
+    mProjection(six::sicd::Utilities::getProjectionModel(mData, mGeom.get()))
+{
+}
+
+void StreamingCropper::checkAOI(const types::RowCol<size_t>& aoiOffset,
+                                const types::RowCol<size_t>& aoiDims) const
+{
+    ::checkAOI(*mData, aoiOffset, aoiDims);
+}
+
+void StreamingCropper::crop(const types::RowCol<size_t>& aoiOffset,
+                            const types::RowCol<size_t>& aoiDims,
+                            const std::string& outPathname)
+{
+    checkAOI(aoiOffset, aoiDims);
+
+    std::unique_ptr<ComplexData> aoiData(updateMetadata(
+            *mData, *mGeom, *mProjection, aoiOffset, aoiDims));
+
+    streamAOI(mReader, mReadMutex, mSchemaPaths, *aoiData,
+              aoiOffset, aoiDims, outPathname, mNumRowsPerBand);
+}
+
+void StreamingCropper::crop(const std::vector<CropRequest>& requests,
+                            size_t numThreads)
+{
+    // Fail before writing anything rather than part way through
+    for (const auto& request : requests)
+    {
+        checkAOI(request.aoiOffset, request.aoiDims);
+    }
+
+    if (numThreads == 0)
+    {
+        numThreads = std::thread::hardware_concurrency();
+    }
+
+    if (numThreads <= 1 || requests.size() <= 1)
+    {
+        CropRunnable(*this, requests.data(), requests.size()).run();
+        return;
+    }
+
+    mt::ThreadGroup threads;
+    const mt::ThreadPlanner planner(requests.size(), numThreads);
+
+    size_t threadNum(0);
+    size_t startRequest(0);
+    size_t numRequestsThisThread(0);
+    while (planner.getThreadInfo(threadNum++, startRequest,
+                                 numRequestsThisThread))
+    {
+        threads.createThread(std::unique_ptr<sys::Runnable>(
+                new CropRunnable(*this, requests.data() + startRequest,
+                                 numRequestsThisThread)));
+    }
+
+    threads.joinAll();
+}
 }
 }
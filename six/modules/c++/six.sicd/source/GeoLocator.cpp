@@ -20,6 +20,8 @@
  *
  */
 
+#include <vector>
+
 #include <six/sicd/AreaPlaneUtility.h>
 #include <six/sicd/GeoLocator.h>
 
@@ -36,6 +38,15 @@ LatLonAlt GeoLocator::geolocate(const RowColDouble& rowCol) const
 {
     return mEcefToLla.transform(mRowColToEcef.rowColToECEF(rowCol));
 }
+void GeoLocator::geolocate(std::span<const RowColDouble> rowCols, std::span<LatLonAlt> llas) const
+{
+    std::vector<scene::Vector3> ecef(rowCols.size());
+    for (size_t ii = 0; ii < rowCols.size(); ++ii)
+    {
+        ecef[ii] = mRowColToEcef.rowColToECEF(rowCols[ii]);
+    }
+    mEcefToLla.transform(std::span<const scene::Vector3>(ecef.data(), ecef.size()), llas);
+}
 
 scene::PlanarGridECEFTransform
 GeoLocator::buildTransformer(const ComplexData& complexData, bool shadowsDown) const
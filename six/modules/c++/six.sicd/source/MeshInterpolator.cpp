@@ -0,0 +1,563 @@
+/* =========================================================================
+ * This file is part of six.sicd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six.sicd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <six/sicd/MeshInterpolator.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <sstream>
+#include <thread>
+
+#include <except/Exception.h>
+#include <mt/Runnable1D.h>
+
+namespace
+{
+// Newton iterations to invert a cell's bilinear map, and how far outside
+// [0, 1] a point may land and still count as inside the cell
+const size_t MAX_ITERATIONS = 10;
+const double CELL_TOLERANCE = 1e-9;
+
+size_t getNumThreads(size_t numThreads)
+{
+    if (numThreads == 0)
+    {
+        numThreads = std::thread::hardware_concurrency();
+    }
+    return std::max<size_t>(numThreads, 1);
+}
+
+// Splits [0, numElements) into one contiguous chunk per thread and calls
+// op(begin, end) for each of them
+template <typename OpT>
+void runChunks(size_t numElements, size_t numThreads, const OpT& op)
+{
+    numThreads = getNumThreads(numThreads);
+    const size_t numChunks = std::max<size_t>(
+            std::min(numThreads, numElements), 1);
+    mt::run1D(numChunks, numThreads, [&](size_t chunk)
+    {
+        op(numElements * chunk / numChunks,
+           numElements * (chunk + 1) / numChunks);
+    });
+}
+
+// Strictly monotonic in one direction or the other
+bool isMonotonic(const std::vector<double>& values, bool& ascending)
+{
+    ascending = values[1] > values[0];
+    for (size_t ii = 1; ii < values.size(); ++ii)
+    {
+        if (ascending ? !(values[ii] > values[ii - 1]) :
+                        !(values[ii] < values[ii - 1]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+double getAxisExtent(const std::vector<double>& values)
+{
+    const auto minMax = std::minmax_element(values.begin(), values.end());
+    return *minMax.second - *minMax.first;
+}
+}
+
+namespace six
+{
+namespace sicd
+{
+const size_t MeshInterpolator::NO_CELL = static_cast<size_t>(-1);
+
+MeshInterpolator::MeshInterpolator(const PlanarCoordinateMesh& mesh,
+                                   double fillValue) :
+    mMeshDims(mesh.getMeshDims()),
+    mFillValue(fillValue),
+    mX(mesh.getX()),
+    mY(mesh.getY()),
+    mRectilinear(false),
+    mRowXAscending(true),
+    mColYAscending(true)
+{
+    if (mMeshDims.row < 2 || mMeshDims.col < 2)
+    {
+        throw except::Exception(Ctxt(
+                "Need at least 2 rows and columns of mesh nodes"));
+    }
+    if (mX.size() != mMeshDims.area() || mY.size() != mMeshDims.area())
+    {
+        throw except::Exception(Ctxt(
+                "Mesh coordinates don't match the mesh dimensions"));
+    }
+
+    mRowX.resize(mMeshDims.row);
+    for (size_t row = 0; row < mMeshDims.row; ++row)
+    {
+        mRowX[row] = mX[row * mMeshDims.col];
+    }
+    mColY.assign(mY.begin(), mY.begin() + mMeshDims.col);
+
+    mRectilinear = isMonotonic(mRowX, mRowXAscending) &&
+            isMonotonic(mColY, mColYAscending);
+
+    // Allow for round off in meshes written as separate x and y arrays
+    const double xTolerance = 1e-9 * getAxisExtent(mRowX);
+    const double yTolerance = 1e-9 * getAxisExtent(mColY);
+    for (size_t row = 0; mRectilinear && row < mMeshDims.row; ++row)
+    {
+        for (size_t col = 0; col < mMeshDims.col; ++col)
+        {
+            const size_t node = row * mMeshDims.col + col;
+            if (std::abs(mX[node] - mRowX[row]) > xTolerance ||
+                std::abs(mY[node] - mColY[col]) > yTolerance)
+            {
+                mRectilinear = false;
+                break;
+            }
+        }
+    }
+
+    if (mRectilinear)
+    {
+        // The node positions are only needed to locate points in cells
+        std::vector<double>().swap(mX);
+        std::vector<double>().swap(mY);
+    }
+    else
+    {
+        buildBuckets();
+    }
+}
+
+void MeshInterpolator::buildBuckets()
+{
+    const auto xMinMax = std::minmax_element(mX.begin(), mX.end());
+    const auto yMinMax = std::minmax_element(mY.begin(), mY.end());
+    mBucketOrigin.row = *xMinMax.first;
+    mBucketOrigin.col = *yMinMax.first;
+    const double xExtent = *xMinMax.second - *xMinMax.first;
+    const double yExtent = *yMinMax.second - *yMinMax.first;
+
+    // About one cell per bucket, with buckets roughly square
+    const types::RowCol<size_t> numCells(mMeshDims.row - 1,
+                                         mMeshDims.col - 1);
+    const double aspect = (xExtent > 0 && yExtent > 0) ?
+            xExtent / yExtent : 1.0;
+    const double numBucketRows = std::sqrt(numCells.area() * aspect);
+    mNumBuckets.row = std::max<size_t>(
+            std::min<size_t>(static_cast<size_t>(numBucketRows),
+                             numCells.area()), 1);
+    mNumBuckets.col = std::max<size_t>(numCells.area() / mNumBuckets.row, 1);
+    mBucketSize.row = xExtent > 0 ? xExtent / mNumBuckets.row : 1.0;
+    mBucketSize.col = yExtent > 0 ? yExtent / mNumBuckets.col : 1.0;
+
+    // Bucket range of each cell's bounding box
+    auto forEachBucket = [&](size_t cell, const std::function<void(size_t)>& op)
+    {
+        const size_t node = (cell / numCells.col) * mMeshDims.col +
+                cell % numCells.col;
+        const size_t nodes[] = {node, node + 1, node + mMeshDims.col,
+                                node + mMeshDims.col + 1};
+        double xMin = mX[node], xMax = mX[node];
+        double yMin = mY[node], yMax = mY[node];
+        for (size_t corner : nodes)
+        {
+            xMin = std::min(xMin, mX[corner]);
+            xMax = std::max(xMax, mX[corner]);
+            yMin = std::min(yMin, mY[corner]);
+            yMax = std::max(yMax, mY[corner]);
+        }
+        auto bucket = [](double value, double origin, double size,
+                         size_t numBuckets)
+        {
+            const double index = std::floor((value - origin) / size);
+            return static_cast<size_t>(std::min(
+                    std::max(index, 0.0),
+                    static_cast<double>(numBuckets - 1)));
+        };
+        const size_t rowBegin = bucket(xMin, mBucketOrigin.row,
+                                       mBucketSize.row, mNumBuckets.row);
+        const size_t rowEnd = bucket(xMax, mBucketOrigin.row,
+                                     mBucketSize.row, mNumBuckets.row);
+        const size_t colBegin = bucket(yMin, mBucketOrigin.col,
+                                       mBucketSize.col, mNumBuckets.col);
+        const size_t colEnd = bucket(yMax, mBucketOrigin.col,
+                                     mBucketSize.col, mNumBuckets.col);
+        for (size_t row = rowBegin; row <= rowEnd; ++row)
+        {
+            for (size_t col = colBegin; col <= colEnd; ++col)
+            {
+                op(row * mNumBuckets.col + col);
+            }
+        }
+    };
+
+    // Count, then fill
+    mBucketStart.assign(mNumBuckets.area() + 1, 0);
+    for (size_t cell = 0; cell < numCells.area(); ++cell)
+    {
+        forEachBucket(cell, [&](size_t bucket)
+        {
+            ++mBucketStart[bucket + 1];
+        });
+    }
+    for (size_t bucket = 0; bucket < mNumBuckets.area(); ++bucket)
+    {
+        mBucketStart[bucket + 1] += mBucketStart[bucket];
+    }
+    mBucketCells.resize(mBucketStart.back());
+    std::vector<size_t> next(mBucketStart.begin(), mBucketStart.end() - 1);
+    for (size_t cell = 0; cell < numCells.area(); ++cell)
+    {
+        forEachBucket(cell, [&](size_t bucket)
+        {
+            mBucketCells[next[bucket]++] = cell;
+        });
+    }
+}
+
+bool MeshInterpolator::isInCell(size_t cell,
+                                double x,
+                                double y,
+                                Location& location) const
+{
+    const size_t node = (cell / (mMeshDims.col - 1)) * mMeshDims.col +
+            cell % (mMeshDims.col - 1);
+    const size_t nextRow = node + mMeshDims.col;
+
+    // p(u, v) = a + b u + c v + d u v
+    const double ax = mX[node];
+    const double bx = mX[nextRow] - ax;
+    const double cx = mX[node + 1] - ax;
+    const double dx = mX[nextRow + 1] - mX[nextRow] - mX[node + 1] + ax;
+    const double ay = mY[node];
+    const double by = mY[nextRow] - ay;
+    const double cy = mY[node + 1] - ay;
+    const double dy = mY[nextRow + 1] - mY[nextRow] - mY[node + 1] + ay;
+
+    double u = 0.5;
+    double v = 0.5;
+    for (size_t ii = 0; ii < MAX_ITERATIONS; ++ii)
+    {
+        const double fx = ax + bx * u + cx * v + dx * u * v - x;
+        const double fy = ay + by * u + cy * v + dy * u * v - y;
+        const double j11 = bx + dx * v;
+        const double j12 = cx + dx * u;
+        const double j21 = by + dy * v;
+        const double j22 = cy + dy * u;
+        const double det = j11 * j22 - j12 * j21;
+        if (det == 0.0)
+        {
+            return false;
+        }
+        const double du = (j22 * fx - j12 * fy) / det;
+        const double dv = (j11 * fy - j21 * fx) / det;
+        u -= du;
+        v -= dv;
+        if (std::abs(du) + std::abs(dv) < 1e-14)
+        {
+            break;
+        }
+    }
+
+    if (!(u >= -CELL_TOLERANCE && u <= 1.0 + CELL_TOLERANCE &&
+          v >= -CELL_TOLERANCE && v <= 1.0 + CELL_TOLERANCE))
+    {
+        return false;
+    }
+    location.node = node;
+    location.u = std::min(std::max(u, 0.0), 1.0);
+    location.v = std::min(std::max(v, 0.0), 1.0);
+    return true;
+}
+
+bool MeshInterpolator::locate(double x,
+                              double y,
+                              size_t& hint,
+                              Location& location) const
+{
+    if (hint != NO_CELL && isInCell(hint, x, y, location))
+    {
+        return true;
+    }
+
+    const double row = std::floor((x - mBucketOrigin.row) / mBucketSize.row);
+    const double col = std::floor((y - mBucketOrigin.col) / mBucketSize.col);
+
+    // Points on the far edge belong to the last bucket
+    const double lastRow = static_cast<double>(mNumBuckets.row - 1);
+    const double lastCol = static_cast<double>(mNumBuckets.col - 1);
+    if (!(row >= 0 && row <= lastRow + 1 && col >= 0 && col <= lastCol + 1))
+    {
+        return false;
+    }
+    const size_t bucket =
+            static_cast<size_t>(std::min(row, lastRow)) * mNumBuckets.col +
+            static_cast<size_t>(std::min(col, lastCol));
+
+    for (size_t ii = mBucketStart[bucket]; ii < mBucketStart[bucket + 1]; ++ii)
+    {
+        const size_t cell = mBucketCells[ii];
+        if (cell != hint && isInCell(cell, x, y, location))
+        {
+            hint = cell;
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t MeshInterpolator::locateOnAxis(const std::vector<double>& axis,
+                                      bool ascending,
+                                      double value,
+                                      double& fraction)
+{
+    const double low = ascending ? axis.front() : axis.back();
+    const double high = ascending ? axis.back() : axis.front();
+    if (!(value >= low && value <= high))
+    {
+        return NO_CELL;
+    }
+
+    const auto it = ascending ?
+            std::upper_bound(axis.begin(), axis.end(), value) :
+            std::upper_bound(axis.begin(), axis.end(), value,
+                             std::greater<double>());
+    const size_t index = std::min<size_t>(
+            std::max<ptrdiff_t>(it - axis.begin() - 1, 0), axis.size() - 2);
+    fraction = (value - axis[index]) / (axis[index + 1] - axis[index]);
+    return index;
+}
+
+void MeshInterpolator::checkField(std::span<const double> field) const
+{
+    if (field.size() != mMeshDims.area())
+    {
+        std::ostringstream ostr;
+        ostr << "Field has " << field.size() << " values but the mesh has "
+             << mMeshDims.area() << " nodes";
+        throw except::Exception(Ctxt(ostr.str()));
+    }
+}
+
+double MeshInterpolator::blend(std::span<const double> field,
+                               const Location& location) const
+{
+    const double* const values = field.data() + location.node;
+    const double* const nextRow = values + mMeshDims.col;
+    const double u = location.u;
+    const double v = location.v;
+    return (1.0 - u) * ((1.0 - v) * values[0] + v * values[1]) +
+            u * ((1.0 - v) * nextRow[0] + v * nextRow[1]);
+}
+
+double MeshInterpolator::interpolate(std::span<const double> field,
+                                     double x,
+                                     double y) const
+{
+    checkField(field);
+
+    Location location;
+    if (mRectilinear)
+    {
+        const size_t row = locateOnAxis(mRowX, mRowXAscending, x, location.u);
+        const size_t col = locateOnAxis(mColY, mColYAscending, y, location.v);
+        if (row == NO_CELL || col == NO_CELL)
+        {
+            return mFillValue;
+        }
+        location.node = row * mMeshDims.col + col;
+        return blend(field, location);
+    }
+
+    size_t hint = NO_CELL;
+    return locate(x, y, hint, location) ? blend(field, location) : mFillValue;
+}
+
+void MeshInterpolator::interpolate(std::span<const double> field,
+                                   std::span<const double> x,
+                                   std::span<const double> y,
+                                   std::span<double> output,
+                                   size_t numThreads) const
+{
+    checkField(field);
+    if (x.size() != y.size() || output.size() < x.size())
+    {
+        throw except::Exception(Ctxt(
+                "Need as many y values and outputs as x values"));
+    }
+
+    runChunks(x.size(), numThreads, [&](size_t begin, size_t end)
+    {
+        size_t hint = NO_CELL;
+        Location location;
+        for (size_t ii = begin; ii < end; ++ii)
+        {
+            if (mRectilinear)
+            {
+                const size_t row = locateOnAxis(mRowX, mRowXAscending,
+                                                x[ii], location.u);
+                const size_t col = locateOnAxis(mColY, mColYAscending,
+                                                y[ii], location.v);
+                if (row == NO_CELL || col == NO_CELL)
+                {
+                    output[ii] = mFillValue;
+                    continue;
+                }
+                location.node = row * mMeshDims.col + col;
+                output[ii] = blend(field, location);
+            }
+            else
+            {
+                output[ii] = locate(x[ii], y[ii], hint, location) ?
+                        blend(field, location) : mFillValue;
+            }
+        }
+    });
+}
+
+void MeshInterpolator::interpolateGrid(std::span<const double> field,
+                                       const types::RowCol<double>& start,
+                                       const types::RowCol<double>& step,
+                                       const types::RowCol<size_t>& dims,
+                                       std::span<double> output,
+                                       size_t numThreads) const
+{
+    checkField(field);
+    if (output.size() < dims.area())
+    {
+        std::ostringstream ostr;
+        ostr << "Need room for " << dims.area() << " values but only got "
+             << output.size();
+        throw except::Exception(Ctxt(ostr.str()));
+    }
+
+    if (mRectilinear)
+    {
+        interpolateGridRectilinear(field, start, step, dims, output.data(),
+                                   numThreads);
+        return;
+    }
+
+    runChunks(dims.row, numThreads, [&](size_t begin, size_t end)
+    {
+        size_t hint = NO_CELL;
+        Location location;
+        for (size_t row = begin; row < end; ++row)
+        {
+            const double x = start.row + static_cast<double>(row) * step.row;
+            double* const rowOutput = output.data() + row * dims.col;
+            for (size_t col = 0; col < dims.col; ++col)
+            {
+                const double y =
+                        start.col + static_cast<double>(col) * step.col;
+                rowOutput[col] = locate(x, y, hint, location) ?
+                        blend(field, location) : mFillValue;
+            }
+        }
+    });
+}
+
+void MeshInterpolator::interpolateGridRectilinear(
+        std::span<const double> field,
+        const types::RowCol<double>& start,
+        const types::RowCol<double>& step,
+        const types::RowCol<size_t>& dims,
+        double* output,
+        size_t numThreads) const
+{
+    // The columns are the same for every row.  y is linear in the output
+    // column, so the ones inside the mesh are a single run.
+    std::vector<size_t> meshCols(dims.col);
+    std::vector<double> fractions(dims.col);
+    size_t colBegin = dims.col;
+    size_t colEnd = 0;
+    for (size_t col = 0; col < dims.col; ++col)
+    {
+        const double y = start.col + static_cast<double>(col) * step.col;
+        meshCols[col] = locateOnAxis(mColY, mColYAscending, y,
+                                     fractions[col]);
+        if (meshCols[col] != NO_CELL)
+        {
+            colBegin = std::min(colBegin, col);
+            colEnd = col + 1;
+        }
+    }
+    colBegin = std::min(colBegin, colEnd);
+
+    runChunks(dims.row, numThreads, [&](size_t begin, size_t end)
+    {
+        std::vector<double> rowValues(mMeshDims.col);
+        for (size_t row = begin; row < end; ++row)
+        {
+            double* const rowOutput = output + row * dims.col;
+            double u = 0.0;
+            const size_t meshRow = locateOnAxis(
+                    mRowX, mRowXAscending,
+                    start.row + static_cast<double>(row) * step.row, u);
+            if (meshRow == NO_CELL)
+            {
+                std::fill_n(rowOutput, dims.col, mFillValue);
+                continue;
+            }
+
+            // Blend the two mesh rows, then interpolate across the blend
+            const double* const values =
+                    field.data() + meshRow * mMeshDims.col;
+            const double* const nextValues = values + mMeshDims.col;
+            for (size_t col = 0; col < mMeshDims.col; ++col)
+            {
+                rowValues[col] = (1.0 - u) * values[col] +
+                        u * nextValues[col];
+            }
+
+            std::fill_n(rowOutput, colBegin, mFillValue);
+            const size_t* const cols = meshCols.data();
+            const double* const v = fractions.data();
+            const double* const blended = rowValues.data();
+            for (size_t col = colBegin; col < colEnd; ++col)
+            {
+                rowOutput[col] = (1.0 - v[col]) * blended[cols[col]] +
+                        v[col] * blended[cols[col] + 1];
+            }
+            std::fill(rowOutput + colEnd, rowOutput + dims.col, mFillValue);
+        }
+    });
+}
+
+void MeshInterpolator::getPixelGrid(const ComplexData& complexData,
+                                    types::RowCol<double>& start,
+                                    types::RowCol<double>& step)
+{
+    // Same convention as ComplexData::pixelToImagePoint()
+    const ImageData& imageData = *complexData.imageData;
+    step.row = complexData.grid->row->sampleSpacing;
+    step.col = complexData.grid->col->sampleSpacing;
+    start.row = (static_cast<double>(imageData.firstRow) -
+                 static_cast<double>(imageData.scpPixel.row)) * step.row;
+    start.col = (static_cast<double>(imageData.firstCol) -
+                 static_cast<double>(imageData.scpPixel.col)) * step.col;
+}
+}
+}
@@ -0,0 +1,422 @@
+/* =========================================================================
+ * This file is part of six.sicd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six.sicd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <six/sicd/RadiometricCalibrator.h>
+
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <sstream>
+#include <thread>
+
+#include <except/Exception.h>
+#include <mt/Runnable1D.h>
+#include <six/Radiometric.h>
+#include <six/sicd/Utilities.h>
+
+namespace
+{
+// Columns evaluated per pass, so a block of a row stays in L1
+const size_t BLOCK_SIZE = 512;
+
+size_t getNumThreads(size_t numThreads)
+{
+    if (numThreads == 0)
+    {
+        numThreads = std::thread::hardware_concurrency();
+    }
+    return std::max<size_t>(numThreads, 1);
+}
+
+const six::Poly2D& getScaleFactorPoly(
+        const six::Radiometric& radiometric,
+        six::sicd::RadiometricCalibrator::Calibration calibration)
+{
+    typedef six::sicd::RadiometricCalibrator::Calibration Calibration;
+    switch (calibration)
+    {
+    case Calibration::RCS:
+        return radiometric.rcsSFPoly;
+    case Calibration::SIGMA_ZERO:
+        return radiometric.sigmaZeroSFPoly;
+    case Calibration::BETA_ZERO:
+        return radiometric.betaZeroSFPoly;
+    case Calibration::GAMMA_ZERO:
+        return radiometric.gammaZeroSFPoly;
+    default:
+        throw except::Exception(Ctxt("Calibration has no scale factor"));
+    }
+}
+
+const six::sicd::ComplexData& getComplexData(six::NITFReadControl& reader)
+{
+    const auto container = reader.getContainer();
+
+    const six::Data* const dataPtr = container->getData(0);
+    if (container->getDataType() != six::DataType::COMPLEX ||
+        dataPtr->getDataType() != six::DataType::COMPLEX)
+    {
+        throw except::Exception(Ctxt("Input is not a SICD"));
+    }
+
+    return *dynamic_cast<const six::sicd::ComplexData*>(dataPtr);
+}
+
+struct Band
+{
+    size_t startRow = 0;
+    size_t numRows = 0;
+    std::vector<std::complex<float> > pixels;
+};
+}
+
+namespace six
+{
+namespace sicd
+{
+RadiometricCalibrator::RadiometricCalibrator(const ComplexData& complexData,
+                                             const Options& options) :
+    mOptions(options),
+    mImageDims(complexData.getNumRows(), complexData.getNumCols()),
+    mSampleSpacing(complexData.grid->row->sampleSpacing,
+                   complexData.grid->col->sampleSpacing)
+{
+    const Radiometric* const radiometric = complexData.radiometric.get();
+    if (!radiometric)
+    {
+        throw except::Exception(Ctxt("SICD has no Radiometric parameters"));
+    }
+
+    if (mOptions.calibration != Calibration::POWER)
+    {
+        const Poly2D& poly =
+                getScaleFactorPoly(*radiometric, mOptions.calibration);
+        if (poly.empty())
+        {
+            throw except::Exception(Ctxt(
+                    "SICD has no scale factor polynomial for the calibration"));
+        }
+        mScaleFactor = flatten(poly);
+    }
+
+    if (mOptions.subtractNoise)
+    {
+        const NoiseLevel& noiseLevel = radiometric->noiseLevel;
+        if (noiseLevel.noisePoly.empty() ||
+            noiseLevel.noiseType != Radiometric::NL_ABSOLUTE)
+        {
+            throw except::Exception(Ctxt(
+                    "Subtracting noise needs an ABSOLUTE noise polynomial"));
+        }
+        mNoise = flatten(noiseLevel.noisePoly);
+    }
+
+    // Same convention as ComplexData::pixelToImagePoint()
+    const ImageData& imageData = *complexData.imageData;
+    mOrigin.row = (static_cast<double>(imageData.firstRow) -
+                   static_cast<double>(imageData.scpPixel.row)) *
+            mSampleSpacing.row;
+    mOrigin.col = (static_cast<double>(imageData.firstCol) -
+                   static_cast<double>(imageData.scpPixel.col)) *
+            mSampleSpacing.col;
+}
+
+RadiometricCalibrator::RadiometricCalibrator(const ComplexData& complexData) :
+    RadiometricCalibrator(complexData, Options())
+{
+}
+
+RadiometricCalibrator::Polynomial
+RadiometricCalibrator::flatten(const Poly2D& poly)
+{
+    Polynomial flat;
+    flat.numX = poly.orderX() + 1;
+    flat.numY = poly.orderY() + 1;
+    flat.coefficients.resize(flat.numX * flat.numY);
+    for (size_t ii = 0; ii < flat.numX; ++ii)
+    {
+        const Poly1D polyY = poly[ii];
+        for (size_t jj = 0; jj < flat.numY; ++jj)
+        {
+            flat.coefficients[ii * flat.numY + jj] = polyY[jj];
+        }
+    }
+    return flat;
+}
+
+void RadiometricCalibrator::evaluateRow(const Polynomial& poly,
+                                        double x,
+                                        double y0,
+                                        double dy,
+                                        size_t numCols,
+                                        double* scratch,
+                                        double* output)
+{
+    // Collapse to a polynomial in y at this x
+    std::fill_n(scratch, poly.numY, 0.0);
+    double xPower = 1.0;
+    for (size_t ii = 0; ii < poly.numX; ++ii)
+    {
+        const double* const coefficients =
+                &poly.coefficients[ii * poly.numY];
+        for (size_t jj = 0; jj < poly.numY; ++jj)
+        {
+            scratch[jj] += coefficients[jj] * xPower;
+        }
+        xPower *= x;
+    }
+
+    // Horner's method, one power at a time across a block of columns, so
+    // the inner loops are independent per column
+    const double highest = scratch[poly.numY - 1];
+    for (size_t start = 0; start < numCols; start += BLOCK_SIZE)
+    {
+        const size_t end = std::min(start + BLOCK_SIZE, numCols);
+        double* const block = output + start;
+        const size_t blockSize = end - start;
+        const double blockY0 = y0 + static_cast<double>(start) * dy;
+
+        for (size_t col = 0; col < blockSize; ++col)
+        {
+            block[col] = highest;
+        }
+        for (size_t jj = poly.numY - 1; jj > 0; --jj)
+        {
+            const double coefficient = scratch[jj - 1];
+            for (size_t col = 0; col < blockSize; ++col)
+            {
+                const double y = blockY0 + static_cast<double>(col) * dy;
+                block[col] = block[col] * y + coefficient;
+            }
+        }
+    }
+}
+
+void RadiometricCalibrator::evaluateGrid(const Poly2D& poly,
+                                         const types::RowCol<double>& start,
+                                         const types::RowCol<double>& step,
+                                         const types::RowCol<size_t>& dims,
+                                         std::span<double> output)
+{
+    if (output.size() < dims.area())
+    {
+        std::ostringstream ostr;
+        ostr << "Need room for " << dims.area() << " values but only got "
+             << output.size();
+        throw except::Exception(Ctxt(ostr.str()));
+    }
+
+    const Polynomial flat = flatten(poly);
+    std::vector<double> scratch(flat.numY);
+    for (size_t row = 0; row < dims.row; ++row)
+    {
+        evaluateRow(flat,
+                    start.row + static_cast<double>(row) * step.row,
+                    start.col,
+                    step.col,
+                    dims.col,
+                    scratch.data(),
+                    output.data() + row * dims.col);
+    }
+}
+
+void RadiometricCalibrator::calibrateRows(const std::complex<float>* pixels,
+                                          const types::RowCol<size_t>& offset,
+                                          const types::RowCol<size_t>& dims,
+                                          float* output) const
+{
+    const bool scale = !mScaleFactor.coefficients.empty();
+    const bool subtractNoise = !mNoise.coefficients.empty();
+
+    std::vector<double> scaleFactors(scale ? dims.col : 0);
+    std::vector<double> noise(subtractNoise ? dims.col : 0);
+    std::vector<double> scratch(std::max(mScaleFactor.numY, mNoise.numY));
+
+    // dB to linear power
+    const double dbToNeper = std::log(10.0) / 10.0;
+
+    const double y0 = mOrigin.col +
+            static_cast<double>(offset.col) * mSampleSpacing.col;
+    for (size_t row = 0; row < dims.row; ++row)
+    {
+        const double x = mOrigin.row +
+                static_cast<double>(offset.row + row) * mSampleSpacing.row;
+        const std::complex<float>* const rowPixels = pixels + row * dims.col;
+        float* const rowOutput = output + row * dims.col;
+
+        for (size_t col = 0; col < dims.col; ++col)
+        {
+            const float re = rowPixels[col].real();
+            const float im = rowPixels[col].imag();
+            rowOutput[col] = re * re + im * im;
+        }
+
+        if (subtractNoise)
+        {
+            evaluateRow(mNoise, x, y0, mSampleSpacing.col, dims.col,
+                        scratch.data(), noise.data());
+            for (size_t col = 0; col < dims.col; ++col)
+            {
+                rowOutput[col] = static_cast<float>(
+                        rowOutput[col] - std::exp(noise[col] * dbToNeper));
+            }
+        }
+
+        if (scale)
+        {
+            evaluateRow(mScaleFactor, x, y0, mSampleSpacing.col, dims.col,
+                        scratch.data(), scaleFactors.data());
+            for (size_t col = 0; col < dims.col; ++col)
+            {
+                rowOutput[col] = static_cast<float>(
+                        rowOutput[col] * scaleFactors[col]);
+            }
+        }
+    }
+}
+
+void RadiometricCalibrator::calibrate(
+        std::span<const std::complex<float> > pixels,
+        const types::RowCol<size_t>& offset,
+        size_t numCols,
+        std::span<float> output) const
+{
+    if (numCols == 0 || pixels.size() % numCols != 0)
+    {
+        throw except::Exception(Ctxt(
+                "Pixels must be a whole number of rows of numCols"));
+    }
+    if (output.size() < pixels.size())
+    {
+        std::ostringstream ostr;
+        ostr << "Need room for " << pixels.size()
+             << " calibrated pixels but only got " << output.size();
+        throw except::Exception(Ctxt(ostr.str()));
+    }
+
+    const types::RowCol<size_t> dims(pixels.size() / numCols, numCols);
+    if (offset.row + dims.row > mImageDims.row ||
+        offset.col + dims.col > mImageDims.col)
+    {
+        throw except::Exception(Ctxt("Block extends past the SICD"));
+    }
+
+    // One contiguous chunk of rows per thread
+    const size_t numThreads = getNumThreads(mOptions.numThreads);
+    const size_t numChunks =
+            std::max<size_t>(std::min(numThreads, dims.row), 1);
+    mt::run1D(numChunks, numThreads, [&](size_t chunk)
+    {
+        const size_t begin = dims.row * chunk / numChunks;
+        const size_t end = dims.row * (chunk + 1) / numChunks;
+        calibrateRows(pixels.data() + begin * dims.col,
+                      types::RowCol<size_t>(offset.row + begin, offset.col),
+                      types::RowCol<size_t>(end - begin, dims.col),
+                      output.data() + begin * dims.col);
+    });
+}
+
+size_t RadiometricCalibrator::getNumRowsPerBand() const
+{
+    // Two bands of complex pixels (one being read) and one calibrated band
+    const size_t bytesPerRow = mImageDims.col *
+            (2 * sizeof(std::complex<float>) + sizeof(float));
+    const size_t numRows = mOptions.maxMemoryBytes / std::max<size_t>(
+            bytesPerRow, 1);
+    return std::max<size_t>(std::min(numRows, mImageDims.row), 1);
+}
+
+void RadiometricCalibrator::calibrate(NITFReadControl& reader,
+                                      const BandSink& sink) const
+{
+    const ComplexData& complexData = ::getComplexData(reader);
+    if (complexData.getNumRows() != mImageDims.row ||
+        complexData.getNumCols() != mImageDims.col)
+    {
+        throw except::Exception(Ctxt(
+                "SICD doesn't match the one the calibrator was made for"));
+    }
+
+    const size_t numRowsPerBand = getNumRowsPerBand();
+    Band bands[2];
+    for (Band& band : bands)
+    {
+        band.pixels.resize(numRowsPerBand * mImageDims.col);
+    }
+    std::vector<float> calibrated(numRowsPerBand * mImageDims.col);
+
+    auto read = [&](size_t startRow, Band& band)
+    {
+        band.startRow = startRow;
+        band.numRows = std::min(numRowsPerBand, mImageDims.row - startRow);
+        Utilities::getWidebandData(
+                reader, complexData,
+                types::RowCol<size_t>(startRow, 0),
+                types::RowCol<size_t>(band.numRows, mImageDims.col),
+                band.pixels.data());
+    };
+
+    read(0, bands[0]);
+    for (size_t startRow = 0, ii = 0; startRow < mImageDims.row; ++ii)
+    {
+        const Band& band = bands[ii % 2];
+        const size_t nextRow = startRow + band.numRows;
+
+        std::future<void> nextRead;
+        if (nextRow < mImageDims.row)
+        {
+            nextRead = std::async(std::launch::async, read, nextRow,
+                                  std::ref(bands[(ii + 1) % 2]));
+        }
+
+        try
+        {
+            const size_t numPixels = band.numRows * mImageDims.col;
+            calibrate(std::span<const std::complex<float> >(
+                              band.pixels.data(), numPixels),
+                      types::RowCol<size_t>(band.startRow, 0),
+                      mImageDims.col,
+                      std::span<float>(calibrated.data(), numPixels));
+            sink(band.startRow,
+                 band.numRows,
+                 std::span<const float>(calibrated.data(), numPixels));
+        }
+        catch (...)
+        {
+            // Don't leave the read running against buffers that are about
+            // to go away
+            if (nextRead.valid())
+            {
+                nextRead.wait();
+            }
+            throw;
+        }
+
+        if (nextRead.valid())
+        {
+            nextRead.get();
+        }
+        startRow = nextRow;
+    }
+}
+}
+}
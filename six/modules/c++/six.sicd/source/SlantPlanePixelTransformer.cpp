@@ -23,6 +23,7 @@
 
 #include <memory>
 #include <algorithm>
+#include <vector>
 
 #include <nitf/coda-oss.hpp>
 #include <except/Exception.h>
@@ -68,6 +69,18 @@ scene::LatLonAlt SlantPlanePixelTransformer::toLLA(
     return scene::Utilities::ecefToLatLon(toECEF(pixel));
 }
 
+void SlantPlanePixelTransformer::toLLA(
+    std::span<const types::RowCol<double>> pixels,
+    std::span<scene::LatLonAlt> llas) const
+{
+    //! project them all, then convert ECEF to LLA in one batch
+    std::vector<scene::Vector3> ecef(pixels.size());
+    std::transform(pixels.begin(), pixels.end(), ecef.begin(),
+                   [&](const types::RowCol<double>& pixel) { return toECEF(pixel); });
+    scene::Utilities::ecefToLatLon(
+        std::span<const scene::Vector3>(ecef.data(), ecef.size()), llas);
+}
+
 scene::LatLon SlantPlanePixelTransformer::toLatLon(
     const types::RowCol<double>& pixel) const
 {
@@ -0,0 +1,568 @@
+/* =========================================================================
+ * This file is part of six.sicd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six.sicd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <six/sicd/SpectralProcessor.h>
+
+#include <string.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+#include <except/Exception.h>
+#include <mt/Runnable1D.h>
+#include <six/FFT.h>
+
+namespace
+{
+// Lines transformed together.  For ROW, this many columns are read from
+// each row at a time.
+const size_t TILE_SIZE = 32;
+
+// Weights below this fraction of the peak aren't divided out
+const double MIN_WEIGHT = 1e-3;
+
+size_t getNumThreads(size_t numThreads)
+{
+    if (numThreads == 0)
+    {
+        numThreads = std::thread::hardware_concurrency();
+    }
+    return std::max<size_t>(numThreads, 1);
+}
+
+six::FFTSign getInverse(six::FFTSign sign)
+{
+    return (sign == six::FFTSign::NEG) ? six::FFTSign::POS :
+                                         six::FFTSign::NEG;
+}
+
+bool isUniform(const std::vector<double>& weights)
+{
+    return std::adjacent_find(weights.begin(), weights.end(),
+                              std::not_equal_to<double>()) == weights.end();
+}
+
+std::unique_ptr<six::sicd::ComplexData> cloneData(
+        const six::sicd::ComplexData& data)
+{
+    return std::unique_ptr<six::sicd::ComplexData>(
+            static_cast<six::sicd::ComplexData*>(data.clone()));
+}
+}
+
+namespace six
+{
+namespace sicd
+{
+const size_t SpectralProcessor::NUM_WEIGHTS;
+
+SpectralProcessor::SpectralProcessor(size_t numThreads) :
+    mNumThreads(getNumThreads(numThreads))
+{
+}
+
+DirectionParameters& SpectralProcessor::getDirection(ComplexData& data,
+                                                     Dimension dimension)
+{
+    return const_cast<DirectionParameters&>(
+            getDirection(static_cast<const ComplexData&>(data), dimension));
+}
+
+const DirectionParameters& SpectralProcessor::getDirection(
+        const ComplexData& data, Dimension dimension)
+{
+    if (data.grid.get() == nullptr)
+    {
+        throw except::Exception(Ctxt("SICD has no Grid"));
+    }
+    const DirectionParameters* const direction =
+            (dimension == Dimension::ROW) ? data.grid->row.get() :
+                                            data.grid->col.get();
+    if (direction == nullptr)
+    {
+        throw except::Exception(Ctxt("SICD Grid is missing a direction"));
+    }
+    return *direction;
+}
+
+SpectralProcessor::Support
+SpectralProcessor::getSupport(const ComplexImage& image, Dimension dimension)
+{
+    const types::RowCol<size_t> dims = getExtent(image.data);
+    if (image.image.size() != dims.area())
+    {
+        std::ostringstream ostr;
+        ostr << "Image has " << image.image.size() << " pixels but the SICD "
+             << "is " << dims.row << " x " << dims.col;
+        throw except::Exception(Ctxt(ostr.str()));
+    }
+
+    const DirectionParameters& direction =
+            getDirection(image.data, dimension);
+    if (!(direction.sampleSpacing > 0.0) ||
+        !(direction.impulseResponseBandwidth > 0.0))
+    {
+        throw except::Exception(Ctxt(
+                "Need a positive sample spacing and impulse response "
+                "bandwidth"));
+    }
+    if (direction.sign != FFTSign::NEG && direction.sign != FFTSign::POS)
+    {
+        throw except::Exception(Ctxt("FFT sign is not set"));
+    }
+
+    Support support;
+    support.length = (dimension == Dimension::ROW) ? dims.row : dims.col;
+    support.binSpacing = 1.0 / (support.length * direction.sampleSpacing);
+    support.bandwidth = direction.impulseResponseBandwidth;
+    support.sign = direction.sign;
+    support.center = 0.0;
+    if (!direction.deltaKCOAPoly.empty())
+    {
+        const types::RowCol<double> middle =
+                image.data.pixelToImagePoint(types::RowCol<double>(
+                        (dims.row - 1) / 2.0, (dims.col - 1) / 2.0));
+        support.center = direction.deltaKCOAPoly(middle.row, middle.col);
+    }
+    return support;
+}
+
+std::vector<double> SpectralProcessor::getOffsets(const Support& support)
+{
+    // Bins past the middle are negative frequencies
+    const double sampleRate = support.length * support.binSpacing;
+    const size_t numPositive = (support.length + 1) / 2;
+    std::vector<double> offsets(support.length);
+    for (size_t bin = 0; bin < support.length; ++bin)
+    {
+        const double frequency = (bin < numPositive) ?
+                static_cast<double>(bin) * support.binSpacing :
+                -static_cast<double>(support.length - bin) *
+                        support.binSpacing;
+        const double offset = frequency - support.center;
+        offsets[bin] = offset - sampleRate * std::round(offset / sampleRate);
+    }
+    return offsets;
+}
+
+double SpectralProcessor::interpolateWeight(const std::vector<double>& weights,
+                                            double bandwidth,
+                                            double offset)
+{
+    const double last = static_cast<double>(weights.size() - 1);
+    const double position =
+            std::min(std::max((offset / bandwidth + 0.5) * last, 0.0), last);
+    const size_t index =
+            std::min(static_cast<size_t>(position), weights.size() - 2);
+    const double fraction = position - static_cast<double>(index);
+    return (1.0 - fraction) * weights[index] + fraction * weights[index + 1];
+}
+
+std::vector<double>
+SpectralProcessor::getWeights(const DirectionParameters& direction)
+{
+    if (!direction.weights.empty())
+    {
+        if (direction.weights.size() < 2)
+        {
+            throw except::Exception(Ctxt("Need at least 2 weights"));
+        }
+        return direction.weights;
+    }
+
+    const std::unique_ptr<Functor> weightFunction =
+            direction.calculateWeightFunction();
+    if (weightFunction.get() == nullptr)
+    {
+        throw except::Exception(Ctxt(
+                "Weighting is unknown: there's no WgtFunct, and WgtType is "
+                "missing or not UNIFORM, HAMMING, HANNING or KAISER"));
+    }
+    std::vector<double> weights = (*weightFunction)(NUM_WEIGHTS);
+    if (weights.empty())
+    {
+        weights.assign(2, 1.0);
+    }
+    return weights;
+}
+
+double SpectralProcessor::getImpulseResponseWidth(
+        const std::vector<double>& weights, double bandwidth)
+{
+    if (weights.size() < 2 || !(bandwidth > 0.0))
+    {
+        throw except::Exception(Ctxt(
+                "Need at least 2 weights and a positive bandwidth"));
+    }
+
+    // Impulse response at x / bandwidth, summed over the midpoints of
+    // NUM_WEIGHTS slices of the support
+    std::vector<double> frequencies(NUM_WEIGHTS);
+    std::vector<double> amplitudes(NUM_WEIGHTS);
+    for (size_t ii = 0; ii < NUM_WEIGHTS; ++ii)
+    {
+        frequencies[ii] = (ii + 0.5) / NUM_WEIGHTS - 0.5;
+        amplitudes[ii] = interpolateWeight(weights, 1.0, frequencies[ii]);
+    }
+    auto power = [&](double x)
+    {
+        std::complex<double> sum(0.0, 0.0);
+        for (size_t ii = 0; ii < NUM_WEIGHTS; ++ii)
+        {
+            sum += amplitudes[ii] *
+                    std::polar(1.0, 2.0 * M_PI *
+                                    frequencies[ii] * x);
+        }
+        return std::norm(sum);
+    };
+
+    // Step out to the half-power point, then bisect
+    const double halfPower = power(0.0) / 2.0;
+    const double step = 0.05;
+    double low = 0.0;
+    while (power(low + step) > halfPower)
+    {
+        low += step;
+        if (low > 100.0)
+        {
+            throw except::Exception(Ctxt(
+                    "Impulse response never falls to half power"));
+        }
+    }
+    double high = low + step;
+    for (size_t ii = 0; ii < 50; ++ii)
+    {
+        const double middle = (low + high) / 2.0;
+        (power(middle) > halfPower ? low : high) = middle;
+    }
+    return (low + high) / bandwidth;
+}
+
+void SpectralProcessor::deweight(ComplexImageResult& image,
+                                 Dimension dimension) const
+{
+    WeightType uniform;
+    uniform.windowName = "UNIFORM";
+    applyWeights(image, dimension, uniform);
+}
+
+void SpectralProcessor::applyWeights(ComplexImageResult& image,
+                                     Dimension dimension,
+                                     const WeightType& weightType,
+                                     const std::vector<double>& weights) const
+{
+    if (image.pComplexData.get() == nullptr)
+    {
+        throw except::Exception(Ctxt("Image has no ComplexData"));
+    }
+    const Support support = getSupport(ComplexImage(image), dimension);
+    DirectionParameters& direction =
+            getDirection(*image.pComplexData, dimension);
+    const std::vector<double> oldWeights = getWeights(direction);
+
+    // UNIFORM from a WgtType is stored without a WgtFunct
+    std::vector<double> storedWeights = weights;
+    if (storedWeights.empty())
+    {
+        DirectionParameters fromType;
+        fromType.weightType.reset(new WeightType(weightType));
+        const std::unique_ptr<Functor> weightFunction =
+                fromType.calculateWeightFunction();
+        if (weightFunction.get() == nullptr)
+        {
+            throw except::Exception(Ctxt(
+                    "No weights given, and WgtType is not UNIFORM, "
+                    "HAMMING, HANNING or KAISER"));
+        }
+        storedWeights = (*weightFunction)(NUM_WEIGHTS);
+    }
+    else if (storedWeights.size() < 2)
+    {
+        throw except::Exception(Ctxt("Need at least 2 weights"));
+    }
+    const std::vector<double> newWeights = storedWeights.empty() ?
+            std::vector<double>(2, 1.0) : storedWeights;
+
+    const double minWeight = MIN_WEIGHT *
+            *std::max_element(oldWeights.begin(), oldWeights.end());
+    const std::vector<double> offsets = getOffsets(support);
+    std::vector<std::vector<float> > gains(
+            1, std::vector<float>(support.length));
+    for (size_t bin = 0; bin < support.length; ++bin)
+    {
+        double gain = 1.0;
+        if (std::abs(offsets[bin]) <= support.bandwidth / 2)
+        {
+            const double oldWeight = interpolateWeight(
+                    oldWeights, support.bandwidth, offsets[bin]);
+            gain = (oldWeight < minWeight) ? 0.0 :
+                    interpolateWeight(newWeights, support.bandwidth,
+                                      offsets[bin]) / oldWeight;
+        }
+        gains[0][bin] = static_cast<float>(gain / support.length);
+    }
+
+    const types::RowCol<size_t> dims = getExtent(*image.pComplexData);
+    std::complex<float>* const pixels = image.widebandData.data();
+    filter(pixels, dims, dimension, support.sign, gains, support.length,
+           std::vector<std::complex<float>*>(1, pixels));
+
+    direction.weights = storedWeights;
+    direction.weightType.reset(new WeightType(weightType));
+    direction.impulseResponseWidth =
+            getImpulseResponseWidth(newWeights, support.bandwidth);
+}
+
+std::vector<ComplexImageResult>
+SpectralProcessor::split(const ComplexImage& image,
+                         Dimension dimension,
+                         size_t numParts) const
+{
+    if (numParts == 0)
+    {
+        throw except::Exception(Ctxt("Need at least one part"));
+    }
+    const Support support = getSupport(image, dimension);
+    const DirectionParameters& direction =
+            getDirection(image.data, dimension);
+    const std::vector<double> weights = getWeights(direction);
+    const types::RowCol<size_t> dims = getExtent(image.data);
+
+    // Each bin of the support goes to exactly one part
+    const double partWidth = support.bandwidth / numParts;
+    const std::vector<double> offsets = getOffsets(support);
+    std::vector<std::vector<float> > gains(
+            numParts, std::vector<float>(support.length, 0.0f));
+    for (size_t bin = 0; bin < support.length; ++bin)
+    {
+        if (std::abs(offsets[bin]) <= support.bandwidth / 2)
+        {
+            const double position =
+                    (offsets[bin] + support.bandwidth / 2) / partWidth;
+            const size_t part = std::min(static_cast<size_t>(position),
+                                         numParts - 1);
+            gains[part][bin] = 1.0f / support.length;
+        }
+    }
+
+    std::vector<ComplexImageResult> parts(numParts);
+    std::vector<std::complex<float>*> outputs(numParts);
+    for (size_t part = 0; part < numParts; ++part)
+    {
+        parts[part].pComplexData = cloneData(image.data);
+        parts[part].widebandData.resize(dims.area());
+        outputs[part] = parts[part].widebandData.data();
+    }
+    filter(image.image.data(), dims, dimension, support.sign, gains,
+           support.length, outputs);
+
+    const bool uniform = isUniform(weights);
+    for (size_t part = 0; part < numParts; ++part)
+    {
+        DirectionParameters& partDirection =
+                getDirection(*parts[part].pComplexData, dimension);
+        const double low = -support.bandwidth / 2 + part * partWidth;
+
+        std::vector<double> partWeights(weights.size());
+        for (size_t ii = 0; ii < weights.size(); ++ii)
+        {
+            partWeights[ii] = interpolateWeight(
+                    weights, support.bandwidth,
+                    low + ii * partWidth / (weights.size() - 1));
+        }
+        if (!uniform)
+        {
+            // A slice of a window is no longer that window
+            partDirection.weights = partWeights;
+            partDirection.weightType.reset(new WeightType());
+            partDirection.weightType->windowName = "UNKNOWN";
+        }
+
+        partDirection.impulseResponseBandwidth = partWidth;
+        partDirection.impulseResponseWidth =
+                getImpulseResponseWidth(partWeights, partWidth);
+        partDirection.deltaK1 += part * partWidth;
+        partDirection.deltaK2 -= (numParts - 1 - part) * partWidth;
+        if (partDirection.deltaKCOAPoly.empty())
+        {
+            partDirection.deltaKCOAPoly = Poly2D(0, 0);
+        }
+        partDirection.deltaKCOAPoly[0][0] += low + partWidth / 2;
+    }
+    return parts;
+}
+
+ComplexImageResult SpectralProcessor::upsample(const ComplexImage& image,
+                                               Dimension dimension,
+                                               size_t factor) const
+{
+    if (factor == 0)
+    {
+        throw except::Exception(Ctxt("Upsample factor must be positive"));
+    }
+    const Support support = getSupport(image, dimension);
+    const types::RowCol<size_t> dims = getExtent(image.data);
+    const size_t outputLength = support.length * factor;
+
+    ComplexImageResult result;
+    result.pComplexData = cloneData(image.data);
+    result.widebandData.resize(dims.area() * factor);
+    filter(image.image.data(), dims, dimension, support.sign,
+           std::vector<std::vector<float> >(
+                   1, std::vector<float>(support.length,
+                                         1.0f / support.length)),
+           outputLength,
+           std::vector<std::complex<float>*>(1, result.widebandData.data()));
+
+    getDirection(*result.pComplexData, dimension).sampleSpacing /= factor;
+    ImageData& imageData = *result.pComplexData->imageData;
+    const ptrdiff_t scale = static_cast<ptrdiff_t>(factor);
+    if (dimension == Dimension::ROW)
+    {
+        imageData.numRows = outputLength;
+        imageData.firstRow *= factor;
+        imageData.fullImage.row *= scale;
+        imageData.scpPixel.row *= scale;
+        for (auto& vertex : imageData.validData)
+        {
+            vertex.row *= scale;
+        }
+    }
+    else
+    {
+        imageData.numCols = outputLength;
+        imageData.firstCol *= factor;
+        imageData.fullImage.col *= scale;
+        imageData.scpPixel.col *= scale;
+        for (auto& vertex : imageData.validData)
+        {
+            vertex.col *= scale;
+        }
+    }
+    return result;
+}
+
+void SpectralProcessor::filter(
+        const std::complex<float>* input,
+        const types::RowCol<size_t>& dims,
+        Dimension dimension,
+        FFTSign sign,
+        const std::vector<std::vector<float> >& gains,
+        size_t outputLength,
+        const std::vector<std::complex<float>*>& outputs) const
+{
+    const bool byColumn = (dimension == Dimension::ROW);
+    const size_t length = byColumn ? dims.row : dims.col;
+    const size_t numLines = byColumn ? dims.col : dims.row;
+    const size_t padding = outputLength - length;
+    const size_t numPositive = (length + 1) / 2;
+
+    const six::FFT forward(length);
+    std::unique_ptr<six::FFT> padded;
+    if (padding > 0)
+    {
+        padded.reset(new six::FFT(outputLength));
+    }
+    const six::FFT& inverse = padded.get() ? *padded : forward;
+    const FFTSign inverseSign = getInverse(sign);
+
+    const size_t numTiles = (numLines + TILE_SIZE - 1) / TILE_SIZE;
+    mt::run1D(numTiles, mNumThreads, [&](size_t tile)
+    {
+        const size_t begin = tile * TILE_SIZE;
+        const size_t numTileLines = std::min(TILE_SIZE, numLines - begin);
+        std::vector<std::complex<float> > lines(numTileLines * length);
+        std::vector<std::complex<float> > work(numTileLines * outputLength);
+
+        // Gather the tile into contiguous lines, transposing columns
+        if (byColumn)
+        {
+            for (size_t ii = 0; ii < length; ++ii)
+            {
+                const std::complex<float>* const row =
+                        input + ii * dims.col + begin;
+                for (size_t line = 0; line < numTileLines; ++line)
+                {
+                    lines[line * length + ii] = row[line];
+                }
+            }
+        }
+        else
+        {
+            memcpy(lines.data(), input + begin * dims.col,
+                   lines.size() * sizeof(std::complex<float>));
+        }
+        for (size_t line = 0; line < numTileLines; ++line)
+        {
+            forward.transform(&lines[line * length], sign);
+        }
+
+        for (size_t output = 0; output < outputs.size(); ++output)
+        {
+            const float* const gain = gains[output].data();
+            for (size_t line = 0; line < numTileLines; ++line)
+            {
+                const std::complex<float>* const spectrum =
+                        &lines[line * length];
+                std::complex<float>* const filtered =
+                        &work[line * outputLength];
+                for (size_t bin = 0; bin < numPositive; ++bin)
+                {
+                    filtered[bin] = spectrum[bin] * gain[bin];
+                }
+                std::fill_n(filtered + numPositive, padding,
+                            std::complex<float>(0.0f, 0.0f));
+                for (size_t bin = numPositive; bin < length; ++bin)
+                {
+                    filtered[bin + padding] = spectrum[bin] * gain[bin];
+                }
+                inverse.transform(filtered, inverseSign);
+            }
+
+            // Scatter back, transposing columns
+            std::complex<float>* const image = outputs[output];
+            if (byColumn)
+            {
+                for (size_t ii = 0; ii < outputLength; ++ii)
+                {
+                    std::complex<float>* const row =
+                            image + ii * dims.col + begin;
+                    for (size_t line = 0; line < numTileLines; ++line)
+                    {
+                        row[line] = work[line * outputLength + ii];
+                    }
+                }
+            }
+            else
+            {
+                memcpy(image + begin * outputLength, work.data(),
+                       work.size() * sizeof(std::complex<float>));
+            }
+        }
+    });
+}
+}
+}
@@ -41,6 +41,8 @@
 #include <six/NITFReadControl.h>
 #include <six/sicd/SICDWriteControl.h>
 #include <six/Utilities.h>
+#include <six/BinaryXML.h>
+#include <six/Instrumentation.h>
 #include <six/sicd/ComplexXMLControl.h>
 #include <six/sicd/SICDMesh.h>
 #include <str/Manip.h>
@@ -197,7 +199,9 @@ public:
         SICDreader<T>(reader, imageNumber, offset, extent, elementsPerRow,
             [&](size_t elementsPerRow, size_t row, size_t rowsToRead, const std::vector<T>& tempVector)
             {
+                SIX_SCOPED_TIMER("six::sicd::Utilities::getWidebandData::convert");
                 process(elementsPerRow, row, rowsToRead, tempVector);
+                SIX_COUNT("six.sicd.pixelsConverted", static_cast<uint64_t>(elementsPerRow / 2 * rowsToRead));
             });
     }
     SICD_readerAndConverter(const SICD_readerAndConverter&) = delete;
@@ -741,6 +745,7 @@ void Utilities::getWidebandData(NITFReadControl& reader,
                                 const types::RowCol<size_t>& extent,
                                 std::complex<float>* buffer)
 {
+    SIX_SCOPED_TIMER("six::sicd::Utilities::getWidebandData");
     const PixelType pixelType = complexData.getPixelType();
     constexpr size_t imageNumber = 0;
 
@@ -1072,6 +1077,22 @@ std::u8string Utilities::toXMLString(const ComplexData& data,
     return ::six::toValidXMLString(data, pSchemaPaths, pLogger_, &xmlRegistry);
 }
 
+std::vector<std::byte> Utilities::toBinary(const ComplexData& data, logging::Logger* pLogger)
+{
+    XMLControlRegistry xmlRegistry;
+    xmlRegistry.addCreator<ComplexXMLControl>();
+    return ::six::toBinary(data, &xmlRegistry, pLogger);
+}
+std::unique_ptr<ComplexData> Utilities::parseDataFromBinary(std::span<const std::byte> bytes,
+    const std::vector<std::filesystem::path>* pSchemaPaths, logging::Logger* pLogger)
+{
+    XMLControlRegistry xmlRegistry;
+    xmlRegistry.addCreator<ComplexXMLControl>();
+
+    auto data = ::six::parseDataFromBinary(xmlRegistry, bytes, pSchemaPaths, pLogger);
+    return std::unique_ptr<ComplexData>(static_cast<ComplexData*>(data.release()));
+}
+
 static void update_for_SICD_130(ComplexData& data)
 {
     data.errorStatistics.reset(new ErrorStatistics());
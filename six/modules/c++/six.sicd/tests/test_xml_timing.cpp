@@ -0,0 +1,97 @@
+/* =========================================================================
+ * This file is part of six.sicd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six.sicd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Times SICD XML serialization and parsing, which is dominated by number
+// <-> text conversions of the polynomial coefficients.
+
+#include <stdlib.h>
+
+#include <iostream>
+#include <string>
+
+#include <sys/StopWatch.h>
+#include <str/Convert.h>
+#include <six/sicd/ComplexData.h>
+#include <six/sicd/Utilities.h>
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        const size_t numIterations = argc > 1 ? str::toType<size_t>(argv[1]) : 100;
+
+        auto pData = six::sicd::Utilities::createFakeComplexData();
+        // Fill some big polynomials with values that need all 17 digits
+        six::Poly2D timeCOAPoly(20, 20);
+        for (size_t ii = 0; ii <= timeCOAPoly.orderX(); ++ii)
+        {
+            for (size_t jj = 0; jj <= timeCOAPoly.orderY(); ++jj)
+            {
+                timeCOAPoly[ii][jj] = 1.0 / static_cast<double>(1 + ii * 21 + jj);
+            }
+        }
+        pData->grid->timeCOAPoly = timeCOAPoly;
+
+        std::u8string xml;
+        sys::RealTimeStopWatch toXMLWatch;
+        toXMLWatch.start();
+        for (size_t ii = 0; ii < numIterations; ++ii)
+        {
+            xml = six::sicd::Utilities::toXMLString(*pData, nullptr /*pSchemaPaths*/);
+        }
+        const double toXMLMs = toXMLWatch.stop();
+
+        std::unique_ptr<six::sicd::ComplexData> pParsed;
+        sys::RealTimeStopWatch parseWatch;
+        parseWatch.start();
+        for (size_t ii = 0; ii < numIterations; ++ii)
+        {
+            pParsed = six::sicd::Utilities::parseDataFromString(xml, nullptr /*pSchemaPaths*/);
+        }
+        const double parseMs = parseWatch.stop();
+
+        std::cout << "XML is " << xml.size() << " bytes: toXMLString "
+                  << (toXMLMs / numIterations) << " ms, parseDataFromString "
+                  << (parseMs / numIterations) << " ms\n";
+
+        // Numbers have to survive the trip exactly
+        if (pParsed->grid->timeCOAPoly != timeCOAPoly)
+        {
+            std::cerr << "Round-tripped TimeCOAPoly doesn't match\n";
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+    }
+    catch (const except::Exception& ex)
+    {
+        std::cerr << ex.toString() << std::endl;
+    }
+    catch (...)
+    {
+        std::cerr << "Unknown exception\n";
+    }
+    return EXIT_FAILURE;
+}
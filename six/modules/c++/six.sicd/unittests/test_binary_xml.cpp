@@ -0,0 +1,140 @@
+/* =========================================================================
+* This file is part of six.sicd-c++
+* =========================================================================
+*
+* (C) Copyright 2026, Maxar Technologies, Inc.
+*
+* six.sicd-c++ is free software; you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation; either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License along with this program; If not,
+* see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#include <string>
+#include <vector>
+#include <std/span>
+
+#include <import/six/sicd.h>
+#include <six/BinaryXML.h>
+#include <six/sicd/Utilities.h>
+
+#include "TestCase.h"
+
+static std::span<const std::byte> as_span(const std::vector<std::byte>& bytes)
+{
+    return std::span<const std::byte>(bytes.data(), bytes.size());
+}
+
+static std::unique_ptr<six::sicd::ComplexData> createData()
+{
+    auto pData = six::sicd::Utilities::createFakeComplexData();
+    pData->collectionInformation->setClassificationLevel("UNCLASSIFIED");
+    pData->collectionInformation->collectorName = "Collector <&>";
+    return pData;
+}
+
+TEST_CASE(testRoundTrip)
+{
+    const auto pData = createData();
+
+    const auto bytes = six::sicd::Utilities::toBinary(*pData);
+    TEST_ASSERT(six::binary::isBinary(as_span(bytes)));
+    const auto pFromBinary = six::sicd::Utilities::parseDataFromBinary(as_span(bytes), nullptr /*pSchemaPaths*/);
+    TEST_ASSERT(*pFromBinary == *pData);
+
+    // Same result as going through XML
+    const auto xml = six::sicd::Utilities::toXMLString(*pData, nullptr /*pSchemaPaths*/);
+    const auto pFromXML = six::sicd::Utilities::parseDataFromString(xml, nullptr /*pSchemaPaths*/);
+    TEST_ASSERT(*pFromBinary == *pFromXML);
+    TEST_ASSERT(six::sicd::Utilities::toXMLString(*pFromBinary, nullptr /*pSchemaPaths*/) == xml);
+
+    // ... and it's smaller
+    TEST_ASSERT(bytes.size() < xml.size());
+    TEST_ASSERT(!six::binary::isBinary(std::string(reinterpret_cast<const char*>(xml.c_str()), xml.size())));
+}
+
+TEST_CASE(testDocumentView)
+{
+    const auto pData = createData();
+    const auto bytes = six::sicd::Utilities::toBinary(*pData);
+
+    const six::binary::DocumentView view(as_span(bytes));
+    TEST_ASSERT_EQ(view.getVersion(), six::binary::VERSION);
+    const auto root = view.getRootElement();
+    TEST_ASSERT_EQ(view.getLocalName(root).str(), "SICD");
+    TEST_ASSERT_EQ(view.getParent(root), six::binary::DocumentView::npos);
+
+    const auto collectionInfo = view.findChild(root, "CollectionInfo");
+    TEST_ASSERT(collectionInfo != six::binary::DocumentView::npos);
+    TEST_ASSERT_EQ(view.getParent(collectionInfo), root);
+    const auto collectorName = view.findChild(collectionInfo, "CollectorName");
+    TEST_ASSERT(collectorName != six::binary::DocumentView::npos);
+    TEST_ASSERT_EQ(view.getCharacterData(collectorName).str(), pData->collectionInformation->collectorName);
+    TEST_ASSERT_EQ(view.getUri(collectorName).str(), view.getUri(root).str());
+    TEST_ASSERT_EQ(view.findChild(collectionInfo, "NoSuchElement"), six::binary::DocumentView::npos);
+
+    const auto classification = view.findChild(collectionInfo, "Classification");
+    TEST_ASSERT(view.getCharacterData(classification) == "UNCLASSIFIED");
+
+    // Every element is reachable from the root, in document order
+    size_t numElements = 0;
+    std::vector<size_t> stack{ root };
+    while (!stack.empty())
+    {
+        const auto element = stack.back();
+        stack.pop_back();
+        TEST_ASSERT_EQ(element, numElements);
+        ++numElements;
+
+        std::vector<size_t> children;
+        for (auto child = view.getFirstChild(element); child != six::binary::DocumentView::npos;
+             child = view.getNextSibling(child))
+        {
+            children.push_back(child);
+        }
+        stack.insert(stack.end(), children.rbegin(), children.rend());
+    }
+    TEST_ASSERT_EQ(numElements, view.getNumElements());
+}
+
+TEST_CASE(testMalformed)
+{
+    const auto pData = createData();
+    const auto bytes = six::sicd::Utilities::toBinary(*pData);
+
+    std::vector<std::byte> empty;
+    TEST_EXCEPTION(six::binary::DocumentView(as_span(empty)));
+
+    auto truncated = bytes;
+    truncated.pop_back();
+    TEST_EXCEPTION(six::binary::DocumentView(as_span(truncated)));
+
+    auto badVersion = bytes;
+    badVersion[4] = static_cast<std::byte>(99);
+    TEST_EXCEPTION(six::binary::DocumentView(as_span(badVersion)));
+
+    // The root's first child pointing back at the root would be a cycle
+    auto cycle = bytes;
+    const size_t firstChild = 32 /*header*/ + 7 * sizeof(uint32_t);
+    for (size_t ii = 0; ii < sizeof(uint32_t); ++ii)
+    {
+        cycle[firstChild + ii] = static_cast<std::byte>(0);
+    }
+    TEST_EXCEPTION(six::binary::DocumentView(as_span(cycle)));
+}
+
+TEST_MAIN(
+    TEST_CHECK(testRoundTrip);
+    TEST_CHECK(testDocumentView);
+    TEST_CHECK(testMalformed);
+    )
@@ -0,0 +1,131 @@
+/* =========================================================================
+* This file is part of six.sicd-c++
+* =========================================================================
+*
+* (C) Copyright 2026, Maxar Technologies, Inc.
+*
+* six.sicd-c++ is free software; you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation; either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License along with this program; If not,
+* see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#include <complex>
+#include <string>
+#include <vector>
+#include <std/filesystem>
+
+#include <import/sys.h>
+
+#include <import/six/sicd.h>
+#include <six/NITFReadControl.h>
+#include <six/sicd/CropUtils.h>
+#include <six/sicd/Utilities.h>
+
+#include "../tests/TestUtilities.h"
+#include "TestCase.h"
+
+static std::filesystem::path argv0()
+{
+    static const sys::OS os;
+    static const std::filesystem::path retval = os.getSpecialEnv("0");
+    return retval;
+}
+
+static std::filesystem::path getNitfPath(const std::filesystem::path& filename)
+{
+    const auto root_dir = six::testing::buildRootDir(argv0());
+    return root_dir / "six" / "modules" / "c++" / "six" / "tests" / "nitf" / filename;
+}
+
+static void checkAOI(const std::string& testName,
+                     const std::vector<std::complex<float>>& image,
+                     const types::RowCol<size_t>& imageDims,
+                     const six::sicd::CropRequest& request)
+{
+    const auto result = six::sicd::Utilities::readSicd(request.outPathname);
+    const auto aoiDims = getExtent(*result.pComplexData);
+    TEST_ASSERT_EQ(aoiDims.row, request.aoiDims.row);
+    TEST_ASSERT_EQ(aoiDims.col, request.aoiDims.col);
+    TEST_ASSERT_EQ(result.pComplexData->imageData->firstRow,
+                   request.aoiOffset.row);
+    TEST_ASSERT_EQ(result.pComplexData->imageData->firstCol,
+                   request.aoiOffset.col);
+
+    const auto& aoi = result.widebandData;
+    TEST_ASSERT_EQ(aoi.size(), request.aoiDims.area());
+    for (size_t row = 0; row < request.aoiDims.row; ++row)
+    {
+        for (size_t col = 0; col < request.aoiDims.col; ++col)
+        {
+            const size_t inIdx = (request.aoiOffset.row + row) * imageDims.col +
+                    request.aoiOffset.col + col;
+            TEST_ASSERT_EQ(aoi[row * request.aoiDims.col + col], image[inIdx]);
+        }
+    }
+}
+
+TEST_CASE(testStreamingCrop)
+{
+    const auto inputPathname = getNitfPath("sicd_50x50.nitf");
+    const auto original = six::sicd::Utilities::readSicd(inputPathname);
+    const auto imageDims = getExtent(*original.pComplexData);
+
+    const std::vector<std::string> schemaPaths;
+    six::NITFReadControl reader;
+    reader.load(inputPathname.string(), schemaPaths);
+
+    // Small bands so that the AOIs span several of them, including a
+    // partial last band
+    six::sicd::StreamingCropper cropper(reader, schemaPaths, 7);
+
+    std::vector<six::sicd::CropRequest> requests;
+    requests.emplace_back(types::RowCol<size_t>(0, 0),
+                          types::RowCol<size_t>(50, 50),
+                          "streaming_crop_full.nitf");
+    requests.emplace_back(types::RowCol<size_t>(3, 11),
+                          types::RowCol<size_t>(30, 17),
+                          "streaming_crop_aoi.nitf");
+    requests.emplace_back(types::RowCol<size_t>(49, 0),
+                          types::RowCol<size_t>(1, 50),
+                          "streaming_crop_last_row.nitf");
+    cropper.crop(requests, 3);
+
+    for (const auto& request : requests)
+    {
+        checkAOI(testName, original.widebandData, imageDims, request);
+        std::filesystem::remove(request.outPathname);
+    }
+}
+
+TEST_CASE(testStreamingCropOutOfBounds)
+{
+    const auto inputPathname = getNitfPath("sicd_50x50.nitf");
+    const std::vector<std::string> schemaPaths;
+    six::NITFReadControl reader;
+    reader.load(inputPathname.string(), schemaPaths);
+
+    six::sicd::StreamingCropper cropper(reader, schemaPaths);
+    TEST_EXCEPTION(cropper.crop(types::RowCol<size_t>(40, 0),
+                                types::RowCol<size_t>(20, 10),
+                                "streaming_crop_bad.nitf"));
+    TEST_EXCEPTION(cropper.crop(types::RowCol<size_t>(0, 0),
+                                types::RowCol<size_t>(0, 10),
+                                "streaming_crop_bad.nitf"));
+}
+
+TEST_MAIN(
+    TEST_CHECK(testStreamingCrop);
+    TEST_CHECK(testStreamingCropOutOfBounds);
+    )
@@ -0,0 +1,171 @@
+/* =========================================================================
+* This file is part of six.sicd-c++
+* =========================================================================
+*
+* (C) Copyright 2026, Maxar Technologies, Inc.
+*
+* six.sicd-c++ is free software; you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation; either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License along with this program; If not,
+* see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <std/filesystem>
+
+#include <import/sys.h>
+
+#include <import/six/sicd.h>
+#include <six/DataCache.h>
+#include <six/NITFReadControl.h>
+#include <six/sicd/Utilities.h>
+
+#include "../tests/TestUtilities.h"
+#include "TestCase.h"
+
+static std::filesystem::path argv0()
+{
+    static const sys::OS os;
+    static const std::filesystem::path retval = os.getSpecialEnv("0");
+    return retval;
+}
+
+static std::filesystem::path getNitfPath(const std::filesystem::path& filename)
+{
+    const auto root_dir = six::testing::buildRootDir(argv0());
+    return root_dir / "six" / "modules" / "c++" / "six" / "tests" / "nitf" / filename;
+}
+
+static std::shared_ptr<const six::Data> makeData()
+{
+    return std::shared_ptr<const six::Data>(six::sicd::Utilities::createFakeComplexData().release());
+}
+
+TEST_CASE(testFindAndInsert)
+{
+    six::DataCache cache;
+    const std::vector<std::string> schemaPaths{ "/some/schemas" };
+    const std::string xml = "<SICD>one</SICD>";
+
+    TEST_ASSERT_NULL(cache.find(xml, schemaPaths).get());
+    const auto data = makeData();
+    cache.insert(xml, schemaPaths, data);
+    TEST_ASSERT_EQ(cache.find(xml, schemaPaths).get(), data.get());
+
+    // Same XML validated against other schemas is a different product
+    TEST_ASSERT_NULL(cache.find(xml, std::vector<std::string>()).get());
+    TEST_ASSERT_NULL(cache.find("<SICD>two</SICD>", schemaPaths).get());
+
+    const auto stats = cache.getStatistics();
+    TEST_ASSERT_EQ(stats.hits, static_cast<size_t>(1));
+    TEST_ASSERT_EQ(stats.misses, static_cast<size_t>(3));
+    TEST_ASSERT_EQ(stats.numEntries, static_cast<size_t>(1));
+    TEST_ASSERT_EQ(stats.numBytes, xml.size());
+
+    // get() only parses on a miss
+    size_t numParses = 0;
+    const auto parse = [&]() { ++numParses; return six::sicd::Utilities::createFakeComplexData(); };
+    TEST_ASSERT_EQ(cache.get(xml, schemaPaths, parse).get(), data.get());
+    TEST_ASSERT_EQ(numParses, static_cast<size_t>(0));
+    const auto parsed = cache.get("<SICD>two</SICD>", schemaPaths, parse);
+    TEST_ASSERT_EQ(numParses, static_cast<size_t>(1));
+    TEST_ASSERT_EQ(cache.get("<SICD>two</SICD>", schemaPaths, parse).get(), parsed.get());
+    TEST_ASSERT_EQ(numParses, static_cast<size_t>(1));
+}
+
+TEST_CASE(testEviction)
+{
+    six::DataCache cache(2 /*maxEntries*/, 1000 /*maxBytes*/);
+    const std::vector<std::string> schemaPaths;
+    cache.insert("a", schemaPaths, makeData());
+    cache.insert("b", schemaPaths, makeData());
+    TEST_ASSERT(cache.find("a", schemaPaths) != nullptr); // "b" is now least-recently used
+    cache.insert("c", schemaPaths, makeData());
+    TEST_ASSERT(cache.find("a", schemaPaths) != nullptr);
+    TEST_ASSERT_NULL(cache.find("b", schemaPaths).get());
+    TEST_ASSERT(cache.find("c", schemaPaths) != nullptr);
+    TEST_ASSERT_EQ(cache.getStatistics().evictions, static_cast<size_t>(1));
+
+    // Too big to ever fit
+    cache.insert(std::string(1001, 'x'), schemaPaths, makeData());
+    TEST_ASSERT_NULL(cache.find(std::string(1001, 'x'), schemaPaths).get());
+
+    // Byte limit
+    cache.setLimits(10, 600);
+    cache.insert(std::string(500, 'y'), schemaPaths, makeData());
+    cache.insert(std::string(500, 'z'), schemaPaths, makeData());
+    TEST_ASSERT_NULL(cache.find(std::string(500, 'y'), schemaPaths).get());
+    TEST_ASSERT(cache.find(std::string(500, 'z'), schemaPaths) != nullptr);
+    TEST_ASSERT(cache.getStatistics().numBytes <= static_cast<size_t>(600));
+
+    cache.clear();
+    TEST_ASSERT_EQ(cache.getStatistics().numEntries, static_cast<size_t>(0));
+    TEST_ASSERT_EQ(cache.getStatistics().numBytes, static_cast<size_t>(0));
+}
+
+TEST_CASE(testReopen)
+{
+    const auto inputPathname = getNitfPath("sicd_50x50.nitf");
+    const auto expected = six::sicd::Utilities::readSicd(inputPathname); // also registers the XML control
+
+    six::DataCache cache;
+    const std::vector<std::string> schemaPaths;
+    for (size_t ii = 0; ii < 3; ++ii)
+    {
+        six::NITFReadControl reader;
+        reader.setDataCache(&cache);
+        reader.load(inputPathname.string(), schemaPaths);
+
+        auto& data = *(reader.getContainer()->getData(0));
+        TEST_ASSERT(data == *(expected.pComplexData));
+
+        // Each reader gets its own copy, changes don't leak into the cache
+        data.setName("changed");
+    }
+
+    const auto stats = cache.getStatistics();
+    TEST_ASSERT_EQ(stats.misses, static_cast<size_t>(1));
+    TEST_ASSERT_EQ(stats.hits, static_cast<size_t>(2));
+    TEST_ASSERT_EQ(stats.numEntries, static_cast<size_t>(1));
+}
+
+TEST_CASE(testNullSchemaPaths)
+{
+    const auto inputPathname = getNitfPath("sicd_50x50.nitf");
+    const auto expected = six::sicd::Utilities::readSicd(inputPathname); // also registers the XML control
+
+    six::DataCache cache;
+    for (size_t ii = 0; ii < 2; ++ii)
+    {
+        six::NITFReadControl reader;
+        reader.setDataCache(&cache);
+        const std::vector<std::filesystem::path>* pSchemaPaths = nullptr;
+        reader.load(inputPathname, pSchemaPaths);
+        TEST_ASSERT(*(reader.getContainer()->getData(0)) == *(expected.pComplexData));
+    }
+
+    // A null pointer is the same as no schema paths: one parse, then a hit
+    const auto stats = cache.getStatistics();
+    TEST_ASSERT_EQ(stats.misses, static_cast<size_t>(1));
+    TEST_ASSERT_EQ(stats.hits, static_cast<size_t>(1));
+    TEST_ASSERT_EQ(stats.numEntries, static_cast<size_t>(1));
+}
+
+TEST_MAIN(
+    TEST_CHECK(testFindAndInsert);
+    TEST_CHECK(testEviction);
+    TEST_CHECK(testReopen);
+    TEST_CHECK(testNullSchemaPaths);
+    )
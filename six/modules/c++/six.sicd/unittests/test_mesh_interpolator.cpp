@@ -0,0 +1,206 @@
+/* =========================================================================
+ * This file is part of six.sicd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six.sicd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include <std/memory>
+
+#include <six/sicd/MeshInterpolator.h>
+#include <six/sicd/SICDMesh.h>
+
+#include "TestCase.h"
+
+namespace
+{
+bool isClose(double actual, double expected)
+{
+    return std::abs(actual - expected) <=
+            1e-9 * std::max(std::abs(expected), 1.0);
+}
+
+// Linear in (x, y), so interpolation reproduces it exactly in any mesh of
+// parallelograms
+double linearField(double x, double y)
+{
+    return 3.0 - 0.5 * x + 0.25 * y;
+}
+
+// Nodes at x0 + row * dx, y0 + col * dy, plus shear * row along y
+std::unique_ptr<six::sicd::NoiseMesh> makeMesh(
+        const types::RowCol<size_t>& dims,
+        double x0, double dx,
+        double y0, double dy,
+        double shear)
+{
+    std::vector<double> x(dims.area());
+    std::vector<double> y(dims.area());
+    std::vector<double> noise(dims.area());
+    for (size_t row = 0; row < dims.row; ++row)
+    {
+        for (size_t col = 0; col < dims.col; ++col)
+        {
+            const size_t idx = row * dims.col + col;
+            x[idx] = x0 + row * dx;
+            y[idx] = y0 + col * dy + shear * row;
+            noise[idx] = linearField(x[idx], y[idx]);
+        }
+    }
+    return std::make_unique<six::sicd::NoiseMesh>("Noise", dims, x, y, noise,
+                                                   noise, noise);
+}
+
+std::span<const double> asSpan(const std::vector<double>& values)
+{
+    return std::span<const double>(values.data(), values.size());
+}
+}
+
+TEST_CASE(testRectilinear)
+{
+    // Descending x, ascending y
+    const auto pMesh = makeMesh(types::RowCol<size_t>(6, 9),
+                                40.0, -10.0, -30.0, 7.5, 0.0);
+    const auto& mesh = *pMesh;
+    const six::sicd::MeshInterpolator interpolator(mesh);
+    TEST_ASSERT(interpolator.isRectilinear());
+
+    const auto field = asSpan(mesh.getCombinedNoise());
+    TEST_ASSERT(isClose(interpolator.interpolate(field, 12.5, 3.0),
+                        linearField(12.5, 3.0)));
+    TEST_ASSERT(isClose(interpolator.interpolate(field, 40.0, -30.0),
+                        linearField(40.0, -30.0)));
+    TEST_ASSERT(isClose(interpolator.interpolate(field, -10.0, 30.0),
+                        linearField(-10.0, 30.0)));
+    TEST_ASSERT(std::isnan(interpolator.interpolate(field, 40.5, 0.0)));
+    TEST_ASSERT(std::isnan(interpolator.interpolate(field, 0.0, 30.5)));
+
+    std::vector<double> tooSmall(field.size() - 1);
+    TEST_EXCEPTION(interpolator.interpolate(asSpan(tooSmall), 0.0, 0.0));
+}
+
+TEST_CASE(testCurvilinear)
+{
+    const auto pMesh = makeMesh(types::RowCol<size_t>(7, 5),
+                                -20.0, 8.0, 10.0, -12.0, 3.0);
+    const auto& mesh = *pMesh;
+    const six::sicd::MeshInterpolator interpolator(mesh, -1.0);
+    TEST_ASSERT(!interpolator.isRectilinear());
+
+    const auto field = asSpan(mesh.getCombinedNoise());
+    TEST_ASSERT(isClose(interpolator.interpolate(field, 1.0, -5.0),
+                        linearField(1.0, -5.0)));
+    TEST_ASSERT(isClose(interpolator.interpolate(field, -20.0, 10.0),
+                        linearField(-20.0, 10.0)));
+
+    // Inside the bounding box but outside the mesh
+    TEST_ASSERT_EQ(interpolator.interpolate(field, -20.0, 12.0), -1.0);
+    TEST_ASSERT_EQ(interpolator.interpolate(field, 100.0, 0.0), -1.0);
+}
+
+TEST_CASE(testGridMatchesPoints)
+{
+    const types::RowCol<double> start(-25.0, -40.0);
+    const types::RowCol<double> step(0.75, 1.25);
+    const types::RowCol<size_t> dims(97, 61);
+
+    for (double shear : {0.0, 2.0})
+    {
+        const auto pMesh = makeMesh(types::RowCol<size_t>(10, 8),
+                                    -20.0, 6.0, -35.0, 9.0, shear);
+        const auto& mesh = *pMesh;
+        const six::sicd::MeshInterpolator interpolator(mesh);
+        const auto field = asSpan(mesh.getCombinedNoise());
+
+        std::vector<double> grid(dims.area());
+        interpolator.interpolateGrid(
+                field, start, step, dims,
+                std::span<double>(grid.data(), grid.size()), 3);
+
+        std::vector<double> x(dims.area());
+        std::vector<double> y(dims.area());
+        for (size_t row = 0; row < dims.row; ++row)
+        {
+            for (size_t col = 0; col < dims.col; ++col)
+            {
+                x[row * dims.col + col] = start.row + row * step.row;
+                y[row * dims.col + col] = start.col + col * step.col;
+            }
+        }
+        std::vector<double> points(dims.area());
+        interpolator.interpolate(
+                field, asSpan(x), asSpan(y),
+                std::span<double>(points.data(), points.size()), 4);
+
+        size_t numInside = 0;
+        for (size_t ii = 0; ii < grid.size(); ++ii)
+        {
+            TEST_ASSERT_EQ(std::isnan(grid[ii]), std::isnan(points[ii]));
+            if (!std::isnan(grid[ii]))
+            {
+                TEST_ASSERT(isClose(grid[ii], points[ii]));
+                TEST_ASSERT(isClose(grid[ii], linearField(x[ii], y[ii])));
+                ++numInside;
+            }
+        }
+
+        // The grid runs off the mesh on every side
+        TEST_ASSERT(numInside > 0);
+        TEST_ASSERT(numInside < grid.size());
+    }
+}
+
+TEST_CASE(testSerializedMesh)
+{
+    const auto pMesh = makeMesh(types::RowCol<size_t>(4, 5),
+                                -3.0, 1.5, 2.0, 0.5, 0.0);
+    const auto& mesh = *pMesh;
+    std::vector<std::byte> buffer;
+    mesh.serialize(buffer);
+
+    six::sicd::NoiseMesh deserialized("Noise");
+    const std::byte* data = buffer.data();
+    deserialized.deserialize(data);
+    TEST_ASSERT(data == buffer.data() + buffer.size());
+    TEST_ASSERT(deserialized.getX() == mesh.getX());
+    TEST_ASSERT(deserialized.getY() == mesh.getY());
+    TEST_ASSERT(deserialized.getCombinedNoise() == mesh.getCombinedNoise());
+
+    const six::sicd::MeshInterpolator interpolator(deserialized);
+    TEST_ASSERT(isClose(
+            interpolator.interpolate(
+                    asSpan(deserialized.getCombinedNoise()), -1.0, 3.3),
+            linearField(-1.0, 3.3)));
+
+    const six::sicd::PlanarCoordinateMesh tooSmall(
+            "Small", types::RowCol<size_t>(1, 3),
+            std::vector<double>(3), std::vector<double>(3));
+    TEST_EXCEPTION(six::sicd::MeshInterpolator(tooSmall));
+}
+
+TEST_MAIN(
+    TEST_CHECK(testRectilinear);
+    TEST_CHECK(testCurvilinear);
+    TEST_CHECK(testGridMatchesPoints);
+    TEST_CHECK(testSerializedMesh);
+    )
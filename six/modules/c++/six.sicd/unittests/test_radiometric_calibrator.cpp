@@ -0,0 +1,283 @@
+/* =========================================================================
+ * This file is part of six.sicd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six.sicd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cmath>
+#include <complex>
+#include <string>
+#include <vector>
+#include <std/filesystem>
+
+#include <import/sys.h>
+
+#include <six/NITFReadControl.h>
+#include <six/sicd/RadiometricCalibrator.h>
+#include <six/sicd/Utilities.h>
+
+#include "../tests/TestUtilities.h"
+#include "TestCase.h"
+
+namespace
+{
+std::filesystem::path argv0()
+{
+    static const sys::OS os;
+    static const std::filesystem::path retval = os.getSpecialEnv("0");
+    return retval;
+}
+
+std::filesystem::path getNitfPath(const std::filesystem::path& filename)
+{
+    const auto root_dir = six::testing::buildRootDir(argv0());
+    return root_dir / "six" / "modules" / "c++" / "six" / "tests" / "nitf" /
+            filename;
+}
+
+bool isClose(double actual, double expected, double tolerance)
+{
+    return std::abs(actual - expected) <=
+            tolerance * std::max(std::abs(expected), 1.0);
+}
+
+bool isCloseCalibrated(double actual, double expected, double magnitude)
+{
+    return std::abs(actual - expected) <=
+            1e-6 * std::max(std::abs(expected), magnitude) + 1e-30;
+}
+
+six::Poly2D makePoly(size_t orderX, size_t orderY)
+{
+    six::Poly2D poly(orderX, orderY);
+    for (size_t ii = 0; ii <= orderX; ++ii)
+    {
+        for (size_t jj = 0; jj <= orderY; ++jj)
+        {
+            poly[ii][jj] = (ii + 1.0) / (jj + 2.0) *
+                    std::pow(1e-3, static_cast<double>(ii + jj)) *
+                    ((ii + jj) % 2 ? -1.0 : 1.0);
+        }
+    }
+    return poly;
+}
+
+std::unique_ptr<six::sicd::ComplexData> makeComplexData()
+{
+    const types::RowCol<size_t> dims(40, 1100);
+    std::unique_ptr<six::sicd::ComplexData> data(
+            six::sicd::Utilities::createFakeComplexData(&dims).release());
+    data->imageData->firstRow = 5;
+    data->imageData->firstCol = 7;
+    data->imageData->scpPixel = types::RowCol<ptrdiff_t>(30, 600);
+    data->grid->row->sampleSpacing = 0.75;
+    data->grid->col->sampleSpacing = 1.25;
+
+    data->radiometric.reset(new six::Radiometric());
+    data->radiometric->sigmaZeroSFPoly = makePoly(2, 3);
+    data->radiometric->noiseLevel.noiseType = six::Radiometric::NL_ABSOLUTE;
+    data->radiometric->noiseLevel.noisePoly = makePoly(1, 2);
+    return data;
+}
+
+// Poly2D::operator() at each pixel, for comparison.  magnitude is the
+// scaled power before noise is subtracted, which bounds the float error.
+double calibrateDirectly(const six::sicd::ComplexData& data,
+                         const six::Poly2D& scaleFactorPoly,
+                         const six::Poly2D* noisePoly,
+                         const types::RowCol<size_t>& pixel,
+                         std::complex<float> value,
+                         double& magnitude)
+{
+    const types::RowCol<double> imagePoint = data.pixelToImagePoint(
+            types::RowCol<double>(static_cast<double>(pixel.row),
+                                  static_cast<double>(pixel.col)));
+    const double scaleFactor =
+            scaleFactorPoly(imagePoint.row, imagePoint.col);
+    double power = std::norm(std::complex<double>(value));
+    magnitude = std::abs(scaleFactor * power);
+    if (noisePoly)
+    {
+        power -= std::pow(10.0,
+                          (*noisePoly)(imagePoint.row, imagePoint.col) / 10);
+    }
+    return scaleFactor * power;
+}
+}
+
+TEST_CASE(testEvaluateGrid)
+{
+    const six::Poly2D poly = makePoly(3, 4);
+    const types::RowCol<double> start(-123.5, -700.25);
+    const types::RowCol<double> step(0.5, 1.5);
+
+    // More columns than one block, and a partial last block
+    const types::RowCol<size_t> dims(7, 1300);
+    std::vector<double> values(dims.area());
+    six::sicd::RadiometricCalibrator::evaluateGrid(
+            poly, start, step, dims,
+            std::span<double>(values.data(), values.size()));
+
+    for (size_t row = 0; row < dims.row; ++row)
+    {
+        for (size_t col = 0; col < dims.col; ++col)
+        {
+            const double expected = poly(start.row + row * step.row,
+                                         start.col + col * step.col);
+            TEST_ASSERT(isClose(values[row * dims.col + col], expected,
+                                1e-12));
+        }
+    }
+
+    std::vector<double> tooSmall(dims.area() - 1);
+    TEST_EXCEPTION(six::sicd::RadiometricCalibrator::evaluateGrid(
+            poly, start, step, dims,
+            std::span<double>(tooSmall.data(), tooSmall.size())));
+}
+
+TEST_CASE(testCalibrateBlock)
+{
+    const auto data = makeComplexData();
+
+    six::sicd::RadiometricCalibrator::Options options;
+    options.subtractNoise = true;
+    options.numThreads = 3;
+    const six::sicd::RadiometricCalibrator calibrator(*data, options);
+
+    const types::RowCol<size_t> offset(4, 9);
+    const types::RowCol<size_t> dims(11, 1050);
+    std::vector<std::complex<float> > pixels(dims.area());
+    for (size_t ii = 0; ii < pixels.size(); ++ii)
+    {
+        pixels[ii] = std::complex<float>(static_cast<float>(ii % 97) - 40,
+                                         static_cast<float>(ii % 31) + 3);
+    }
+
+    std::vector<float> calibrated(pixels.size());
+    const std::span<const std::complex<float> > input(pixels.data(),
+                                                      pixels.size());
+    const std::span<float> output(calibrated.data(), calibrated.size());
+    calibrator.calibrate(input, offset, dims.col, output);
+    for (size_t row = 0; row < dims.row; ++row)
+    {
+        for (size_t col = 0; col < dims.col; ++col)
+        {
+            const size_t idx = row * dims.col + col;
+            double magnitude = 0.0;
+            const double expected = calibrateDirectly(
+                    *data,
+                    data->radiometric->sigmaZeroSFPoly,
+                    &data->radiometric->noiseLevel.noisePoly,
+                    types::RowCol<size_t>(offset.row + row, offset.col + col),
+                    pixels[idx],
+                    magnitude);
+            TEST_ASSERT(isCloseCalibrated(calibrated[idx], expected,
+                                          magnitude));
+        }
+    }
+
+    // Past the edge of the image
+    TEST_EXCEPTION(calibrator.calibrate(
+            input, types::RowCol<size_t>(30, 9), dims.col, output));
+    TEST_EXCEPTION(calibrator.calibrate(
+            input, types::RowCol<size_t>(4, 100), dims.col, output));
+}
+
+TEST_CASE(testMissingParameters)
+{
+    auto data = makeComplexData();
+
+    six::sicd::RadiometricCalibrator::Options options;
+    options.calibration =
+            six::sicd::RadiometricCalibrator::Calibration::RCS;
+    TEST_EXCEPTION(six::sicd::RadiometricCalibrator(*data, options));
+
+    // Power needs no polynomial
+    options.calibration =
+            six::sicd::RadiometricCalibrator::Calibration::POWER;
+    six::sicd::RadiometricCalibrator power(*data, options);
+
+    // Relative noise can't be subtracted
+    options.subtractNoise = true;
+    data->radiometric->noiseLevel.noiseType = six::Radiometric::NL_RELATIVE;
+    TEST_EXCEPTION(six::sicd::RadiometricCalibrator(*data, options));
+
+    data->radiometric.reset();
+    TEST_EXCEPTION(six::sicd::RadiometricCalibrator(*data));
+}
+
+TEST_CASE(testCalibrateSICD)
+{
+    const auto inputPathname = getNitfPath("sicd_50x50.nitf");
+    const auto original = six::sicd::Utilities::readSicd(inputPathname);
+    const auto& data = *original.pComplexData;
+    const auto imageDims = getExtent(data);
+
+    const std::vector<std::string> schemaPaths;
+    six::NITFReadControl reader;
+    reader.load(inputPathname.string(), schemaPaths);
+
+    // Small bands, so there are several and a partial last one
+    six::sicd::RadiometricCalibrator::Options options;
+    options.calibration =
+            six::sicd::RadiometricCalibrator::Calibration::GAMMA_ZERO;
+    options.subtractNoise = true;
+    options.maxMemoryBytes = 7 * imageDims.col * 20;
+    const six::sicd::RadiometricCalibrator calibrator(data, options);
+    TEST_ASSERT_EQ(calibrator.getNumRowsPerBand(), static_cast<size_t>(7));
+
+    std::vector<float> calibrated(imageDims.area());
+    size_t nextRow = 0;
+    calibrator.calibrate(reader, [&](size_t startRow,
+                                     size_t numRows,
+                                     std::span<const float> band)
+    {
+        TEST_ASSERT_EQ(startRow, nextRow);
+        TEST_ASSERT_EQ(band.size(), numRows * imageDims.col);
+        std::copy(band.begin(), band.end(),
+                  calibrated.begin() + startRow * imageDims.col);
+        nextRow += numRows;
+    });
+    TEST_ASSERT_EQ(nextRow, imageDims.row);
+
+    for (size_t row = 0; row < imageDims.row; ++row)
+    {
+        for (size_t col = 0; col < imageDims.col; ++col)
+        {
+            const size_t idx = row * imageDims.col + col;
+            double magnitude = 0.0;
+            const double expected = calibrateDirectly(
+                    data,
+                    data.radiometric->gammaZeroSFPoly,
+                    &data.radiometric->noiseLevel.noisePoly,
+                    types::RowCol<size_t>(row, col),
+                    original.widebandData[idx],
+                    magnitude);
+            TEST_ASSERT(isCloseCalibrated(calibrated[idx], expected,
+                                          magnitude));
+        }
+    }
+}
+
+TEST_MAIN(
+    TEST_CHECK(testEvaluateGrid);
+    TEST_CHECK(testCalibrateBlock);
+    TEST_CHECK(testMissingParameters);
+    TEST_CHECK(testCalibrateSICD);
+    )
@@ -0,0 +1,270 @@
+/* =========================================================================
+ * This file is part of six.sicd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six.sicd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#include <six/sicd/SpectralProcessor.h>
+#include <six/sicd/Utilities.h>
+
+#include "TestCase.h"
+
+namespace
+{
+typedef six::sicd::SpectralProcessor::Dimension Dimension;
+
+const types::RowCol<size_t> DIMS(30, 64);
+
+bool isClose(std::complex<float> actual, std::complex<double> expected)
+{
+    return std::abs(std::complex<double>(actual) - expected) < 1e-4;
+}
+
+void setDirection(six::sicd::DirectionParameters& direction,
+                  double sampleSpacing,
+                  double bandwidth,
+                  six::FFTSign sign,
+                  double deltaKCOA)
+{
+    direction.sampleSpacing = sampleSpacing;
+    direction.impulseResponseBandwidth = bandwidth;
+    direction.sign = sign;
+    direction.deltaKCOAPoly = six::Poly2D(0, 0);
+    direction.deltaKCOAPoly[0][0] = deltaKCOA;
+    direction.deltaK1 = deltaKCOA - bandwidth / 2;
+    direction.deltaK2 = deltaKCOA + bandwidth / 2;
+    direction.weightType.reset(new six::sicd::WeightType());
+    direction.weightType->windowName = "UNIFORM";
+    direction.weights.clear();
+}
+
+six::sicd::ComplexImageResult makeImage()
+{
+    six::sicd::ComplexImageResult image;
+    image.pComplexData.reset(
+            six::sicd::Utilities::createFakeComplexData(&DIMS).release());
+    auto& grid = *image.pComplexData->grid;
+    setDirection(*grid.row, 0.5, 1.2, six::FFTSign::POS, 0.0);
+    setDirection(*grid.col, 0.25, 2.0, six::FFTSign::NEG, 0.5);
+    image.widebandData.resize(DIMS.area());
+    return image;
+}
+
+// A complex exponential at spatial frequency bin / (length * spacing),
+// relative to the one at bin 0, in a line with the given FFT sign
+std::complex<double> tone(double bin,
+                          double position,
+                          size_t length,
+                          six::FFTSign sign)
+{
+    const double direction = (sign == six::FFTSign::NEG) ? 1.0 : -1.0;
+    return std::polar(1.0, direction * 2.0 * M_PI * bin * position / length);
+}
+
+// Sum of tones along the columns, at each of bins
+void fillColumnTones(six::sicd::ComplexImageResult& image,
+                     const std::vector<double>& bins)
+{
+    for (size_t row = 0; row < DIMS.row; ++row)
+    {
+        for (size_t col = 0; col < DIMS.col; ++col)
+        {
+            std::complex<double> value(0.0, 0.0);
+            for (double bin : bins)
+            {
+                value += tone(bin, col, DIMS.col, six::FFTSign::NEG);
+            }
+            value *= tone(2.0, row, DIMS.row, six::FFTSign::POS);
+            image.widebandData[row * DIMS.col + col] =
+                    std::complex<float>(value);
+        }
+    }
+}
+
+double interpolate(const std::vector<double>& weights, double fraction)
+{
+    const double position = fraction * (weights.size() - 1);
+    const size_t index = static_cast<size_t>(position);
+    return weights[index] +
+            (position - index) * (weights[index + 1] - weights[index]);
+}
+}
+
+TEST_CASE(testImpulseResponseWidth)
+{
+    const double uniform = six::sicd::SpectralProcessor::
+            getImpulseResponseWidth(std::vector<double>(2, 1.0), 2.0);
+    TEST_ASSERT_ALMOST_EQ_EPS(uniform, 0.8859 / 2.0, 1e-4);
+
+    six::sicd::DirectionParameters direction;
+    direction.weightType.reset(new six::sicd::WeightType());
+    direction.weightType->windowName = "HAMMING";
+    const auto hamming = six::sicd::SpectralProcessor::getWeights(direction);
+    TEST_ASSERT_EQ(hamming.size(),
+                   six::sicd::SpectralProcessor::NUM_WEIGHTS);
+    TEST_ASSERT_GREATER(six::sicd::SpectralProcessor::
+            getImpulseResponseWidth(hamming, 2.0), 1.3 * uniform);
+
+    direction.weightType->windowName = "TAYLOR";
+    TEST_EXCEPTION(six::sicd::SpectralProcessor::getWeights(direction));
+}
+
+TEST_CASE(testApplyWeights)
+{
+    // Column spectrum bins are 1 / 16 apart; the support is [-0.5, 1.5]
+    auto image = makeImage();
+    const std::vector<double> bins = {-4.0, 3.0, 10.0, 22.0, 30.0};
+    fillColumnTones(image, bins);
+    const auto original = image.widebandData;
+
+    const six::sicd::SpectralProcessor processor(3);
+    six::sicd::WeightType hamming;
+    hamming.windowName = "HAMMING";
+    processor.applyWeights(image, Dimension::COL, hamming);
+
+    const auto& col = *image.pComplexData->grid->col;
+    TEST_ASSERT_EQ(col.weightType->windowName, std::string("HAMMING"));
+    TEST_ASSERT_EQ(col.weights.size(),
+                   six::sicd::SpectralProcessor::NUM_WEIGHTS);
+    TEST_ASSERT_GREATER(col.impulseResponseWidth, 0.8859 / 2.0 * 1.3);
+
+    // Each tone is scaled by the weight at its frequency; 30 is outside
+    // the support
+    for (size_t row = 0; row < DIMS.row; ++row)
+    {
+        for (size_t c = 0; c < DIMS.col; ++c)
+        {
+            std::complex<double> expected(0.0, 0.0);
+            for (double bin : bins)
+            {
+                const double frequency = bin / 16.0;
+                const double weight = (bin == 30.0) ? 1.0 :
+                        interpolate(col.weights, (frequency + 0.5) / 2.0);
+                expected += weight * tone(bin, c, DIMS.col,
+                                          six::FFTSign::NEG);
+            }
+            expected *= tone(2.0, row, DIMS.row, six::FFTSign::POS);
+            TEST_ASSERT(isClose(image.widebandData[row * DIMS.col + c],
+                                expected));
+        }
+    }
+
+    processor.deweight(image, Dimension::COL);
+    TEST_ASSERT_EQ(col.weightType->windowName, std::string("UNIFORM"));
+    TEST_ASSERT(col.weights.empty());
+    TEST_ASSERT_ALMOST_EQ_EPS(col.impulseResponseWidth, 0.8859 / 2.0, 1e-4);
+    for (size_t ii = 0; ii < original.size(); ++ii)
+    {
+        TEST_ASSERT(isClose(image.widebandData[ii], original[ii]));
+    }
+
+    image.pComplexData->grid->row->weightType->windowName = "TAYLOR";
+    TEST_EXCEPTION(processor.deweight(image, Dimension::ROW));
+}
+
+TEST_CASE(testSplit)
+{
+    auto image = makeImage();
+    fillColumnTones(image, {-4.0, 3.0, 10.0, 22.0});
+
+    const six::sicd::SpectralProcessor processor;
+    const auto parts = processor.split(
+            six::sicd::ComplexImage(image), Dimension::COL, 2);
+    TEST_ASSERT_EQ(parts.size(), static_cast<size_t>(2));
+
+    // [-0.5, 0.5) and [0.5, 1.5]
+    const std::vector<std::vector<double> > partBins = {{-4.0, 3.0},
+                                                         {10.0, 22.0}};
+    for (size_t part = 0; part < parts.size(); ++part)
+    {
+        const auto& col = *parts[part].pComplexData->grid->col;
+        TEST_ASSERT_ALMOST_EQ(col.impulseResponseBandwidth, 1.0);
+        TEST_ASSERT_ALMOST_EQ(col.deltaKCOAPoly[0][0], part ? 1.0 : 0.0);
+        TEST_ASSERT_ALMOST_EQ(col.deltaK1, part ? 0.5 : -0.5);
+        TEST_ASSERT_ALMOST_EQ(col.deltaK2, part ? 1.5 : 0.5);
+        TEST_ASSERT_ALMOST_EQ_EPS(col.impulseResponseWidth, 0.8859, 1e-4);
+        TEST_ASSERT_EQ(col.weightType->windowName, std::string("UNIFORM"));
+
+        auto expected = makeImage();
+        fillColumnTones(expected, partBins[part]);
+        for (size_t ii = 0; ii < DIMS.area(); ++ii)
+        {
+            TEST_ASSERT(isClose(parts[part].widebandData[ii],
+                                expected.widebandData[ii]));
+        }
+    }
+
+    TEST_EXCEPTION(processor.split(
+            six::sicd::ComplexImage(image), Dimension::COL, 0));
+}
+
+TEST_CASE(testUpsample)
+{
+    auto image = makeImage();
+    auto& imageData = *image.pComplexData->imageData;
+    imageData.firstRow = 4;
+    imageData.scpPixel.row = 15;
+    for (size_t row = 0; row < DIMS.row; ++row)
+    {
+        for (size_t col = 0; col < DIMS.col; ++col)
+        {
+            image.widebandData[row * DIMS.col + col] = std::complex<float>(
+                    tone(-7.0, row, DIMS.row, six::FFTSign::POS) +
+                    0.5 * tone(5.0, row, DIMS.row, six::FFTSign::POS));
+        }
+    }
+
+    const size_t factor = 3;
+    const six::sicd::SpectralProcessor processor(2);
+    const auto upsampled = processor.upsample(
+            six::sicd::ComplexImage(image), Dimension::ROW, factor);
+
+    const auto& data = *upsampled.pComplexData;
+    TEST_ASSERT_EQ(data.getNumRows(), DIMS.row * factor);
+    TEST_ASSERT_EQ(data.getNumCols(), DIMS.col);
+    TEST_ASSERT_EQ(data.imageData->firstRow, static_cast<size_t>(12));
+    TEST_ASSERT_EQ(data.imageData->scpPixel.row, static_cast<ptrdiff_t>(45));
+    TEST_ASSERT_ALMOST_EQ(data.grid->row->sampleSpacing, 0.5 / factor);
+    TEST_ASSERT_EQ(upsampled.widebandData.size(), DIMS.area() * factor);
+
+    // The same tones, sampled between the original rows
+    for (size_t row = 0; row < DIMS.row * factor; ++row)
+    {
+        const double position = static_cast<double>(row) / factor;
+        const std::complex<double> expected =
+                tone(-7.0, position, DIMS.row, six::FFTSign::POS) +
+                0.5 * tone(5.0, position, DIMS.row, six::FFTSign::POS);
+        for (size_t col = 0; col < DIMS.col; ++col)
+        {
+            TEST_ASSERT(isClose(upsampled.widebandData[row * DIMS.col + col],
+                                expected));
+        }
+    }
+}
+
+TEST_MAIN(
+    TEST_CHECK(testImpulseResponseWidth);
+    TEST_CHECK(testApplyWeights);
+    TEST_CHECK(testSplit);
+    TEST_CHECK(testUpsample);
+    )
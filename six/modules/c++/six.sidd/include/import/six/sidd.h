@@ -27,6 +27,7 @@
 #include "six/sidd/Annotations.h"
 #include "six/sidd/Compression.h"
 #include "six/sidd/CropUtils.h"
+#include "six/sidd/DRAHistogram.h"
 #include "six/sidd/DerivedData.h"
 #include "six/sidd/DerivedDataBuilder.h"
 #include "six/sidd/DerivedXMLControl.h"
@@ -36,8 +37,12 @@
 #include "six/sidd/GeographicAndTarget.h"
 #include "six/sidd/GeoTIFFReadControl.h"
 #include "six/sidd/GeoTIFFWriteControl.h"
+#include "six/sidd/KernelFilter.h"
+#include "six/sidd/PolyphaseResampler.h"
 #include "six/sidd/ProductCreation.h"
+#include "six/sidd/ProductGenerator.h"
 #include "six/sidd/ProductProcessing.h"
+#include "six/sidd/RRDSGenerator.h"
 #include "six/sidd/SFA.h"
 #include "six/sidd/Utilities.h"
 
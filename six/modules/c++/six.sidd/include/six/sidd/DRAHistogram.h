@@ -0,0 +1,175 @@
+/* =========================================================================
+ * This file is part of six.sidd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six.sidd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef __SIX_SIDD_DRA_HISTOGRAM_H__
+#define __SIX_SIDD_DRA_HISTOGRAM_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <complex>
+#include <vector>
+
+#include <std/span>
+
+#include <six/sidd/Display.h>
+
+namespace six
+{
+namespace sidd
+{
+//! How complex SICD pixels are detected
+enum class Detection
+{
+    AMPLITUDE, //! |z|
+    POWER      //! |z|^2
+};
+
+/*!
+ * \class DRAHistogram
+ * \brief Mergeable histogram of detected values for computing the
+ * percentile-based stretch described by DynamicRangeAdjustment
+ *
+ * Bins are spaced logarithmically (BINS_PER_OCTAVE per factor of two over
+ * 2^-64 to 2^64), so one fixed-size histogram covers any SAR dynamic range
+ * without knowing it in advance, and histograms from different threads,
+ * bands or machines merge by adding counts.  Zeros are counted in a bin of
+ * their own and NaNs are skipped.  Exact minimum and maximum values are
+ * kept alongside the counts.
+ *
+ * Quantiles are interpolated within a bin, so a quantile is within a
+ * factor of (1 + getBinRelativeError()) of the true value.  When the
+ * histogram only holds a subsample of the image, getSampledRankError()
+ * bounds the additional error in rank.
+ *
+ * A DRAHistogram isn't thread-safe; give each thread its own and combine
+ * them with merge().
+ */
+class DRAHistogram
+{
+public:
+    static const size_t BINS_PER_OCTAVE = 64;
+
+    DRAHistogram();
+
+    //! Adds detected values
+    void add(std::span<const float> detected);
+
+    //! Detects complex pixels (e.g. from getWidebandData()) and adds them
+    void add(std::span<const std::complex<float> > pixels,
+             Detection detection);
+
+    //! Adds the counts of another histogram to this one
+    void merge(const DRAHistogram& other);
+
+    /*!
+     * Sums partial histograms.  Threads split the bins between them, so no
+     * locking is needed however many partials there are.
+     *
+     * \param partials Histograms to sum
+     * \param numThreads Threads to use.  0 means one per core.
+     */
+    static DRAHistogram merge(std::span<const DRAHistogram> partials,
+                              size_t numThreads = 0);
+
+    //! \return Number of values added, not counting NaNs
+    uint64_t getNumValues() const
+    {
+        return mNumValues;
+    }
+
+    //! \return Smallest value added, or +infinity if there are none
+    double getMin() const
+    {
+        return mMin;
+    }
+
+    //! \return Largest value added, or -infinity if there are none
+    double getMax() const
+    {
+        return mMax;
+    }
+
+    /*!
+     * \param fraction Fraction of values at or below the quantile, in [0, 1]
+     *
+     * \return The quantile, clamped to [getMin(), getMax()].  0 if the
+     * histogram is empty.
+     */
+    double getQuantile(double fraction) const;
+
+    //! \return Relative width of a bin, the bound on quantile value error
+    static double getBinRelativeError();
+
+    /*!
+     * Bounds how far the fraction of the image below a quantile can be from
+     * the requested fraction when the histogram holds numSamples values
+     * drawn from the image, by the Dvoretzky-Kiefer-Wolfowitz inequality.
+     * The bound assumes the samples are representative; regularly strided
+     * rows are in practice, unless the scene has structure at the stride.
+     *
+     * \param numSamples Number of values in the histogram
+     * \param confidence Probability the bound holds, in (0, 1)
+     *
+     * \return Bound on the rank error, as a fraction of the image
+     */
+    static double getSampledRankError(uint64_t numSamples,
+                                      double confidence = 0.95);
+
+    /*!
+     * Computes the range of detected values a percentile stretch maps onto
+     * the display: the Pmin and Pmax quantiles, moved toward the minimum
+     * and maximum by EminModifier and EmaxModifier.
+     *
+     * \param params Stretch parameters.  Pmin and Pmax are fractions in
+     * [0, 1].
+     * \param[out] low Detected value mapped to the bottom of the display
+     * \param[out] high Detected value mapped to the top of the display
+     */
+    void getStretch(const DynamicRangeAdjustment::DRAParameters& params,
+                    double& low,
+                    double& high) const;
+
+    /*!
+     * Converts a percentile stretch into the equivalent fixed stretch, so a
+     * product can record (or be generated from) DRAOverrides:
+     * code = (detected - subtractor) * multiplier.
+     *
+     * \param params Stretch parameters
+     * \param numCodes Number of display codes the stretch spans (e.g. 256)
+     */
+    DynamicRangeAdjustment::DRAOverrides
+    getDRAOverrides(const DynamicRangeAdjustment::DRAParameters& params,
+                    size_t numCodes) const;
+
+private:
+    static size_t getBin(double value);
+
+    std::vector<uint64_t> mCounts;
+    uint64_t mNumValues;
+    double mMin;
+    double mMax;
+};
+}
+}
+
+#endif
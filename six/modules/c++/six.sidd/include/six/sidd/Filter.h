@@ -22,6 +22,7 @@
 #ifndef __SIX_SIDD_FILTER_H__
 #define __SIX_SIDD_FILTER_H__
 
+#include <six/Types.h>
 #include <six/sidd/Enums.h>
 
 namespace six
@@ -0,0 +1,148 @@
+/* =========================================================================
+ * This file is part of six.sidd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six.sidd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef __SIX_SIDD_KERNEL_FILTER_H__
+#define __SIX_SIDD_KERNEL_FILTER_H__
+
+#include <stddef.h>
+
+#include <vector>
+
+#include <std/span>
+
+#include <types/RowCol.h>
+#include <six/sidd/Filter.h>
+
+namespace six
+{
+namespace sidd
+{
+/*!
+ * \class KernelFilter
+ * \brief Applies a spatially invariant Filter::Kernel to an image
+ *
+ * The kernel is applied by convolution or correlation as the Filter says.
+ * Kernel coefficients are row-major, and the kernel is centered on element
+ * ((numRows - 1) / 2, (numCols - 1) / 2).  Pixels past the edge of the
+ * input are taken to repeat the nearest edge pixel.
+ *
+ * Kernels that are the outer product of a column and a row vector (e.g.
+ * most smoothing and interpolation kernels) are detected and applied as two
+ * 1D passes.  Both paths accumulate a whole row at a time, one tap at a
+ * time, over tiles of columns that stay in cache, so the inner loops are
+ * contiguous multiply-adds the compiler vectorizes.  Output rows are split
+ * into bands across threads.
+ */
+class KernelFilter
+{
+public:
+    /*!
+     * \param filter Filter with a custom kernel
+     *
+     * \throw except::Exception if the filter doesn't have a custom kernel
+     * or the kernel's size doesn't match its coefficients
+     */
+    explicit KernelFilter(const Filter& filter);
+
+    KernelFilter(const Filter::Kernel::Custom& kernel,
+                 FilterOperation operation);
+
+    //! \return Number of kernel rows and columns
+    const types::RowCol<size_t>& getSize() const
+    {
+        return mSize;
+    }
+
+    /*!
+     * \return Number of input rows and columns the kernel reaches before
+     * an output pixel.  It reaches getSize() - getCenter() - 1 after it.
+     */
+    const types::RowCol<size_t>& getCenter() const
+    {
+        return mCenter;
+    }
+
+    //! \return Whether the kernel is applied as two 1D passes
+    bool isSeparable() const
+    {
+        return mSeparable;
+    }
+
+    /*!
+     * Filters an image
+     *
+     * \param input Row-major input pixels
+     * \param dims Size of the input (and output) image
+     * \param[out] output Row-major output pixels.  Mustn't overlap input.
+     * \param numThreads Threads to use.  0 means one per core.
+     */
+    void apply(std::span<const float> input,
+               const types::RowCol<size_t>& dims,
+               std::span<float> output,
+               size_t numThreads = 0) const;
+
+    /*!
+     * Filters some rows of an image, for callers that stream an image in
+     * bands.  The input band is treated as the whole image, so to match
+     * apply() it needs getCenter().row rows before the first output row and
+     * getSize().row - getCenter().row - 1 rows after the last one, unless
+     * those are off the edge of the image.
+     *
+     * \param input Row-major input band
+     * \param inputDims Size of the input band
+     * \param startRow First row of the band to filter
+     * \param numRows Number of rows to filter
+     * \param[out] output numRows filtered rows
+     */
+    void applyRows(std::span<const float> input,
+                   const types::RowCol<size_t>& inputDims,
+                   size_t startRow,
+                   size_t numRows,
+                   std::span<float> output) const;
+
+private:
+    void applySeparable(const float* input,
+                        const types::RowCol<size_t>& inputDims,
+                        size_t startRow,
+                        size_t numRows,
+                        float* output) const;
+
+    void applyDirect(const float* input,
+                     const types::RowCol<size_t>& inputDims,
+                     size_t startRow,
+                     size_t numRows,
+                     float* output) const;
+
+    types::RowCol<size_t> mSize;
+    types::RowCol<size_t> mCenter;
+
+    // Coefficients in correlation order (flipped for convolution)
+    std::vector<float> mCoefs;
+
+    bool mSeparable;
+    std::vector<float> mColumnCoefs; // applied down columns
+    std::vector<float> mRowCoefs;    // applied along rows
+};
+}
+}
+
+#endif
@@ -0,0 +1,140 @@
+/* =========================================================================
+ * This file is part of six.sidd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six.sidd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef __SIX_SIDD_POLYPHASE_RESAMPLER_H__
+#define __SIX_SIDD_POLYPHASE_RESAMPLER_H__
+
+#include <stddef.h>
+
+#include <vector>
+
+#include <std/span>
+
+#include <types/RowCol.h>
+#include <six/sidd/Filter.h>
+
+namespace six
+{
+namespace sidd
+{
+/*!
+ * \class PolyphaseResampler
+ * \brief Resamples an image with a Filter::Bank
+ *
+ * Each of the bank's numPhasings phases is a numPoints-tap 1D filter for
+ * one fractional offset: phase p interpolates at offset p / numPhasings
+ * past an input sample.  The bank is applied separably, along the rows and
+ * then down the columns.  Output pixel o is centered on input position
+ * (o + 0.5) * inputSize / outputSize - 0.5, and its taps start
+ * (numPoints - 1) / 2 samples before that position.  Pixels past the edge
+ * of the input are taken to repeat the nearest edge pixel.
+ *
+ * Predefined banks from the SIDD filter database are generated with
+ * createBank().  The tap positions and phases are computed once per output
+ * row and column, and the column pass accumulates whole rows, so the inner
+ * loops are contiguous multiply-adds the compiler vectorizes.
+ */
+class PolyphaseResampler
+{
+public:
+    static const size_t DEFAULT_NUM_PHASINGS = 64;
+
+    /*!
+     * \param filter Filter with a custom or predefined (by database name)
+     * bank
+     * \param numPhasings Phases to generate for a predefined bank
+     *
+     * \throw except::Exception if the filter doesn't have a bank, its bank
+     * is predefined by family and member, or a custom bank's size doesn't
+     * match its coefficients
+     */
+    explicit PolyphaseResampler(const Filter& filter,
+                                size_t numPhasings = DEFAULT_NUM_PHASINGS);
+
+    PolyphaseResampler(const Filter::Bank::Custom& bank,
+                       FilterOperation operation);
+
+    size_t getNumPhasings() const
+    {
+        return mNumPhasings;
+    }
+
+    size_t getNumPoints() const
+    {
+        return mNumPoints;
+    }
+
+    /*!
+     * \return The numPoints coefficients of a phase, in correlation order
+     * (i.e. as applied to increasing input positions)
+     */
+    std::span<const float> getPhase(size_t phase) const;
+
+    /*!
+     * Resamples an image
+     *
+     * \param input Row-major input pixels
+     * \param inputDims Size of the input image
+     * \param[out] output Row-major output pixels
+     * \param outputDims Size of the output image
+     * \param numThreads Threads to use.  0 means one per core.
+     */
+    void resample(std::span<const float> input,
+                  const types::RowCol<size_t>& inputDims,
+                  std::span<float> output,
+                  const types::RowCol<size_t>& outputDims,
+                  size_t numThreads = 0) const;
+
+    /*!
+     * Generates a bank from the SIDD filter database.  Each phase's
+     * coefficients sum to 1.
+     *
+     * \param name Interpolator to generate
+     * \param numPhasings Number of fractional offsets
+     *
+     * \return Bank in correlation order
+     */
+    static Filter::Bank::Custom createBank(FilterDatabaseName name,
+                                           size_t numPhasings);
+
+private:
+    // First input sample and phase of each output sample along one axis
+    struct Taps
+    {
+        std::vector<ptrdiff_t> start;
+        std::vector<size_t> phase;
+    };
+
+    Taps getTaps(size_t inputSize, size_t outputSize) const;
+
+    void init(const Filter::Bank::Custom& bank, FilterOperation operation);
+
+    size_t mNumPhasings;
+    size_t mNumPoints;
+
+    // numPhasings * numPoints coefficients in correlation order
+    std::vector<float> mCoefs;
+};
+}
+}
+
+#endif
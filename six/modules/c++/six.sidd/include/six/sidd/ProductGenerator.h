@@ -0,0 +1,271 @@
+/* =========================================================================
+ * This file is part of six.sidd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six.sidd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef __SIX_SIDD_PRODUCT_GENERATOR_H__
+#define __SIX_SIDD_PRODUCT_GENERATOR_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <complex>
+#include <string>
+#include <vector>
+
+#include <std/cstddef>
+#include <std/span>
+
+#include <io/SeekableStreams.h>
+#include <six/NITFReadControl.h>
+#include <six/sidd/DRAHistogram.h>
+#include <six/sidd/DerivedData.h>
+#include <six/sidd/Display.h>
+
+namespace six
+{
+namespace sidd
+{
+/*!
+ * \class DisplayRemapper
+ * \brief Quantizes detected values to SIDD product pixels
+ *
+ * Detected values in [low, high] are mapped linearly onto the product's
+ * code range; values outside of it are clipped.  For the lookup pixel types
+ * (MONO8LU and RGB8LU) the code is an index into the remap LUT, which is
+ * carried in the NITF and applied by the viewer.  For the other pixel types
+ * a remap LUT, if present, is applied here: the code indexes the LUT and the
+ * LUT entry is written.  Without a LUT, RGB24I products are gray.
+ */
+class DisplayRemapper
+{
+public:
+    /*!
+     * \param display Display of the product being generated
+     * \param low Detected value mapped to the first code
+     * \param high Detected value mapped to the last code
+     *
+     * \throw except::Exception if the display's pixel type isn't a SIDD
+     * pixel type or its remap LUT doesn't fit the pixel type
+     */
+    DisplayRemapper(const Display& display, double low, double high);
+
+    //! \return Number of distinct output codes
+    size_t getNumCodes() const
+    {
+        return mNumCodes;
+    }
+
+    //! \return Number of bytes in one product pixel
+    size_t getNumBytesPerPixel() const
+    {
+        return mNumBytesPerPixel;
+    }
+
+    double getLow() const
+    {
+        return mLow;
+    }
+
+    double getHigh() const
+    {
+        return mHigh;
+    }
+
+    /*!
+     * \param detected Detected values
+     * \param[out] pixels Product pixels, big endian.  Must hold
+     * getNumBytesPerPixel() bytes per detected value.
+     */
+    void remap(std::span<const float> detected,
+               std::span<std::byte> pixels) const;
+
+private:
+    size_t mNumCodes;
+    size_t mNumBytesPerPixel;
+    double mLow;
+    double mHigh;
+    float mScale;
+
+    // Output bytes for every code, so remapping is a single gather
+    std::vector<std::byte> mCodeBytes;
+};
+
+/*!
+ * \class ProductGenerator
+ * \brief Generates a detected SIDD product from a SICD
+ *
+ * The SICD is streamed in bands of rows.  Each band is detected, remapped
+ * per the DerivedData's Display (dynamic range adjustment and remap LUT) and
+ * written through a SIDDByteProvider, while the next band is read in the
+ * background.  Memory use is bounded by Options::maxMemoryBytes regardless
+ * of image size.
+ *
+ * The dynamic range adjustment is taken from the first InteractiveProcessing
+ * of the Display:
+ * - AUTO (or DRAParameters present): the Pmin/Pmax percentiles of the
+ *   detected image, widened toward its min/max by EminModifier/EmaxModifier,
+ *   span the output codes.  The percentiles come from a DRAHistogram of
+ *   up to Options::maxStatisticsRows evenly spaced rows, read before the
+ *   product is written, so the SICD is streamed once.  Setting
+ *   maxStatisticsRows to 0 uses every row instead, at the cost of a
+ *   second full pass.
+ * - MANUAL with DRAOverrides: code = (detected - Subtractor) * Multiplier,
+ *   so no statistics pass is needed.
+ * - NONE, or no DynamicRangeAdjustment: the full detected range spans the
+ *   output codes.
+ *
+ * The product is written unblocked, with the SIDD's image segmentation.
+ * The DerivedData must describe an image the same size as the SICD; the
+ * DerivedData's geometry isn't otherwise checked.
+ */
+class ProductGenerator
+{
+public:
+    static const size_t DEFAULT_MAX_MEMORY_BYTES = 256 * 1024 * 1024;
+    static const size_t DEFAULT_MAX_STATISTICS_ROWS = 2048;
+
+    struct Options
+    {
+        Detection detection = Detection::AMPLITUDE;
+
+        /*!
+         * Upper bound on the pixel buffers (input bands, detected band and
+         * output band).  At least one row is always processed at a time.
+         */
+        size_t maxMemoryBytes = DEFAULT_MAX_MEMORY_BYTES;
+
+        //! Threads used for detection and remapping.  0 means one per core.
+        size_t numThreads = 0;
+
+        /*!
+         * Most rows sampled for the dynamic range adjustment statistics.
+         * 0 means every row.
+         */
+        size_t maxStatisticsRows = DEFAULT_MAX_STATISTICS_ROWS;
+    };
+
+    //! Wall-clock time (seconds) spent in each stage of the last generate()
+    struct Timings
+    {
+        //! Reading SICD bands.  Overlaps the other stages.
+        double read = 0.0;
+
+        //! Accumulating statistics for the dynamic range adjustment
+        double statistics = 0.0;
+
+        double detect = 0.0;
+        double remap = 0.0;
+        double write = 0.0;
+
+        //! All of generate(), including time spent waiting on reads
+        double total = 0.0;
+
+        size_t numRowsPerBand = 0;
+        size_t numBands = 0;
+
+        //! Bytes allocated for pixel buffers
+        size_t bufferBytes = 0;
+
+        //! SICD rows the statistics were computed from
+        size_t numStatisticsRows = 0;
+
+        /*!
+         * Bound (95% confidence) on the rank error of the percentiles due
+         * to sampling rows.  0 when every row was used.
+         */
+        double statisticsRankError = 0.0;
+    };
+
+    /*!
+     * \param derivedData Metadata of the product to generate
+     * \param schemaPaths Schemas used to validate the SIDD XML when it's
+     * written
+     * \param options Processing options
+     */
+    ProductGenerator(const DerivedData& derivedData,
+                     const std::vector<std::string>& schemaPaths,
+                     const Options& options);
+    ProductGenerator(const DerivedData& derivedData,
+                     const std::vector<std::string>& schemaPaths);
+
+    /*!
+     * Generates the SIDD
+     *
+     * \param sicdReader Reader that has loaded the SICD.  It's only used by
+     * one thread at a time.
+     * \param outStream Stream to write the SIDD NITF to
+     *
+     * \throw except::Exception if the SICD's pixel type isn't supported or
+     * its size doesn't match the DerivedData
+     */
+    void generate(NITFReadControl& sicdReader,
+                  io::SeekableOutputStream& outStream);
+
+    //! Generates the SIDD to outputPathname
+    void generate(NITFReadControl& sicdReader,
+                  const std::string& outputPathname);
+
+    //! \return Timings of the last call to generate()
+    const Timings& getTimings() const
+    {
+        return mTimings;
+    }
+
+    /*!
+     * \return Number of rows processed at a time for an image with numCols
+     * columns of SICD pixels of the given type
+     */
+    size_t getNumRowsPerBand(size_t numCols, PixelType sicdPixelType) const;
+
+    /*!
+     * Detects complex pixels.  The loops are written so that the compiler
+     * vectorizes them.
+     */
+    static void detect(std::span<const std::complex<float> > input,
+                       Detection detection,
+                       std::span<float> output);
+
+    //! Detects RE16I_IM16I pixels, given as interleaved I/Q pairs
+    static void detect(std::span<const int16_t> input,
+                       Detection detection,
+                       std::span<float> output);
+
+    /*!
+     * Detects AMP8I_PHS8I pixels, given as interleaved amplitude/phase
+     * pairs.  Only the amplitudes are used.
+     *
+     * \param amplitudes The amplitude of each of the 256 amplitude codes
+     */
+    static void detect(std::span<const uint8_t> input,
+                       const float* amplitudes,
+                       Detection detection,
+                       std::span<float> output);
+
+private:
+    const DerivedData& mDerivedData;
+    const std::vector<std::string> mSchemaPaths;
+    const Options mOptions;
+    Timings mTimings;
+};
+}
+}
+
+#endif
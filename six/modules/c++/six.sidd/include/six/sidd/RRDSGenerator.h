@@ -0,0 +1,281 @@
+/* =========================================================================
+ * This file is part of six.sidd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six.sidd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef __SIX_SIDD_RRDS_GENERATOR_H__
+#define __SIX_SIDD_RRDS_GENERATOR_H__
+
+#include <stddef.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <std/span>
+
+#include <io/SeekableStreams.h>
+#include <types/RowCol.h>
+#include <six/NITFReadControl.h>
+#include <six/sidd/DerivedData.h>
+#include <six/sidd/Display.h>
+#include <six/sidd/KernelFilter.h>
+
+namespace six
+{
+namespace sidd
+{
+/*!
+ * \class RRDSReducer
+ * \brief Halves the resolution of an image streamed a band of rows at a time
+ *
+ * The reduction follows an RRDS's downsampling method:
+ * - DECIMATE and NEAREST_NEIGHBOR keep every other pixel, so output pixel o
+ *   is input pixel 2o.
+ * - MAX_PIXEL and AVERAGE combine 2x2 blocks, so output pixel o is centered
+ *   on input position 2o + 0.5.
+ * - BILINEAR and LAGRANGE interpolate at input position 2o + 0.5 with the
+ *   RRDS's interpolation filter bank, or the filter database interpolator
+ *   of the same name if there's no interpolation filter.  For a custom bank
+ *   the phase nearest half a pixel is used, and getOffset() says where it
+ *   landed.
+ *
+ * The RRDS's anti-alias kernel, if any, is applied first for every method
+ * but DECIMATE and MAX_PIXEL.  Only the rows the filters still need are kept,
+ * so memory is proportional to the image width rather than its size.
+ */
+class RRDSReducer
+{
+public:
+    /*!
+     * \param rrds Downsampling method and filters
+     * \param inputDims Size of the image being reduced
+     * \param numThreads Threads to use.  0 means one per core.
+     *
+     * \throw except::Exception if the RRDS's filters can't be applied
+     */
+    RRDSReducer(const RRDS& rrds,
+                const types::RowCol<size_t>& inputDims,
+                size_t numThreads = 0);
+
+    const types::RowCol<size_t>& getInputDims() const
+    {
+        return mInputDims;
+    }
+
+    //! \return Size of the reduced image: half the input, rounded up
+    const types::RowCol<size_t>& getOutputDims() const
+    {
+        return mOutputDims;
+    }
+
+    /*!
+     * \return Input position of output pixel 0 along each axis.  Output
+     * pixel o is at input position 2o + getOffset().
+     */
+    double getOffset() const
+    {
+        return mOffset;
+    }
+
+    /*!
+     * Adds the next rows of the input image
+     *
+     * \param rows Row-major input rows.  Must be whole rows.
+     * \param[out] reduced Output rows that can now be computed are appended
+     *
+     * \return Number of output rows appended
+     */
+    size_t push(std::span<const float> rows, std::vector<float>& reduced);
+
+    //! \return Whether every output row has been produced
+    bool isDone() const
+    {
+        return mNumOutputRows == mOutputDims.row;
+    }
+
+private:
+    // Input rows [begin, begin + numRows), kept contiguously
+    struct Rows
+    {
+        size_t begin = 0;
+        size_t numRows = 0;
+        std::vector<float> pixels;
+
+        const float* row(size_t index, size_t numCols) const
+        {
+            return &pixels[(index - begin) * numCols];
+        }
+        void append(const float* rows, size_t count, size_t numCols);
+        void discardBefore(size_t index, size_t numCols);
+    };
+
+    // Input rows [first, last] feeding output row o (before clamping)
+    ptrdiff_t getFirstRow(size_t outputRow) const;
+    ptrdiff_t getLastRow(size_t outputRow) const;
+
+    void antiAlias(size_t numInputRows);
+    void reduce(size_t numOutputRows, std::vector<float>& reduced) const;
+    void reduceRow(size_t outputRow, float* scratch, float* output) const;
+
+    types::RowCol<size_t> mInputDims;
+    types::RowCol<size_t> mOutputDims;
+    size_t mNumThreads;
+
+    std::unique_ptr<KernelFilter> mAntiAlias;
+    bool mMaxPixel;
+    std::vector<float> mTaps;   // applied to input 2o + mFirstTap + k
+    ptrdiff_t mFirstTap;
+    double mOffset;
+
+    Rows mInput;                // received and not yet anti-aliased
+    Rows mFiltered;             // anti-aliased and not yet reduced
+    size_t mNumInputRows;
+    size_t mNumFilteredRows;
+    size_t mNumOutputRows;
+};
+
+/*!
+ * \class RRDSGenerator
+ * \brief Generates reduced resolution datasets for a SIDD
+ *
+ * Builds a pyramid of images, each half the size of the one before it, from
+ * a SIDD image in one streaming pass: bands of the SIDD are read once and
+ * pushed through a chain of RRDSReducers, one per level, following the
+ * Display's NonInteractiveProcessing RRDS (or for SIDD 1.0, which has none,
+ * the Display's decimationMethod).  Each level is written as it's
+ * produced to its own sidecar SIDD, whose Measurement (pixel footprint,
+ * sample spacing, reference point, polynomials and valid data) describes
+ * the reduced image.  Memory use is bounded by the read band plus a few
+ * rows per level.
+ *
+ * Filtering is done per channel in floating point; results are rounded and
+ * clipped to the pixel type.  Lookup pixel types (MONO8LU and RGB8LU) are
+ * always decimated, since their codes can't be filtered.
+ */
+class RRDSGenerator
+{
+public:
+    static const size_t DEFAULT_MAX_MEMORY_BYTES = 64 * 1024 * 1024;
+    static const size_t DEFAULT_MIN_SIZE = 256;
+
+    struct Options
+    {
+        /*!
+         * Number of levels to generate.  0 means halve until both
+         * dimensions are at most minSize.
+         */
+        size_t numLevels = 0;
+
+        size_t minSize = DEFAULT_MIN_SIZE;
+
+        //! Upper bound on the buffer SIDD bands are read into
+        size_t maxMemoryBytes = DEFAULT_MAX_MEMORY_BYTES;
+
+        //! Threads used for filtering.  0 means one per core.
+        size_t numThreads = 0;
+    };
+
+    /*!
+     * \param derivedData Metadata of the SIDD to reduce
+     * \param schemaPaths Schemas used to validate the SIDD XML when it's
+     * written
+     * \param options Processing options
+     *
+     * \throw except::Exception if the pixel type isn't a SIDD pixel type or
+     * the RRDS's filters can't be applied
+     */
+    RRDSGenerator(const DerivedData& derivedData,
+                  const std::vector<std::string>& schemaPaths,
+                  const Options& options);
+    RRDSGenerator(const DerivedData& derivedData,
+                  const std::vector<std::string>& schemaPaths);
+
+    size_t getNumLevels() const
+    {
+        return mLevels.size();
+    }
+
+    /*!
+     * \param level Level, starting at 1 for the first reduction
+     *
+     * \return Metadata of the level's sidecar SIDD
+     */
+    const DerivedData& getDerivedData(size_t level) const;
+
+    /*!
+     * Generates every level
+     *
+     * \param siddReader Reader that has loaded the SIDD
+     * \param outStreams One stream per level to write its SIDD NITF to
+     *
+     * \throw except::Exception if the SIDD's size or pixel type doesn't
+     * match the DerivedData
+     */
+    void generate(NITFReadControl& siddReader,
+                  const std::vector<io::SeekableOutputStream*>& outStreams);
+
+    /*!
+     * Generates every level to getPathname(siddPathname, level)
+     *
+     * \return Pathnames written
+     */
+    std::vector<std::string> generate(NITFReadControl& siddReader,
+                                      const std::string& siddPathname);
+
+    //! \return Sidecar pathname for a level, e.g. image_rrds2.nitf
+    static std::string getPathname(const std::string& siddPathname,
+                                   size_t level);
+
+    /*!
+     * Describes a reduced image: full resolution row (or column) x is
+     * reduced row (or column) (x - shift) / factor.
+     *
+     * \param derivedData Metadata of the full resolution image
+     * \param dims Size of the reduced image
+     * \param factor Reduction factor
+     * \param shift Full resolution position of reduced pixel 0
+     *
+     * \return Metadata of the reduced image
+     */
+    static std::unique_ptr<DerivedData> reduce(
+            const DerivedData& derivedData,
+            const types::RowCol<size_t>& dims,
+            double factor,
+            double shift);
+
+private:
+    struct Level
+    {
+        types::RowCol<size_t> inputDims;
+        std::unique_ptr<DerivedData> derivedData;
+    };
+
+    const DerivedData& mDerivedData;
+    const std::vector<std::string> mSchemaPaths;
+    const Options mOptions;
+    RRDS mRRDS;
+    size_t mNumChannels;
+    std::vector<Level> mLevels;
+};
+}
+}
+
+#endif
@@ -26,6 +26,8 @@
 #include <vector>
 #include <std/filesystem>
 #include <std/string>
+#include <std/span>
+#include <std/cstddef>
 
 #include <import/scene.h>
 #include <types/RgAz.h>
@@ -153,6 +155,30 @@ public:
             logging::Logger* logger);
     static std::u8string toXMLString(const DerivedData&,
         const std::vector<std::filesystem::path>*, logging::Logger* pLogger = nullptr);
+
+    /*
+     * Converts 'data' to six::binary (see six/BinaryXML.h), which is much
+     * faster to pass around and parse than XML.
+     *
+     * \param data Representation of SIDD data
+     * \param logger Logger.  If nullptr, no logger will be used.
+     *
+     * \return six::binary representation of 'data'
+     */
+    static std::vector<std::byte> toBinary(const DerivedData& data,
+        logging::Logger* pLogger = nullptr);
+
+    /*
+     * Converts the output of toBinary() back into a DerivedData object.
+     *
+     * \param bytes six::binary representation of SIDD data
+     * \param pSchemaPaths Schema path(s) to validate against; may be nullptr
+     * \param logger Logger.  If nullptr, no logger will be used.
+     *
+     * \return Data representation of 'bytes'
+     */
+    static std::unique_ptr<DerivedData> parseDataFromBinary(std::span<const std::byte> bytes,
+        const std::vector<std::filesystem::path>* pSchemaPaths, logging::Logger* pLogger = nullptr);
 };
 }
 }
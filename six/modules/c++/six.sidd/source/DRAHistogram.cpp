@@ -0,0 +1,243 @@
+/* =========================================================================
+ * This file is part of six.sidd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six.sidd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <six/sidd/DRAHistogram.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <thread>
+
+#include <except/Exception.h>
+#include <mt/Runnable1D.h>
+#include <six/sidd/ProductGenerator.h>
+
+namespace
+{
+const int MIN_OCTAVE = -64;
+const int MAX_OCTAVE = 64;
+const size_t NUM_BINS = (MAX_OCTAVE - MIN_OCTAVE) *
+        six::sidd::DRAHistogram::BINS_PER_OCTAVE;
+
+// Values detected at a time by add(complex)
+const size_t DETECT_CHUNK_SIZE = 4096;
+}
+
+namespace six
+{
+namespace sidd
+{
+DRAHistogram::DRAHistogram() :
+    // Bin 0 holds zeros
+    mCounts(NUM_BINS + 1, 0),
+    mNumValues(0),
+    mMin(std::numeric_limits<double>::infinity()),
+    mMax(-std::numeric_limits<double>::infinity())
+{
+}
+
+size_t DRAHistogram::getBin(double value)
+{
+    if (!(value > 0.0))
+    {
+        return 0;
+    }
+    const double bin = (std::log2(value) - MIN_OCTAVE) * BINS_PER_OCTAVE;
+    if (bin < 0.0)
+    {
+        return 0;
+    }
+    return 1 + std::min(static_cast<size_t>(bin), NUM_BINS - 1);
+}
+
+void DRAHistogram::add(std::span<const float> detected)
+{
+    uint64_t* const counts = mCounts.data();
+    for (size_t ii = 0; ii < detected.size(); ++ii)
+    {
+        const double value = detected[ii];
+        if (std::isnan(value))
+        {
+            continue;
+        }
+        ++counts[getBin(value)];
+        ++mNumValues;
+        mMin = std::min(mMin, value);
+        mMax = std::max(mMax, value);
+    }
+}
+
+void DRAHistogram::add(std::span<const std::complex<float> > pixels,
+                       Detection detection)
+{
+    std::vector<float> detected(std::min(pixels.size(), DETECT_CHUNK_SIZE));
+    for (size_t start = 0; start < pixels.size(); start += detected.size())
+    {
+        const size_t numPixels =
+                std::min(detected.size(), pixels.size() - start);
+        const std::span<float> chunk(detected.data(), numPixels);
+        ProductGenerator::detect(
+                std::span<const std::complex<float> >(
+                        pixels.data() + start, numPixels),
+                detection, chunk);
+        add(std::span<const float>(chunk.data(), chunk.size()));
+    }
+}
+
+void DRAHistogram::merge(const DRAHistogram& other)
+{
+    for (size_t ii = 0; ii < mCounts.size(); ++ii)
+    {
+        mCounts[ii] += other.mCounts[ii];
+    }
+    mNumValues += other.mNumValues;
+    mMin = std::min(mMin, other.mMin);
+    mMax = std::max(mMax, other.mMax);
+}
+
+DRAHistogram DRAHistogram::merge(std::span<const DRAHistogram> partials,
+                                 size_t numThreads)
+{
+    if (numThreads == 0)
+    {
+        numThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+
+    DRAHistogram merged;
+    for (const DRAHistogram& partial : partials)
+    {
+        merged.mNumValues += partial.mNumValues;
+        merged.mMin = std::min(merged.mMin, partial.mMin);
+        merged.mMax = std::max(merged.mMax, partial.mMax);
+    }
+
+    // Each thread owns a contiguous range of bins
+    const size_t numBins = merged.mCounts.size();
+    const size_t numChunks = std::min(numThreads, numBins);
+    mt::run1D(numChunks, numThreads, [&](size_t chunk)
+    {
+        const size_t begin = numBins * chunk / numChunks;
+        const size_t end = numBins * (chunk + 1) / numChunks;
+        uint64_t* const counts = merged.mCounts.data();
+        for (const DRAHistogram& partial : partials)
+        {
+            const uint64_t* const partialCounts = partial.mCounts.data();
+            for (size_t ii = begin; ii < end; ++ii)
+            {
+                counts[ii] += partialCounts[ii];
+            }
+        }
+    });
+    return merged;
+}
+
+double DRAHistogram::getQuantile(double fraction) const
+{
+    if (mNumValues == 0)
+    {
+        return 0.0;
+    }
+
+    fraction = std::min(std::max(fraction, 0.0), 1.0);
+    const double target = fraction * static_cast<double>(mNumValues);
+    double cumulative = 0.0;
+    for (size_t ii = 0; ii < mCounts.size(); ++ii)
+    {
+        const double count = static_cast<double>(mCounts[ii]);
+        if (count > 0.0 && cumulative + count >= target)
+        {
+            if (ii == 0)
+            {
+                return mMin;
+            }
+
+            // Interpolate geometrically within the bin
+            const double binFraction = (target - cumulative) / count;
+            const double value = std::exp2(
+                    (static_cast<double>(ii - 1) + binFraction) /
+                            BINS_PER_OCTAVE + MIN_OCTAVE);
+            return std::min(std::max(value, mMin), mMax);
+        }
+        cumulative += count;
+    }
+    return mMax;
+}
+
+double DRAHistogram::getBinRelativeError()
+{
+    return std::exp2(1.0 / BINS_PER_OCTAVE) - 1.0;
+}
+
+double DRAHistogram::getSampledRankError(uint64_t numSamples,
+                                         double confidence)
+{
+    if (!(confidence > 0.0 && confidence < 1.0))
+    {
+        throw except::Exception(Ctxt(
+                "Confidence must be in (0, 1) but is " +
+                std::to_string(confidence)));
+    }
+    if (numSamples == 0)
+    {
+        return 1.0;
+    }
+
+    // P(sup |F_n - F| > e) <= 2 exp(-2 n e^2)
+    return std::min(std::sqrt(std::log(2.0 / (1.0 - confidence)) /
+                              (2.0 * static_cast<double>(numSamples))),
+                    1.0);
+}
+
+void DRAHistogram::getStretch(
+        const DynamicRangeAdjustment::DRAParameters& params,
+        double& low,
+        double& high) const
+{
+    if (mNumValues == 0)
+    {
+        low = high = 0.0;
+        return;
+    }
+
+    const double eMin = getQuantile(params.pMin);
+    const double eMax = getQuantile(params.pMax);
+    low = eMin - params.eMinModifier * (eMin - mMin);
+    high = eMax + params.eMaxModifier * (mMax - eMax);
+}
+
+DynamicRangeAdjustment::DRAOverrides DRAHistogram::getDRAOverrides(
+        const DynamicRangeAdjustment::DRAParameters& params,
+        size_t numCodes) const
+{
+    double low;
+    double high;
+    getStretch(params, low, high);
+
+    DynamicRangeAdjustment::DRAOverrides overrides;
+    overrides.subtractor = low;
+    overrides.multiplier = (high > low && numCodes > 1) ?
+            (numCodes - 1) / (high - low) : 0.0;
+    return overrides;
+}
+}
+}
@@ -30,6 +30,7 @@
 #include <except/Exception.h>
 #include <gsl/gsl.h>
 #include <six/sidd/DerivedDataBuilder.h>
+#include <six/CharConv.h>
 
 namespace
 {
@@ -112,7 +113,7 @@ void DerivedXMLParser::getAttributeIfExists(
 {
     if (attributes.contains(attributeName))
     {
-        value = str::toType<ptrdiff_t>(attributes.getValue(attributeName));
+        value = six::charconv::toType<ptrdiff_t>(attributes.getValue(attributeName));
     }
     else
     {
@@ -127,7 +128,7 @@ void DerivedXMLParser::getAttributeIfExists(
 {
     if (attributes.contains(attributeName))
     {
-        value = str::toType<size_t>(attributes.getValue(attributeName));
+        value = six::charconv::toType<size_t>(attributes.getValue(attributeName));
     }
     else
     {
@@ -414,7 +415,7 @@ Remap* DerivedXMLParser::parseRemapChoiceFromXML(
             XMLElem remapLUTElem = getFirstAndOnly(colorRemapElem, "RemapLUT");
 
             //get size attribute
-            auto size = str::toType<size_t>(remapLUTElem->attribute("size"));
+            auto size = six::charconv::toType<size_t>(remapLUTElem->attribute("size"));
 
             // xs:list is space delimited
             std::string lutStr = remapLUTElem->getCharacterData();
@@ -428,7 +429,7 @@ Remap* DerivedXMLParser::parseRemapChoiceFromXML(
                 std::vector<std::string> rgb = str::split(lutVals[i], ",");
                 for (size_t j = 0; j < rgb.size(); j++)
                 {
-                    const auto intermediateVal = str::toType<size_t>(rgb[j]);
+                    const auto intermediateVal = six::charconv::toType<size_t>(rgb[j]);
                     if (intermediateVal > 255)
                     {
                         throw except::Exception(Ctxt(
@@ -485,7 +486,7 @@ Remap* DerivedXMLParser::parseRemapChoiceFromXML(
 mem::auto_ptr<LUT> DerivedXMLParser::parseSingleLUT(const xml::lite::Element* elem) const
 {
     //get size attribute
-    const auto size = str::toType<size_t>(const_cast<XMLElem>(elem)->attribute("size"));
+    const auto size = six::charconv::toType<size_t>(const_cast<XMLElem>(elem)->attribute("size"));
 
     std::string lutStr = "";
     parseString(elem, lutStr);
@@ -494,7 +495,7 @@ mem::auto_ptr<LUT> DerivedXMLParser::parseSingleLUT(const xml::lite::Element* el
 
     for (size_t ii = 0; ii < lutVals.size(); ++ii)
     {
-        const short lutVal = str::toType<short>(lutVals[ii]);
+        const short lutVal = six::charconv::toType<short>(lutVals[ii]);
         ::memcpy(&(lut->table[ii * lut->elementSize]),
                  &lutVal, sizeof(short));
     }
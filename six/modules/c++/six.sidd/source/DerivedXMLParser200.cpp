@@ -24,6 +24,7 @@
 
 #include <six/SICommonXMLParser10x.h>
 #include <six/sidd/DerivedDataBuilder.h>
+#include <six/CharConv.h>
 #include <six/sidd/DerivedXMLParser200.h>
 
 namespace
@@ -2100,7 +2101,7 @@ std::unique_ptr<LUT> DerivedXMLParser200::parseSingleLUT(const std::string& lutS
 
     for (size_t ii = 0; ii < lutVals.size(); ++ii)
     {
-        const short lutVal = str::toType<short>(lutVals[ii]);
+        const short lutVal = six::charconv::toType<short>(lutVals[ii]);
         ::memcpy(&(lut->table[ii * lut->elementSize]),
             &lutVal, sizeof(short));
     }
@@ -0,0 +1,348 @@
+/* =========================================================================
+ * This file is part of six.sidd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six.sidd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <six/sidd/KernelFilter.h>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <thread>
+
+#include <except/Exception.h>
+#include <mt/Runnable1D.h>
+#include <six/Init.h>
+
+namespace
+{
+// Columns processed at a time, so an output tile and the input rows feeding
+// it stay in L1/L2 while every tap is accumulated
+const ptrdiff_t TILE_SIZE = 2048;
+
+// Tolerance, relative to the largest coefficient, for treating a kernel as
+// separable
+const double SEPARABLE_TOLERANCE = 1e-6;
+
+ptrdiff_t clamp(ptrdiff_t index, ptrdiff_t size)
+{
+    return std::min(std::max<ptrdiff_t>(index, 0), size - 1);
+}
+
+/*
+ * out[c] += coef * in[c + shift] for c in [begin, end), with indices off the
+ * end of the row clamped to the edge
+ */
+void accumulateShifted(const float* in,
+                       ptrdiff_t numCols,
+                       ptrdiff_t shift,
+                       float coef,
+                       ptrdiff_t begin,
+                       ptrdiff_t end,
+                       float* out)
+{
+    const ptrdiff_t interiorBegin =
+            std::min(std::max(begin, -shift), end);
+    const ptrdiff_t interiorEnd =
+            std::max(std::min(end, numCols - shift), interiorBegin);
+
+    for (ptrdiff_t col = begin; col < interiorBegin; ++col)
+    {
+        out[col] += coef * in[clamp(col + shift, numCols)];
+    }
+    for (ptrdiff_t col = interiorBegin; col < interiorEnd; ++col)
+    {
+        out[col] += coef * in[col + shift];
+    }
+    for (ptrdiff_t col = interiorEnd; col < end; ++col)
+    {
+        out[col] += coef * in[clamp(col + shift, numCols)];
+    }
+}
+
+size_t getNumThreads(size_t numThreads)
+{
+    if (numThreads == 0)
+    {
+        numThreads = std::thread::hardware_concurrency();
+    }
+    return std::max<size_t>(numThreads, 1);
+}
+
+void checkSize(size_t expected, size_t actual, const std::string& what)
+{
+    if (expected != actual)
+    {
+        throw except::Exception(Ctxt(
+                "Expected " + std::to_string(expected) + " " + what +
+                " but got " + std::to_string(actual)));
+    }
+}
+
+const six::sidd::Filter::Kernel::Custom&
+getCustomKernel(const six::sidd::Filter& filter)
+{
+    if (!filter.filterKernel.get() || !filter.filterKernel->custom.get())
+    {
+        throw except::Exception(Ctxt(
+                "Filter " + filter.filterName + " has no custom kernel"));
+    }
+    return *filter.filterKernel->custom;
+}
+}
+
+namespace six
+{
+namespace sidd
+{
+KernelFilter::KernelFilter(const Filter& filter) :
+    KernelFilter(getCustomKernel(filter), filter.operation)
+{
+}
+
+KernelFilter::KernelFilter(const Filter::Kernel::Custom& kernel,
+                           FilterOperation operation) :
+    mSeparable(false)
+{
+    if (six::Init::isUndefined(kernel.size) ||
+        kernel.size.row <= 0 || kernel.size.col <= 0)
+    {
+        throw except::Exception(Ctxt("Filter kernel has no size"));
+    }
+    mSize = types::RowCol<size_t>(kernel.size.row, kernel.size.col);
+    checkSize(mSize.area(), kernel.filterCoef.size(), "kernel coefficients");
+
+    // Convolution is correlation with the kernel flipped, which also moves
+    // the center of an even-sized kernel
+    const bool flip = (operation == FilterOperation::CONVOLUTION);
+    const types::RowCol<size_t> center((mSize.row - 1) / 2,
+                                       (mSize.col - 1) / 2);
+    mCenter = flip ? types::RowCol<size_t>(mSize.row - 1 - center.row,
+                                           mSize.col - 1 - center.col) :
+                     center;
+
+    mCoefs.resize(mSize.area());
+    double maxAbs = 0.0;
+    size_t pivot = 0;
+    for (size_t ii = 0; ii < mCoefs.size(); ++ii)
+    {
+        const double coef = kernel.filterCoef[flip ? mCoefs.size() - 1 - ii :
+                                                     ii];
+        mCoefs[ii] = static_cast<float>(coef);
+        if (std::abs(coef) > maxAbs)
+        {
+            maxAbs = std::abs(coef);
+            pivot = ii;
+        }
+    }
+
+    // A rank-1 kernel is column(pivot col) * row(pivot row) / pivot
+    const size_t pivotRow = pivot / mSize.col;
+    const size_t pivotCol = pivot % mSize.col;
+    std::vector<double> column(mSize.row);
+    std::vector<double> row(mSize.col);
+    for (size_t rr = 0; rr < mSize.row; ++rr)
+    {
+        column[rr] = mCoefs[rr * mSize.col + pivotCol];
+    }
+    for (size_t cc = 0; cc < mSize.col; ++cc)
+    {
+        row[cc] = (maxAbs > 0.0) ?
+                mCoefs[pivotRow * mSize.col + cc] / mCoefs[pivot] : 0.0;
+    }
+
+    mSeparable = (mSize.row > 1 && mSize.col > 1);
+    for (size_t ii = 0; ii < mCoefs.size() && mSeparable; ++ii)
+    {
+        const double product = column[ii / mSize.col] * row[ii % mSize.col];
+        mSeparable = std::abs(product - mCoefs[ii]) <=
+                SEPARABLE_TOLERANCE * maxAbs;
+    }
+    if (mSeparable)
+    {
+        mColumnCoefs.assign(column.begin(), column.end());
+        mRowCoefs.assign(row.begin(), row.end());
+    }
+}
+
+void KernelFilter::apply(std::span<const float> input,
+                         const types::RowCol<size_t>& dims,
+                         std::span<float> output,
+                         size_t numThreads) const
+{
+    checkSize(dims.area(), input.size(), "input pixels");
+    checkSize(dims.area(), output.size(), "output pixels");
+    if (dims.area() == 0)
+    {
+        return;
+    }
+
+    // A few bands per thread evens out the load
+    numThreads = getNumThreads(numThreads);
+    const size_t numBands = std::min(dims.row, 4 * numThreads);
+    mt::run1D(numBands, numThreads, [&](size_t band)
+    {
+        const size_t startRow = dims.row * band / numBands;
+        const size_t endRow = dims.row * (band + 1) / numBands;
+        if (mSeparable)
+        {
+            applySeparable(input.data(), dims, startRow, endRow - startRow,
+                           output.data() + startRow * dims.col);
+        }
+        else
+        {
+            applyDirect(input.data(), dims, startRow, endRow - startRow,
+                        output.data() + startRow * dims.col);
+        }
+    });
+}
+
+void KernelFilter::applyRows(std::span<const float> input,
+                             const types::RowCol<size_t>& inputDims,
+                             size_t startRow,
+                             size_t numRows,
+                             std::span<float> output) const
+{
+    checkSize(inputDims.area(), input.size(), "input pixels");
+    checkSize(numRows * inputDims.col, output.size(), "output pixels");
+    if (startRow + numRows > inputDims.row)
+    {
+        throw except::Exception(Ctxt(
+                "Rows [" + std::to_string(startRow) + ", " +
+                std::to_string(startRow + numRows) + ") aren't in a " +
+                std::to_string(inputDims.row) + "-row band"));
+    }
+    if (numRows == 0 || inputDims.col == 0)
+    {
+        return;
+    }
+
+    if (mSeparable)
+    {
+        applySeparable(input.data(), inputDims, startRow, numRows,
+                       output.data());
+    }
+    else
+    {
+        applyDirect(input.data(), inputDims, startRow, numRows,
+                    output.data());
+    }
+}
+
+void KernelFilter::applyDirect(const float* input,
+                               const types::RowCol<size_t>& inputDims,
+                               size_t startRow,
+                               size_t numRows,
+                               float* output) const
+{
+    const ptrdiff_t numInputRows = static_cast<ptrdiff_t>(inputDims.row);
+    const ptrdiff_t numCols = static_cast<ptrdiff_t>(inputDims.col);
+    const ptrdiff_t kernelRows = static_cast<ptrdiff_t>(mSize.row);
+    const ptrdiff_t kernelCols = static_cast<ptrdiff_t>(mSize.col);
+    const ptrdiff_t centerRow = static_cast<ptrdiff_t>(mCenter.row);
+    const ptrdiff_t centerCol = static_cast<ptrdiff_t>(mCenter.col);
+
+    for (size_t ii = 0; ii < numRows; ++ii)
+    {
+        const ptrdiff_t row = static_cast<ptrdiff_t>(startRow + ii);
+        float* const out = output + ii * inputDims.col;
+        for (ptrdiff_t begin = 0; begin < numCols; begin += TILE_SIZE)
+        {
+            const ptrdiff_t end = std::min(begin + TILE_SIZE, numCols);
+            std::fill(out + begin, out + end, 0.0f);
+            for (ptrdiff_t kr = 0; kr < kernelRows; ++kr)
+            {
+                const float* const in = input +
+                        clamp(row + kr - centerRow, numInputRows) * numCols;
+                const float* const coefs = &mCoefs[kr * kernelCols];
+                for (ptrdiff_t kc = 0; kc < kernelCols; ++kc)
+                {
+                    if (coefs[kc] != 0.0f)
+                    {
+                        accumulateShifted(in, numCols, kc - centerCol,
+                                          coefs[kc], begin, end, out);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void KernelFilter::applySeparable(const float* input,
+                                  const types::RowCol<size_t>& inputDims,
+                                  size_t startRow,
+                                  size_t numRows,
+                                  float* output) const
+{
+    const ptrdiff_t numInputRows = static_cast<ptrdiff_t>(inputDims.row);
+    const ptrdiff_t numCols = static_cast<ptrdiff_t>(inputDims.col);
+    const ptrdiff_t kernelRows = static_cast<ptrdiff_t>(mSize.row);
+    const ptrdiff_t kernelCols = static_cast<ptrdiff_t>(mSize.col);
+    const ptrdiff_t centerRow = static_cast<ptrdiff_t>(mCenter.row);
+    const ptrdiff_t centerCol = static_cast<ptrdiff_t>(mCenter.col);
+
+    // Filter along the rows the band reaches...
+    const ptrdiff_t firstRow = std::max<ptrdiff_t>(
+            static_cast<ptrdiff_t>(startRow) - centerRow, 0);
+    const ptrdiff_t lastRow = std::min<ptrdiff_t>(
+            static_cast<ptrdiff_t>(startRow + numRows) - 1 +
+                    kernelRows - 1 - centerRow,
+            numInputRows - 1);
+    std::vector<float> rowFiltered((lastRow - firstRow + 1) * numCols, 0.0f);
+    for (ptrdiff_t row = firstRow; row <= lastRow; ++row)
+    {
+        const float* const in = input + row * numCols;
+        float* const out = &rowFiltered[(row - firstRow) * numCols];
+        for (ptrdiff_t begin = 0; begin < numCols; begin += TILE_SIZE)
+        {
+            const ptrdiff_t end = std::min(begin + TILE_SIZE, numCols);
+            for (ptrdiff_t kc = 0; kc < kernelCols; ++kc)
+            {
+                accumulateShifted(in, numCols, kc - centerCol,
+                                  mRowCoefs[kc], begin, end, out);
+            }
+        }
+    }
+
+    // ...then down the columns
+    for (size_t ii = 0; ii < numRows; ++ii)
+    {
+        const ptrdiff_t row = static_cast<ptrdiff_t>(startRow + ii);
+        float* const out = output + ii * inputDims.col;
+        for (ptrdiff_t begin = 0; begin < numCols; begin += TILE_SIZE)
+        {
+            const ptrdiff_t end = std::min(begin + TILE_SIZE, numCols);
+            std::fill(out + begin, out + end, 0.0f);
+            for (ptrdiff_t kr = 0; kr < kernelRows; ++kr)
+            {
+                const float coef = mColumnCoefs[kr];
+                const float* const in = &rowFiltered[
+                        (clamp(row + kr - centerRow, numInputRows) -
+                         firstRow) * numCols];
+                for (ptrdiff_t col = begin; col < end; ++col)
+                {
+                    out[col] += coef * in[col];
+                }
+            }
+        }
+    }
+}
+}
+}
@@ -0,0 +1,327 @@
+/* =========================================================================
+ * This file is part of six.sidd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six.sidd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <six/sidd/PolyphaseResampler.h>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <thread>
+
+#include <except/Exception.h>
+#include <mt/Runnable1D.h>
+#include <six/Init.h>
+
+namespace
+{
+ptrdiff_t clamp(ptrdiff_t index, ptrdiff_t size)
+{
+    return std::min(std::max<ptrdiff_t>(index, 0), size - 1);
+}
+
+size_t getNumThreads(size_t numThreads)
+{
+    if (numThreads == 0)
+    {
+        numThreads = std::thread::hardware_concurrency();
+    }
+    return std::max<size_t>(numThreads, 1);
+}
+
+void checkSize(size_t expected, size_t actual, const std::string& what)
+{
+    if (expected != actual)
+    {
+        throw except::Exception(Ctxt(
+                "Expected " + std::to_string(expected) + " " + what +
+                " but got " + std::to_string(actual)));
+    }
+}
+
+// Keys' cubic convolution kernel with a = -0.5
+double cubic(double distance)
+{
+    const double a = -0.5;
+    distance = std::abs(distance);
+    if (distance <= 1.0)
+    {
+        return ((a + 2.0) * distance - (a + 3.0)) * distance * distance + 1.0;
+    }
+    if (distance < 2.0)
+    {
+        return ((a * distance - 5.0 * a) * distance + 8.0 * a) * distance -
+                4.0 * a;
+    }
+    return 0.0;
+}
+}
+
+namespace six
+{
+namespace sidd
+{
+PolyphaseResampler::PolyphaseResampler(const Filter& filter,
+                                       size_t numPhasings)
+{
+    if (!filter.filterBank.get())
+    {
+        throw except::Exception(Ctxt(
+                "Filter " + filter.filterName + " has no bank"));
+    }
+
+    const Filter::Bank& bank = *filter.filterBank;
+    if (bank.custom.get())
+    {
+        init(*bank.custom, filter.operation);
+    }
+    else if (bank.predefined.get() &&
+             !six::Init::isUndefined(bank.predefined->databaseName))
+    {
+        init(createBank(bank.predefined->databaseName, numPhasings),
+             filter.operation);
+    }
+    else
+    {
+        throw except::Exception(Ctxt(
+                "Filter " + filter.filterName +
+                " doesn't have a custom bank or a database name"));
+    }
+}
+
+PolyphaseResampler::PolyphaseResampler(const Filter::Bank::Custom& bank,
+                                       FilterOperation operation)
+{
+    init(bank, operation);
+}
+
+void PolyphaseResampler::init(const Filter::Bank::Custom& bank,
+                              FilterOperation operation)
+{
+    if (six::Init::isUndefined(bank.numPhasings) ||
+        six::Init::isUndefined(bank.numPoints) ||
+        bank.numPhasings == 0 || bank.numPoints == 0)
+    {
+        throw except::Exception(Ctxt("Filter bank has no size"));
+    }
+    mNumPhasings = bank.numPhasings;
+    mNumPoints = bank.numPoints;
+    checkSize(mNumPhasings * mNumPoints, bank.filterCoef.size(),
+              "bank coefficients");
+
+    // Convolution applies each phase's points in reverse
+    const bool flip = (operation == FilterOperation::CONVOLUTION);
+    mCoefs.resize(bank.filterCoef.size());
+    for (size_t phase = 0; phase < mNumPhasings; ++phase)
+    {
+        const double* const coefs = &bank.filterCoef[phase * mNumPoints];
+        for (size_t point = 0; point < mNumPoints; ++point)
+        {
+            mCoefs[phase * mNumPoints + point] = static_cast<float>(
+                    coefs[flip ? mNumPoints - 1 - point : point]);
+        }
+    }
+}
+
+std::span<const float> PolyphaseResampler::getPhase(size_t phase) const
+{
+    if (phase >= mNumPhasings)
+    {
+        throw except::Exception(Ctxt(
+                "Phase " + std::to_string(phase) + " isn't in a " +
+                std::to_string(mNumPhasings) + "-phase bank"));
+    }
+    return std::span<const float>(&mCoefs[phase * mNumPoints], mNumPoints);
+}
+
+Filter::Bank::Custom PolyphaseResampler::createBank(FilterDatabaseName name,
+                                                    size_t numPhasings)
+{
+    if (numPhasings == 0)
+    {
+        throw except::Exception(Ctxt("A filter bank needs a phase"));
+    }
+
+    Filter::Bank::Custom bank;
+    bank.numPhasings = numPhasings;
+    bank.numPoints = (name == FilterDatabaseName::NEAREST_NEIGHBOR ||
+                      name == FilterDatabaseName::BILINEAR) ? 2 : 4;
+    bank.filterCoef.resize(bank.numPhasings * bank.numPoints);
+
+    for (size_t phase = 0; phase < numPhasings; ++phase)
+    {
+        const double t = static_cast<double>(phase) / numPhasings;
+        double* const coefs = &bank.filterCoef[phase * bank.numPoints];
+        if (name == FilterDatabaseName::NEAREST_NEIGHBOR)
+        {
+            coefs[0] = (t < 0.5) ? 1.0 : 0.0;
+            coefs[1] = 1.0 - coefs[0];
+        }
+        else if (name == FilterDatabaseName::BILINEAR)
+        {
+            coefs[0] = 1.0 - t;
+            coefs[1] = t;
+        }
+        else if (name == FilterDatabaseName::CUBIC)
+        {
+            coefs[0] = cubic(1.0 + t);
+            coefs[1] = cubic(t);
+            coefs[2] = cubic(1.0 - t);
+            coefs[3] = cubic(2.0 - t);
+        }
+        else if (name == FilterDatabaseName::LAGRANGE)
+        {
+            // Third order Lagrange polynomials through -1, 0, 1, 2
+            coefs[0] = -t * (t - 1.0) * (t - 2.0) / 6.0;
+            coefs[1] = (t + 1.0) * (t - 1.0) * (t - 2.0) / 2.0;
+            coefs[2] = -(t + 1.0) * t * (t - 2.0) / 2.0;
+            coefs[3] = (t + 1.0) * t * (t - 1.0) / 6.0;
+        }
+        else
+        {
+            throw except::Exception(Ctxt(
+                    "Unknown filter database name " + name.toString()));
+        }
+    }
+    return bank;
+}
+
+PolyphaseResampler::Taps
+PolyphaseResampler::getTaps(size_t inputSize, size_t outputSize) const
+{
+    Taps taps;
+    taps.start.resize(outputSize);
+    taps.phase.resize(outputSize);
+
+    const double scale = static_cast<double>(inputSize) / outputSize;
+    const ptrdiff_t offset = static_cast<ptrdiff_t>(mNumPoints - 1) / 2;
+    for (size_t ii = 0; ii < outputSize; ++ii)
+    {
+        const double position = (ii + 0.5) * scale - 0.5;
+        const double base = std::floor(position);
+        size_t phase = static_cast<size_t>(
+                std::round((position - base) * mNumPhasings));
+        ptrdiff_t start = static_cast<ptrdiff_t>(base);
+        if (phase == mNumPhasings)
+        {
+            phase = 0;
+            ++start;
+        }
+        taps.start[ii] = start - offset;
+        taps.phase[ii] = phase;
+    }
+    return taps;
+}
+
+void PolyphaseResampler::resample(std::span<const float> input,
+                                  const types::RowCol<size_t>& inputDims,
+                                  std::span<float> output,
+                                  const types::RowCol<size_t>& outputDims,
+                                  size_t numThreads) const
+{
+    checkSize(inputDims.area(), input.size(), "input pixels");
+    checkSize(outputDims.area(), output.size(), "output pixels");
+    if (outputDims.area() == 0)
+    {
+        return;
+    }
+    if (inputDims.area() == 0)
+    {
+        throw except::Exception(Ctxt("Can't resample an empty image"));
+    }
+
+    numThreads = getNumThreads(numThreads);
+    const ptrdiff_t numPoints = static_cast<ptrdiff_t>(mNumPoints);
+    const ptrdiff_t numInputRows = static_cast<ptrdiff_t>(inputDims.row);
+    const ptrdiff_t numInputCols = static_cast<ptrdiff_t>(inputDims.col);
+    const size_t numOutputCols = outputDims.col;
+    const Taps colTaps = getTaps(inputDims.col, outputDims.col);
+    const Taps rowTaps = getTaps(inputDims.row, outputDims.row);
+
+    // Resample along each input row...
+    std::vector<float> rowResampled(inputDims.row * numOutputCols);
+    const size_t numRowBands = std::min(inputDims.row, 4 * numThreads);
+    mt::run1D(numRowBands, numThreads, [&](size_t band)
+    {
+        const size_t begin = inputDims.row * band / numRowBands;
+        const size_t end = inputDims.row * (band + 1) / numRowBands;
+        for (size_t row = begin; row < end; ++row)
+        {
+            const float* const in = input.data() + row * inputDims.col;
+            float* const out = &rowResampled[row * numOutputCols];
+            for (size_t col = 0; col < numOutputCols; ++col)
+            {
+                const ptrdiff_t start = colTaps.start[col];
+                const float* const coefs =
+                        &mCoefs[colTaps.phase[col] * mNumPoints];
+                float sum = 0.0f;
+                if (start >= 0 && start + numPoints <= numInputCols)
+                {
+                    for (ptrdiff_t point = 0; point < numPoints; ++point)
+                    {
+                        sum += coefs[point] * in[start + point];
+                    }
+                }
+                else
+                {
+                    for (ptrdiff_t point = 0; point < numPoints; ++point)
+                    {
+                        sum += coefs[point] *
+                                in[clamp(start + point, numInputCols)];
+                    }
+                }
+                out[col] = sum;
+            }
+        }
+    });
+
+    // ...then accumulate whole rows of that down the columns
+    const size_t numColBands = std::min(outputDims.row, 4 * numThreads);
+    mt::run1D(numColBands, numThreads, [&](size_t band)
+    {
+        const size_t begin = outputDims.row * band / numColBands;
+        const size_t end = outputDims.row * (band + 1) / numColBands;
+        for (size_t row = begin; row < end; ++row)
+        {
+            float* const out = output.data() + row * numOutputCols;
+            std::fill(out, out + numOutputCols, 0.0f);
+            const float* const coefs =
+                    &mCoefs[rowTaps.phase[row] * mNumPoints];
+            for (ptrdiff_t point = 0; point < numPoints; ++point)
+            {
+                const float coef = coefs[point];
+                if (coef == 0.0f)
+                {
+                    continue;
+                }
+                const float* const in = &rowResampled[
+                        clamp(rowTaps.start[row] + point, numInputRows) *
+                        numOutputCols];
+                for (size_t col = 0; col < numOutputCols; ++col)
+                {
+                    out[col] += coef * in[col];
+                }
+            }
+        }
+    });
+}
+}
+}
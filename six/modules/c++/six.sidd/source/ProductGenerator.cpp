@@ -0,0 +1,708 @@
+/* =========================================================================
+ * This file is part of six.sidd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six.sidd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <six/sidd/ProductGenerator.h>
+
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <future>
+#include <string>
+#include <thread>
+
+#include <except/Exception.h>
+#include <io/FileOutputStream.h>
+#include <mt/Runnable1D.h>
+#include <nitf/NITFBufferList.hpp>
+#include <six/Region.h>
+#include <six/sidd/SIDDByteProvider.h>
+
+namespace
+{
+typedef std::chrono::steady_clock Clock;
+
+double secondsSince(const Clock::time_point& start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+size_t getNumThreads(size_t numThreads)
+{
+    if (numThreads == 0)
+    {
+        numThreads = std::thread::hardware_concurrency();
+    }
+    return std::max<size_t>(numThreads, 1);
+}
+
+// Splits [0, numElements) into one contiguous chunk per thread and calls
+// op(chunk, begin, end) for each of them
+template <typename OpT>
+void runChunks(size_t numElements, size_t numThreads, const OpT& op)
+{
+    const size_t numChunks = std::max<size_t>(
+            std::min(numThreads, numElements), 1);
+    mt::run1D(numChunks, numThreads, [&](size_t chunk)
+    {
+        op(chunk,
+           numElements * chunk / numChunks,
+           numElements * (chunk + 1) / numChunks);
+    });
+}
+
+size_t getNumSICDBytesPerPixel(six::PixelType pixelType)
+{
+    switch (pixelType)
+    {
+    case six::PixelType::RE32F_IM32F:
+        return 8;
+    case six::PixelType::RE16I_IM16I:
+        return 4;
+    case six::PixelType::AMP8I_PHS8I:
+        return 2;
+    default:
+        throw except::Exception(Ctxt(
+                "Unsupported SICD pixel type " + pixelType.toString()));
+    }
+}
+
+size_t getNumProductBytesPerPixel(six::PixelType pixelType)
+{
+    switch (pixelType)
+    {
+    case six::PixelType::MONO8I:
+    case six::PixelType::MONO8LU:
+    case six::PixelType::RGB8LU:
+        return 1;
+    case six::PixelType::MONO16I:
+        return 2;
+    case six::PixelType::RGB24I:
+        return 3;
+    default:
+        throw except::Exception(Ctxt(
+                "Unsupported SIDD pixel type " + pixelType.toString()));
+    }
+}
+
+bool isLookupPixelType(six::PixelType pixelType)
+{
+    return pixelType == six::PixelType::MONO8LU ||
+           pixelType == six::PixelType::RGB8LU;
+}
+
+const six::LUT* getRemapLUT(const six::sidd::Display& display)
+{
+    return display.remapInformation.get() ?
+            display.remapInformation->remapLUT.get() : nullptr;
+}
+
+size_t getNumRemapCodes(const six::sidd::Display& display)
+{
+    const six::LUT* const lut = getRemapLUT(display);
+    if (isLookupPixelType(display.pixelType))
+    {
+        return lut ? std::min<size_t>(lut->numEntries, 256) : 256;
+    }
+    if (lut)
+    {
+        return lut->numEntries;
+    }
+    return display.pixelType == six::PixelType::MONO16I ? 65536 : 256;
+}
+
+const six::sidd::DynamicRangeAdjustment*
+getDRA(const six::sidd::Display& display)
+{
+    if (display.interactiveProcessing.empty() ||
+        !display.interactiveProcessing[0].get())
+    {
+        return nullptr;
+    }
+    return &display.interactiveProcessing[0]->dynamicRangeAdjustment;
+}
+
+bool usesOverrides(const six::sidd::DynamicRangeAdjustment* dra)
+{
+    if (!dra || dra->algorithmType == six::sidd::DRAType::NONE ||
+        !dra->draOverrides.get())
+    {
+        return false;
+    }
+    return dra->algorithmType == six::sidd::DRAType::MANUAL ||
+           !dra->draParameters.get();
+}
+
+struct Band
+{
+    size_t startRow = 0;
+    size_t numRows = 0;
+    std::vector<std::byte> pixels;
+};
+
+// State shared by all bands of one generate() call
+struct Input
+{
+    six::NITFReadControl* reader = nullptr;
+    six::PixelType pixelType;
+    size_t numRows = 0;
+    size_t numCols = 0;
+    size_t numRowsPerBand = 0;
+    float amplitudes[256];
+};
+
+void readRows(const Input& input,
+              size_t startRow,
+              size_t numRows,
+              std::byte* pixels)
+{
+    six::Region region;
+    region.setStartRow(static_cast<ptrdiff_t>(startRow));
+    region.setNumRows(static_cast<ptrdiff_t>(numRows));
+    region.setStartCol(0);
+    region.setNumCols(static_cast<ptrdiff_t>(input.numCols));
+    region.setBuffer(pixels);
+    input.reader->interleaved(region, 0);
+}
+
+void readBand(const Input& input, size_t startRow, Band& band)
+{
+    band.startRow = startRow;
+    band.numRows = std::min(input.numRowsPerBand, input.numRows - startRow);
+    readRows(input, startRow, band.numRows, band.pixels.data());
+}
+
+/*
+ * Calls processBand() on each band of the SICD in order.  The next band is
+ * read on another thread while the current one is processed, so the SICD
+ * reader is only ever used by one thread at a time.
+ */
+template <typename ProcessT>
+void streamBands(const Input& input,
+                 Band (&bands)[2],
+                 double& readSeconds,
+                 const ProcessT& processBand)
+{
+    auto read = [&input](size_t startRow, Band& band)
+    {
+        const Clock::time_point start = Clock::now();
+        readBand(input, startRow, band);
+        return secondsSince(start);
+    };
+
+    readSeconds += read(0, bands[0]);
+    for (size_t startRow = 0, ii = 0; startRow < input.numRows; ++ii)
+    {
+        const Band& band = bands[ii % 2];
+        const size_t nextRow = startRow + band.numRows;
+
+        std::future<double> nextRead;
+        if (nextRow < input.numRows)
+        {
+            nextRead = std::async(std::launch::async, read, nextRow,
+                                  std::ref(bands[(ii + 1) % 2]));
+        }
+
+        try
+        {
+            processBand(band);
+        }
+        catch (...)
+        {
+            // Don't leave the read running against buffers that are about
+            // to go away
+            if (nextRead.valid())
+            {
+                nextRead.wait();
+            }
+            throw;
+        }
+
+        if (nextRead.valid())
+        {
+            readSeconds += nextRead.get();
+        }
+        startRow = nextRow;
+    }
+}
+
+void detectBand(const Input& input,
+                const Band& band,
+                six::sidd::Detection detection,
+                size_t numThreads,
+                std::span<float> detected)
+{
+    const size_t numPixels = band.numRows * input.numCols;
+    runChunks(numPixels, numThreads,
+              [&](size_t, size_t begin, size_t end)
+    {
+        const size_t numChunkPixels = end - begin;
+        const std::span<float> output(detected.data() + begin,
+                                      numChunkPixels);
+        const std::byte* const pixels = band.pixels.data();
+        switch (input.pixelType)
+        {
+        case six::PixelType::RE32F_IM32F:
+            six::sidd::ProductGenerator::detect(
+                    std::span<const std::complex<float> >(
+                            reinterpret_cast<const std::complex<float>*>(
+                                    pixels) + begin,
+                            numChunkPixels),
+                    detection, output);
+            break;
+        case six::PixelType::RE16I_IM16I:
+            six::sidd::ProductGenerator::detect(
+                    std::span<const int16_t>(
+                            reinterpret_cast<const int16_t*>(pixels) +
+                                    2 * begin,
+                            2 * numChunkPixels),
+                    detection, output);
+            break;
+        default:
+            six::sidd::ProductGenerator::detect(
+                    std::span<const uint8_t>(
+                            reinterpret_cast<const uint8_t*>(pixels) +
+                                    2 * begin,
+                            2 * numChunkPixels),
+                    input.amplitudes, detection, output);
+        }
+    });
+}
+
+template <typename T>
+void detectIQ(const T* iq,
+              size_t numPixels,
+              six::sidd::Detection detection,
+              float* output)
+{
+    // Separate loops per detection keep the bodies branch-free so both
+    // vectorize; the sqrt one needs -fno-math-errno (see CMakeLists.txt)
+    if (detection == six::sidd::Detection::POWER)
+    {
+        for (size_t ii = 0; ii < numPixels; ++ii)
+        {
+            const float i = static_cast<float>(iq[2 * ii]);
+            const float q = static_cast<float>(iq[2 * ii + 1]);
+            output[ii] = i * i + q * q;
+        }
+    }
+    else
+    {
+        for (size_t ii = 0; ii < numPixels; ++ii)
+        {
+            const float i = static_cast<float>(iq[2 * ii]);
+            const float q = static_cast<float>(iq[2 * ii + 1]);
+            output[ii] = std::sqrt(i * i + q * q);
+        }
+    }
+}
+
+void checkDetectSizes(size_t numPixels, size_t numOutputs)
+{
+    if (numPixels != numOutputs)
+    {
+        throw except::Exception(Ctxt(
+                "Expected " + std::to_string(numPixels) +
+                " detected values but got " + std::to_string(numOutputs)));
+    }
+}
+}
+
+namespace six
+{
+namespace sidd
+{
+DisplayRemapper::DisplayRemapper(const Display& display,
+                                 double low,
+                                 double high) :
+    mNumCodes(getNumRemapCodes(display)),
+    mNumBytesPerPixel(getNumProductBytesPerPixel(display.pixelType)),
+    mLow(low),
+    mHigh(high),
+    mScale(high > low ? static_cast<float>((mNumCodes - 1) / (high - low)) :
+                        0.0f),
+    mCodeBytes(mNumCodes * mNumBytesPerPixel)
+{
+    const LUT* const lut = getRemapLUT(display);
+    if (mNumCodes == 0)
+    {
+        throw except::Exception(Ctxt("Remap LUT has no entries"));
+    }
+
+    for (size_t code = 0; code < mNumCodes; ++code)
+    {
+        std::byte* const bytes = &mCodeBytes[code * mNumBytesPerPixel];
+        if (isLookupPixelType(display.pixelType))
+        {
+            bytes[0] = static_cast<std::byte>(code);
+        }
+        else if (lut)
+        {
+            if (lut->elementSize != mNumBytesPerPixel)
+            {
+                throw except::Exception(Ctxt(
+                        "Remap LUT has " + std::to_string(lut->elementSize) +
+                        "-byte entries but " + display.pixelType.toString() +
+                        " pixels are " + std::to_string(mNumBytesPerPixel) +
+                        " bytes"));
+            }
+
+            if (mNumBytesPerPixel == 2)
+            {
+                // Mono LUT entries are held in native byte order
+                uint16_t value;
+                ::memcpy(&value, (*lut)[code], sizeof(value));
+                bytes[0] = static_cast<std::byte>(value >> 8);
+                bytes[1] = static_cast<std::byte>(value & 0xFF);
+            }
+            else
+            {
+                ::memcpy(bytes, (*lut)[code], mNumBytesPerPixel);
+            }
+        }
+        else if (mNumBytesPerPixel == 2)
+        {
+            bytes[0] = static_cast<std::byte>(code >> 8);
+            bytes[1] = static_cast<std::byte>(code & 0xFF);
+        }
+        else
+        {
+            // MONO8I, or gray RGB24I
+            std::fill_n(bytes, mNumBytesPerPixel,
+                        static_cast<std::byte>(code));
+        }
+    }
+}
+
+void DisplayRemapper::remap(std::span<const float> detected,
+                            std::span<std::byte> pixels) const
+{
+    if (pixels.size() != detected.size() * mNumBytesPerPixel)
+    {
+        throw except::Exception(Ctxt(
+                "Expected " +
+                std::to_string(detected.size() * mNumBytesPerPixel) +
+                " output bytes but got " + std::to_string(pixels.size())));
+    }
+
+    const float low = static_cast<float>(mLow);
+    const float maxCode = static_cast<float>(mNumCodes - 1);
+    const std::byte* const codeBytes = mCodeBytes.data();
+    std::byte* const out = pixels.data();
+    for (size_t ii = 0; ii < detected.size(); ++ii)
+    {
+        // Written so NaNs land on code 0
+        const float scaled = std::min(
+                std::max(0.0f, (detected[ii] - low) * mScale), maxCode);
+        const size_t code = static_cast<size_t>(scaled + 0.5f);
+        switch (mNumBytesPerPixel)
+        {
+        case 1:
+            out[ii] = codeBytes[code];
+            break;
+        case 2:
+            out[2 * ii] = codeBytes[2 * code];
+            out[2 * ii + 1] = codeBytes[2 * code + 1];
+            break;
+        default:
+            out[3 * ii] = codeBytes[3 * code];
+            out[3 * ii + 1] = codeBytes[3 * code + 1];
+            out[3 * ii + 2] = codeBytes[3 * code + 2];
+        }
+    }
+}
+
+ProductGenerator::ProductGenerator(const DerivedData& derivedData,
+                                   const std::vector<std::string>& schemaPaths,
+                                   const Options& options) :
+    mDerivedData(derivedData),
+    mSchemaPaths(schemaPaths),
+    mOptions(options)
+{
+    if (!mDerivedData.display.get())
+    {
+        throw except::Exception(Ctxt("DerivedData has no Display"));
+    }
+
+    // Fail now rather than after reading the SICD
+    getNumProductBytesPerPixel(mDerivedData.display->pixelType);
+}
+
+ProductGenerator::ProductGenerator(const DerivedData& derivedData,
+                                   const std::vector<std::string>& schemaPaths) :
+    ProductGenerator(derivedData, schemaPaths, Options())
+{
+}
+
+size_t ProductGenerator::getNumRowsPerBand(size_t numCols,
+                                           PixelType sicdPixelType) const
+{
+    // Two input bands (one being read while the other is processed), the
+    // detected band and the output band
+    const size_t bytesPerRow = numCols *
+            (2 * getNumSICDBytesPerPixel(sicdPixelType) + sizeof(float) +
+             getNumProductBytesPerPixel(mDerivedData.display->pixelType));
+    return std::max<size_t>(mOptions.maxMemoryBytes / bytesPerRow, 1);
+}
+
+void ProductGenerator::detect(std::span<const std::complex<float> > input,
+                              Detection detection,
+                              std::span<float> output)
+{
+    checkDetectSizes(input.size(), output.size());
+    detectIQ(reinterpret_cast<const float*>(input.data()), input.size(),
+             detection, output.data());
+}
+
+void ProductGenerator::detect(std::span<const int16_t> input,
+                              Detection detection,
+                              std::span<float> output)
+{
+    checkDetectSizes(input.size() / 2, output.size());
+    detectIQ(input.data(), output.size(), detection, output.data());
+}
+
+void ProductGenerator::detect(std::span<const uint8_t> input,
+                              const float* amplitudes,
+                              Detection detection,
+                              std::span<float> output)
+{
+    checkDetectSizes(input.size() / 2, output.size());
+    const uint8_t* const pixels = input.data();
+    float* const out = output.data();
+    if (detection == Detection::POWER)
+    {
+        for (size_t ii = 0; ii < output.size(); ++ii)
+        {
+            const float amplitude = amplitudes[pixels[2 * ii]];
+            out[ii] = amplitude * amplitude;
+        }
+    }
+    else
+    {
+        for (size_t ii = 0; ii < output.size(); ++ii)
+        {
+            out[ii] = amplitudes[pixels[2 * ii]];
+        }
+    }
+}
+
+void ProductGenerator::generate(NITFReadControl& sicdReader,
+                                const std::string& outputPathname)
+{
+    io::FileOutputStream outStream(outputPathname);
+    generate(sicdReader, outStream);
+    outStream.close();
+}
+
+void ProductGenerator::generate(NITFReadControl& sicdReader,
+                                io::SeekableOutputStream& outStream)
+{
+    const Clock::time_point start = Clock::now();
+    mTimings = Timings();
+
+    const std::shared_ptr<const Container> container =
+            sicdReader.getContainer();
+    const Data* const sicd = (container && !container->empty()) ?
+            container->getData(0) : nullptr;
+    if (!sicd || sicd->getDataType() != DataType::COMPLEX)
+    {
+        throw except::Exception(Ctxt("Reader hasn't loaded a SICD"));
+    }
+
+    Input input;
+    input.reader = &sicdReader;
+    input.pixelType = sicd->getPixelType();
+    input.numRows = sicd->getNumRows();
+    input.numCols = sicd->getNumCols();
+    if (input.numRows != mDerivedData.getNumRows() ||
+        input.numCols != mDerivedData.getNumCols())
+    {
+        throw except::Exception(Ctxt(
+                "SICD is " + std::to_string(input.numRows) + " x " +
+                std::to_string(input.numCols) + " but the SIDD is " +
+                std::to_string(mDerivedData.getNumRows()) + " x " +
+                std::to_string(mDerivedData.getNumCols())));
+    }
+
+    const AmplitudeTable* const amplitudeTable = sicd->getAmplitudeTable();
+    for (size_t ii = 0; ii < 256; ++ii)
+    {
+        input.amplitudes[ii] = amplitudeTable ?
+                static_cast<float>(amplitudeTable->index(ii)) :
+                static_cast<float>(ii);
+    }
+
+    input.numRowsPerBand = std::min(
+            getNumRowsPerBand(input.numCols, input.pixelType), input.numRows);
+    mTimings.numRowsPerBand = input.numRowsPerBand;
+
+    const size_t numThreads = getNumThreads(mOptions.numThreads);
+    const size_t numBandPixels = input.numRowsPerBand * input.numCols;
+    Band bands[2];
+    for (Band& band : bands)
+    {
+        band.pixels.resize(numBandPixels *
+                           getNumSICDBytesPerPixel(input.pixelType));
+    }
+    std::vector<float> detected(numBandPixels);
+
+    // Dynamic range adjustment
+    const Display& display = *mDerivedData.display;
+    const DynamicRangeAdjustment* const dra = getDRA(display);
+    double low = 0.0;
+    double high = 0.0;
+    if (usesOverrides(dra))
+    {
+        low = dra->draOverrides->subtractor;
+        high = (dra->draOverrides->multiplier > 0.0) ?
+                low + (getNumRemapCodes(display) - 1) /
+                        dra->draOverrides->multiplier :
+                low;
+    }
+    else
+    {
+        std::vector<DRAHistogram> partials(numThreads);
+        auto accumulate = [&](const Band& band)
+        {
+            Clock::time_point stageStart = Clock::now();
+            detectBand(input, band, mOptions.detection, numThreads,
+                       std::span<float>(detected.data(), detected.size()));
+            mTimings.detect += secondsSince(stageStart);
+
+            stageStart = Clock::now();
+            runChunks(band.numRows * input.numCols, numThreads,
+                      [&](size_t chunk, size_t begin, size_t end)
+            {
+                partials[chunk].add(std::span<const float>(
+                        detected.data() + begin, end - begin));
+            });
+            mTimings.statistics += secondsSince(stageStart);
+            mTimings.numStatisticsRows += band.numRows;
+        };
+
+        const size_t maxRows = mOptions.maxStatisticsRows;
+        if (maxRows == 0 || maxRows >= input.numRows)
+        {
+            streamBands(input, bands, mTimings.read, accumulate);
+        }
+        else
+        {
+            // Evenly spaced rows, gathered a band at a time
+            const size_t numRowBytes = input.numCols *
+                    getNumSICDBytesPerPixel(input.pixelType);
+            Band& band = bands[0];
+            for (size_t sample = 0; sample < maxRows;)
+            {
+                const Clock::time_point readStart = Clock::now();
+                band.numRows = 0;
+                for (; band.numRows < input.numRowsPerBand &&
+                       sample < maxRows;
+                     ++band.numRows, ++sample)
+                {
+                    const size_t row = (2 * sample + 1) * input.numRows /
+                            (2 * maxRows);
+                    readRows(input, row, 1,
+                             band.pixels.data() + band.numRows * numRowBytes);
+                }
+                mTimings.read += secondsSince(readStart);
+                accumulate(band);
+            }
+        }
+
+        const Clock::time_point stageStart = Clock::now();
+        const DRAHistogram histogram = DRAHistogram::merge(
+                std::span<const DRAHistogram>(partials.data(),
+                                              partials.size()),
+                numThreads);
+        if (histogram.getNumValues() > 0)
+        {
+            low = histogram.getMin();
+            high = histogram.getMax();
+        }
+        if (dra && dra->algorithmType != DRAType::NONE &&
+            dra->draParameters.get())
+        {
+            histogram.getStretch(*dra->draParameters, low, high);
+        }
+        if (mTimings.numStatisticsRows < input.numRows)
+        {
+            mTimings.statisticsRankError = DRAHistogram::getSampledRankError(
+                    histogram.getNumValues());
+        }
+        mTimings.statistics += secondsSince(stageStart);
+    }
+
+    const DisplayRemapper remapper(display, low, high);
+    std::vector<std::byte> product(numBandPixels *
+                                   remapper.getNumBytesPerPixel());
+    mTimings.bufferBytes = 2 * bands[0].pixels.size() +
+            detected.size() * sizeof(float) + product.size();
+
+    Clock::time_point stageStart = Clock::now();
+    const SIDDByteProvider byteProvider(mDerivedData, mSchemaPaths);
+    mTimings.write += secondsSince(stageStart);
+
+    streamBands(input, bands, mTimings.read, [&](const Band& band)
+    {
+        const size_t numPixels = band.numRows * input.numCols;
+
+        Clock::time_point stageStart = Clock::now();
+        detectBand(input, band, mOptions.detection, numThreads,
+                   std::span<float>(detected.data(), detected.size()));
+        mTimings.detect += secondsSince(stageStart);
+
+        stageStart = Clock::now();
+        runChunks(numPixels, numThreads,
+                  [&](size_t, size_t begin, size_t end)
+        {
+            const size_t numBytesPerPixel = remapper.getNumBytesPerPixel();
+            remapper.remap(
+                    std::span<const float>(detected.data() + begin,
+                                           end - begin),
+                    std::span<std::byte>(
+                            product.data() + begin * numBytesPerPixel,
+                            (end - begin) * numBytesPerPixel));
+        });
+        mTimings.remap += secondsSince(stageStart);
+
+        stageStart = Clock::now();
+        nitf::NITFBufferList buffers;
+        nitf::Off fileOffset;
+        byteProvider.getBytes(product.data(), band.startRow, band.numRows,
+                              fileOffset, buffers);
+        outStream.seek(fileOffset, io::Seekable::START);
+        for (const nitf::NITFBuffer& buffer : buffers.mBuffers)
+        {
+            outStream.write(static_cast<const std::byte*>(buffer.mData),
+                            buffer.mNumBytes);
+        }
+        mTimings.write += secondsSince(stageStart);
+
+        ++mTimings.numBands;
+    });
+
+    mTimings.total = secondsSince(start);
+}
+}
+}
@@ -0,0 +1,760 @@
+/* =========================================================================
+ * This file is part of six.sidd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six.sidd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <six/sidd/RRDSGenerator.h>
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <thread>
+
+#include <std/cstddef>
+
+#include <except/Exception.h>
+#include <io/FileOutputStream.h>
+#include <mt/Runnable1D.h>
+#include <six/Init.h>
+#include <six/Region.h>
+#include <six/sidd/PolyphaseResampler.h>
+#include <six/sidd/SIDDByteProvider.h>
+
+namespace
+{
+ptrdiff_t clamp(ptrdiff_t index, ptrdiff_t size)
+{
+    return std::min(std::max<ptrdiff_t>(index, 0), size - 1);
+}
+
+size_t getNumThreads(size_t numThreads)
+{
+    if (numThreads == 0)
+    {
+        numThreads = std::thread::hardware_concurrency();
+    }
+    return std::max<size_t>(numThreads, 1);
+}
+
+// op(begin, end) over a split of [0, numElements) across threads
+template <typename OpT>
+void runChunks(size_t numElements, size_t numThreads, const OpT& op)
+{
+    const size_t numChunks = std::min(numThreads, numElements);
+    mt::run1D(numChunks, numThreads, [&](size_t chunk)
+    {
+        op(numElements * chunk / numChunks,
+           numElements * (chunk + 1) / numChunks);
+    });
+}
+
+size_t getNumBytesPerPixel(six::PixelType pixelType)
+{
+    switch (pixelType)
+    {
+    case six::PixelType::MONO8I:
+    case six::PixelType::MONO8LU:
+    case six::PixelType::RGB8LU:
+        return 1;
+    case six::PixelType::MONO16I:
+        return 2;
+    case six::PixelType::RGB24I:
+        return 3;
+    default:
+        throw except::Exception(Ctxt(
+                "Unsupported SIDD pixel type " + pixelType.toString()));
+    }
+}
+
+bool isLookupPixelType(six::PixelType pixelType)
+{
+    return pixelType == six::PixelType::MONO8LU ||
+           pixelType == six::PixelType::RGB8LU;
+}
+
+/*
+ * The RRDS from the Display's NonInteractiveProcessing, or for SIDD 1.0
+ * (which has none) the closest match to the recommended decimation method
+ */
+six::sidd::RRDS getRRDS(const six::sidd::Display& display)
+{
+    if (!display.nonInteractiveProcessing.empty() &&
+        display.nonInteractiveProcessing[0].get())
+    {
+        return display.nonInteractiveProcessing[0]->rrds;
+    }
+
+    six::sidd::RRDS rrds;
+    if (display.decimationMethod == six::DecimationMethod::NEAREST_NEIGHBOR)
+    {
+        rrds.downsamplingMethod =
+                six::sidd::DownsamplingMethod::NEAREST_NEIGHBOR;
+    }
+    else if (display.decimationMethod == six::DecimationMethod::BILINEAR)
+    {
+        rrds.downsamplingMethod = six::sidd::DownsamplingMethod::BILINEAR;
+    }
+    else if (display.decimationMethod ==
+             six::DecimationMethod::BRIGHTEST_PIXEL)
+    {
+        rrds.downsamplingMethod = six::sidd::DownsamplingMethod::MAX_PIXEL;
+    }
+    else if (display.decimationMethod == six::DecimationMethod::LAGRANGE)
+    {
+        rrds.downsamplingMethod = six::sidd::DownsamplingMethod::LAGRANGE;
+    }
+    else
+    {
+        rrds.downsamplingMethod = six::sidd::DownsamplingMethod::DECIMATE;
+    }
+    return rrds;
+}
+
+// poly(factor * row + shift, factor * col + shift)
+six::Poly2D scaleInput(const six::Poly2D& poly, double factor, double shift)
+{
+    if (poly.empty())
+    {
+        return poly;
+    }
+    const double coeffs[] = {shift, factor};
+    return poly.transformInput(six::Poly2D(1, 0, coeffs),
+                               six::Poly2D(0, 1, coeffs));
+}
+
+// (poly - shift) / factor
+six::Poly2D scaleOutput(const six::Poly2D& poly, double factor, double shift)
+{
+    six::Poly2D scaled(poly);
+    if (!scaled.empty())
+    {
+        scaled.coeffs()[0][0] -= shift;
+        scaled /= factor;
+    }
+    return scaled;
+}
+
+// Quantizes float channels to interleaved, big endian SIDD pixels
+void quantize(const std::vector<std::vector<float> >& channels,
+              size_t numPixels,
+              size_t numBytesPerPixel,
+              std::byte* pixels)
+{
+    const float maxValue = (numBytesPerPixel == 2) ? 65535.0f : 255.0f;
+    auto toCode = [maxValue](float value)
+    {
+        return static_cast<uint32_t>(
+                std::min(std::max(value + 0.5f, 0.0f), maxValue));
+    };
+
+    if (numBytesPerPixel == 2)
+    {
+        const float* const in = channels[0].data();
+        for (size_t ii = 0; ii < numPixels; ++ii)
+        {
+            const uint32_t code = toCode(in[ii]);
+            pixels[2 * ii] = static_cast<std::byte>(code >> 8);
+            pixels[2 * ii + 1] = static_cast<std::byte>(code & 0xFF);
+        }
+        return;
+    }
+
+    const size_t numChannels = channels.size();
+    for (size_t channel = 0; channel < numChannels; ++channel)
+    {
+        const float* const in = channels[channel].data();
+        for (size_t ii = 0; ii < numPixels; ++ii)
+        {
+            pixels[ii * numChannels + channel] =
+                    static_cast<std::byte>(toCode(in[ii]));
+        }
+    }
+}
+}
+
+namespace six
+{
+namespace sidd
+{
+void RRDSReducer::Rows::append(const float* rows,
+                               size_t count,
+                               size_t numCols)
+{
+    pixels.insert(pixels.end(), rows, rows + count * numCols);
+    numRows += count;
+}
+
+void RRDSReducer::Rows::discardBefore(size_t index, size_t numCols)
+{
+    const size_t count = std::min(index > begin ? index - begin : 0,
+                                  numRows);
+    pixels.erase(pixels.begin(), pixels.begin() + count * numCols);
+    begin += count;
+    numRows -= count;
+}
+
+RRDSReducer::RRDSReducer(const RRDS& rrds,
+                         const types::RowCol<size_t>& inputDims,
+                         size_t numThreads) :
+    mInputDims(inputDims),
+    mOutputDims((inputDims.row + 1) / 2, (inputDims.col + 1) / 2),
+    mNumThreads(getNumThreads(numThreads)),
+    mMaxPixel(false),
+    mFirstTap(0),
+    mOffset(0.0),
+    mNumInputRows(0),
+    mNumFilteredRows(0),
+    mNumOutputRows(0)
+{
+    if (inputDims.area() == 0)
+    {
+        throw except::Exception(Ctxt("Can't reduce an empty image"));
+    }
+
+    const DownsamplingMethod method = rrds.downsamplingMethod;
+    if (method == DownsamplingMethod::DECIMATE ||
+        method == DownsamplingMethod::NEAREST_NEIGHBOR)
+    {
+        mTaps = {1.0f};
+    }
+    else if (method == DownsamplingMethod::MAX_PIXEL)
+    {
+        mMaxPixel = true;
+        mTaps = {1.0f, 1.0f};
+        mOffset = 0.5;
+    }
+    else if (method == DownsamplingMethod::AVERAGE)
+    {
+        mTaps = {0.5f, 0.5f};
+        mOffset = 0.5;
+    }
+    else if (method == DownsamplingMethod::BILINEAR ||
+             method == DownsamplingMethod::LAGRANGE)
+    {
+        const PolyphaseResampler resampler = rrds.interpolation.get() ?
+                PolyphaseResampler(*rrds.interpolation) :
+                PolyphaseResampler(
+                        PolyphaseResampler::createBank(
+                                method == DownsamplingMethod::BILINEAR ?
+                                        FilterDatabaseName::BILINEAR :
+                                        FilterDatabaseName::LAGRANGE,
+                                2),
+                        FilterOperation::CORRELATION);
+        const size_t numPhasings = resampler.getNumPhasings();
+        const size_t phase = (numPhasings + 1) / 2 % numPhasings;
+        const std::span<const float> taps = resampler.getPhase(phase);
+        mTaps.assign(taps.begin(), taps.end());
+        mFirstTap = -static_cast<ptrdiff_t>(resampler.getNumPoints() - 1) / 2;
+        mOffset = static_cast<double>(phase) / numPhasings;
+    }
+    else
+    {
+        throw except::Exception(Ctxt(
+                "Unsupported downsampling method " + method.toString()));
+    }
+
+    if (rrds.antiAlias.get() &&
+        method != DownsamplingMethod::DECIMATE &&
+        method != DownsamplingMethod::MAX_PIXEL)
+    {
+        mAntiAlias.reset(new KernelFilter(*rrds.antiAlias));
+    }
+}
+
+ptrdiff_t RRDSReducer::getFirstRow(size_t outputRow) const
+{
+    return 2 * static_cast<ptrdiff_t>(outputRow) + mFirstTap;
+}
+
+ptrdiff_t RRDSReducer::getLastRow(size_t outputRow) const
+{
+    return getFirstRow(outputRow) + static_cast<ptrdiff_t>(mTaps.size()) - 1;
+}
+
+size_t RRDSReducer::push(std::span<const float> rows,
+                         std::vector<float>& reduced)
+{
+    const size_t numCols = mInputDims.col;
+    const size_t numRows = rows.size() / numCols;
+    if (numRows * numCols != rows.size() ||
+        mNumInputRows + numRows > mInputDims.row)
+    {
+        throw except::Exception(Ctxt(
+                "Can't add " + std::to_string(rows.size()) + " pixels to a " +
+                std::to_string(mInputDims.row) + " x " +
+                std::to_string(numCols) + " image with " +
+                std::to_string(mNumInputRows) + " rows"));
+    }
+    mNumInputRows += numRows;
+
+    if (mAntiAlias.get())
+    {
+        mInput.append(rows.data(), numRows, numCols);
+        antiAlias(mNumInputRows);
+    }
+    else
+    {
+        mFiltered.append(rows.data(), numRows, numCols);
+        mNumFilteredRows = mNumInputRows;
+    }
+
+    // Output rows whose input rows have all arrived
+    const bool allFiltered = (mNumFilteredRows == mInputDims.row);
+    size_t endRow = mNumOutputRows;
+    while (endRow < mOutputDims.row &&
+           (allFiltered ||
+            getLastRow(endRow) < static_cast<ptrdiff_t>(mNumFilteredRows)))
+    {
+        ++endRow;
+    }
+    const size_t numOutputRows = endRow - mNumOutputRows;
+    if (numOutputRows > 0)
+    {
+        reduce(numOutputRows, reduced);
+        mNumOutputRows = endRow;
+        if (mNumOutputRows < mOutputDims.row)
+        {
+            mFiltered.discardBefore(
+                    clamp(getFirstRow(mNumOutputRows), mInputDims.row),
+                    numCols);
+        }
+    }
+    return numOutputRows;
+}
+
+void RRDSReducer::antiAlias(size_t numInputRows)
+{
+    const size_t numCols = mInputDims.col;
+    const size_t center = mAntiAlias->getCenter().row;
+    const size_t after = mAntiAlias->getSize().row - center - 1;
+
+    // Filtered rows whose input rows have all arrived
+    const size_t endRow = (numInputRows == mInputDims.row) ?
+            numInputRows :
+            (numInputRows > after ? numInputRows - after : 0);
+    if (endRow <= mNumFilteredRows)
+    {
+        return;
+    }
+
+    // The kept input rows start at or before the first one needed, and
+    // end at the last one received, so they filter like the whole image
+    const size_t startRow = mNumFilteredRows;
+    const size_t numRows = endRow - startRow;
+    const types::RowCol<size_t> bandDims(mInput.numRows, numCols);
+    const std::span<const float> band(mInput.pixels.data(),
+                                      mInput.pixels.size());
+    const size_t offset = mFiltered.pixels.size();
+    mFiltered.pixels.resize(offset + numRows * numCols);
+    mFiltered.numRows += numRows;
+    float* const filtered = mFiltered.pixels.data() + offset;
+    runChunks(numRows, mNumThreads, [&](size_t begin, size_t end)
+    {
+        mAntiAlias->applyRows(
+                band, bandDims, startRow + begin - mInput.begin, end - begin,
+                std::span<float>(filtered + begin * numCols,
+                                 (end - begin) * numCols));
+    });
+    mNumFilteredRows = endRow;
+
+    if (endRow < mInputDims.row)
+    {
+        mInput.discardBefore(endRow > center ? endRow - center : 0, numCols);
+    }
+}
+
+void RRDSReducer::reduce(size_t numOutputRows,
+                         std::vector<float>& reduced) const
+{
+    const size_t offset = reduced.size();
+    reduced.resize(offset + numOutputRows * mOutputDims.col);
+    runChunks(numOutputRows, mNumThreads, [&](size_t begin, size_t end)
+    {
+        std::vector<float> scratch(mInputDims.col);
+        for (size_t ii = begin; ii < end; ++ii)
+        {
+            reduceRow(mNumOutputRows + ii, scratch.data(),
+                      &reduced[offset + ii * mOutputDims.col]);
+        }
+    });
+}
+
+void RRDSReducer::reduceRow(size_t outputRow,
+                            float* scratch,
+                            float* output) const
+{
+    const ptrdiff_t numRows = static_cast<ptrdiff_t>(mInputDims.row);
+    const ptrdiff_t numCols = static_cast<ptrdiff_t>(mInputDims.col);
+    const ptrdiff_t numTaps = static_cast<ptrdiff_t>(mTaps.size());
+    const ptrdiff_t firstRow = getFirstRow(outputRow);
+
+    // Down the column...
+    if (mMaxPixel)
+    {
+        const float* const top = mFiltered.row(clamp(firstRow, numRows),
+                                               numCols);
+        const float* const bottom = mFiltered.row(
+                clamp(firstRow + 1, numRows), numCols);
+        for (ptrdiff_t col = 0; col < numCols; ++col)
+        {
+            scratch[col] = std::max(top[col], bottom[col]);
+        }
+    }
+    else
+    {
+        std::fill(scratch, scratch + numCols, 0.0f);
+        for (ptrdiff_t tap = 0; tap < numTaps; ++tap)
+        {
+            const float coef = mTaps[tap];
+            const float* const in = mFiltered.row(
+                    clamp(firstRow + tap, numRows), numCols);
+            for (ptrdiff_t col = 0; col < numCols; ++col)
+            {
+                scratch[col] += coef * in[col];
+            }
+        }
+    }
+
+    // ...then along the row
+    const ptrdiff_t numOutputCols = static_cast<ptrdiff_t>(mOutputDims.col);
+    for (ptrdiff_t col = 0; col < numOutputCols; ++col)
+    {
+        const ptrdiff_t firstCol = 2 * col + mFirstTap;
+        if (mMaxPixel)
+        {
+            output[col] = std::max(scratch[firstCol],
+                                   scratch[clamp(firstCol + 1, numCols)]);
+        }
+        else if (firstCol >= 0 && firstCol + numTaps <= numCols)
+        {
+            float sum = 0.0f;
+            for (ptrdiff_t tap = 0; tap < numTaps; ++tap)
+            {
+                sum += mTaps[tap] * scratch[firstCol + tap];
+            }
+            output[col] = sum;
+        }
+        else
+        {
+            float sum = 0.0f;
+            for (ptrdiff_t tap = 0; tap < numTaps; ++tap)
+            {
+                sum += mTaps[tap] * scratch[clamp(firstCol + tap, numCols)];
+            }
+            output[col] = sum;
+        }
+    }
+}
+
+RRDSGenerator::RRDSGenerator(const DerivedData& derivedData,
+                             const std::vector<std::string>& schemaPaths) :
+    RRDSGenerator(derivedData, schemaPaths, Options())
+{
+}
+
+RRDSGenerator::RRDSGenerator(const DerivedData& derivedData,
+                             const std::vector<std::string>& schemaPaths,
+                             const Options& options) :
+    mDerivedData(derivedData),
+    mSchemaPaths(schemaPaths),
+    mOptions(options),
+    mRRDS(getRRDS(*derivedData.display)),
+    mNumChannels(derivedData.getPixelType() == PixelType::RGB24I ? 3 : 1)
+{
+    // Throws for anything but a SIDD pixel type
+    const PixelType pixelType = derivedData.getPixelType();
+    getNumBytesPerPixel(pixelType);
+    if (isLookupPixelType(pixelType))
+    {
+        mRRDS = RRDS();
+        mRRDS.downsamplingMethod = DownsamplingMethod::DECIMATE;
+    }
+
+    // Full resolution position of each level's pixel 0
+    types::RowCol<size_t> dims(derivedData.getNumRows(),
+                               derivedData.getNumCols());
+    double factor = 1.0;
+    double shift = 0.0;
+    while ((options.numLevels > 0) ?
+                   mLevels.size() < options.numLevels :
+                   std::max(dims.row, dims.col) > options.minSize)
+    {
+        if (dims.row <= 1 && dims.col <= 1)
+        {
+            break;
+        }
+
+        // Checks the filters as well
+        const RRDSReducer reducer(mRRDS, dims, 1);
+        shift += factor * reducer.getOffset();
+        factor *= 2.0;
+
+        Level level;
+        level.inputDims = dims;
+        dims = reducer.getOutputDims();
+        level.derivedData = reduce(derivedData, dims, factor, shift);
+        mLevels.push_back(std::move(level));
+    }
+}
+
+const DerivedData& RRDSGenerator::getDerivedData(size_t level) const
+{
+    if (level == 0 || level > mLevels.size())
+    {
+        throw except::Exception(Ctxt(
+                "Level " + std::to_string(level) + " isn't in [1, " +
+                std::to_string(mLevels.size()) + "]"));
+    }
+    return *mLevels[level - 1].derivedData;
+}
+
+std::string RRDSGenerator::getPathname(const std::string& siddPathname,
+                                       size_t level)
+{
+    const std::string suffix = "_rrds" + std::to_string(level);
+    const std::string::size_type slash = siddPathname.find_last_of("/\\");
+    const std::string::size_type dot = siddPathname.rfind('.');
+    if (dot == std::string::npos ||
+        (slash != std::string::npos && dot < slash))
+    {
+        return siddPathname + suffix + ".nitf";
+    }
+    return siddPathname.substr(0, dot) + suffix + siddPathname.substr(dot);
+}
+
+std::unique_ptr<DerivedData> RRDSGenerator::reduce(
+        const DerivedData& derivedData,
+        const types::RowCol<size_t>& dims,
+        double factor,
+        double shift)
+{
+    std::unique_ptr<DerivedData> reduced(
+            static_cast<DerivedData*>(derivedData.clone()));
+    Measurement& measurement = *reduced->measurement;
+    measurement.setPixelFootprint(dims);
+
+    Projection* const projection = measurement.projection.get();
+    if (projection)
+    {
+        RowColDouble& rowCol = projection->referencePoint.rowCol;
+        rowCol.row = (rowCol.row - shift) / factor;
+        rowCol.col = (rowCol.col - shift) / factor;
+
+        if (projection->isMeasurable())
+        {
+            MeasurableProjection& measurable =
+                    static_cast<MeasurableProjection&>(*projection);
+            measurable.sampleSpacing.row *= factor;
+            measurable.sampleSpacing.col *= factor;
+            measurable.timeCOAPoly =
+                    scaleInput(measurable.timeCOAPoly, factor, shift);
+        }
+        else if (projection->projectionType == ProjectionType::POLYNOMIAL)
+        {
+            PolynomialProjection& polynomial =
+                    static_cast<PolynomialProjection&>(*projection);
+            polynomial.rowColToLat =
+                    scaleInput(polynomial.rowColToLat, factor, shift);
+            polynomial.rowColToLon =
+                    scaleInput(polynomial.rowColToLon, factor, shift);
+            polynomial.rowColToAlt =
+                    scaleInput(polynomial.rowColToAlt, factor, shift);
+            polynomial.latLonToRow =
+                    scaleOutput(polynomial.latLonToRow, factor, shift);
+            polynomial.latLonToCol =
+                    scaleOutput(polynomial.latLonToCol, factor, shift);
+        }
+    }
+
+    for (RowColInt& vertex : measurement.validData)
+    {
+        vertex.row = clamp(std::llround((vertex.row - shift) / factor),
+                           static_cast<ptrdiff_t>(dims.row));
+        vertex.col = clamp(std::llround((vertex.col - shift) / factor),
+                           static_cast<ptrdiff_t>(dims.col));
+    }
+    return reduced;
+}
+
+std::vector<std::string> RRDSGenerator::generate(
+        NITFReadControl& siddReader,
+        const std::string& siddPathname)
+{
+    std::vector<std::string> pathnames;
+    std::vector<std::unique_ptr<io::FileOutputStream> > streams;
+    std::vector<io::SeekableOutputStream*> outStreams;
+    for (size_t level = 1; level <= mLevels.size(); ++level)
+    {
+        pathnames.push_back(getPathname(siddPathname, level));
+        streams.emplace_back(new io::FileOutputStream(pathnames.back()));
+        outStreams.push_back(streams.back().get());
+    }
+
+    generate(siddReader, outStreams);
+    for (auto& stream : streams)
+    {
+        stream->close();
+    }
+    return pathnames;
+}
+
+void RRDSGenerator::generate(
+        NITFReadControl& siddReader,
+        const std::vector<io::SeekableOutputStream*>& outStreams)
+{
+    if (outStreams.size() != mLevels.size())
+    {
+        throw except::Exception(Ctxt(
+                "Expected " + std::to_string(mLevels.size()) +
+                " output streams but got " +
+                std::to_string(outStreams.size())));
+    }
+
+    const std::shared_ptr<const Container> container =
+            siddReader.getContainer();
+    const Data* const sidd = (container && !container->empty()) ?
+            container->getData(0) : nullptr;
+    if (!sidd || sidd->getDataType() != DataType::DERIVED)
+    {
+        throw except::Exception(Ctxt("Reader hasn't loaded a SIDD"));
+    }
+    const PixelType pixelType = mDerivedData.getPixelType();
+    const size_t numRows = mDerivedData.getNumRows();
+    const size_t numCols = mDerivedData.getNumCols();
+    if (sidd->getNumRows() != numRows || sidd->getNumCols() != numCols ||
+        sidd->getPixelType() != pixelType)
+    {
+        throw except::Exception(Ctxt(
+                "The SIDD being read doesn't match the one being reduced"));
+    }
+
+    // Fresh reducers and byte providers for each level
+    std::vector<std::vector<std::unique_ptr<RRDSReducer> > > reducers;
+    std::vector<std::unique_ptr<SIDDByteProvider> > byteProviders;
+    for (const Level& level : mLevels)
+    {
+        reducers.emplace_back();
+        for (size_t channel = 0; channel < mNumChannels; ++channel)
+        {
+            reducers.back().emplace_back(new RRDSReducer(
+                    mRRDS, level.inputDims, mOptions.numThreads));
+        }
+        byteProviders.emplace_back(
+                new SIDDByteProvider(*level.derivedData, mSchemaPaths));
+    }
+    std::vector<size_t> numRowsWritten(mLevels.size(), 0);
+
+    const size_t numBytesPerPixel = getNumBytesPerPixel(pixelType);
+    const size_t numRowsPerBand = std::min(
+            std::max<size_t>(mOptions.maxMemoryBytes /
+                             (numCols * (numBytesPerPixel +
+                                         mNumChannels * sizeof(float))),
+                             1),
+            numRows);
+    std::vector<std::byte> band(numRowsPerBand * numCols * numBytesPerPixel);
+    std::vector<std::vector<float> > channels(mNumChannels);
+    std::vector<std::vector<float> > reduced(mNumChannels);
+    std::vector<std::byte> pixels;
+
+    for (size_t startRow = 0; startRow < numRows; startRow += numRowsPerBand)
+    {
+        const size_t numBandRows = std::min(numRowsPerBand,
+                                            numRows - startRow);
+        Region region;
+        region.setStartRow(static_cast<ptrdiff_t>(startRow));
+        region.setNumRows(static_cast<ptrdiff_t>(numBandRows));
+        region.setStartCol(0);
+        region.setNumCols(static_cast<ptrdiff_t>(numCols));
+        region.setBuffer(band.data());
+        siddReader.interleaved(region, 0);
+
+        // Native byte order from the reader, one plane per channel
+        const size_t numPixels = numBandRows * numCols;
+        for (size_t channel = 0; channel < mNumChannels; ++channel)
+        {
+            channels[channel].resize(numPixels);
+        }
+        if (numBytesPerPixel == 2)
+        {
+            const uint16_t* const in =
+                    reinterpret_cast<const uint16_t*>(band.data());
+            std::copy(in, in + numPixels, channels[0].begin());
+        }
+        else
+        {
+            const uint8_t* const in =
+                    reinterpret_cast<const uint8_t*>(band.data());
+            for (size_t channel = 0; channel < mNumChannels; ++channel)
+            {
+                float* const out = channels[channel].data();
+                for (size_t ii = 0; ii < numPixels; ++ii)
+                {
+                    out[ii] = in[ii * mNumChannels + channel];
+                }
+            }
+        }
+
+        // Each level's new rows feed the next level
+        for (size_t level = 0; level < mLevels.size(); ++level)
+        {
+            size_t numReducedRows = 0;
+            for (size_t channel = 0; channel < mNumChannels; ++channel)
+            {
+                reduced[channel].clear();
+                numReducedRows = reducers[level][channel]->push(
+                        std::span<const float>(channels[channel].data(),
+                                               channels[channel].size()),
+                        reduced[channel]);
+            }
+            if (numReducedRows == 0)
+            {
+                break;
+            }
+
+            const size_t numReducedCols =
+                    reducers[level][0]->getOutputDims().col;
+            pixels.resize(numReducedRows * numReducedCols *
+                          numBytesPerPixel);
+            quantize(reduced, numReducedRows * numReducedCols,
+                     numBytesPerPixel, pixels.data());
+
+            nitf::NITFBufferList buffers;
+            nitf::Off fileOffset;
+            byteProviders[level]->getBytes(pixels.data(),
+                                           numRowsWritten[level],
+                                           numReducedRows,
+                                           fileOffset, buffers);
+            io::SeekableOutputStream& outStream = *outStreams[level];
+            outStream.seek(fileOffset, io::Seekable::START);
+            for (const nitf::NITFBuffer& buffer : buffers.mBuffers)
+            {
+                outStream.write(static_cast<const std::byte*>(buffer.mData),
+                                buffer.mNumBytes);
+            }
+            numRowsWritten[level] += numReducedRows;
+
+            std::swap(channels, reduced);
+        }
+    }
+}
+}
+}
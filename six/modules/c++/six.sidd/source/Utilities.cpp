@@ -26,6 +26,7 @@
 #include <str/EncodedStringView.h>
 
 #include "six/Utilities.h"
+#include "six/BinaryXML.h"
 #include "six/sidd/DerivedXMLControl.h"
 #include "six/sidd/DerivedDataBuilder.h"
 
@@ -606,6 +607,22 @@ std::u8string Utilities::toXMLString(const DerivedData& data,
     return ::six::toValidXMLString(data, pSchemaPaths, pLogger_, &xmlRegistry);
 }
 
+std::vector<std::byte> Utilities::toBinary(const DerivedData& data, logging::Logger* pLogger)
+{
+    XMLControlRegistry xmlRegistry;
+    xmlRegistry.addCreator<DerivedXMLControl>();
+    return ::six::toBinary(data, &xmlRegistry, pLogger);
+}
+std::unique_ptr<DerivedData> Utilities::parseDataFromBinary(std::span<const std::byte> bytes,
+    const std::vector<std::filesystem::path>* pSchemaPaths, logging::Logger* pLogger)
+{
+    XMLControlRegistry xmlRegistry;
+    xmlRegistry.addCreator<DerivedXMLControl>();
+
+    auto data = ::six::parseDataFromBinary(xmlRegistry, bytes, pSchemaPaths, pLogger);
+    return std::unique_ptr<DerivedData>(static_cast<DerivedData*>(data.release()));
+}
+
 static void createPredefinedFilter(six::sidd::Filter& filter)
 {
     filter.filterName = "Some predefined Filter";
@@ -0,0 +1,202 @@
+/* =========================================================================
+ * This file is part of six.sidd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six.sidd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <vector>
+
+#include <std/span>
+
+#include <six/sidd/DRAHistogram.h>
+#include "TestCase.h"
+
+namespace
+{
+// 1, 2, ..., 10000
+std::vector<float> getRamp()
+{
+    std::vector<float> values(10000);
+    for (size_t ii = 0; ii < values.size(); ++ii)
+    {
+        values[ii] = static_cast<float>(ii + 1);
+    }
+    return values;
+}
+
+void add(six::sidd::DRAHistogram& histogram,
+         const std::vector<float>& values,
+         size_t begin,
+         size_t end)
+{
+    histogram.add(std::span<const float>(values.data() + begin, end - begin));
+}
+}
+
+TEST_CASE(testQuantiles)
+{
+    const std::vector<float> ramp = getRamp();
+    six::sidd::DRAHistogram histogram;
+    add(histogram, ramp, 0, ramp.size());
+
+    // Zeros get their own bin; NaNs are skipped
+    const std::vector<float> extras =
+            {0.0f, std::numeric_limits<float>::quiet_NaN()};
+    add(histogram, extras, 0, extras.size());
+
+    TEST_ASSERT_EQ(histogram.getNumValues(), static_cast<uint64_t>(10001));
+    TEST_ASSERT_EQ(histogram.getMin(), 0.0);
+    TEST_ASSERT_EQ(histogram.getMax(), 10000.0);
+    TEST_ASSERT_EQ(histogram.getQuantile(0.0), 0.0);
+    TEST_ASSERT_EQ(histogram.getQuantile(1.0), 10000.0);
+
+    const double tolerance = six::sidd::DRAHistogram::getBinRelativeError();
+    TEST_ASSERT_LESSER(tolerance, 0.011);
+    for (double fraction : {0.02, 0.25, 0.5, 0.9, 0.99})
+    {
+        const double expected = fraction * 10001.0;
+        const double actual = histogram.getQuantile(fraction);
+        TEST_ASSERT_LESSER(std::abs(actual - expected), expected * tolerance);
+    }
+
+    const six::sidd::DRAHistogram empty;
+    TEST_ASSERT_EQ(empty.getNumValues(), static_cast<uint64_t>(0));
+    TEST_ASSERT_EQ(empty.getQuantile(0.5), 0.0);
+}
+
+TEST_CASE(testMerge)
+{
+    const std::vector<float> ramp = getRamp();
+    six::sidd::DRAHistogram whole;
+    add(whole, ramp, 0, ramp.size());
+
+    std::vector<six::sidd::DRAHistogram> partials(4);
+    for (size_t ii = 0; ii < partials.size(); ++ii)
+    {
+        add(partials[ii], ramp, ii * 2500, (ii + 1) * 2500);
+    }
+
+    six::sidd::DRAHistogram serial;
+    for (const six::sidd::DRAHistogram& partial : partials)
+    {
+        serial.merge(partial);
+    }
+
+    for (size_t numThreads : {1, 3, 0})
+    {
+        const six::sidd::DRAHistogram parallel =
+                six::sidd::DRAHistogram::merge(
+                        std::span<const six::sidd::DRAHistogram>(
+                                partials.data(), partials.size()),
+                        numThreads);
+        TEST_ASSERT_EQ(parallel.getNumValues(), whole.getNumValues());
+        TEST_ASSERT_EQ(parallel.getMin(), whole.getMin());
+        TEST_ASSERT_EQ(parallel.getMax(), whole.getMax());
+        for (double fraction : {0.01, 0.5, 0.97})
+        {
+            TEST_ASSERT_EQ(parallel.getQuantile(fraction),
+                           whole.getQuantile(fraction));
+            TEST_ASSERT_EQ(serial.getQuantile(fraction),
+                           whole.getQuantile(fraction));
+        }
+    }
+}
+
+TEST_CASE(testComplex)
+{
+    std::vector<std::complex<float> > pixels;
+    std::vector<float> power;
+    for (size_t ii = 0; ii < 5000; ++ii)
+    {
+        const std::complex<float> pixel(0.5f * ii, -0.25f * ii);
+        pixels.push_back(pixel);
+        power.push_back(std::norm(pixel));
+    }
+
+    six::sidd::DRAHistogram fromComplex;
+    fromComplex.add(std::span<const std::complex<float> >(pixels.data(),
+                                                          pixels.size()),
+                    six::sidd::Detection::POWER);
+    six::sidd::DRAHistogram fromDetected;
+    add(fromDetected, power, 0, power.size());
+
+    TEST_ASSERT_EQ(fromComplex.getNumValues(), fromDetected.getNumValues());
+    TEST_ASSERT_ALMOST_EQ_EPS(fromComplex.getMax(), fromDetected.getMax(),
+                              1e-3);
+    TEST_ASSERT_ALMOST_EQ_EPS(fromComplex.getQuantile(0.5),
+                              fromDetected.getQuantile(0.5), 1e-3);
+}
+
+TEST_CASE(testSampledRankError)
+{
+    // sqrt(ln(2 / 0.05) / (2 * 1e6))
+    TEST_ASSERT_ALMOST_EQ_EPS(
+            six::sidd::DRAHistogram::getSampledRankError(1000000),
+            0.0013581, 1e-6);
+    TEST_ASSERT_EQ(six::sidd::DRAHistogram::getSampledRankError(0), 1.0);
+    TEST_ASSERT_LESSER(
+            six::sidd::DRAHistogram::getSampledRankError(1000000, 0.5),
+            six::sidd::DRAHistogram::getSampledRankError(1000000, 0.99));
+    TEST_EXCEPTION(six::sidd::DRAHistogram::getSampledRankError(10, 1.0));
+}
+
+TEST_CASE(testStretch)
+{
+    const std::vector<float> ramp = getRamp();
+    six::sidd::DRAHistogram histogram;
+    add(histogram, ramp, 0, ramp.size());
+    const double tolerance = six::sidd::DRAHistogram::getBinRelativeError();
+
+    six::sidd::DynamicRangeAdjustment::DRAParameters params;
+    params.pMin = 0.1;
+    params.pMax = 0.9;
+    params.eMinModifier = 0.0;
+    params.eMaxModifier = 0.0;
+
+    double low;
+    double high;
+    histogram.getStretch(params, low, high);
+    TEST_ASSERT_LESSER(std::abs(low - 1000.0), 1000.0 * tolerance);
+    TEST_ASSERT_LESSER(std::abs(high - 9000.0), 9000.0 * tolerance);
+
+    // The modifiers move the end points out to the min and max
+    params.eMinModifier = 1.0;
+    params.eMaxModifier = 0.5;
+    histogram.getStretch(params, low, high);
+    TEST_ASSERT_EQ(low, 1.0);
+    const double eMax = histogram.getQuantile(0.9);
+    TEST_ASSERT_ALMOST_EQ_EPS(high, eMax + 0.5 * (10000.0 - eMax), 1e-9);
+
+    const six::sidd::DynamicRangeAdjustment::DRAOverrides overrides =
+            histogram.getDRAOverrides(params, 256);
+    TEST_ASSERT_EQ(overrides.subtractor, low);
+    TEST_ASSERT_ALMOST_EQ_EPS(overrides.multiplier, 255.0 / (high - low),
+                              1e-12);
+}
+
+TEST_MAIN(
+    TEST_CHECK(testQuantiles);
+    TEST_CHECK(testMerge);
+    TEST_CHECK(testComplex);
+    TEST_CHECK(testSampledRankError);
+    TEST_CHECK(testStretch);
+)
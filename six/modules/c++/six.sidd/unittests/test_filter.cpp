@@ -0,0 +1,385 @@
+/* =========================================================================
+ * This file is part of six.sidd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six.sidd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <std/span>
+
+#include <six/sidd/KernelFilter.h>
+#include <six/sidd/PolyphaseResampler.h>
+#include "TestCase.h"
+
+namespace
+{
+const types::RowCol<size_t> DIMS(37, 53);
+
+std::vector<float> getImage(const types::RowCol<size_t>& dims)
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    std::vector<float> image(dims.area());
+    for (float& pixel : image)
+    {
+        pixel = distribution(generator);
+    }
+    return image;
+}
+
+six::sidd::Filter::Kernel::Custom getKernel(size_t rows, size_t cols)
+{
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    six::sidd::Filter::Kernel::Custom kernel;
+    kernel.size = six::RowColInt(rows, cols);
+    kernel.filterCoef.resize(rows * cols);
+    for (double& coef : kernel.filterCoef)
+    {
+        coef = distribution(generator);
+    }
+    return kernel;
+}
+
+ptrdiff_t clamp(ptrdiff_t index, size_t size)
+{
+    return std::min(std::max<ptrdiff_t>(index, 0),
+                    static_cast<ptrdiff_t>(size) - 1);
+}
+
+// Textbook 2D filtering with edge replication
+std::vector<float> filter(const std::vector<float>& image,
+                          const types::RowCol<size_t>& dims,
+                          const six::sidd::Filter::Kernel::Custom& kernel,
+                          six::sidd::FilterOperation operation)
+{
+    const ptrdiff_t rows = kernel.size.row;
+    const ptrdiff_t cols = kernel.size.col;
+    const ptrdiff_t centerRow = (rows - 1) / 2;
+    const ptrdiff_t centerCol = (cols - 1) / 2;
+    const bool convolve =
+            (operation == six::sidd::FilterOperation::CONVOLUTION);
+
+    std::vector<float> output(image.size());
+    for (size_t row = 0; row < dims.row; ++row)
+    {
+        for (size_t col = 0; col < dims.col; ++col)
+        {
+            double sum = 0.0;
+            for (ptrdiff_t kr = 0; kr < rows; ++kr)
+            {
+                for (ptrdiff_t kc = 0; kc < cols; ++kc)
+                {
+                    const ptrdiff_t offsetRow =
+                            convolve ? centerRow - kr : kr - centerRow;
+                    const ptrdiff_t offsetCol =
+                            convolve ? centerCol - kc : kc - centerCol;
+                    sum += kernel.filterCoef[kr * cols + kc] *
+                            image[clamp(row + offsetRow, dims.row) * dims.col +
+                                  clamp(col + offsetCol, dims.col)];
+                }
+            }
+            output[row * dims.col + col] = static_cast<float>(sum);
+        }
+    }
+    return output;
+}
+
+double getMaxDifference(const std::vector<float>& lhs,
+                        const std::vector<float>& rhs)
+{
+    double maxDifference = 0.0;
+    for (size_t ii = 0; ii < lhs.size(); ++ii)
+    {
+        maxDifference = std::max<double>(maxDifference,
+                                         std::abs(lhs[ii] - rhs[ii]));
+    }
+    return maxDifference;
+}
+
+std::vector<float> apply(const six::sidd::KernelFilter& kernelFilter,
+                         const std::vector<float>& image,
+                         const types::RowCol<size_t>& dims,
+                         size_t numThreads)
+{
+    std::vector<float> output(image.size());
+    kernelFilter.apply(std::span<const float>(image.data(), image.size()),
+                       dims,
+                       std::span<float>(output.data(), output.size()),
+                       numThreads);
+    return output;
+}
+
+std::vector<float> resample(const six::sidd::PolyphaseResampler& resampler,
+                            const std::vector<float>& image,
+                            const types::RowCol<size_t>& inputDims,
+                            const types::RowCol<size_t>& outputDims)
+{
+    std::vector<float> output(outputDims.area());
+    resampler.resample(std::span<const float>(image.data(), image.size()),
+                       inputDims,
+                       std::span<float>(output.data(), output.size()),
+                       outputDims);
+    return output;
+}
+}
+
+TEST_CASE(testKernel)
+{
+    const std::vector<float> image = getImage(DIMS);
+    for (auto operation : {six::sidd::FilterOperation::CONVOLUTION,
+                           six::sidd::FilterOperation::CORRELATION})
+    {
+        // Even sizes exercise the flipped center
+        for (size_t size : {3, 4, 5})
+        {
+            const six::sidd::Filter::Kernel::Custom kernel =
+                    getKernel(size, size + 1);
+            const std::vector<float> expected =
+                    filter(image, DIMS, kernel, operation);
+
+            const six::sidd::KernelFilter kernelFilter(kernel, operation);
+            TEST_ASSERT_FALSE(kernelFilter.isSeparable());
+            for (size_t numThreads : {1, 3, 0})
+            {
+                TEST_ASSERT_LESSER(
+                        getMaxDifference(apply(kernelFilter, image, DIMS,
+                                               numThreads),
+                                         expected),
+                        1e-5);
+            }
+        }
+    }
+}
+
+TEST_CASE(testSeparable)
+{
+    // Outer product of [1 2 1] and [1 4 6 4 1]
+    const double column[] = {1.0, 2.0, 1.0};
+    const double row[] = {1.0, 4.0, 6.0, 4.0, 1.0};
+    six::sidd::Filter::Kernel::Custom kernel;
+    kernel.size = six::RowColInt(3, 5);
+    for (double cc : column)
+    {
+        for (double rr : row)
+        {
+            kernel.filterCoef.push_back(cc * rr / 64.0);
+        }
+    }
+
+    const std::vector<float> image = getImage(DIMS);
+    for (auto operation : {six::sidd::FilterOperation::CONVOLUTION,
+                           six::sidd::FilterOperation::CORRELATION})
+    {
+        const six::sidd::KernelFilter kernelFilter(kernel, operation);
+        TEST_ASSERT_TRUE(kernelFilter.isSeparable());
+        TEST_ASSERT_LESSER(
+                getMaxDifference(apply(kernelFilter, image, DIMS, 2),
+                                 filter(image, DIMS, kernel, operation)),
+                1e-5);
+    }
+}
+
+TEST_CASE(testApplyRows)
+{
+    const std::vector<float> image = getImage(DIMS);
+    const six::sidd::Filter::Kernel::Custom kernel = getKernel(5, 3);
+    const six::sidd::KernelFilter kernelFilter(
+            kernel, six::sidd::FilterOperation::CORRELATION);
+    const std::vector<float> expected = apply(kernelFilter, image, DIMS, 1);
+
+    // Rows 10-19 need rows 8-21
+    const size_t firstInputRow = 8;
+    const types::RowCol<size_t> bandDims(14, DIMS.col);
+    std::vector<float> output(10 * DIMS.col);
+    kernelFilter.applyRows(
+            std::span<const float>(image.data() + firstInputRow * DIMS.col,
+                                   bandDims.area()),
+            bandDims, 2, 10,
+            std::span<float>(output.data(), output.size()));
+    for (size_t ii = 0; ii < output.size(); ++ii)
+    {
+        TEST_ASSERT_EQ(output[ii], expected[10 * DIMS.col + ii]);
+    }
+}
+
+TEST_CASE(testKernelErrors)
+{
+    six::sidd::Filter::Kernel::Custom kernel = getKernel(3, 3);
+    kernel.filterCoef.pop_back();
+    TEST_EXCEPTION(six::sidd::KernelFilter(
+            kernel, six::sidd::FilterOperation::CONVOLUTION));
+
+    six::sidd::Filter filter;
+    TEST_EXCEPTION(six::sidd::KernelFilter{filter});
+    TEST_EXCEPTION(six::sidd::PolyphaseResampler{filter});
+}
+
+TEST_CASE(testBilinear)
+{
+    // Upsampling a ramp with linear interpolation reproduces the ramp away
+    // from the edges
+    const types::RowCol<size_t> inputDims(8, 16);
+    const types::RowCol<size_t> outputDims(32, 64);
+    std::vector<float> image(inputDims.area());
+    for (size_t row = 0; row < inputDims.row; ++row)
+    {
+        for (size_t col = 0; col < inputDims.col; ++col)
+        {
+            image[row * inputDims.col + col] =
+                    static_cast<float>(2.0 * row + col);
+        }
+    }
+
+    six::sidd::Filter filter;
+    filter.filterName = "bilinear";
+    filter.filterBank.reset(new six::sidd::Filter::Bank());
+    filter.filterBank->predefined.reset(
+            new six::sidd::Filter::Predefined());
+    filter.filterBank->predefined->databaseName =
+            six::sidd::FilterDatabaseName::BILINEAR;
+    filter.operation = six::sidd::FilterOperation::CORRELATION;
+    // Output pixels are at eighths of an input pixel, so 8 phases are exact
+    const six::sidd::PolyphaseResampler resampler(filter, 8);
+    TEST_ASSERT_EQ(resampler.getNumPoints(), static_cast<size_t>(2));
+
+    const std::vector<float> output =
+            resample(resampler, image, inputDims, outputDims);
+    for (size_t row = 2; row < outputDims.row - 2; ++row)
+    {
+        for (size_t col = 2; col < outputDims.col - 2; ++col)
+        {
+            const double inputRow = (row + 0.5) / 4.0 - 0.5;
+            const double inputCol = (col + 0.5) / 4.0 - 0.5;
+            TEST_ASSERT_ALMOST_EQ_EPS(output[row * outputDims.col + col],
+                                      2.0 * inputRow + inputCol, 1e-4);
+        }
+    }
+}
+
+TEST_CASE(testBank)
+{
+    // Against a direct evaluation of the bank for a non-integer ratio
+    const types::RowCol<size_t> inputDims(20, 30);
+    const types::RowCol<size_t> outputDims(13, 47);
+    const std::vector<float> image = getImage(inputDims);
+
+    six::sidd::Filter::Bank::Custom bank;
+    bank.numPhasings = 8;
+    bank.numPoints = 5;
+    std::mt19937 generator(3);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    for (size_t ii = 0; ii < bank.numPhasings * bank.numPoints; ++ii)
+    {
+        bank.filterCoef.push_back(distribution(generator));
+    }
+
+    const auto taps = [&](size_t output, size_t inputSize, size_t outputSize,
+                          ptrdiff_t& start, size_t& phase)
+    {
+        const double position =
+                (output + 0.5) * inputSize / outputSize - 0.5;
+        const double base = std::floor(position);
+        phase = static_cast<size_t>(
+                std::round((position - base) * bank.numPhasings));
+        start = static_cast<ptrdiff_t>(base) - 2;
+        if (phase == bank.numPhasings)
+        {
+            phase = 0;
+            ++start;
+        }
+    };
+
+    const six::sidd::PolyphaseResampler resampler(
+            bank, six::sidd::FilterOperation::CORRELATION);
+    const std::vector<float> output =
+            resample(resampler, image, inputDims, outputDims);
+    for (size_t row = 0; row < outputDims.row; ++row)
+    {
+        ptrdiff_t startRow;
+        size_t phaseRow;
+        taps(row, inputDims.row, outputDims.row, startRow, phaseRow);
+        for (size_t col = 0; col < outputDims.col; ++col)
+        {
+            ptrdiff_t startCol;
+            size_t phaseCol;
+            taps(col, inputDims.col, outputDims.col, startCol, phaseCol);
+
+            double sum = 0.0;
+            for (size_t rr = 0; rr < bank.numPoints; ++rr)
+            {
+                for (size_t cc = 0; cc < bank.numPoints; ++cc)
+                {
+                    sum += bank.filterCoef[phaseRow * bank.numPoints + rr] *
+                           bank.filterCoef[phaseCol * bank.numPoints + cc] *
+                           image[clamp(startRow + rr, inputDims.row) *
+                                         inputDims.col +
+                                 clamp(startCol + cc, inputDims.col)];
+                }
+            }
+            TEST_ASSERT_ALMOST_EQ_EPS(output[row * outputDims.col + col],
+                                      sum, 1e-4);
+        }
+    }
+}
+
+TEST_CASE(testIdentity)
+{
+    // Resampling to the same size lands on phase 0 of every interpolator,
+    // which is the input sample
+    const std::vector<float> image = getImage(DIMS);
+    for (auto name : {six::sidd::FilterDatabaseName::NEAREST_NEIGHBOR,
+                      six::sidd::FilterDatabaseName::BILINEAR,
+                      six::sidd::FilterDatabaseName::CUBIC,
+                      six::sidd::FilterDatabaseName::LAGRANGE})
+    {
+        const six::sidd::Filter::Bank::Custom bank =
+                six::sidd::PolyphaseResampler::createBank(name, 16);
+        for (size_t phase = 0; phase < bank.numPhasings; ++phase)
+        {
+            double sum = 0.0;
+            for (size_t point = 0; point < bank.numPoints; ++point)
+            {
+                sum += bank.filterCoef[phase * bank.numPoints + point];
+            }
+            TEST_ASSERT_ALMOST_EQ_EPS(sum, 1.0, 1e-12);
+        }
+
+        const six::sidd::PolyphaseResampler resampler(
+                bank, six::sidd::FilterOperation::CORRELATION);
+        TEST_ASSERT_LESSER(
+                getMaxDifference(resample(resampler, image, DIMS, DIMS),
+                                 image),
+                1e-6);
+    }
+}
+
+TEST_MAIN(
+    TEST_CHECK(testKernel);
+    TEST_CHECK(testSeparable);
+    TEST_CHECK(testApplyRows);
+    TEST_CHECK(testKernelErrors);
+    TEST_CHECK(testBilinear);
+    TEST_CHECK(testBank);
+    TEST_CHECK(testIdentity);
+)
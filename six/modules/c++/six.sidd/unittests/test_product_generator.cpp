@@ -0,0 +1,501 @@
+/* =========================================================================
+ * This file is part of six.sidd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six.sidd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <complex>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <std/cstddef>
+#include <std/filesystem>
+#include <std/span>
+
+#include <io/ByteStream.h>
+#include <sys/OS.h>
+
+#include <six/NITFReadControl.h>
+#include <six/Utilities.h>
+#include <six/XMLControlFactory.h>
+#include <six/sicd/ComplexXMLControl.h>
+#include <six/sidd/DerivedXMLControl.h>
+#include <six/sidd/ProductGenerator.h>
+#include <six/sidd/Utilities.h>
+#include "TestCase.h"
+
+namespace
+{
+std::filesystem::path argv0()
+{
+    static const sys::OS os;
+    static const std::filesystem::path retval = os.getSpecialEnv("0");
+    return retval;
+}
+
+std::filesystem::path getNitfPath(const std::filesystem::path& filename)
+{
+    const auto root_dir = six::testing::buildRootDir(argv0());
+    return root_dir / "six" / "modules" / "c++" / "six" / "tests" / "nitf" /
+            filename;
+}
+
+// Reads image 0 of a loaded NITF
+std::vector<std::byte> readImage(six::NITFReadControl& reader)
+{
+    const six::Data& data = *reader.getContainer()->getData(0);
+    std::vector<std::byte> image(data.getNumRows() * data.getNumCols() *
+                                 data.getNumBytesPerPixel());
+    six::Region region;
+    region.setBuffer(image.data());
+    reader.interleaved(region, 0);
+    return image;
+}
+
+// A 1.0 SIDD the size of the SICD; the DRA only lives in memory
+std::unique_ptr<six::sidd::DerivedData>
+createDerivedData(const types::RowCol<size_t>& dims,
+                  const six::sidd::DynamicRangeAdjustment& dra)
+{
+    std::unique_ptr<six::sidd::DerivedData> data(
+            six::sidd::Utilities::createFakeDerivedData().release());
+    setExtent(*data, dims);
+    data->setPixelType(six::PixelType::MONO8I);
+    data->display->interactiveProcessing.resize(1);
+    data->display->interactiveProcessing[0].reset(
+            new six::sidd::InteractiveProcessing());
+    data->display->interactiveProcessing[0]->dynamicRangeAdjustment = dra;
+    return data;
+}
+
+six::sidd::DynamicRangeAdjustment createAutoDRA()
+{
+    six::sidd::DynamicRangeAdjustment dra;
+    dra.algorithmType = six::sidd::DRAType::AUTO;
+    dra.draParameters.reset(
+            new six::sidd::DynamicRangeAdjustment::DRAParameters());
+    dra.draParameters->pMin = 0.05;
+    dra.draParameters->pMax = 0.95;
+    dra.draParameters->eMinModifier = 0.25;
+    dra.draParameters->eMaxModifier = 0.5;
+    return dra;
+}
+
+/*
+ * Detects and remaps the whole image at once.  The statistics (if any) come
+ * from maxStatisticsRows evenly spaced rows, or every row if that's 0.
+ */
+std::vector<std::byte> getExpectedProduct(
+        const std::vector<std::complex<float> >& image,
+        const types::RowCol<size_t>& dims,
+        const six::sidd::Display& display,
+        six::sidd::Detection detection,
+        size_t maxStatisticsRows = 0)
+{
+    std::vector<float> detected(image.size());
+    six::sidd::ProductGenerator::detect(
+            std::span<const std::complex<float> >(image.data(), image.size()),
+            detection,
+            std::span<float>(detected.data(), detected.size()));
+
+    const six::sidd::DynamicRangeAdjustment& dra =
+            display.interactiveProcessing[0]->dynamicRangeAdjustment;
+    double low;
+    double high;
+    if (dra.algorithmType == six::sidd::DRAType::MANUAL)
+    {
+        low = dra.draOverrides->subtractor;
+        high = low + 255.0 / dra.draOverrides->multiplier;
+    }
+    else
+    {
+        const size_t numRows =
+                (maxStatisticsRows == 0 || maxStatisticsRows >= dims.row) ?
+                dims.row : maxStatisticsRows;
+        six::sidd::DRAHistogram histogram;
+        for (size_t sample = 0; sample < numRows; ++sample)
+        {
+            const size_t row = (2 * sample + 1) * dims.row / (2 * numRows);
+            histogram.add(std::span<const float>(
+                    detected.data() + row * dims.col, dims.col));
+        }
+        low = histogram.getMin();
+        high = histogram.getMax();
+        if (dra.algorithmType == six::sidd::DRAType::AUTO)
+        {
+            histogram.getStretch(*dra.draParameters, low, high);
+        }
+    }
+
+    const six::sidd::DisplayRemapper remapper(display, low, high);
+    std::vector<std::byte> product(detected.size());
+    remapper.remap(std::span<const float>(detected.data(), detected.size()),
+                   std::span<std::byte>(product.data(), product.size()));
+    return product;
+}
+
+class GenerateTester
+{
+public:
+    GenerateTester()
+    {
+        mXmlRegistry.addCreator<six::sicd::ComplexXMLControl>();
+        mXmlRegistry.addCreator<six::sidd::DerivedXMLControl>();
+        mReader.setXMLControlRegistry(&mXmlRegistry);
+        mReader.load(getNitfPath("sicd_50x50.nitf").string(), mSchemaPaths);
+        const six::Data& sicd = *mReader.getContainer()->getData(0);
+        mDims = types::RowCol<size_t>(sicd.getNumRows(), sicd.getNumCols());
+
+        const std::vector<std::byte> pixels = readImage(mReader);
+        mImage.resize(mDims.area());
+        std::copy(pixels.begin(), pixels.end(),
+                  reinterpret_cast<std::byte*>(mImage.data()));
+    }
+
+    const types::RowCol<size_t>& getDims() const
+    {
+        return mDims;
+    }
+
+    const std::vector<std::complex<float> >& getImage() const
+    {
+        return mImage;
+    }
+
+    six::NITFReadControl& getReader()
+    {
+        return mReader;
+    }
+
+    //! Generates the SIDD and reads its pixels back
+    std::vector<std::byte> generate(six::sidd::ProductGenerator& generator,
+                                    const std::string& pathname)
+    {
+        generator.generate(mReader, pathname);
+
+        six::NITFReadControl siddReader;
+        siddReader.setXMLControlRegistry(&mXmlRegistry);
+        siddReader.load(pathname, mSchemaPaths);
+        const std::vector<std::byte> product = readImage(siddReader);
+        std::filesystem::remove(pathname);
+        return product;
+    }
+
+private:
+    const std::vector<std::string> mSchemaPaths;
+    six::XMLControlRegistry mXmlRegistry;
+    six::NITFReadControl mReader;
+    types::RowCol<size_t> mDims;
+    std::vector<std::complex<float> > mImage;
+};
+
+std::vector<std::byte> remap(const six::sidd::DisplayRemapper& remapper,
+                             const std::vector<float>& detected)
+{
+    std::vector<std::byte> pixels(detected.size() *
+                                  remapper.getNumBytesPerPixel());
+    remapper.remap(std::span<const float>(detected.data(), detected.size()),
+                   std::span<std::byte>(pixels.data(), pixels.size()));
+    return pixels;
+}
+}
+
+TEST_CASE(testDetect)
+{
+    const std::vector<std::complex<float> > complex =
+            {{3.0f, 4.0f}, {0.0f, -2.0f}, {-1.0f, 0.0f}};
+    std::vector<float> detected(complex.size());
+    six::sidd::ProductGenerator::detect(
+            std::span<const std::complex<float> >(complex.data(),
+                                                  complex.size()),
+            six::sidd::Detection::AMPLITUDE,
+            std::span<float>(detected.data(), detected.size()));
+    TEST_ASSERT_ALMOST_EQ_EPS(detected[0], 5.0f, 1e-6f);
+    TEST_ASSERT_ALMOST_EQ_EPS(detected[1], 2.0f, 1e-6f);
+    TEST_ASSERT_ALMOST_EQ_EPS(detected[2], 1.0f, 1e-6f);
+
+    const std::vector<int16_t> iq = {3, 4, 0, -2, -1, 0};
+    six::sidd::ProductGenerator::detect(
+            std::span<const int16_t>(iq.data(), iq.size()),
+            six::sidd::Detection::POWER,
+            std::span<float>(detected.data(), detected.size()));
+    TEST_ASSERT_ALMOST_EQ_EPS(detected[0], 25.0f, 1e-6f);
+    TEST_ASSERT_ALMOST_EQ_EPS(detected[1], 4.0f, 1e-6f);
+    TEST_ASSERT_ALMOST_EQ_EPS(detected[2], 1.0f, 1e-6f);
+
+    // AMP8I_PHS8I only looks at the amplitude codes
+    float amplitudes[256];
+    for (size_t ii = 0; ii < 256; ++ii)
+    {
+        amplitudes[ii] = 0.5f * ii;
+    }
+    const std::vector<uint8_t> ampPhase = {10, 200, 0, 7, 255, 1};
+    six::sidd::ProductGenerator::detect(
+            std::span<const uint8_t>(ampPhase.data(), ampPhase.size()),
+            amplitudes,
+            six::sidd::Detection::AMPLITUDE,
+            std::span<float>(detected.data(), detected.size()));
+    TEST_ASSERT_ALMOST_EQ_EPS(detected[0], 5.0f, 1e-6f);
+    TEST_ASSERT_ALMOST_EQ_EPS(detected[1], 0.0f, 1e-6f);
+    TEST_ASSERT_ALMOST_EQ_EPS(detected[2], 127.5f, 1e-6f);
+
+    std::vector<float> tooShort(2);
+    TEST_EXCEPTION(six::sidd::ProductGenerator::detect(
+            std::span<const int16_t>(iq.data(), iq.size()),
+            six::sidd::Detection::POWER,
+            std::span<float>(tooShort.data(), tooShort.size())));
+}
+
+TEST_CASE(testRemapMono)
+{
+    six::sidd::Display display;
+    display.pixelType = six::PixelType::MONO8I;
+
+    const six::sidd::DisplayRemapper remapper8(display, 10.0, 265.0);
+    TEST_ASSERT_EQ(remapper8.getNumCodes(), static_cast<size_t>(256));
+    TEST_ASSERT_EQ(remapper8.getNumBytesPerPixel(), static_cast<size_t>(1));
+
+    const std::vector<float> detected =
+            {0.0f, 10.0f, 11.2f, 137.0f, 265.0f, 1.0e6f,
+             std::numeric_limits<float>::quiet_NaN()};
+    std::vector<std::byte> pixels = remap(remapper8, detected);
+    TEST_ASSERT_EQ(static_cast<int>(pixels[0]), 0);
+    TEST_ASSERT_EQ(static_cast<int>(pixels[1]), 0);
+    TEST_ASSERT_EQ(static_cast<int>(pixels[2]), 1);
+    TEST_ASSERT_EQ(static_cast<int>(pixels[3]), 127);
+    TEST_ASSERT_EQ(static_cast<int>(pixels[4]), 255);
+    TEST_ASSERT_EQ(static_cast<int>(pixels[5]), 255);
+    TEST_ASSERT_EQ(static_cast<int>(pixels[6]), 0);
+
+    // 16-bit pixels come out big endian
+    display.pixelType = six::PixelType::MONO16I;
+    const six::sidd::DisplayRemapper remapper16(display, 0.0, 65535.0);
+    TEST_ASSERT_EQ(remapper16.getNumCodes(), static_cast<size_t>(65536));
+    pixels = remap(remapper16, {258.0f});
+    TEST_ASSERT_EQ(pixels.size(), static_cast<size_t>(2));
+    TEST_ASSERT_EQ(static_cast<int>(pixels[0]), 1);
+    TEST_ASSERT_EQ(static_cast<int>(pixels[1]), 2);
+
+    // Without a LUT, RGB24I is gray
+    display.pixelType = six::PixelType::RGB24I;
+    const six::sidd::DisplayRemapper remapperRGB(display, 0.0, 255.0);
+    pixels = remap(remapperRGB, {42.0f});
+    TEST_ASSERT_EQ(pixels.size(), static_cast<size_t>(3));
+    TEST_ASSERT_EQ(static_cast<int>(pixels[0]), 42);
+    TEST_ASSERT_EQ(static_cast<int>(pixels[1]), 42);
+    TEST_ASSERT_EQ(static_cast<int>(pixels[2]), 42);
+
+    display.pixelType = six::PixelType::RE32F_IM32F;
+    TEST_EXCEPTION(six::sidd::DisplayRemapper(display, 0.0, 1.0));
+}
+
+TEST_CASE(testRemapLUT)
+{
+    // Lookup pixel types write the index; the LUT travels in the NITF
+    six::sidd::Display display;
+    display.pixelType = six::PixelType::RGB8LU;
+    display.remapInformation.reset(
+            new six::sidd::ColorDisplayRemap(new six::LUT(16, 3)));
+    const six::sidd::DisplayRemapper lookupRemapper(display, 0.0, 15.0);
+    TEST_ASSERT_EQ(lookupRemapper.getNumCodes(), static_cast<size_t>(16));
+    std::vector<std::byte> pixels = remap(lookupRemapper, {7.2f, 100.0f});
+    TEST_ASSERT_EQ(static_cast<int>(pixels[0]), 7);
+    TEST_ASSERT_EQ(static_cast<int>(pixels[1]), 15);
+
+    // Other pixel types have the LUT applied
+    display.pixelType = six::PixelType::RGB24I;
+    six::LUT* const lut = new six::LUT(4, 3);
+    for (size_t ii = 0; ii < 4; ++ii)
+    {
+        (*lut)[ii][0] = static_cast<unsigned char>(ii);
+        (*lut)[ii][1] = static_cast<unsigned char>(10 * ii);
+        (*lut)[ii][2] = static_cast<unsigned char>(100 + ii);
+    }
+    display.remapInformation.reset(new six::sidd::ColorDisplayRemap(lut));
+    const six::sidd::DisplayRemapper lutRemapper(display, 0.0, 3.0);
+    pixels = remap(lutRemapper, {2.0f});
+    TEST_ASSERT_EQ(static_cast<int>(pixels[0]), 2);
+    TEST_ASSERT_EQ(static_cast<int>(pixels[1]), 20);
+    TEST_ASSERT_EQ(static_cast<int>(pixels[2]), 102);
+
+    // The LUT's entries have to fit the pixels
+    display.pixelType = six::PixelType::MONO8I;
+    TEST_EXCEPTION(six::sidd::DisplayRemapper(display, 0.0, 1.0));
+}
+
+TEST_CASE(testGenerate)
+{
+    GenerateTester tester;
+    const types::RowCol<size_t>& dims = tester.getDims();
+    const std::unique_ptr<six::sidd::DerivedData> derivedData =
+            createDerivedData(dims, createAutoDRA());
+
+    // Room for 8 rows at a time, so 7 bands with a short last one
+    const size_t bytesPerRow = dims.col * (2 * 8 + sizeof(float) + 1);
+    six::sidd::ProductGenerator::Options options;
+    options.maxMemoryBytes = 8 * bytesPerRow + bytesPerRow / 2;
+    options.numThreads = 3;
+    six::sidd::ProductGenerator generator(*derivedData,
+                                          std::vector<std::string>(),
+                                          options);
+    TEST_ASSERT_EQ(generator.getNumRowsPerBand(
+                           dims.col, six::PixelType::RE32F_IM32F),
+                   static_cast<size_t>(8));
+
+    const std::vector<std::byte> product =
+            tester.generate(generator, "product_generator_auto.nitf");
+    const six::sidd::ProductGenerator::Timings& timings =
+            generator.getTimings();
+    TEST_ASSERT_EQ(timings.numRowsPerBand, static_cast<size_t>(8));
+    TEST_ASSERT_EQ(timings.numBands, static_cast<size_t>(7));
+    TEST_ASSERT(timings.bufferBytes <= options.maxMemoryBytes);
+    TEST_ASSERT_EQ(timings.numStatisticsRows, dims.row);
+
+    const std::vector<std::byte> expected = getExpectedProduct(
+            tester.getImage(), dims, *derivedData->display,
+            six::sidd::Detection::AMPLITUDE);
+    TEST_ASSERT_EQ(product.size(), expected.size());
+    for (size_t ii = 0; ii < product.size(); ++ii)
+    {
+        TEST_ASSERT_EQ(static_cast<int>(product[ii]),
+                       static_cast<int>(expected[ii]));
+    }
+}
+
+TEST_CASE(testGenerateOverrides)
+{
+    GenerateTester tester;
+    const types::RowCol<size_t>& dims = tester.getDims();
+
+    // Fixed stretch, so no statistics are gathered
+    six::sidd::DynamicRangeAdjustment dra;
+    dra.algorithmType = six::sidd::DRAType::MANUAL;
+    dra.draOverrides.reset(
+            new six::sidd::DynamicRangeAdjustment::DRAOverrides());
+    dra.draOverrides->subtractor = 0.1;
+    dra.draOverrides->multiplier = 200.0;
+    const std::unique_ptr<six::sidd::DerivedData> derivedData =
+            createDerivedData(dims, dra);
+
+    six::sidd::ProductGenerator::Options options;
+    options.detection = six::sidd::Detection::POWER;
+    options.maxMemoryBytes = 1;
+    six::sidd::ProductGenerator generator(*derivedData,
+                                          std::vector<std::string>(),
+                                          options);
+    const std::vector<std::byte> product =
+            tester.generate(generator, "product_generator_manual.nitf");
+    const six::sidd::ProductGenerator::Timings& timings =
+            generator.getTimings();
+    TEST_ASSERT_EQ(timings.numRowsPerBand, static_cast<size_t>(1));
+    TEST_ASSERT_EQ(timings.numBands, dims.row);
+    TEST_ASSERT_EQ(timings.numStatisticsRows, static_cast<size_t>(0));
+
+    const std::vector<std::byte> expected = getExpectedProduct(
+            tester.getImage(), dims, *derivedData->display,
+            six::sidd::Detection::POWER);
+    TEST_ASSERT_EQ(product.size(), expected.size());
+    for (size_t ii = 0; ii < product.size(); ++ii)
+    {
+        TEST_ASSERT_EQ(static_cast<int>(product[ii]),
+                       static_cast<int>(expected[ii]));
+    }
+
+    // The SICD has to match the SIDD
+    const std::unique_ptr<six::sidd::DerivedData> wrongSize =
+            createDerivedData(types::RowCol<size_t>(dims.row, dims.col + 1),
+                              dra);
+    six::sidd::ProductGenerator wrongSizeGenerator(
+            *wrongSize, std::vector<std::string>(), options);
+    io::ByteStream outStream;
+    TEST_EXCEPTION(wrongSizeGenerator.generate(tester.getReader(),
+                                               outStream));
+}
+
+TEST_CASE(testGenerateSampledStatistics)
+{
+    GenerateTester tester;
+    const types::RowCol<size_t>& dims = tester.getDims();
+    const std::unique_ptr<six::sidd::DerivedData> derivedData =
+            createDerivedData(dims, createAutoDRA());
+
+    // 0 and anything from the number of rows up take every row in a second
+    // pass; fewer rows are sampled before the product is written
+    for (size_t maxStatisticsRows : {0, 7, 20, 49, 50, 1000})
+    {
+        six::sidd::ProductGenerator::Options options;
+        options.maxMemoryBytes = 8 * dims.col * (2 * 8 + sizeof(float) + 1);
+        options.numThreads = 2;
+        options.maxStatisticsRows = maxStatisticsRows;
+        six::sidd::ProductGenerator generator(*derivedData,
+                                              std::vector<std::string>(),
+                                              options);
+        const std::vector<std::byte> product =
+                tester.generate(generator, "product_generator_sampled.nitf");
+
+        const six::sidd::ProductGenerator::Timings& timings =
+                generator.getTimings();
+        TEST_ASSERT_EQ(timings.numBands, static_cast<size_t>(7));
+        if (maxStatisticsRows == 0 || maxStatisticsRows >= dims.row)
+        {
+            TEST_ASSERT_EQ(timings.numStatisticsRows, dims.row);
+            TEST_ASSERT_EQ(timings.statisticsRankError, 0.0);
+        }
+        else
+        {
+            TEST_ASSERT_EQ(timings.numStatisticsRows, maxStatisticsRows);
+            TEST_ASSERT_EQ(timings.statisticsRankError,
+                           six::sidd::DRAHistogram::getSampledRankError(
+                                   maxStatisticsRows * dims.col));
+            TEST_ASSERT(timings.statisticsRankError > 0.0);
+        }
+
+        const std::vector<std::byte> expected = getExpectedProduct(
+                tester.getImage(), dims, *derivedData->display,
+                six::sidd::Detection::AMPLITUDE, maxStatisticsRows);
+        TEST_ASSERT_EQ(product.size(), expected.size());
+        for (size_t ii = 0; ii < product.size(); ++ii)
+        {
+            TEST_ASSERT_EQ(static_cast<int>(product[ii]),
+                           static_cast<int>(expected[ii]));
+        }
+    }
+
+    // Sampling a few rows stretches differently than using all of them
+    const std::vector<std::byte> all = getExpectedProduct(
+            tester.getImage(), dims, *derivedData->display,
+            six::sidd::Detection::AMPLITUDE);
+    TEST_ASSERT(all != getExpectedProduct(
+            tester.getImage(), dims, *derivedData->display,
+            six::sidd::Detection::AMPLITUDE, 7));
+}
+
+TEST_MAIN(
+    TEST_CHECK(testDetect);
+    TEST_CHECK(testRemapMono);
+    TEST_CHECK(testRemapLUT);
+    TEST_CHECK(testGenerate);
+    TEST_CHECK(testGenerateOverrides);
+    TEST_CHECK(testGenerateSampledStatistics);
+)
@@ -0,0 +1,267 @@
+/* =========================================================================
+ * This file is part of six.sidd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six.sidd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <std/span>
+
+#include <six/sidd/DerivedDataBuilder.h>
+#include <six/sidd/KernelFilter.h>
+#include <six/sidd/RRDSGenerator.h>
+#include "TestCase.h"
+
+namespace
+{
+const types::RowCol<size_t> DIMS(41, 30);
+
+std::vector<float> getImage()
+{
+    std::mt19937 generator(11);
+    std::uniform_real_distribution<float> distribution(0.0f, 255.0f);
+    std::vector<float> image(DIMS.area());
+    for (float& pixel : image)
+    {
+        pixel = distribution(generator);
+    }
+    return image;
+}
+
+float at(const std::vector<float>& image, ptrdiff_t row, ptrdiff_t col)
+{
+    row = std::min<ptrdiff_t>(std::max<ptrdiff_t>(row, 0), DIMS.row - 1);
+    col = std::min<ptrdiff_t>(std::max<ptrdiff_t>(col, 0), DIMS.col - 1);
+    return image[row * DIMS.col + col];
+}
+
+// Separable taps at input 2o + firstTap + k, with edge replication
+std::vector<float> reduce(const std::vector<float>& image,
+                          const std::vector<double>& taps,
+                          ptrdiff_t firstTap)
+{
+    const types::RowCol<size_t> dims((DIMS.row + 1) / 2, (DIMS.col + 1) / 2);
+    std::vector<float> reduced(dims.area());
+    for (size_t row = 0; row < dims.row; ++row)
+    {
+        for (size_t col = 0; col < dims.col; ++col)
+        {
+            double sum = 0.0;
+            for (size_t rr = 0; rr < taps.size(); ++rr)
+            {
+                for (size_t cc = 0; cc < taps.size(); ++cc)
+                {
+                    sum += taps[rr] * taps[cc] *
+                            at(image, 2 * row + firstTap + rr,
+                               2 * col + firstTap + cc);
+                }
+            }
+            reduced[row * dims.col + col] = static_cast<float>(sum);
+        }
+    }
+    return reduced;
+}
+
+// Pushes the image numRowsPerPush rows at a time
+std::vector<float> push(const std::string& testName,
+                        six::sidd::RRDSReducer& reducer,
+                        const std::vector<float>& image,
+                        size_t numRowsPerPush)
+{
+    std::vector<float> reduced;
+    size_t numReducedRows = 0;
+    for (size_t row = 0; row < DIMS.row; row += numRowsPerPush)
+    {
+        const size_t numRows = std::min(numRowsPerPush, DIMS.row - row);
+        numReducedRows += reducer.push(
+                std::span<const float>(image.data() + row * DIMS.col,
+                                       numRows * DIMS.col),
+                reduced);
+    }
+    TEST_ASSERT_TRUE(reducer.isDone());
+    TEST_ASSERT_EQ(numReducedRows, reducer.getOutputDims().row);
+    return reduced;
+}
+
+void assertNear(const std::string& testName,
+                const std::vector<float>& actual,
+                const std::vector<float>& expected,
+                double tolerance)
+{
+    TEST_ASSERT_EQ(actual.size(), expected.size());
+    for (size_t ii = 0; ii < actual.size(); ++ii)
+    {
+        TEST_ASSERT_ALMOST_EQ_EPS(actual[ii], expected[ii], tolerance);
+    }
+}
+}
+
+TEST_CASE(testMethods)
+{
+    const std::vector<float> image = getImage();
+    six::sidd::RRDS rrds;
+
+    rrds.downsamplingMethod = six::sidd::DownsamplingMethod::DECIMATE;
+    six::sidd::RRDSReducer decimate(rrds, DIMS, 1);
+    TEST_ASSERT_EQ(decimate.getOutputDims().row, static_cast<size_t>(21));
+    TEST_ASSERT_EQ(decimate.getOutputDims().col, static_cast<size_t>(15));
+    TEST_ASSERT_EQ(decimate.getOffset(), 0.0);
+    assertNear(testName, push(testName, decimate, image, 7),
+               reduce(image, {1.0}, 0), 1e-4);
+
+    rrds.downsamplingMethod = six::sidd::DownsamplingMethod::AVERAGE;
+    six::sidd::RRDSReducer average(rrds, DIMS, 2);
+    TEST_ASSERT_EQ(average.getOffset(), 0.5);
+    assertNear(testName, push(testName, average, image, 5),
+               reduce(image, {0.5, 0.5}, 0), 1e-3);
+
+    // Lagrange at half a pixel
+    rrds.downsamplingMethod = six::sidd::DownsamplingMethod::LAGRANGE;
+    six::sidd::RRDSReducer lagrange(rrds, DIMS, 3);
+    TEST_ASSERT_EQ(lagrange.getOffset(), 0.5);
+    assertNear(testName, push(testName, lagrange, image, 4),
+               reduce(image, {-0.0625, 0.5625, 0.5625, -0.0625}, -1), 1e-3);
+
+    rrds.downsamplingMethod = six::sidd::DownsamplingMethod::MAX_PIXEL;
+    six::sidd::RRDSReducer maxPixel(rrds, DIMS, 1);
+    const std::vector<float> reduced = push(testName, maxPixel, image, 1);
+    for (size_t row = 0; row < maxPixel.getOutputDims().row; ++row)
+    {
+        for (size_t col = 0; col < maxPixel.getOutputDims().col; ++col)
+        {
+            const float expected = std::max(
+                    std::max(at(image, 2 * row, 2 * col),
+                             at(image, 2 * row, 2 * col + 1)),
+                    std::max(at(image, 2 * row + 1, 2 * col),
+                             at(image, 2 * row + 1, 2 * col + 1)));
+            TEST_ASSERT_EQ(reduced[row * maxPixel.getOutputDims().col + col],
+                           expected);
+        }
+    }
+}
+
+TEST_CASE(testAntiAlias)
+{
+    // Streaming in any band size matches filtering the whole image first
+    six::sidd::RRDS rrds;
+    rrds.downsamplingMethod = six::sidd::DownsamplingMethod::BILINEAR;
+    rrds.antiAlias.reset(new six::sidd::Filter());
+    rrds.antiAlias->filterKernel.reset(new six::sidd::Filter::Kernel());
+    rrds.antiAlias->filterKernel->custom.reset(
+            new six::sidd::Filter::Kernel::Custom());
+    six::sidd::Filter::Kernel::Custom& kernel =
+            *rrds.antiAlias->filterKernel->custom;
+    kernel.size = six::RowColInt(5, 3);
+    kernel.filterCoef = {1, 2, 1, 2, 4, 2, 4, 8, 4, 2, 4, 2, 1, 2, 1};
+    for (double& coef : kernel.filterCoef)
+    {
+        coef /= 40.0;
+    }
+    rrds.antiAlias->operation = six::sidd::FilterOperation::CORRELATION;
+
+    const std::vector<float> image = getImage();
+    std::vector<float> filtered(image.size());
+    six::sidd::KernelFilter(*rrds.antiAlias).apply(
+            std::span<const float>(image.data(), image.size()), DIMS,
+            std::span<float>(filtered.data(), filtered.size()));
+    const std::vector<float> expected = reduce(filtered, {0.5, 0.5}, 0);
+
+    for (size_t numRowsPerPush : {1, 2, 3, 10, 41})
+    {
+        six::sidd::RRDSReducer reducer(rrds, DIMS, 2);
+        assertNear(testName, push(testName, reducer, image, numRowsPerPush),
+                   expected, 1e-3);
+    }
+
+    six::sidd::RRDSReducer reducer(rrds, DIMS, 1);
+    std::vector<float> reduced;
+    TEST_EXCEPTION(reducer.push(
+            std::span<const float>(image.data(), DIMS.col + 1), reduced));
+}
+
+TEST_CASE(testReduceMeasurement)
+{
+    six::sidd::DerivedDataBuilder builder;
+    builder.addDisplay(six::PixelType::MONO8I);
+    builder.addMeasurement(six::ProjectionType::PLANE);
+    std::unique_ptr<six::sidd::DerivedData> derivedData(builder.steal());
+    derivedData->setNumRows(100);
+    derivedData->setNumCols(60);
+
+    six::sidd::PlaneProjection& projection =
+            static_cast<six::sidd::PlaneProjection&>(
+                    *derivedData->measurement->projection);
+    projection.sampleSpacing = six::RowColDouble(0.5, 0.25);
+    projection.referencePoint.rowCol = six::RowColDouble(50.0, 30.0);
+    const double coeffs[] = {10.0, 0.5, 0.25, 0.0};
+    projection.timeCOAPoly = six::Poly2D(1, 1, coeffs);
+    derivedData->measurement->validData = {six::RowColInt(0, 0),
+                                           six::RowColInt(0, 59),
+                                           six::RowColInt(99, 59),
+                                           six::RowColInt(99, 0)};
+
+    // Two levels of 2x2 averaging
+    const std::unique_ptr<six::sidd::DerivedData> reduced =
+            six::sidd::RRDSGenerator::reduce(
+                    *derivedData, types::RowCol<size_t>(25, 15), 4.0, 1.5);
+    TEST_ASSERT_EQ(reduced->getNumRows(), static_cast<size_t>(25));
+    TEST_ASSERT_EQ(reduced->getNumCols(), static_cast<size_t>(15));
+
+    const six::sidd::PlaneProjection& reducedProjection =
+            static_cast<const six::sidd::PlaneProjection&>(
+                    *reduced->measurement->projection);
+    TEST_ASSERT_EQ(reducedProjection.sampleSpacing.row, 2.0);
+    TEST_ASSERT_EQ(reducedProjection.sampleSpacing.col, 1.0);
+    TEST_ASSERT_EQ(reducedProjection.referencePoint.rowCol.row, 12.125);
+    TEST_ASSERT_EQ(reducedProjection.referencePoint.rowCol.col, 7.125);
+
+    // Same time at the same place on the ground
+    for (double row : {0.0, 3.0, 24.0})
+    {
+        for (double col : {0.0, 14.0})
+        {
+            TEST_ASSERT_ALMOST_EQ_EPS(
+                    reducedProjection.timeCOAPoly(row, col),
+                    projection.timeCOAPoly(4.0 * row + 1.5, 4.0 * col + 1.5),
+                    1e-12);
+        }
+    }
+
+    const std::vector<six::RowColInt>& validData =
+            reduced->measurement->validData;
+    TEST_ASSERT_EQ(validData[0].row, 0);
+    TEST_ASSERT_EQ(validData[1].col, 14);
+    TEST_ASSERT_EQ(validData[2].row, 24);
+
+    // The original is untouched
+    TEST_ASSERT_EQ(derivedData->getNumRows(), static_cast<size_t>(100));
+    TEST_ASSERT_EQ(projection.sampleSpacing.row, 0.5);
+}
+
+TEST_MAIN(
+    TEST_CHECK(testMethods);
+    TEST_CHECK(testAntiAlias);
+    TEST_CHECK(testReduceMeasurement);
+)
@@ -0,0 +1,165 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef __SIX_BATCH_INPUT_STREAM_H__
+#define __SIX_BATCH_INPUT_STREAM_H__
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <io/FileInputStream.h>
+#include <nitf/CustomIO.hpp>
+
+namespace six
+{
+/*!
+ *  \class BatchInputStream
+ *  \brief A file input stream that can read many (offset, size) ranges
+ *  with one call
+ *
+ *  On Linux the reads of a batch are queued on an io_uring, so the device
+ *  sees up to queueDepth requests at once. Elsewhere, or when the kernel
+ *  refuses to set up a ring, the batch is read synchronously with
+ *  positional reads.
+ *
+ *  Large reads, batched or through the usual InputStream::read(), are
+ *  split into chunks so even a single read keeps the queue full.
+ *
+ *  readBatch() doesn't use or move the stream position, and can be called
+ *  from several threads at once. Each concurrent batch gets its own ring
+ *  from a pool, so batches don't wait on each other.
+ */
+class BatchInputStream final : public io::FileInputStreamOS
+{
+public:
+    enum class Backend
+    {
+        AUTO,        //!< io_uring if the kernel allows it, else SYNCHRONOUS
+        IO_URING,    //!< io_uring or throw
+        SYNCHRONOUS  //!< Positional reads, one at a time
+    };
+
+    //! A range of the file to read into buffer
+    struct Request
+    {
+        int64_t offset;
+        size_t size;
+        void* buffer;
+    };
+
+    //! Reads are split into chunks of at most this many bytes
+    static const size_t CHUNK_SIZE = 1024 * 1024;
+
+    /*!
+     *  \param pathname File to read
+     *  \param backend How to read batches
+     *  \param queueDepth Most reads in flight at once on an io_uring
+     *
+     *  \throws except::Exception if backend is IO_URING and the ring can't
+     *  be set up
+     */
+    BatchInputStream(const std::string& pathname,
+                     Backend backend = Backend::AUTO,
+                     size_t queueDepth = 64);
+
+    ~BatchInputStream();
+
+    BatchInputStream(const BatchInputStream&) = delete;
+    BatchInputStream& operator=(const BatchInputStream&) = delete;
+
+    //! The backend in use, never AUTO
+    Backend getBackend() const
+    {
+        return mBackend;
+    }
+
+    /*!
+     *  Reads every request in full, in no particular order
+     *
+     *  \throws except::IOException if any range can't be read, after
+     *  every read in flight has completed
+     */
+    void readBatch(const std::vector<Request>& requests);
+
+protected:
+    sys::SSize_T readImpl(void* buffer, size_t len) override;
+
+private:
+    struct IOUring;
+
+    void readSynchronous(const Request& request);
+
+    //! An idle ring from the pool, or a new one; nullptr if none can be made
+    std::unique_ptr<IOUring> acquireRing();
+    void releaseRing(std::unique_ptr<IOUring>&& ring);
+
+    Backend mBackend;
+    unsigned mQueueDepth;
+    std::vector<std::unique_ptr<IOUring> > mRings;  // Idle rings
+    std::mutex mMutex;
+};
+
+/*!
+ *  \class BatchIOInterface
+ *  \brief Lets NITRO read a file through a BatchInputStream
+ *
+ *  Image segment reads larger than a chunk are queued together rather
+ *  than read one after another.
+ */
+class BatchIOInterface final : public nitf::CustomIO
+{
+public:
+    BatchIOInterface(const std::string& pathname,
+                     BatchInputStream::Backend backend =
+                             BatchInputStream::Backend::AUTO);
+
+    BatchIOInterface(const BatchIOInterface&) = delete;
+    BatchIOInterface& operator=(const BatchIOInterface&) = delete;
+
+    BatchInputStream& getStream()
+    {
+        return mStream;
+    }
+
+private:
+    void readImpl(void* buffer, size_t size) override;
+
+    void writeImpl(const void* buffer, size_t size) override;
+
+    bool canSeekImpl() const override;
+
+    nitf::Off seekImpl(nitf::Off offset, int whence) override;
+
+    nitf::Off tellImpl() const override;
+
+    nitf::Off getSizeImpl() const override;
+
+    int getModeImpl() const override;
+
+    void closeImpl() override;
+
+    mutable BatchInputStream mStream;
+};
+}
+
+#endif
@@ -0,0 +1,203 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef SIX_six_BinaryXML_h_INCLUDED_
+#define SIX_six_BinaryXML_h_INCLUDED_
+#pragma once
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <std/cstddef> // std::byte
+#include <std/span>
+#include <std/filesystem>
+
+#include <xml/lite/Document.h>
+#include <logging/Logger.h>
+
+#include <six/Data.h>
+#include <six/XMLControlFactory.h>
+
+namespace six
+{
+/*!
+ *  A compact binary form of the SICD/SIDD metadata tree, for passing
+ *  metadata between processes and caching it without formatting and
+ *  re-parsing XML text.
+ *
+ *  The encoding is the XML DOM the XMLControls read and write, so it
+ *  covers every SICD/SIDD version the XML does.  The layout is flat and
+ *  little-endian so a DocumentView can walk it in place:
+ *
+ *  \verbatim
+ *  Header      magic "SIXB", version, numElements, numAttributes,
+ *              stringPoolSize, three reserved words (32 bytes)
+ *  Elements    numElements records of 11 uint32s, in document order:
+ *              qname, uri, characterData (each an offset/length into the
+ *              string pool), parent, firstChild, nextSibling,
+ *              firstAttribute, numAttributes
+ *  Attributes  numAttributes records of 6 uint32s: qname, uri, value
+ *  Strings     stringPoolSize bytes of UTF-8, not NUL-terminated
+ *  \endverbatim
+ *
+ *  Element 0 is the root; a missing parent/child/sibling is 0xFFFFFFFF.
+ */
+namespace binary
+{
+constexpr uint32_t VERSION = 1;
+
+//! Does 'bytes' start like six::binary data (as opposed to, say, XML)?
+bool isBinary(std::span<const std::byte> bytes);
+bool isBinary(const std::string& bytes);
+
+/*!
+ *  \class DocumentView
+ *  \brief Read-only access to six::binary data without copying it
+ *
+ *  The constructor checks that every offset and index is in range (and
+ *  that the tree is well-formed), so the accessors don't have to.  The
+ *  view doesn't own the bytes; they have to outlive it.
+ */
+class DocumentView final
+{
+public:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    //! A string in the pool; not NUL-terminated
+    struct String final
+    {
+        const char* data = nullptr;
+        size_t size = 0;
+
+        std::string str() const
+        {
+            return std::string(data, size);
+        }
+        bool operator==(const std::string& rhs) const
+        {
+            return rhs.compare(0, rhs.size(), data, size) == 0;
+        }
+        bool operator!=(const std::string& rhs) const
+        {
+            return !(*this == rhs);
+        }
+    };
+
+    //! \throw except::Exception if 'bytes' isn't valid six::binary data
+    explicit DocumentView(std::span<const std::byte> bytes);
+
+    uint32_t getVersion() const
+    {
+        return mVersion;
+    }
+    size_t getNumElements() const
+    {
+        return mNumElements;
+    }
+    size_t getRootElement() const
+    {
+        return 0;
+    }
+
+    String getQName(size_t element) const;
+    String getLocalName(size_t element) const;
+    String getUri(size_t element) const;
+    String getCharacterData(size_t element) const;
+
+    size_t getParent(size_t element) const;
+    size_t getFirstChild(size_t element) const;
+    size_t getNextSibling(size_t element) const;
+
+    //! First child of 'element' with the given local name, or npos
+    size_t findChild(size_t element, const std::string& localName) const;
+
+    size_t getNumAttributes(size_t element) const;
+    String getAttributeQName(size_t element, size_t attribute) const;
+    String getAttributeUri(size_t element, size_t attribute) const;
+    String getAttributeValue(size_t element, size_t attribute) const;
+
+    //! Build the equivalent xml::lite::Document
+    std::unique_ptr<xml::lite::Document> toDocument() const;
+
+private:
+    const std::byte* element(size_t index) const;
+    const std::byte* attribute(size_t element, size_t attribute) const;
+    String string(const std::byte* ref) const;
+
+    uint32_t mVersion = 0;
+    size_t mNumElements = 0;
+    size_t mNumAttributes = 0;
+    const std::byte* mElements = nullptr;
+    const std::byte* mAttributes = nullptr;
+    const char* mStrings = nullptr;
+    size_t mStringPoolSize = 0;
+};
+
+//! \throw except::Exception if the document is too big for 32-bit offsets
+std::vector<std::byte> encode(const xml::lite::Document&);
+
+//! Same as DocumentView(bytes).toDocument()
+std::unique_ptr<xml::lite::Document> decode(std::span<const std::byte> bytes);
+inline std::unique_ptr<xml::lite::Document> decode(const std::vector<std::byte>& bytes)
+{
+    return decode(std::span<const std::byte>(bytes.data(), bytes.size()));
+}
+}
+
+/*!
+ *  Convert 'data' to six::binary; the binary equivalent of toXMLString().
+ *
+ *  \param data SICD or SIDD metadata
+ *  \param xmlRegistry Registry to create the XMLControl from; defaults to
+ *  the XMLControlFactory
+ *  \param logger Logger for the XMLControl; may be nullptr
+ */
+std::vector<std::byte> toBinary(const Data& data,
+                                const XMLControlRegistry* xmlRegistry = nullptr,
+                                logging::Logger* logger = nullptr);
+
+/*!
+ *  Convert six::binary back to Data; the binary equivalent of
+ *  parseDataFromString().  Nothing is validated unless schema paths are
+ *  given.
+ *
+ *  \param xmlReg Registry with an XMLControl for the data type
+ *  \param bytes Output of toBinary()
+ *  \param pSchemaPaths Schema path(s) to validate against; may be nullptr
+ *  \param pLogger Logger for the XMLControl; may be nullptr
+ */
+std::unique_ptr<Data> parseDataFromBinary(const XMLControlRegistry& xmlReg,
+    std::span<const std::byte> bytes,
+    const std::vector<std::filesystem::path>* pSchemaPaths,
+    logging::Logger* pLogger = nullptr);
+inline std::unique_ptr<Data> parseDataFromBinary(const XMLControlRegistry& xmlReg,
+    const std::vector<std::byte>& bytes,
+    const std::vector<std::filesystem::path>* pSchemaPaths,
+    logging::Logger* pLogger = nullptr)
+{
+    const std::span<const std::byte> bytes_(bytes.data(), bytes.size());
+    return parseDataFromBinary(xmlReg, bytes_, pSchemaPaths, pLogger);
+}
+}
+
+#endif // SIX_six_BinaryXML_h_INCLUDED_
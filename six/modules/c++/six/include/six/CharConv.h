@@ -0,0 +1,148 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef SIX_six_CharConv_h_INCLUDED_
+#define SIX_six_CharConv_h_INCLUDED_
+#pragma once
+
+#include <stdint.h>
+
+#include <string>
+#include <limits>
+#include <type_traits>
+#include <system_error>
+
+#include <sys/Conf.h>
+#include <except/Exception.h>
+
+namespace six
+{
+/*!
+ * Locale-independent numeric conversions for the XML readers and writers.
+ *
+ * These follow the std::from_chars()/std::to_chars() interface (C++17) so
+ * callers can move to <charconv> directly once it is available everywhere.
+ * Unlike str::toType()/str::toString(), nothing here touches an iostream
+ * or the global locale.
+ */
+namespace charconv
+{
+struct from_chars_result final
+{
+    const char* ptr;
+    std::errc ec;
+};
+struct to_chars_result final
+{
+    char* ptr;
+    std::errc ec;
+};
+
+/*!
+ * Parse a decimal floating-point value from [first, last): an optional
+ * sign, digits with an optional '.', and an optional exponent.  Leading
+ * whitespace is NOT skipped.  "inf", "nan" and hexadecimal are rejected,
+ * matching what str::toType<double>() accepts.
+ */
+from_chars_result from_chars(const char* first, const char* last, double& value);
+
+//! Parse an optionally signed decimal integer from [first, last)
+from_chars_result from_chars(const char* first, const char* last, int64_t& value);
+from_chars_result from_chars(const char* first, const char* last, uint64_t& value);
+
+/*!
+ * Write the shortest representation of value (in "%g" style) that
+ * reads back as exactly the same double.
+ */
+to_chars_result to_chars(char* first, char* last, double value);
+
+//! Write value using "%.<precision>g", but always with '.' as the radix
+to_chars_result to_chars(char* first, char* last, double value, int precision);
+
+to_chars_result to_chars(char* first, char* last, int64_t value);
+to_chars_result to_chars(char* first, char* last, uint64_t value);
+
+namespace details
+{
+template <typename T>
+using IntegerFor = typename std::conditional<std::is_signed<T>::value, int64_t, uint64_t>::type;
+
+const char* skipSpace(const char* first, const char* last);
+[[noreturn]] void throwBadCast(const std::string& s, const char* type);
+
+template <typename T>
+inline T toType(const std::string& s, std::true_type /*is_integral*/)
+{
+    const char* const last = s.data() + s.size();
+    IntegerFor<T> value;
+    const auto result = from_chars(skipSpace(s.data(), last), last, value);
+    if ((result.ec != std::errc()) ||
+        (value < static_cast<IntegerFor<T>>(std::numeric_limits<T>::min())) ||
+        (value > static_cast<IntegerFor<T>>(std::numeric_limits<T>::max())))
+    {
+        throwBadCast(s, "integer");
+    }
+    return static_cast<T>(value);
+}
+template <typename T>
+inline T toType(const std::string& s, std::false_type /*is_integral*/)
+{
+    const char* const last = s.data() + s.size();
+    double value;
+    const auto result = from_chars(skipSpace(s.data(), last), last, value);
+    if (result.ec != std::errc())
+    {
+        throwBadCast(s, "double");
+    }
+    return static_cast<T>(value);
+}
+}
+
+/*!
+ * Drop-in replacements for str::toType<T>() on arithmetic types: leading
+ * whitespace is skipped and conversion stops at the first character that
+ * can't be part of the number.
+ *
+ * \throw except::BadCastException if no number could be read
+ */
+template <typename T>
+inline T toType(const std::string& s)
+{
+    static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value,
+                  "six::charconv::toType() is only for numbers");
+    return details::toType<T>(s, std::is_integral<T>());
+}
+
+//! Shortest round-trip formatting; see to_chars()
+std::string toString(double value);
+template <typename T>
+inline std::string toString(T value)
+{
+    static_assert(std::is_integral<T>::value && !std::is_same<T, bool>::value,
+                  "six::charconv::toString() is only for numbers");
+    char buf[32];
+    const auto result = to_chars(buf, buf + sizeof(buf), static_cast<details::IntegerFor<T>>(value));
+    return std::string(buf, result.ptr);
+}
+}
+}
+
+#endif // SIX_six_CharConv_h_INCLUDED_
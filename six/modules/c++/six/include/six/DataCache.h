@@ -0,0 +1,166 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef SIX_six_DataCache_h_INCLUDED_
+#define SIX_six_DataCache_h_INCLUDED_
+#pragma once
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <std/filesystem>
+
+#include <six/Data.h>
+
+namespace six
+{
+/*!
+ *  \class DataCache
+ *  \brief Process-wide cache of parsed SICD/SIDD metadata
+ *
+ *  Parsing and validating the XML DES is most of the cost of opening a
+ *  SICD or SIDD.  This cache maps the exact DES bytes, along with the
+ *  schema paths used to validate them, to the Data that came out of the
+ *  parser.  Cached Data is immutable and shared; callers that need to
+ *  make changes work on a unique_clone(), which is far cheaper than
+ *  parsing the XML again.
+ *
+ *  Entries are evicted least-recently-used first once either the number
+ *  of entries or the total size of their XML exceeds the limits.
+ *
+ *  All methods are thread-safe.
+ */
+class DataCache final
+{
+public:
+    static const size_t DEFAULT_MAX_ENTRIES;
+    static const size_t DEFAULT_MAX_BYTES;
+
+    struct Statistics final
+    {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+        size_t numEntries = 0;
+        size_t numBytes = 0; //!< Size of the cached XML
+    };
+
+    DataCache(size_t maxEntries = DEFAULT_MAX_ENTRIES,
+              size_t maxBytes = DEFAULT_MAX_BYTES);
+    DataCache(const DataCache&) = delete;
+    DataCache& operator=(const DataCache&) = delete;
+    DataCache(DataCache&&) = delete;
+    DataCache& operator=(DataCache&&) = delete;
+
+    //! The cache used by NITFReadControl::setDataCache() by default
+    static DataCache& getInstance();
+
+    /*!
+     *  \param xml The DES contents
+     *  \param schemaPaths Schema path(s) the XML was validated against
+     *  \return The cached Data, or nullptr if there isn't any.  Counts
+     *  as a hit or a miss.
+     */
+    std::shared_ptr<const Data> find(const std::string& xml,
+                                     const std::vector<std::string>& schemaPaths);
+    std::shared_ptr<const Data> find(const std::string& xml,
+                                     const std::vector<std::filesystem::path>& schemaPaths);
+
+    /*!
+     *  Add 'data' for 'xml'/'schemaPaths', replacing any existing entry,
+     *  then evict entries as needed to stay within the limits.  An entry
+     *  bigger than the byte limit is not cached at all.
+     */
+    void insert(const std::string& xml,
+                const std::vector<std::string>& schemaPaths,
+                std::shared_ptr<const Data> data);
+    void insert(const std::string& xml,
+                const std::vector<std::filesystem::path>& schemaPaths,
+                std::shared_ptr<const Data> data);
+
+    /*!
+     *  Return the cached Data, calling parse() and caching its result on a
+     *  miss.  parse() is called without the cache locked, so two threads
+     *  missing on the same product may both parse it.
+     *
+     *  \param parse Callable returning a std::unique_ptr<Data>
+     */
+    template <typename TSchemaPath, typename TParse>
+    std::shared_ptr<const Data> get(const std::string& xml,
+                                    const std::vector<TSchemaPath>& schemaPaths,
+                                    TParse&& parse)
+    {
+        auto retval = find(xml, schemaPaths);
+        if (retval == nullptr)
+        {
+            retval = std::shared_ptr<const Data>(parse());
+            if (retval != nullptr)
+            {
+                insert(xml, schemaPaths, retval);
+            }
+        }
+        return retval;
+    }
+
+    //! Change the limits, evicting entries as needed
+    void setLimits(size_t maxEntries, size_t maxBytes);
+
+    //! Remove all entries; the statistics are not reset
+    void clear();
+
+    Statistics getStatistics() const;
+    void resetStatistics();
+
+    //! The (non-cryptographic) hash used to index the cache
+    static uint64_t hash(const void* data, size_t numBytes);
+
+private:
+    struct Entry final
+    {
+        uint64_t hash;
+        std::string xml;
+        std::string schemaPaths;
+        std::shared_ptr<const Data> data;
+    };
+    using EntryList = std::list<Entry>;
+
+    std::shared_ptr<const Data> find_(const std::string& xml, const std::string& schemaPaths);
+    void insert_(const std::string& xml, std::string&& schemaPaths, std::shared_ptr<const Data>);
+    EntryList::iterator findEntry(uint64_t hash, const std::string& xml,
+                                  const std::string& schemaPaths);
+    void erase(EntryList::iterator);
+    void evict();
+
+    mutable std::mutex mMutex;
+    size_t mMaxEntries;
+    size_t mMaxBytes;
+    EntryList mEntries; // most-recently used first
+    std::unordered_multimap<uint64_t, EntryList::iterator> mIndex;
+    Statistics mStatistics;
+};
+}
+
+#endif // SIX_six_DataCache_h_INCLUDED_
@@ -26,8 +26,11 @@
 
 #include <string>
 #include <map>
+#include <vector>
+#include <algorithm>
 #include <ostream>
 #include <new>
+#include <cstring>
 
 #include <scene/sys_Conf.h>
 #include <import/except.h>
@@ -67,15 +70,21 @@ namespace details
     inline T index(const std::map<std::string, T>& map, const std::string& v)
     {
         const auto result = nitf::details::index(map, v);
-        const except::InvalidFormatException ex(Ctxt(FmtX("Invalid enum value: %s", v.c_str())));
-        return nitf::details::value(result, ex);
+        if (!result.has_value())
+        {
+            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", v.c_str())));
+        }
+        return *result;
     }
     template<typename T>
     inline std::string index(const std::map<T, std::string>& map, T v)
     {
         const auto result = nitf::details::index(map, v);
-        const except::InvalidFormatException ex(Ctxt(FmtX("Invalid enum value: %d", v)));
-        return nitf::details::value(result, ex);
+        if (!result.has_value())
+        {
+            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", v)));
+        }
+        return *result;
     }
 
     template<typename T>
@@ -104,24 +113,107 @@ namespace details
     inline T toType(const std::map<std::string, TValues>& map, const std::string& v)
     {
         const auto result = toType<T>(map, v, std::nothrow);
-        const except::Exception ex(Ctxt("Unknown type '" + v + "'"));
-        return nitf::details::value(result, ex);
+        if (!result.has_value())
+        {
+            throw except::Exception(Ctxt("Unknown type '" + v + "'"));
+        }
+        return *result;
     }
 
-    // Base type for all enums; avoids code duplication
-    template<typename T>
-    class Enum
+    //! One name of an enum value; several names may share a value, e.g. "NOT_SET" and "NOT SET"
+    struct EnumEntry final
     {
-        static const std::map<std::string, int>& string_to_int()
+        const char* name;
+        int value;
+    };
+
+    /*!
+     *  \class EnumTable
+     *  \brief Name and value indexes over an enum's entries
+     *
+     *  The entries are a constant-initialized array in each enum type, so
+     *  the only work done at runtime is one sort the first time the type is
+     *  used.  Every lookup after that is a binary search which neither
+     *  allocates nor builds a std::string.
+     */
+    class EnumTable final
+    {
+        std::vector<EnumEntry> mByName; // sorted by name
+        std::vector<EnumEntry> mByValue; // sorted by value, one name per value
+
+        static bool lessName(const EnumEntry& lhs, const EnumEntry& rhs)
         {
-            static const auto retval = details::to_string_to_int(T::string_to_value_());
-            return retval;
+            return std::strcmp(lhs.name, rhs.name) < 0;
+        }
+        static bool lessValue(const EnumEntry& lhs, const EnumEntry& rhs)
+        {
+            return lhs.value < rhs.value;
+        }
+
+    public:
+        template<size_t N>
+        explicit EnumTable(const EnumEntry (&entries)[N]) :
+            mByName(entries, entries + N)
+        {
+            std::sort(mByName.begin(), mByName.end(), lessName);
+
+            // When several names share a value, toString() has always
+            // returned the one that sorts last (e.g. "NOT_SET", not "NOT SET").
+            mByValue = mByName;
+            std::stable_sort(mByValue.begin(), mByValue.end(), lessValue);
+            auto out = mByValue.begin();
+            for (auto it = mByValue.begin(); it != mByValue.end(); ++it)
+            {
+                if ((it + 1 == mByValue.end()) || ((it + 1)->value != it->value))
+                {
+                    *out++ = *it;
+                }
+            }
+            mByValue.erase(out, mByValue.end());
         }
-        static const std::map<int, std::string>& int_to_string()
+
+        //! \return the entry named "name", or nullptr
+        const EnumEntry* find(const std::string& name) const noexcept
         {
-            static const auto retval = nitf::details::swap_key_value(string_to_int());
+            const auto it = std::lower_bound(mByName.begin(), mByName.end(), name,
+                [](const EnumEntry& entry, const std::string& name) { return name.compare(entry.name) > 0; });
+            return ((it != mByName.end()) && (name.compare(it->name) == 0)) ? &(*it) : nullptr;
+        }
+
+        //! \return the canonical entry for "value", or nullptr
+        const EnumEntry* find(int value) const noexcept
+        {
+            const EnumEntry key{ "", value };
+            const auto it = std::lower_bound(mByValue.begin(), mByValue.end(), key, lessValue);
+            return ((it != mByValue.end()) && (it->value == value)) ? &(*it) : nullptr;
+        }
+
+        //! Number of distinct values
+        size_t size() const noexcept
+        {
+            return mByValue.size();
+        }
+
+        template<typename TValues>
+        std::map<std::string, TValues> toMap() const
+        {
+            std::map<std::string, TValues> retval;
+            for (auto&& entry : mByName)
+            {
+                retval[entry.name] = static_cast<TValues>(entry.value);
+            }
             return retval;
         }
+    };
+
+    // Base type for all enums; avoids code duplication
+    template<typename T>
+    class Enum
+    {
+        static const EnumTable& table()
+        {
+            return T::table_();
+        }
 
     protected:
         Enum() = default;
@@ -129,7 +221,10 @@ namespace details
         //! int constructor
         explicit Enum(int i)
         {
-            (void)details::index(int_to_string(), i); // validate "i"
+            if (table().find(i) == nullptr) // validate "i"
+            {
+                throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", i)));
+            }
             value = i;
         }
 
@@ -139,26 +234,38 @@ namespace details
         //! Returns string representation of the value
         std::optional<std::string> toString(std::nothrow_t) const
         {
-            return nitf::details::index(int_to_string(), value);
+            const auto entry = table().find(value);
+            return entry == nullptr ? std::optional<std::string>() : std::optional<std::string>(entry->name);
         }
         std::string toString(bool throw_if_not_set = false) const
         {
-            return details::toString(int_to_string(), value, throw_if_not_set);
+            const auto entry = table().find(value);
+            if ((entry == nullptr) || (throw_if_not_set && (value == NOT_SET_VALUE)))
+            {
+                throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+            }
+            return entry->name;
         }
 
         static std::optional<T> toType(const std::string& v, std::nothrow_t)
         {
-            return details::toType<T>(string_to_int(), v, std::nothrow);
+            const auto entry = table().find(v);
+            return entry == nullptr ? std::optional<T>() : std::optional<T>(six::Enum::cast<T>(entry->value));
         }
         static T toType(const std::string& v)
         {
-            return details::toType<T>(string_to_int(), v);
+            const auto entry = table().find(v);
+            if (entry == nullptr)
+            {
+                throw except::Exception(Ctxt("Unknown type '" + v + "'"));
+            }
+            return six::Enum::cast<T>(entry->value);
         }
 
         operator int() const { return value; }
 
         // needed for SWIG
-        static size_t size() { return int_to_string().size(); }
+        static size_t size() { return table().size(); }
         bool operator<(const int& o) const { return value < o; }
         bool operator<(const Enum& o) const { return *this < o.value; }
         bool operator==(const int& o) const { return value == o; }
@@ -199,9 +306,10 @@ namespace details
     #define SIX_Enum_BEGIN_enum enum values {
     #define SIX_Enum_BEGIN_DEFINE(name) struct name final : public six::details::Enum<name> { 
     #define SIX_Enum_END_DEFINE(name)  SIX_Enum_constructors_(name); }
-    #define SIX_Enum_BEGIN_string_to_value static const std::map<std::string, values>& string_to_value_() { static const std::map<std::string, values> retval {
+    #define SIX_Enum_BEGIN_string_to_value static const six::details::EnumTable& table_() { static const six::details::EnumEntry entries[] {
     #define SIX_Enum_END_enum NOT_SET = six::NOT_SET_VALUE };
-    #define SIX_Enum_END_string_to_value SIX_Enum_map_entry_NOT_SET }; return retval; }
+    #define SIX_Enum_END_string_to_value SIX_Enum_map_entry_NOT_SET }; static const six::details::EnumTable retval(entries); return retval; } \
+        static std::map<std::string, values> string_to_value_() { return table_().toMap<values>(); }
 
     #define SIX_Enum_ENUM_begin_(name) SIX_Enum_BEGIN_DEFINE(name) SIX_Enum_constructors_(name); SIX_Enum_BEGIN_enum
     #define SIX_Enum_ENUM_1_ SIX_Enum_END_enum SIX_Enum_BEGIN_string_to_value
@@ -0,0 +1,91 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef __SIX_FFT_H__
+#define __SIX_FFT_H__
+
+#include <stddef.h>
+
+#include <complex>
+#include <vector>
+
+#include <six/Enums.h>
+
+namespace six
+{
+/*!
+ * \class FFT
+ * \brief Unnormalized complex DFT of a fixed length
+ *
+ * transform() computes X[k] = sum over n of x[n] exp(sign * j 2 pi n k / N),
+ * so an inverse is a transform with the opposite sign followed by a scale
+ * of 1 / N.  Powers of two use an iterative radix-2 transform; other lengths
+ * use Bluestein's algorithm on a radix-2 transform of at least 2N - 1.
+ * Twiddles are computed in double precision once, so a plan is immutable
+ * and can be shared by any number of threads.
+ */
+class FFT
+{
+public:
+    /*!
+     * \param size Transform length
+     *
+     * \throw except::Exception if size is 0
+     */
+    explicit FFT(size_t size);
+
+    size_t size() const
+    {
+        return mSize;
+    }
+
+    /*!
+     * Transforms in place
+     *
+     * \param data size() values
+     * \param sign Sign of the exponent
+     */
+    void transform(std::complex<float>* data, FFTSign sign) const;
+
+    /*!
+     * Transforms in place with the zero index in the middle of both the
+     * input and the output, i.e. index ii means n (or k) = ii - size() / 2
+     */
+    void transformCentered(std::complex<float>* data, FFTSign sign) const;
+
+    //! \return Smallest power of two at least size
+    static size_t nextPowerOfTwo(size_t size);
+
+private:
+    void radix2(std::complex<float>* data, bool conjugate) const;
+
+    size_t mSize;
+    size_t mPaddedSize;
+    std::vector<size_t> mBitReversed;
+    std::vector<std::complex<float> > mTwiddles;
+
+    // Bluestein's chirp and the transform of its convolution kernel
+    std::vector<std::complex<float> > mChirp;
+    std::vector<std::complex<float> > mKernel;
+};
+}
+
+#endif
@@ -0,0 +1,241 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef __SIX_INSTRUMENTATION_H__
+#define __SIX_INSTRUMENTATION_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace six
+{
+class InstrumentationSink;
+
+/*!
+ * \class Instrumentation
+ * \brief Timers and counters for the read, parse and write paths
+ *
+ * Instrumentation is off by default.  While it's off, SIX_SCOPED_TIMER and
+ * SIX_COUNT cost one relaxed atomic load each, and building with
+ * SIX_DISABLE_INSTRUMENTATION defined compiles them out entirely.
+ *
+ * While it's on, each thread adds to its own totals, whose lock is only
+ * ever contended by getReport() and reset().  With tracing on too, every
+ * timed scope also records an event for ChromeTraceSink, up to
+ * MAX_EVENTS_PER_THREAD per thread.
+ *
+ * Names are kept by pointer until a report is made, so they should be
+ * string literals.
+ */
+class Instrumentation
+{
+public:
+    static const size_t MAX_EVENTS_PER_THREAD = 1 << 20;
+
+    struct TimerStatistics
+    {
+        uint64_t count = 0;
+        int64_t totalNanoseconds = 0;
+        int64_t minNanoseconds = 0;
+        int64_t maxNanoseconds = 0;
+    };
+
+    //! A traced scope.  Times are from when instrumentation was first used.
+    struct Event
+    {
+        std::string name;
+        uint64_t threadId = 0;  //!< In the order threads were first seen
+        int64_t startNanoseconds = 0;
+        int64_t durationNanoseconds = 0;
+    };
+
+    struct Report
+    {
+        std::map<std::string, uint64_t> counters;
+        std::map<std::string, TimerStatistics> timers;
+        std::vector<Event> events;  //!< In order of start time
+    };
+
+    /*!
+     * \param enabled Turns timers and counters on or off
+     * \param tracing Also record every timed scope
+     */
+    static void setEnabled(bool enabled, bool tracing = false);
+
+    static bool isEnabled()
+    {
+        return sEnabled.load(std::memory_order_relaxed);
+    }
+
+    static bool isTracing()
+    {
+        return sTracing.load(std::memory_order_relaxed);
+    }
+
+    //! Adds value to the counter name
+    static void count(const char* name, uint64_t value = 1);
+
+    //! Adds one timing of name
+    static void recordTime(const char* name,
+                           std::chrono::steady_clock::time_point start,
+                           std::chrono::steady_clock::time_point end);
+
+    //! \return Totals of every thread since the last reset()
+    static Report getReport();
+
+    //! Clears all totals and events
+    static void reset();
+
+    //! Sets where flush() writes reports; null drops them
+    static void setSink(std::shared_ptr<InstrumentationSink> sink);
+
+    //! Writes getReport() to the sink, if there is one, then resets
+    static void flush();
+
+private:
+    static std::atomic<bool> sEnabled;
+    static std::atomic<bool> sTracing;
+};
+
+/*!
+ * \class ScopedTimer
+ * \brief Times its own lifetime when instrumentation is on
+ */
+class ScopedTimer
+{
+public:
+    explicit ScopedTimer(const char* name) :
+        mName(Instrumentation::isEnabled() ? name : nullptr)
+    {
+        if (mName)
+        {
+            mStart = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ScopedTimer()
+    {
+        if (mName)
+        {
+            Instrumentation::recordTime(mName, mStart,
+                                        std::chrono::steady_clock::now());
+        }
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    const char* const mName;
+    std::chrono::steady_clock::time_point mStart;
+};
+
+/*!
+ * \class InstrumentationSink
+ * \brief Destination for Instrumentation reports
+ */
+class InstrumentationSink
+{
+public:
+    virtual ~InstrumentationSink()
+    {
+    }
+
+    virtual void write(const Instrumentation::Report& report) = 0;
+};
+
+/*!
+ * \class JSONInstrumentationSink
+ * \brief Writes the totals of a report as JSON
+ *
+ * {"counters": {name: value, ...},
+ *  "timers": {name: {"count": n, "totalSeconds": s, "minSeconds": s,
+ *                    "maxSeconds": s}, ...}}
+ */
+class JSONInstrumentationSink : public InstrumentationSink
+{
+public:
+    explicit JSONInstrumentationSink(std::ostream& stream) :
+        mStream(stream)
+    {
+    }
+
+    void write(const Instrumentation::Report& report) override;
+
+private:
+    std::ostream& mStream;
+};
+
+/*!
+ * \class ChromeTraceSink
+ * \brief Writes a report in the Chrome trace event format
+ *
+ * Each traced scope is a complete ("X") event, and each counter a counter
+ * ("C") event at the end of the trace.  The output loads in
+ * chrome://tracing or Perfetto.
+ */
+class ChromeTraceSink : public InstrumentationSink
+{
+public:
+    explicit ChromeTraceSink(std::ostream& stream) :
+        mStream(stream)
+    {
+    }
+
+    void write(const Instrumentation::Report& report) override;
+
+private:
+    std::ostream& mStream;
+};
+}
+
+#ifdef SIX_DISABLE_INSTRUMENTATION
+#define SIX_SCOPED_TIMER(name) ((void)0)
+#define SIX_COUNT(name, value) ((void)0)
+#else
+#define SIX_INSTRUMENTATION_CONCAT_(a, b) a##b
+#define SIX_INSTRUMENTATION_CONCAT(a, b) SIX_INSTRUMENTATION_CONCAT_(a, b)
+
+//! Times the rest of the enclosing scope as name
+#define SIX_SCOPED_TIMER(name) \
+    const six::ScopedTimer SIX_INSTRUMENTATION_CONCAT(sixScopedTimer_, \
+                                                      __LINE__)(name)
+
+//! Adds value to the counter name
+#define SIX_COUNT(name, value) \
+    do \
+    { \
+        if (six::Instrumentation::isEnabled()) \
+        { \
+            six::Instrumentation::count((name), (value)); \
+        } \
+    } while (0)
+#endif
+
+#endif
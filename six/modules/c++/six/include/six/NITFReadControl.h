@@ -31,6 +31,7 @@
 #include "six/ReadControl.h"
 #include "six/ReadControlFactory.h"
 #include "six/Adapters.h"
+#include "six/DataCache.h"
 #include <io/SeekableStreams.h>
 #include <import/nitf.hpp>
 #include <nitf/IOStreamReader.hpp>
@@ -192,6 +193,16 @@ struct NITFReadControl : public ReadControl
         return mRecord;
     }
 
+    /*!
+     *  Look up the XML DES in 'pCache' before parsing it, and add it after.
+     *  The Container still gets its own copy of the Data.  Pass nullptr
+     *  (the default for a new NITFReadControl) to always parse.
+     */
+    void setDataCache(DataCache* pCache = &DataCache::getInstance())
+    {
+        mDataCache = pCache;
+    }
+
     // Just in case you need it and are willing to cast
     nitf::Reader getReader() const
     {
@@ -283,6 +294,8 @@ private:
     // The issue occurs from the explicit destructor of
     // IOControl
     std::shared_ptr<nitf::IOInterface> mInterface;
+
+    DataCache* mDataCache = nullptr;
 };
 
 
@@ -22,6 +22,14 @@
 #ifndef __SIX_PARAMETER_H__
 #define __SIX_PARAMETER_H__
 
+#include <stdint.h>
+
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <string>
+#include <type_traits>
+
 #include "six/Types.h"
 #include <import/str.h>
 
@@ -35,33 +43,31 @@ namespace six
  *  for use with the Options object and allows the developer to set
  *  and get parameters directly from native types without string
  *  conversion.
+ *
+ *  Integers, floats, doubles and complex values are stored as such, along
+ *  with their text, so numeric parameters are read back without parsing.
+ *  Anything else is stored as its string.  Reading a number back as a type
+ *  that can hold it exactly is a cast; otherwise (e.g. 2.5 as an int) the
+ *  value is parsed from str() as it always has been.  str() is the same
+ *  text str::toString() gives for the type that was set.  The text is
+ *  formatted when a number is set, so const access never writes and a
+ *  Parameter can be read from several threads at once.
  */
 class Parameter
 {
 public:
     Parameter() = default;
-    //!  Destructor
-    ~Parameter()
-    {
-    }
-
-    Parameter(const Parameter & other)
-      : mValue(other.mValue),
-        mName(other.mName)
-    {
-    }
+    Parameter(const Parameter&) = default;
+    Parameter& operator=(const Parameter&) = default;
+    Parameter(Parameter&&) = default;
+    Parameter& operator=(Parameter&&) = default;
+    ~Parameter() = default;
 
     //!  Templated constructor, constructs from given value
     template<typename T>
-    Parameter(T value)
-    {
-        mValue = str::toString<T>(value);
-    }
-
-    template<typename T>
-    Parameter(std::complex<T> value)
+    Parameter(const T& value)
     {
-        mValue = str::toString<std::complex<T> >(mValue);
+        assign(value);
     }
 
      /*!
@@ -72,14 +78,15 @@ public:
     template<typename T>
     inline operator T() const
     {
-        return str::toType<T>(mValue);
+        return get(Tag<T>());
     }
 
     //!  Get a string as a string
-    inline std::string str() const
+    std::string str() const
     {
         return mValue;
     }
+
     //!  Get the parameter's name
     inline std::string getName() const
     {
@@ -90,7 +97,22 @@ public:
     template<typename T>
     inline std::complex<T> getComplex() const
     {
-        return str::toType<std::complex<T> >(mValue);
+        switch (mType)
+        {
+        case Type::COMPLEX_FLOAT:
+        case Type::COMPLEX_DOUBLE:
+            if (fits<T>(mNumber.real[0]) && fits<T>(mNumber.real[1]))
+            {
+                return std::complex<T>(static_cast<T>(mNumber.real[0]),
+                                       static_cast<T>(mNumber.real[1]));
+            }
+            break;
+        case Type::STRING:
+            return str::toType<std::complex<T> >(mValue);
+        default:
+            return std::complex<T>(get(Tag<T>()), T());
+        }
+        return str::toType<std::complex<T> >(str());
     }
 
     //!  Set the parameters' name
@@ -101,16 +123,9 @@ public:
 
     //!  Set the parameters' value
     template<typename T>
-    void setValue(T value)
+    void setValue(const T& value)
     {
-        mValue = str::toString<T>(value);
-    }
-
-    //! Overload templated setValue function
-    template<typename T>
-    void setValue(const std::complex<T>& value)
-    {
-        mValue = str::toString<std::complex<T> >(value);
+        assign(value);
     }
 
     //!  Get back const char*
@@ -121,7 +136,26 @@ public:
 
     bool operator==(const Parameter& o) const
     {
-        return mName == o.mName && mValue == o.mValue;
+        if (mName != o.mName)
+        {
+            return false;
+        }
+        if (mType != o.mType)
+        {
+            return str() == o.str();
+        }
+        switch (mType)
+        {
+        case Type::STRING:
+            return mValue == o.mValue;
+        case Type::INTEGER:
+            return mNumber.integer == o.mNumber.integer;
+        case Type::UNSIGNED:
+            return mNumber.unsignedInteger == o.mNumber.unsignedInteger;
+        default:
+            return mNumber.real[0] == o.mNumber.real[0] &&
+                    mNumber.real[1] == o.mNumber.real[1];
+        }
     }
 
     bool operator!=(const Parameter& o) const
@@ -130,12 +164,250 @@ public:
     }
 
 protected:
+    enum class Type
+    {
+        STRING,
+        INTEGER,
+        UNSIGNED,
+        FLOAT,
+        DOUBLE,
+        COMPLEX_FLOAT,
+        COMPLEX_DOUBLE
+    };
+
+    template<typename T>
+    struct Tag
+    {
+    };
+
+    // Integers other than bool and char (which are formatted as text)
+    template<typename T>
+    struct IsInteger : std::integral_constant<bool,
+            std::is_integral<T>::value &&
+            !std::is_same<T, bool>::value &&
+            !std::is_same<T, char>::value &&
+            !std::is_same<T, wchar_t>::value &&
+            !std::is_same<T, char16_t>::value &&
+            !std::is_same<T, char32_t>::value>
+    {
+    };
+
+    template<typename T>
+    struct IsNumber : std::integral_constant<bool,
+            IsInteger<T>::value ||
+            std::is_same<T, float>::value ||
+            std::is_same<T, double>::value>
+    {
+    };
+
+    void setString(const std::string& value)
+    {
+        mType = Type::STRING;
+        mValue = value;
+    }
+
+    void assign(const std::string& value)
+    {
+        setString(value);
+    }
+    void assign(const char* value)
+    {
+        setString(value);
+    }
+    void assign(float value)
+    {
+        setReal(Type::FLOAT, value, 0.0);
+    }
+    void assign(double value)
+    {
+        setReal(Type::DOUBLE, value, 0.0);
+    }
+
+    template<typename T>
+    typename std::enable_if<IsInteger<T>::value>::type assign(const T& value)
+    {
+        if (std::is_signed<T>::value)
+        {
+            mType = Type::INTEGER;
+            mNumber.integer = static_cast<int64_t>(value);
+        }
+        else
+        {
+            mType = Type::UNSIGNED;
+            mNumber.unsignedInteger = static_cast<uint64_t>(value);
+        }
+        mValue = format();
+    }
+
+    template<typename T>
+    typename std::enable_if<!IsNumber<T>::value>::type assign(const T& value)
+    {
+        setString(str::toString(value));
+    }
+
+    template<typename T>
+    void assign(const std::complex<T>& value)
+    {
+        // Only stored as doubles if that's exact
+        if (std::is_same<T, float>::value || std::is_same<T, double>::value ||
+            (IsInteger<T>::value && sizeof(T) <= 4))
+        {
+            setReal(std::is_same<T, float>::value ? Type::COMPLEX_FLOAT :
+                                                    Type::COMPLEX_DOUBLE,
+                    static_cast<double>(value.real()),
+                    static_cast<double>(value.imag()));
+        }
+        else
+        {
+            setString(str::toString(value));
+        }
+    }
+
+    void setReal(Type type, double real, double imag)
+    {
+        mType = type;
+        mNumber.real[0] = real;
+        mNumber.real[1] = imag;
+        mValue = format();
+    }
+
+    // The text str::toString() gives for the number as it was set
+    std::string format() const
+    {
+        switch (mType)
+        {
+        case Type::INTEGER:
+            return str::toString(mNumber.integer);
+        case Type::UNSIGNED:
+            return str::toString(mNumber.unsignedInteger);
+        case Type::FLOAT:
+            return str::toString(static_cast<float>(mNumber.real[0]));
+        case Type::DOUBLE:
+            return str::toString(mNumber.real[0]);
+        case Type::COMPLEX_FLOAT:
+            return str::toString(std::complex<float>(
+                    static_cast<float>(mNumber.real[0]),
+                    static_cast<float>(mNumber.real[1])));
+        case Type::COMPLEX_DOUBLE:
+            return str::toString(std::complex<double>(mNumber.real[0],
+                                                      mNumber.real[1]));
+        default:
+            return std::string();
+        }
+    }
+
+    // Whether a number converts to a T without changing its value
+    template<typename T, typename U>
+    static typename std::enable_if<std::is_floating_point<T>::value, bool>::type
+    fits(U)
+    {
+        return true;
+    }
+
+    template<typename T>
+    static typename std::enable_if<std::is_integral<T>::value, bool>::type
+    fits(int64_t value)
+    {
+        return value < 0 ?
+                (std::is_signed<T>::value &&
+                 value >= static_cast<int64_t>(
+                         std::numeric_limits<T>::lowest())) :
+                static_cast<uint64_t>(value) <=
+                        static_cast<uint64_t>(std::numeric_limits<T>::max());
+    }
+
+    template<typename T>
+    static typename std::enable_if<std::is_integral<T>::value, bool>::type
+    fits(uint64_t value)
+    {
+        return value <= static_cast<uint64_t>(std::numeric_limits<T>::max());
+    }
+
+    template<typename T>
+    static typename std::enable_if<std::is_integral<T>::value, bool>::type
+    fits(double value)
+    {
+        // max() + 1 is a power of two, so it's exact as a double
+        return std::trunc(value) == value &&
+                value >= static_cast<double>(
+                        std::numeric_limits<T>::lowest()) &&
+                value < static_cast<double>(
+                        std::numeric_limits<T>::max() / 2 + 1) * 2.0;
+    }
+
+    template<typename T>
+    T get(Tag<T>) const
+    {
+        return getNumber<T>(std::integral_constant<bool,
+                IsNumber<T>::value ||
+                std::is_same<T, long double>::value>());
+    }
+
+    template<typename T>
+    std::complex<T> get(Tag<std::complex<T> >) const
+    {
+        return getComplex<T>();
+    }
+
+    std::string get(Tag<std::string>) const
+    {
+        return str();
+    }
+
+    template<typename T>
+    T getNumber(std::true_type) const
+    {
+        switch (mType)
+        {
+        case Type::INTEGER:
+            if (fits<T>(mNumber.integer))
+            {
+                return static_cast<T>(mNumber.integer);
+            }
+            break;
+        case Type::UNSIGNED:
+            if (fits<T>(mNumber.unsignedInteger))
+            {
+                return static_cast<T>(mNumber.unsignedInteger);
+            }
+            break;
+        case Type::FLOAT:
+        case Type::DOUBLE:
+            if (fits<T>(mNumber.real[0]))
+            {
+                return static_cast<T>(mNumber.real[0]);
+            }
+            break;
+        case Type::STRING:
+            return str::toType<T>(mValue);
+        default:
+            break;
+        }
+        return str::toType<T>(str());
+    }
+
+    template<typename T>
+    T getNumber(std::false_type) const
+    {
+        return str::toType<T>(str());
+    }
+
+    union Number
+    {
+        int64_t integer;
+        uint64_t unsignedInteger;
+        double real[2];
+    };
+
+    Type mType = Type::STRING;
+    Number mNumber = {};
+
+    // The value as a string, formatted when a number is set so const
+    // access never writes
     std::string mValue;
     std::string mName;
-
 };
 
 }
 
 #endif
-
@@ -23,9 +23,12 @@
 #define __SIX_SERIALIZE_H__
 #pragma once
 
+#include <string.h>
+
 #include <vector>
 #include <algorithm>
 #include <iterator>
+#include <type_traits>
 
 #include <std/cstddef> // std::byte
 
@@ -134,10 +137,7 @@ struct Serializer<std::vector<T> >
         const size_t length = val.size();
 
         Serializer<size_t>::serializeImpl(length, swapBytes, buffer);
-        for (size_t ii = 0; ii < length; ++ii)
-        {
-            Serializer<T>::serializeImpl(val[ii], swapBytes, buffer);
-        }
+        serializeElements(val, swapBytes, buffer, IsBlock());
     }
     static void serializeImpl(const std::vector<T>& val,
                               bool swapBytes,
@@ -167,12 +167,8 @@ struct Serializer<std::vector<T> >
         size_t length;
         Serializer<size_t>::deserializeImpl(buffer, swapBytes, length);
         val.resize(currentVectorLength + length);
-
-        for (size_t ii = 0; ii < length; ++ii)
-        {
-            Serializer<T>::deserializeImpl(buffer, swapBytes,
-                val[currentVectorLength + ii]);
-        }
+        deserializeElements(buffer, swapBytes, currentVectorLength, val,
+                            IsBlock());
     }
     static void deserializeImpl(const std::byte*& buffer,
                                 bool swapBytes,
@@ -181,6 +177,82 @@ struct Serializer<std::vector<T> >
         auto& buffer_ = reinterpret_cast<const sys::byte*&>(buffer);
         deserializeImpl(buffer_, swapBytes, val);
     }
+
+private:
+    // Plain numbers are copied (and swapped) as one block rather than one
+    // element at a time
+    typedef std::integral_constant<bool,
+            std::is_arithmetic<T>::value &&
+            !std::is_same<T, bool>::value> IsBlock;
+
+    template<typename U>
+    static void serializeElements(const std::vector<T>& val,
+                                  bool swapBytes,
+                                  std::vector<U>& buffer,
+                                  std::true_type)
+    {
+        const size_t numBytes = val.size() * sizeof(T);
+        if (numBytes == 0)
+        {
+            return;
+        }
+        const size_t prevLength = buffer.size();
+        buffer.resize(prevLength + numBytes);
+        if (swapBytes)
+        {
+            sys::byteSwap(val.data(),
+                          static_cast<unsigned short>(sizeof(T)),
+                          val.size(),
+                          &buffer[prevLength]);
+        }
+        else
+        {
+            memcpy(&buffer[prevLength], val.data(), numBytes);
+        }
+    }
+    template<typename U>
+    static void serializeElements(const std::vector<T>& val,
+                                  bool swapBytes,
+                                  std::vector<U>& buffer,
+                                  std::false_type)
+    {
+        for (size_t ii = 0; ii < val.size(); ++ii)
+        {
+            Serializer<T>::serializeImpl(val[ii], swapBytes, buffer);
+        }
+    }
+
+    static void deserializeElements(const sys::byte*& buffer,
+                                    bool swapBytes,
+                                    size_t start,
+                                    std::vector<T>& val,
+                                    std::true_type)
+    {
+        const size_t length = val.size() - start;
+        if (length == 0)
+        {
+            return;
+        }
+        memcpy(&val[start], buffer, length * sizeof(T));
+        if (swapBytes)
+        {
+            sys::byteSwap(&val[start],
+                          static_cast<unsigned short>(sizeof(T)),
+                          length);
+        }
+        buffer += length * sizeof(T);
+    }
+    static void deserializeElements(const sys::byte*& buffer,
+                                    bool swapBytes,
+                                    size_t start,
+                                    std::vector<T>& val,
+                                    std::false_type)
+    {
+        for (size_t ii = start; ii < val.size(); ++ii)
+        {
+            Serializer<T>::deserializeImpl(buffer, swapBytes, val[ii]);
+        }
+    }
 };
 
 /*!
@@ -39,6 +39,7 @@
 #include <six/Init.h>
 #include <six/Utilities.h>
 #include <six/Logger.h>
+#include <six/CharConv.h>
 
 namespace six
 {
@@ -208,7 +209,7 @@ struct XmlLite final
     {
         try
         {
-            value = str::toType<T>(element.getCharacterData());
+            value = toNumber_<T>(element.getCharacterData());
         }
         catch (const except::BadCastException& ex)
         {
@@ -279,6 +280,24 @@ struct XmlLite final
     static void setAttribute(xml::lite::Element&, const xml::lite::QName&, const std::string& v);
 
 private:
+    template <typename T>
+    static T toNumber_(const std::string& s)
+    {
+        // six::charconv only knows about numbers; anything else still goes through str::
+        using is_number = std::integral_constant<bool, std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>;
+        return toNumber_<T>(s, is_number());
+    }
+    template <typename T>
+    static T toNumber_(const std::string& s, std::true_type)
+    {
+        return charconv::toType<T>(s);
+    }
+    template <typename T>
+    static T toNumber_(const std::string& s, std::false_type)
+    {
+        return str::toType<T>(s);
+    }
+
     xml::lite::Element& createInt_(const std::string& name, int p, xml::lite::Element& parent) const;
     xml::lite::Element& createString_(const std::string& name, const std::string& p, xml::lite::Element& parent) const;
     xml::lite::QName makeQName(const std::string& name) const;
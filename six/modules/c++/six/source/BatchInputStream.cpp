@@ -0,0 +1,527 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <six/BatchInputStream.h>
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <sstream>
+
+#include <except/Exception.h>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#define SIX_HAVE_IO_URING 1
+#endif
+#endif
+
+#ifndef SIX_HAVE_IO_URING
+#define SIX_HAVE_IO_URING 0
+#endif
+
+namespace
+{
+std::vector<six::BatchInputStream::Request> splitIntoChunks(
+        const std::vector<six::BatchInputStream::Request>& requests)
+{
+    std::vector<six::BatchInputStream::Request> chunks;
+    for (const auto& request : requests)
+    {
+        auto buffer = static_cast<std::byte*>(request.buffer);
+        for (size_t done = 0; done < request.size;
+             done += six::BatchInputStream::CHUNK_SIZE)
+        {
+            const size_t size = std::min(six::BatchInputStream::CHUNK_SIZE,
+                                         request.size - done);
+            chunks.push_back({request.offset + static_cast<int64_t>(done),
+                              size,
+                              buffer + done});
+        }
+    }
+    return chunks;
+}
+
+void throwShortRead(const six::BatchInputStream::Request& request,
+                    const std::string& reason)
+{
+    std::ostringstream ostr;
+    ostr << "Failed to read " << request.size << " bytes at offset "
+         << request.offset << ": " << reason;
+    throw except::IOException(Ctxt(ostr.str()));
+}
+}
+
+namespace six
+{
+#if SIX_HAVE_IO_URING
+/*
+ *  A minimal io_uring: the kernel's submission and completion rings mapped
+ *  into our address space, driven with the raw system calls so there's no
+ *  dependency on liburing.
+ */
+struct BatchInputStream::IOUring final
+{
+    explicit IOUring(unsigned entries)
+    {
+        io_uring_params params;
+        memset(&params, 0, sizeof(params));
+        mFd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+        if (mFd < 0)
+        {
+            throw except::IOException(Ctxt(
+                    std::string("io_uring_setup failed: ") + strerror(errno)));
+        }
+        mEntries = params.sq_entries;
+
+        mSQSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        mCQSize = params.cq_off.cqes +
+                params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap)
+        {
+            mSQSize = mCQSize = std::max(mSQSize, mCQSize);
+        }
+
+        mSQ = map(mSQSize, IORING_OFF_SQ_RING);
+        mCQ = singleMap ? mSQ : map(mCQSize, IORING_OFF_CQ_RING);
+        mSQEsSize = params.sq_entries * sizeof(io_uring_sqe);
+        mSQEs = static_cast<io_uring_sqe*>(map(mSQEsSize, IORING_OFF_SQES));
+
+        auto sq = static_cast<char*>(mSQ);
+        mSQHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        mSQTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        mSQMask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        mSQArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+
+        auto cq = static_cast<char*>(mCQ);
+        mCQHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        mCQTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        mCQMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        mCQEs = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    }
+
+    ~IOUring()
+    {
+        if (mSQEs)
+        {
+            munmap(mSQEs, mSQEsSize);
+        }
+        if (mCQ && mCQ != mSQ)
+        {
+            munmap(mCQ, mCQSize);
+        }
+        if (mSQ)
+        {
+            munmap(mSQ, mSQSize);
+        }
+        if (mFd >= 0)
+        {
+            ::close(mFd);
+        }
+    }
+
+    IOUring(const IOUring&) = delete;
+    IOUring& operator=(const IOUring&) = delete;
+
+    /*
+     *  Keeps up to mEntries reads in flight until every chunk is read.
+     *  Short reads are finished synchronously. The first error is thrown
+     *  once nothing is in flight, so no buffer is written after we return.
+     */
+    void read(int fileFd, const std::vector<Request>& chunks)
+    {
+        std::vector<iovec> iovecs(chunks.size());
+        size_t next = 0;
+        size_t inFlight = 0;
+        std::string error;
+        const Request* failed = nullptr;
+
+        while (inFlight > 0 || (next < chunks.size() && !failed))
+        {
+            // Fill the submission queue
+            unsigned tail = *mSQTail;
+            while (next < chunks.size() && inFlight < mEntries && !failed)
+            {
+                iovecs[next].iov_base = chunks[next].buffer;
+                iovecs[next].iov_len = chunks[next].size;
+
+                const unsigned index = tail & mSQMask;
+                io_uring_sqe& sqe = mSQEs[index];
+                memset(&sqe, 0, sizeof(sqe));
+                sqe.opcode = IORING_OP_READV;
+                sqe.fd = fileFd;
+                sqe.addr = reinterpret_cast<uint64_t>(&iovecs[next]);
+                sqe.len = 1;
+                sqe.off = static_cast<uint64_t>(chunks[next].offset);
+                sqe.user_data = next;
+                mSQArray[index] = index;
+
+                ++tail;
+                ++next;
+                ++inFlight;
+            }
+            __atomic_store_n(mSQTail, tail, __ATOMIC_RELEASE);
+
+            // Includes anything an interrupted call didn't submit
+            const unsigned toSubmit =
+                    tail - __atomic_load_n(mSQHead, __ATOMIC_ACQUIRE);
+
+            const int result = static_cast<int>(syscall(
+                    __NR_io_uring_enter, mFd, toSubmit, 1,
+                    IORING_ENTER_GETEVENTS, nullptr, 0));
+            if (result < 0 && errno != EINTR)
+            {
+                // Nothing more can be reaped safely; the ring is unusable
+                throw except::IOException(Ctxt(
+                        std::string("io_uring_enter failed: ") +
+                        strerror(errno)));
+            }
+
+            // Drain the completion queue
+            unsigned head = *mCQHead;
+            const unsigned cqTail = __atomic_load_n(mCQTail, __ATOMIC_ACQUIRE);
+            for (; head != cqTail; ++head)
+            {
+                const io_uring_cqe& cqe = mCQEs[head & mCQMask];
+                const Request& chunk = chunks[cqe.user_data];
+                --inFlight;
+                if (failed)
+                {
+                    continue;
+                }
+
+                if (cqe.res < 0)
+                {
+                    failed = &chunk;
+                    error = strerror(-cqe.res);
+                }
+                else if (static_cast<size_t>(cqe.res) < chunk.size)
+                {
+                    Request rest = chunk;
+                    rest.offset += cqe.res;
+                    rest.size -= cqe.res;
+                    rest.buffer = static_cast<std::byte*>(rest.buffer) +
+                            cqe.res;
+                    if (!readRemainder(fileFd, rest))
+                    {
+                        failed = &chunk;
+                        error = "end of file";
+                    }
+                }
+            }
+            __atomic_store_n(mCQHead, head, __ATOMIC_RELEASE);
+        }
+
+        if (failed)
+        {
+            throwShortRead(*failed, error);
+        }
+    }
+
+private:
+    void* map(size_t size, uint64_t offset)
+    {
+        void* const ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                               MAP_SHARED | MAP_POPULATE, mFd,
+                               static_cast<off_t>(offset));
+        if (ptr == MAP_FAILED)
+        {
+            throw except::IOException(Ctxt(
+                    std::string("Mapping the io_uring failed: ") +
+                    strerror(errno)));
+        }
+        return ptr;
+    }
+
+    static bool readRemainder(int fileFd, Request request)
+    {
+        auto buffer = static_cast<std::byte*>(request.buffer);
+        while (request.size > 0)
+        {
+            const ssize_t numRead = pread(fileFd, buffer, request.size,
+                                          static_cast<off_t>(request.offset));
+            if (numRead < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (numRead <= 0)
+            {
+                return false;
+            }
+            buffer += numRead;
+            request.offset += numRead;
+            request.size -= numRead;
+        }
+        return true;
+    }
+
+    int mFd = -1;
+    unsigned mEntries = 0;
+    void* mSQ = nullptr;
+    size_t mSQSize = 0;
+    void* mCQ = nullptr;
+    size_t mCQSize = 0;
+    io_uring_sqe* mSQEs = nullptr;
+    size_t mSQEsSize = 0;
+    unsigned* mSQHead = nullptr;
+    unsigned* mSQTail = nullptr;
+    unsigned mSQMask = 0;
+    unsigned* mSQArray = nullptr;
+    unsigned* mCQHead = nullptr;
+    unsigned* mCQTail = nullptr;
+    unsigned mCQMask = 0;
+    io_uring_cqe* mCQEs = nullptr;
+};
+#else
+struct BatchInputStream::IOUring final
+{
+};
+#endif
+
+BatchInputStream::BatchInputStream(const std::string& pathname,
+                                   Backend backend,
+                                   size_t queueDepth) :
+    io::FileInputStreamOS(pathname),
+    mBackend(Backend::SYNCHRONOUS),
+    mQueueDepth(static_cast<unsigned>(std::max<size_t>(queueDepth, 1)))
+{
+    if (backend == Backend::SYNCHRONOUS)
+    {
+        return;
+    }
+
+#if SIX_HAVE_IO_URING
+    try
+    {
+        mRings.emplace_back(new IOUring(mQueueDepth));
+        mBackend = Backend::IO_URING;
+    }
+    catch (const except::Exception&)
+    {
+        // Old kernels and seccomp profiles refuse io_uring
+        if (backend == Backend::IO_URING)
+        {
+            throw;
+        }
+    }
+#else
+    if (backend == Backend::IO_URING)
+    {
+        throw except::Exception(Ctxt(
+                "io_uring is not available on this platform"));
+    }
+#endif
+}
+
+BatchInputStream::~BatchInputStream()
+{
+}
+
+void BatchInputStream::readBatch(const std::vector<Request>& requests)
+{
+    const std::vector<Request> chunks = splitIntoChunks(requests);
+
+#if SIX_HAVE_IO_URING
+    if (mBackend == Backend::IO_URING)
+    {
+        std::unique_ptr<IOUring> ring = acquireRing();
+        if (ring.get())
+        {
+            // A ring that threw isn't put back; it may still have reads
+            // in flight
+            ring->read(mFile.getHandle(), chunks);
+            releaseRing(std::move(ring));
+            return;
+        }
+    }
+#endif
+
+    for (const Request& chunk : chunks)
+    {
+        readSynchronous(chunk);
+    }
+}
+
+std::unique_ptr<BatchInputStream::IOUring> BatchInputStream::acquireRing()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (!mRings.empty())
+        {
+            std::unique_ptr<IOUring> ring = std::move(mRings.back());
+            mRings.pop_back();
+            return ring;
+        }
+    }
+
+#if SIX_HAVE_IO_URING
+    try
+    {
+        return std::unique_ptr<IOUring>(new IOUring(mQueueDepth));
+    }
+    catch (const except::Exception&)
+    {
+        // Out of rings (e.g. locked memory limits); read synchronously
+    }
+#endif
+    return nullptr;
+}
+
+void BatchInputStream::releaseRing(std::unique_ptr<IOUring>&& ring)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mRings.push_back(std::move(ring));
+}
+
+void BatchInputStream::readSynchronous(const Request& request)
+{
+#if !defined(_WIN32)
+    auto buffer = static_cast<std::byte*>(request.buffer);
+    size_t done = 0;
+    while (done < request.size)
+    {
+        const ssize_t numRead = pread(
+                mFile.getHandle(), buffer + done, request.size - done,
+                static_cast<off_t>(request.offset + done));
+        if (numRead < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (numRead < 0)
+        {
+            throwShortRead(request, strerror(errno));
+        }
+        if (numRead == 0)
+        {
+            throwShortRead(request, "end of file");
+        }
+        done += numRead;
+    }
+#else
+    // No positional reads, so put the file pointer back afterward
+    std::lock_guard<std::mutex> lock(mMutex);
+    const sys::Off_T position = mFile.getCurrentOffset();
+    mFile.seekTo(request.offset, sys::File::FROM_START);
+    try
+    {
+        mFile.readInto(request.buffer, request.size);
+    }
+    catch (const except::Exception& ex)
+    {
+        mFile.seekTo(position, sys::File::FROM_START);
+        throwShortRead(request, ex.getMessage());
+    }
+    mFile.seekTo(position, sys::File::FROM_START);
+#endif
+}
+
+sys::SSize_T BatchInputStream::readImpl(void* buffer, size_t len)
+{
+    if (mBackend != Backend::IO_URING || len <= CHUNK_SIZE)
+    {
+        return io::FileInputStreamOS::readImpl(buffer, len);
+    }
+
+    const sys::Off_T avail = available();
+    if (!avail)
+    {
+        return io::InputStream::IS_EOF;
+    }
+    len = std::min(len, static_cast<size_t>(avail));
+
+    const sys::Off_T position = mFile.getCurrentOffset();
+    readBatch({{position, len, buffer}});
+    mFile.seekTo(position + static_cast<sys::Off_T>(len),
+                 sys::File::FROM_START);
+    return static_cast<sys::SSize_T>(len);
+}
+
+BatchIOInterface::BatchIOInterface(const std::string& pathname,
+                                   BatchInputStream::Backend backend) :
+    mStream(pathname, backend)
+{
+}
+
+void BatchIOInterface::readImpl(void* buffer, size_t size)
+{
+    mStream.read(buffer, size, true /*verifyFullRead*/);
+}
+
+void BatchIOInterface::writeImpl(const void*, size_t)
+{
+    throw except::Exception(Ctxt("BatchIOInterface is read-only"));
+}
+
+bool BatchIOInterface::canSeekImpl() const
+{
+    return true;
+}
+
+nitf::Off BatchIOInterface::seekImpl(nitf::Off offset, int whence)
+{
+    io::Seekable::Whence ioWhence = io::Seekable::START;
+    switch (whence)
+    {
+    case SEEK_SET:
+        ioWhence = io::Seekable::START;
+        break;
+    case SEEK_CUR:
+        ioWhence = io::Seekable::CURRENT;
+        break;
+    case SEEK_END:
+        ioWhence = io::Seekable::END;
+        break;
+    default:
+        throw except::Exception(Ctxt(
+                "Unknown whence value: " + std::to_string(whence)));
+    }
+    return mStream.seek(offset, ioWhence);
+}
+
+nitf::Off BatchIOInterface::tellImpl() const
+{
+    return mStream.tell();
+}
+
+nitf::Off BatchIOInterface::getSizeImpl() const
+{
+    return mStream.tell() + mStream.available();
+}
+
+int BatchIOInterface::getModeImpl() const
+{
+    return NITF_ACCESS_READONLY;
+}
+
+void BatchIOInterface::closeImpl()
+{
+    mStream.close();
+}
+}
@@ -0,0 +1,487 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "six/BinaryXML.h"
+
+#include <string.h>
+
+#include <limits>
+#include <unordered_map>
+
+#include <sys/Conf.h>
+#include <except/Exception.h>
+#include <str/Manip.h>
+#include <xml/lite/Element.h>
+#include <logging/NullLogger.h>
+
+namespace
+{
+constexpr char MAGIC[] = { 'S', 'I', 'X', 'B' };
+constexpr size_t HEADER_SIZE = 32;
+constexpr uint32_t NONE = 0xFFFFFFFF;
+
+// Words in an element record
+enum ElementWord
+{
+    ELEMENT_QNAME = 0, // offset, length
+    ELEMENT_URI = 2,
+    ELEMENT_TEXT = 4,
+    ELEMENT_PARENT = 6,
+    ELEMENT_FIRST_CHILD,
+    ELEMENT_NEXT_SIBLING,
+    ELEMENT_FIRST_ATTRIBUTE,
+    ELEMENT_NUM_ATTRIBUTES,
+    ELEMENT_WORDS
+};
+// Words in an attribute record
+enum AttributeWord
+{
+    ATTRIBUTE_QNAME = 0,
+    ATTRIBUTE_URI = 2,
+    ATTRIBUTE_VALUE = 4,
+    ATTRIBUTE_WORDS = 6
+};
+constexpr size_t ELEMENT_SIZE = ELEMENT_WORDS * sizeof(uint32_t);
+constexpr size_t ATTRIBUTE_SIZE = ATTRIBUTE_WORDS * sizeof(uint32_t);
+
+// Explicitly little-endian so the data is portable; this is a plain load
+// on little-endian hosts.
+inline uint32_t load(const std::byte* p)
+{
+    const auto b = reinterpret_cast<const unsigned char*>(p);
+    return static_cast<uint32_t>(b[0]) | (static_cast<uint32_t>(b[1]) << 8) |
+        (static_cast<uint32_t>(b[2]) << 16) | (static_cast<uint32_t>(b[3]) << 24);
+}
+inline uint32_t load(const std::byte* record, size_t word)
+{
+    return load(record + word * sizeof(uint32_t));
+}
+inline void store(uint32_t value, std::vector<std::byte>& bytes)
+{
+    for (size_t ii = 0; ii < sizeof(value); ++ii)
+    {
+        bytes.push_back(static_cast<std::byte>((value >> (8 * ii)) & 0xFF));
+    }
+}
+
+inline size_t toIndex(uint32_t value)
+{
+    return value == NONE ? six::binary::DocumentView::npos : value;
+}
+
+std::string toString(const coda_oss::u8string& s)
+{
+    return std::string(reinterpret_cast<const char*>(s.c_str()), s.size());
+}
+
+class Encoder final
+{
+public:
+    void addElement(const xml::lite::Element& element, uint32_t parent)
+    {
+        const auto index = newRecord(mElements, ELEMENT_WORDS);
+        auto word = mElements.begin() + index * ELEMENT_WORDS;
+        addString(element.getQName(), word + ELEMENT_QNAME);
+        addString(element.getUri(), word + ELEMENT_URI);
+        coda_oss::u8string characterData;
+        addString(toString(element.getCharacterData(characterData)), word + ELEMENT_TEXT);
+        word[ELEMENT_PARENT] = parent;
+        word[ELEMENT_FIRST_CHILD] = NONE;
+        word[ELEMENT_NEXT_SIBLING] = NONE;
+
+        const auto& attributes = element.getAttributes();
+        const auto numAttributes = static_cast<size_t>(attributes.getLength());
+        mElements[index * ELEMENT_WORDS + ELEMENT_FIRST_ATTRIBUTE] =
+                static_cast<uint32_t>(mAttributes.size() / ATTRIBUTE_WORDS);
+        mElements[index * ELEMENT_WORDS + ELEMENT_NUM_ATTRIBUTES] =
+                static_cast<uint32_t>(numAttributes);
+        for (size_t ii = 0; ii < numAttributes; ++ii)
+        {
+            const auto i = static_cast<int>(ii);
+            const auto attribute = newRecord(mAttributes, ATTRIBUTE_WORDS) * ATTRIBUTE_WORDS;
+            addString(attributes.getQName(i), mAttributes.begin() + attribute + ATTRIBUTE_QNAME);
+            addString(attributes.getUri(i), mAttributes.begin() + attribute + ATTRIBUTE_URI);
+            addString(attributes.getValue(i), mAttributes.begin() + attribute + ATTRIBUTE_VALUE);
+        }
+
+        // Children are written right after their parent (document order),
+        // and mElements may move, so link them up by index.
+        uint32_t previous = NONE;
+        for (const auto pChild : element.getChildren())
+        {
+            const auto child = static_cast<uint32_t>(mElements.size() / ELEMENT_WORDS);
+            addElement(*pChild, index);
+            if (previous == NONE)
+            {
+                mElements[index * ELEMENT_WORDS + ELEMENT_FIRST_CHILD] = child;
+            }
+            else
+            {
+                mElements[previous * ELEMENT_WORDS + ELEMENT_NEXT_SIBLING] = child;
+            }
+            previous = child;
+        }
+    }
+
+    std::vector<std::byte> finish() const
+    {
+        std::vector<std::byte> retval;
+        retval.reserve(HEADER_SIZE + (mElements.size() + mAttributes.size()) * sizeof(uint32_t) +
+                       mStrings.size());
+        for (auto ch : MAGIC)
+        {
+            retval.push_back(static_cast<std::byte>(ch));
+        }
+        store(six::binary::VERSION, retval);
+        store(static_cast<uint32_t>(mElements.size() / ELEMENT_WORDS), retval);
+        store(static_cast<uint32_t>(mAttributes.size() / ATTRIBUTE_WORDS), retval);
+        store(static_cast<uint32_t>(mStrings.size()), retval);
+        store(0, retval);
+        store(0, retval);
+        store(0, retval);
+
+        for (auto word : mElements)
+        {
+            store(word, retval);
+        }
+        for (auto word : mAttributes)
+        {
+            store(word, retval);
+        }
+        const auto strings = reinterpret_cast<const std::byte*>(mStrings.data());
+        retval.insert(retval.end(), strings, strings + mStrings.size());
+        return retval;
+    }
+
+private:
+    static uint32_t newRecord(std::vector<uint32_t>& records, size_t numWords)
+    {
+        const auto retval = records.size() / numWords;
+        if (retval >= NONE)
+        {
+            throw except::Exception(Ctxt("Too many XML nodes for six::binary"));
+        }
+        records.resize(records.size() + numWords);
+        return static_cast<uint32_t>(retval);
+    }
+
+    // Names repeat a lot (and values some), so each distinct string is
+    // stored once.
+    void addString(const std::string& s, std::vector<uint32_t>::iterator ref)
+    {
+        if (s.empty())
+        {
+            ref[0] = ref[1] = 0;
+            return;
+        }
+        auto it = mOffsets.find(s);
+        if (it == mOffsets.end())
+        {
+            if (mStrings.size() + s.size() > std::numeric_limits<uint32_t>::max())
+            {
+                throw except::Exception(Ctxt("Too much XML text for six::binary"));
+            }
+            it = mOffsets.emplace(s, static_cast<uint32_t>(mStrings.size())).first;
+            mStrings += s;
+        }
+        ref[0] = it->second;
+        ref[1] = static_cast<uint32_t>(s.size());
+    }
+
+    std::vector<uint32_t> mElements;
+    std::vector<uint32_t> mAttributes;
+    std::string mStrings;
+    std::unordered_map<std::string, uint32_t> mOffsets;
+};
+}
+
+namespace six
+{
+namespace binary
+{
+constexpr size_t DocumentView::npos;
+
+bool isBinary(std::span<const std::byte> bytes)
+{
+    return (bytes.size() >= sizeof(MAGIC)) &&
+        (memcmp(bytes.data(), MAGIC, sizeof(MAGIC)) == 0);
+}
+bool isBinary(const std::string& bytes)
+{
+    return isBinary(std::span<const std::byte>(
+            reinterpret_cast<const std::byte*>(bytes.data()), bytes.size()));
+}
+
+DocumentView::DocumentView(std::span<const std::byte> bytes)
+{
+    if ((bytes.size() < HEADER_SIZE) || !isBinary(bytes))
+    {
+        throw except::Exception(Ctxt("Not six::binary data"));
+    }
+    const auto header = bytes.data();
+    mVersion = load(header, 1);
+    if (mVersion != VERSION)
+    {
+        throw except::Exception(Ctxt("Unsupported six::binary version " +
+                                     std::to_string(mVersion)));
+    }
+    mNumElements = load(header, 2);
+    mNumAttributes = load(header, 3);
+    mStringPoolSize = load(header, 4);
+
+    // 64-bit math: none of these can overflow
+    const uint64_t size = static_cast<uint64_t>(HEADER_SIZE) +
+        static_cast<uint64_t>(mNumElements) * ELEMENT_SIZE +
+        static_cast<uint64_t>(mNumAttributes) * ATTRIBUTE_SIZE + mStringPoolSize;
+    if (size != bytes.size())
+    {
+        throw except::Exception(Ctxt("six::binary data is " + std::to_string(bytes.size()) +
+                                     " bytes, expected " + std::to_string(size)));
+    }
+    if (mNumElements == 0)
+    {
+        throw except::Exception(Ctxt("six::binary data has no root element"));
+    }
+    mElements = header + HEADER_SIZE;
+    mAttributes = mElements + mNumElements * ELEMENT_SIZE;
+    mStrings = reinterpret_cast<const char*>(mAttributes + mNumAttributes * ATTRIBUTE_SIZE);
+
+    const auto checkString = [&](const std::byte* record, size_t word) {
+        const uint64_t end = static_cast<uint64_t>(load(record, word)) + load(record, word + 1);
+        if (end > mStringPoolSize)
+        {
+            throw except::Exception(Ctxt("six::binary string is out of range"));
+        }
+    };
+    for (size_t ii = 0; ii < mNumAttributes; ++ii)
+    {
+        const auto record = mAttributes + ii * ATTRIBUTE_SIZE;
+        checkString(record, ATTRIBUTE_QNAME);
+        checkString(record, ATTRIBUTE_URI);
+        checkString(record, ATTRIBUTE_VALUE);
+    }
+
+    // Elements are in document order, so links only ever point forward
+    // (and parents backward); that rules out cycles.
+    for (size_t ii = 0; ii < mNumElements; ++ii)
+    {
+        const auto record = element(ii);
+        checkString(record, ELEMENT_QNAME);
+        checkString(record, ELEMENT_URI);
+        checkString(record, ELEMENT_TEXT);
+
+        const auto parent = toIndex(load(record, ELEMENT_PARENT));
+        const auto firstChild = toIndex(load(record, ELEMENT_FIRST_CHILD));
+        const auto nextSibling = toIndex(load(record, ELEMENT_NEXT_SIBLING));
+        const bool badParent = (ii == 0) ? (parent != npos) : (parent >= ii);
+        const bool badChild = (firstChild != npos) &&
+            ((firstChild <= ii) || (firstChild >= mNumElements) ||
+             (toIndex(load(element(firstChild), ELEMENT_PARENT)) != ii));
+        const bool badSibling = (nextSibling != npos) &&
+            ((nextSibling <= ii) || (nextSibling >= mNumElements) ||
+             (toIndex(load(element(nextSibling), ELEMENT_PARENT)) != parent));
+        const uint64_t attributesEnd = static_cast<uint64_t>(load(record, ELEMENT_FIRST_ATTRIBUTE)) +
+            load(record, ELEMENT_NUM_ATTRIBUTES);
+        if (badParent || badChild || badSibling || (attributesEnd > mNumAttributes))
+        {
+            throw except::Exception(Ctxt("six::binary element " + std::to_string(ii) +
+                                         " is malformed"));
+        }
+    }
+}
+
+const std::byte* DocumentView::element(size_t index) const
+{
+    return mElements + index * ELEMENT_SIZE;
+}
+const std::byte* DocumentView::attribute(size_t element_, size_t attribute_) const
+{
+    const auto record = element(element_);
+    if (attribute_ >= load(record, ELEMENT_NUM_ATTRIBUTES))
+    {
+        throw except::Exception(Ctxt("Attribute index " + std::to_string(attribute_) +
+                                     " is out of range"));
+    }
+    return mAttributes + (load(record, ELEMENT_FIRST_ATTRIBUTE) + attribute_) * ATTRIBUTE_SIZE;
+}
+DocumentView::String DocumentView::string(const std::byte* ref) const
+{
+    String retval;
+    retval.data = mStrings + load(ref, 0);
+    retval.size = load(ref, 1);
+    return retval;
+}
+
+DocumentView::String DocumentView::getQName(size_t element_) const
+{
+    return string(element(element_) + ELEMENT_QNAME * sizeof(uint32_t));
+}
+DocumentView::String DocumentView::getLocalName(size_t element_) const
+{
+    auto retval = getQName(element_);
+    const auto colon = static_cast<const char*>(memchr(retval.data, ':', retval.size));
+    if (colon != nullptr)
+    {
+        retval.size -= (colon + 1) - retval.data;
+        retval.data = colon + 1;
+    }
+    return retval;
+}
+DocumentView::String DocumentView::getUri(size_t element_) const
+{
+    return string(element(element_) + ELEMENT_URI * sizeof(uint32_t));
+}
+DocumentView::String DocumentView::getCharacterData(size_t element_) const
+{
+    return string(element(element_) + ELEMENT_TEXT * sizeof(uint32_t));
+}
+
+size_t DocumentView::getParent(size_t element_) const
+{
+    return toIndex(load(element(element_), ELEMENT_PARENT));
+}
+size_t DocumentView::getFirstChild(size_t element_) const
+{
+    return toIndex(load(element(element_), ELEMENT_FIRST_CHILD));
+}
+size_t DocumentView::getNextSibling(size_t element_) const
+{
+    return toIndex(load(element(element_), ELEMENT_NEXT_SIBLING));
+}
+size_t DocumentView::findChild(size_t element_, const std::string& localName) const
+{
+    for (auto child = getFirstChild(element_); child != npos; child = getNextSibling(child))
+    {
+        if (getLocalName(child) == localName)
+        {
+            return child;
+        }
+    }
+    return npos;
+}
+
+size_t DocumentView::getNumAttributes(size_t element_) const
+{
+    return load(element(element_), ELEMENT_NUM_ATTRIBUTES);
+}
+DocumentView::String DocumentView::getAttributeQName(size_t element_, size_t attribute_) const
+{
+    return string(attribute(element_, attribute_) + ATTRIBUTE_QNAME * sizeof(uint32_t));
+}
+DocumentView::String DocumentView::getAttributeUri(size_t element_, size_t attribute_) const
+{
+    return string(attribute(element_, attribute_) + ATTRIBUTE_URI * sizeof(uint32_t));
+}
+DocumentView::String DocumentView::getAttributeValue(size_t element_, size_t attribute_) const
+{
+    return string(attribute(element_, attribute_) + ATTRIBUTE_VALUE * sizeof(uint32_t));
+}
+
+std::unique_ptr<xml::lite::Document> DocumentView::toDocument() const
+{
+    // Parents always come before their children, and siblings in order,
+    // so one pass appending each element to its parent rebuilds the tree.
+    std::vector<xml::lite::Element*> elements(mNumElements);
+    std::unique_ptr<xml::lite::Element> root;
+    for (size_t ii = 0; ii < mNumElements; ++ii)
+    {
+        auto pElement = xml::lite::Element::create(getQName(ii).str(), getUri(ii).str());
+        const auto characterData = getCharacterData(ii);
+        pElement->setCharacterData(coda_oss::u8string(
+                reinterpret_cast<const coda_oss::u8string::value_type*>(characterData.data),
+                characterData.size));
+
+        auto& attributes = pElement->getAttributes();
+        for (size_t jj = 0; jj < getNumAttributes(ii); ++jj)
+        {
+            xml::lite::AttributeNode node;
+            node.setQName(getAttributeQName(ii, jj).str());
+            node.setUri(getAttributeUri(ii, jj).str());
+            node.setValue(getAttributeValue(ii, jj).str());
+            attributes.add(node);
+        }
+
+        if (ii == 0)
+        {
+            elements[ii] = pElement.get();
+            root = std::move(pElement);
+        }
+        else
+        {
+            elements[ii] = &(elements[getParent(ii)]->addChild(std::move(pElement)));
+        }
+    }
+    return std::unique_ptr<xml::lite::Document>(new xml::lite::Document(std::move(root)));
+}
+
+std::vector<std::byte> encode(const xml::lite::Document& document)
+{
+    Encoder encoder;
+    encoder.addElement(getRootElement(document), NONE);
+    return encoder.finish();
+}
+
+std::unique_ptr<xml::lite::Document> decode(std::span<const std::byte> bytes)
+{
+    return DocumentView(bytes).toDocument();
+}
+}
+
+std::vector<std::byte> toBinary(const Data& data,
+                                const XMLControlRegistry* xmlRegistry,
+                                logging::Logger* logger)
+{
+    if (!xmlRegistry)
+    {
+        xmlRegistry = &XMLControlFactory::getInstance();
+    }
+    logging::NullLogger nullLogger;
+    const std::unique_ptr<XMLControl> xmlControl(
+            xmlRegistry->newXMLControl(data.getDataType(), logger ? logger : &nullLogger));
+
+    const std::vector<std::filesystem::path>* pSchemaPaths = nullptr; // no validation
+    const auto doc = xmlControl->toXML(data, pSchemaPaths);
+    return binary::encode(*doc);
+}
+
+std::unique_ptr<Data> parseDataFromBinary(const XMLControlRegistry& xmlReg,
+    std::span<const std::byte> bytes,
+    const std::vector<std::filesystem::path>* pSchemaPaths,
+    logging::Logger* pLogger)
+{
+    const auto doc = binary::decode(bytes);
+
+    //! Check the root localName for the XML type, as parseData() does
+    const auto xmlType = getRootElement(*doc).getLocalName();
+    DataType dataType;
+    if (str::startsWith(xmlType, "SICD"))
+        dataType = DataType::COMPLEX;
+    else if (str::startsWith(xmlType, "SIDD"))
+        dataType = DataType::DERIVED;
+    else
+        throw except::Exception(Ctxt("Unexpected XML type"));
+
+    logging::NullLogger nullLogger;
+    const std::unique_ptr<XMLControl> xmlControl(
+            xmlReg.newXMLControl(dataType, pLogger ? pLogger : &nullLogger));
+    return xmlControl->fromXML(*doc, pSchemaPaths);
+}
+}
@@ -0,0 +1,512 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "six/CharConv.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <locale.h>
+#include <errno.h>
+
+#include <cmath>
+
+namespace
+{
+inline bool isDigit(char c)
+{
+    return (c >= '0') && (c <= '9');
+}
+
+// The current C locale's radix character; only needed on the slow paths
+// which go through the C library.
+inline char radixChar()
+{
+    const struct lconv* const lc = localeconv();
+    return ((lc != nullptr) && (lc->decimal_point != nullptr) && (lc->decimal_point[0] != '\0')) ?
+        lc->decimal_point[0] : '.';
+}
+
+// Every double up to 2^53 and every power of ten up to 1e22 are exact, so
+// a single multiply or divide is correctly rounded (Clinger's fast path).
+constexpr uint64_t maxExactMantissa = uint64_t(1) << 53;
+constexpr int maxExactPow10 = 22;
+constexpr double exactPow10[maxExactPow10 + 1] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+// A decimal number is never longer than this; if it is, strtod() gets a
+// heap copy instead of the stack buffer.
+constexpr size_t maxStackDigits = 64;
+
+double slowStrtod(const char* first, const char* last, size_t radixPos, bool& ok)
+{
+    // strtod() wants a NUL-terminated string using the current radix.
+    const size_t length = static_cast<size_t>(last - first);
+    char stackBuf[maxStackDigits + 1];
+    std::string heapBuf;
+    char* buf = stackBuf;
+    if (length > maxStackDigits)
+    {
+        heapBuf.resize(length);
+        buf = &heapBuf[0];
+    }
+    memcpy(buf, first, length);
+    buf[length] = '\0';
+    if (radixPos < length)
+    {
+        buf[radixPos] = radixChar();
+    }
+
+    errno = 0;
+    char* end = nullptr;
+    const double retval = strtod(buf, &end);
+    // ERANGE is reported for both overflow and underflow; only overflow
+    // is an error, matching what std::from_chars() would do with denormals.
+    ok = (end == buf + length) && !((errno == ERANGE) && std::isinf(retval));
+    return retval;
+}
+
+template <typename TUInt>
+six::charconv::from_chars_result parseDigits(const char* first, const char* last, TUInt& value)
+{
+    const char* p = first;
+    TUInt retval = 0;
+    constexpr auto maxValue = std::numeric_limits<TUInt>::max();
+    for (; (p != last) && isDigit(*p); ++p)
+    {
+        const auto digit = static_cast<TUInt>(*p - '0');
+        if (retval > (maxValue - digit) / 10)
+        {
+            while ((p != last) && isDigit(*p))
+            {
+                ++p;
+            }
+            return { p, std::errc::result_out_of_range };
+        }
+        retval = retval * 10 + digit;
+    }
+    if (p == first)
+    {
+        return { first, std::errc::invalid_argument };
+    }
+    value = retval;
+    return { p, std::errc() };
+}
+
+char* writeDigits(char* first, char* last, uint64_t value)
+{
+    char buf[24];
+    char* p = buf + sizeof(buf);
+    do
+    {
+        *--p = static_cast<char>('0' + (value % 10));
+        value /= 10;
+    } while (value != 0);
+
+    const auto length = static_cast<size_t>(buf + sizeof(buf) - p);
+    if (static_cast<size_t>(last - first) < length)
+    {
+        return nullptr;
+    }
+    memcpy(first, p, length);
+    return first + length;
+}
+
+// Significant digits of a double as "%.16e" would write them, so that
+// fewer digits can be tried without going back to the C library.
+constexpr int maxDigits = 17;
+struct DecimalDigits final
+{
+    bool negative = false;
+    char digits[maxDigits] = {};
+    int exponent = 0; // of digits[0]
+    int numDigits = maxDigits;
+
+    // Rounding the already rounded 17 digits again can go the wrong way
+    // when what's dropped is exactly "5", "50", ...; the caller has to ask
+    // the C library for those.
+    bool isTie(int precision) const
+    {
+        if ((precision >= maxDigits) || (digits[precision] != '5'))
+        {
+            return false;
+        }
+        for (int ii = precision + 1; ii < maxDigits; ++ii)
+        {
+            if (digits[ii] != '0')
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    DecimalDigits round(int precision) const
+    {
+        DecimalDigits retval(*this);
+        retval.numDigits = precision;
+        if ((precision < maxDigits) && (digits[precision] >= '5'))
+        {
+            int ii = precision - 1;
+            for (; (ii >= 0) && (retval.digits[ii] == '9'); --ii)
+            {
+                retval.digits[ii] = '0';
+            }
+            if (ii >= 0)
+            {
+                ++retval.digits[ii];
+            }
+            else
+            {
+                // 9.99... rounded up to 10.0
+                retval.digits[0] = '1';
+                ++retval.exponent;
+            }
+        }
+        while ((retval.numDigits > 1) && (retval.digits[retval.numDigits - 1] == '0'))
+        {
+            --retval.numDigits;
+        }
+        return retval;
+    }
+
+    // Same layout as "%.<precision>g"
+    six::charconv::to_chars_result format(char* first, char* last, int precision) const
+    {
+        char buf[32];
+        char* p = buf;
+        if (negative)
+        {
+            *p++ = '-';
+        }
+        if ((exponent < -4) || (exponent >= precision))
+        {
+            *p++ = digits[0];
+            if (numDigits > 1)
+            {
+                *p++ = '.';
+                memcpy(p, digits + 1, numDigits - 1);
+                p += numDigits - 1;
+            }
+            *p++ = 'e';
+            *p++ = exponent < 0 ? '-' : '+';
+            const int absExponent = exponent < 0 ? -exponent : exponent;
+            if (absExponent < 10)
+            {
+                *p++ = '0';
+            }
+            p = writeDigits(p, buf + sizeof(buf), static_cast<uint64_t>(absExponent));
+        }
+        else if (exponent < 0)
+        {
+            *p++ = '0';
+            *p++ = '.';
+            for (int ii = -1; ii > exponent; --ii)
+            {
+                *p++ = '0';
+            }
+            memcpy(p, digits, numDigits);
+            p += numDigits;
+        }
+        else
+        {
+            for (int ii = 0; ii <= exponent; ++ii)
+            {
+                *p++ = ii < numDigits ? digits[ii] : '0';
+            }
+            if (numDigits > exponent + 1)
+            {
+                *p++ = '.';
+                memcpy(p, digits + exponent + 1, numDigits - exponent - 1);
+                p += numDigits - exponent - 1;
+            }
+        }
+
+        const auto length = static_cast<size_t>(p - buf);
+        if (static_cast<size_t>(last - first) < length)
+        {
+            return { last, std::errc::value_too_large };
+        }
+        memcpy(first, buf, length);
+        return { first + length, std::errc() };
+    }
+};
+}
+
+namespace six
+{
+namespace charconv
+{
+from_chars_result from_chars(const char* first, const char* last, double& value)
+{
+    const char* p = first;
+    const bool negative = (p != last) && (*p == '-');
+    if ((p != last) && ((*p == '-') || (*p == '+')))
+    {
+        ++p;
+    }
+
+    // Mantissa: collect up to 19 significant digits, which always fit
+    uint64_t mantissa = 0;
+    size_t numSignificant = 0;
+    bool truncated = false;
+    int exponent = 0;
+    size_t numDigits = 0;
+    size_t radixPos = std::string::npos;
+    for (; p != last; ++p)
+    {
+        if (isDigit(*p))
+        {
+            ++numDigits;
+            if ((mantissa == 0) && (*p == '0'))
+            {
+                // leading zero; only the position of the radix matters
+            }
+            else if (numSignificant < 19)
+            {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+                ++numSignificant;
+            }
+            else
+            {
+                truncated = truncated || (*p != '0');
+                ++exponent;
+            }
+            if (radixPos != std::string::npos)
+            {
+                --exponent;
+            }
+        }
+        else if ((*p == '.') && (radixPos == std::string::npos))
+        {
+            radixPos = static_cast<size_t>(p - first);
+        }
+        else
+        {
+            break;
+        }
+    }
+    if (numDigits == 0)
+    {
+        return { first, std::errc::invalid_argument };
+    }
+
+    // Optional exponent; an 'e' not followed by digits isn't part of the number
+    if ((p != last) && ((*p == 'e') || (*p == 'E')))
+    {
+        const char* q = p + 1;
+        const bool negativeExp = (q != last) && (*q == '-');
+        if ((q != last) && ((*q == '-') || (*q == '+')))
+        {
+            ++q;
+        }
+        uint64_t exp10 = 0;
+        const auto result = parseDigits(q, last, exp10);
+        if (result.ec != std::errc::invalid_argument)
+        {
+            p = result.ptr;
+            const auto bigExp = (result.ec == std::errc()) && (exp10 < 100000) ?
+                static_cast<int>(exp10) : 100000;
+            exponent += negativeExp ? -bigExp : bigExp;
+        }
+    }
+
+#if FLT_EVAL_METHOD == 0
+    if (!truncated && (mantissa <= maxExactMantissa) &&
+        (exponent >= -maxExactPow10) && (exponent <= maxExactPow10))
+    {
+        auto retval = static_cast<double>(mantissa);
+        retval = exponent < 0 ? retval / exactPow10[-exponent] : retval * exactPow10[exponent];
+        value = negative ? -retval : retval;
+        return { p, std::errc() };
+    }
+#endif
+    if (mantissa == 0)
+    {
+        value = negative ? -0.0 : 0.0;
+        return { p, std::errc() };
+    }
+
+    bool ok;
+    const double retval = slowStrtod(first, p, radixPos, ok);
+    if (!ok)
+    {
+        return { p, std::errc::result_out_of_range };
+    }
+    value = retval;
+    return { p, std::errc() };
+}
+
+from_chars_result from_chars(const char* first, const char* last, int64_t& value)
+{
+    const char* p = first;
+    const bool negative = (p != last) && (*p == '-');
+    if ((p != last) && ((*p == '-') || (*p == '+')))
+    {
+        ++p;
+    }
+
+    uint64_t magnitude = 0;
+    auto result = parseDigits(p, last, magnitude);
+    if (result.ec == std::errc::invalid_argument)
+    {
+        result.ptr = first;
+        return result;
+    }
+    constexpr auto maxPositive = static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+    if ((result.ec != std::errc()) || (magnitude > maxPositive + (negative ? 1 : 0)))
+    {
+        return { result.ptr, std::errc::result_out_of_range };
+    }
+    value = negative ? static_cast<int64_t>(0 - magnitude) : static_cast<int64_t>(magnitude);
+    return result;
+}
+from_chars_result from_chars(const char* first, const char* last, uint64_t& value)
+{
+    const char* p = first;
+    if ((p != last) && (*p == '+'))
+    {
+        ++p;
+    }
+    auto result = parseDigits(p, last, value);
+    if (result.ec == std::errc::invalid_argument)
+    {
+        result.ptr = first;
+    }
+    return result;
+}
+
+to_chars_result to_chars(char* first, char* last, double value, int precision)
+{
+    // Big enough for "%.17g" of anything: sign, 17 digits, radix, "e-308"
+    char buf[32];
+    const int length = snprintf(buf, sizeof(buf), "%.*g", precision, value);
+    if ((length < 0) || (static_cast<size_t>(length) >= sizeof(buf)) ||
+        (static_cast<size_t>(last - first) < static_cast<size_t>(length)))
+    {
+        return { last, std::errc::value_too_large };
+    }
+
+    const char radix = radixChar();
+    for (int ii = 0; ii < length; ++ii)
+    {
+        first[ii] = (buf[ii] == radix) ? '.' : buf[ii];
+    }
+    return { first + length, std::errc() };
+}
+
+to_chars_result to_chars(char* first, char* last, double value)
+{
+    if ((value == 0.0) || !std::isfinite(value))
+    {
+        return to_chars(first, last, value, DBL_DIG);
+    }
+
+    // 17 significant digits always round-trip; most values need fewer.
+    // Get all 17 from the C library once, then find the shortest rounding
+    // of them that reads back exactly.  "%g" drops trailing zeros, so the
+    // first precision that works is also the shortest.
+    char buf[32];
+    const int length = snprintf(buf, sizeof(buf), "%.16e", value);
+    if ((length < 0) || (static_cast<size_t>(length) >= sizeof(buf)))
+    {
+        return to_chars(first, last, value, 17);
+    }
+    DecimalDigits decimal;
+    decimal.negative = (buf[0] == '-');
+    const char* p = buf + (decimal.negative ? 1 : 0);
+    for (char* d = decimal.digits; d != decimal.digits + maxDigits; ++p)
+    {
+        if (isDigit(*p))
+        {
+            *d++ = *p;
+        }
+    }
+    decimal.exponent = atoi(strchr(p, 'e') + 1);
+
+    for (int precision = DBL_DIG; precision <= maxDigits; ++precision)
+    {
+        const auto result = decimal.isTie(precision) ? to_chars(first, last, value, precision) :
+            decimal.round(precision).format(first, last, precision);
+        if (result.ec != std::errc())
+        {
+            return result;
+        }
+
+        double roundTrip;
+        const auto parsed = from_chars(first, result.ptr, roundTrip);
+        if ((precision == maxDigits) ||
+            ((parsed.ec == std::errc()) && (parsed.ptr == result.ptr) && (roundTrip == value)))
+        {
+            return result;
+        }
+    }
+    return { last, std::errc::value_too_large }; // can't get here
+}
+
+to_chars_result to_chars(char* first, char* last, int64_t value)
+{
+    if (value < 0)
+    {
+        if (first == last)
+        {
+            return { last, std::errc::value_too_large };
+        }
+        *first = '-';
+        char* const end = writeDigits(first + 1, last, 0 - static_cast<uint64_t>(value));
+        return end == nullptr ? to_chars_result{ last, std::errc::value_too_large } : to_chars_result{ end, std::errc() };
+    }
+    return to_chars(first, last, static_cast<uint64_t>(value));
+}
+to_chars_result to_chars(char* first, char* last, uint64_t value)
+{
+    char* const end = writeDigits(first, last, value);
+    return end == nullptr ? to_chars_result{ last, std::errc::value_too_large } : to_chars_result{ end, std::errc() };
+}
+
+std::string toString(double value)
+{
+    char buf[32];
+    const auto result = to_chars(buf, buf + sizeof(buf), value);
+    assert(result.ec == std::errc());
+    return std::string(buf, result.ptr);
+}
+
+const char* details::skipSpace(const char* first, const char* last)
+{
+    while ((first != last) &&
+           ((*first == ' ') || (*first == '\t') || (*first == '\n') ||
+            (*first == '\r') || (*first == '\f') || (*first == '\v')))
+    {
+        ++first;
+    }
+    return first;
+}
+
+void details::throwBadCast(const std::string& s, const char* type)
+{
+    throw except::BadCastException(Ctxt("Error casting '" + s + "' to " + type));
+}
+}
+}
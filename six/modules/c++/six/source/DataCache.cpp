@@ -0,0 +1,246 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "six/DataCache.h"
+
+#include <string.h>
+
+#include <iterator>
+
+#include <sys/Conf.h>
+#include <except/Exception.h>
+
+namespace
+{
+// The path set is part of the key: the same XML validated against
+// different schemas may not have been accepted by both.
+std::string joinSchemaPaths(const std::vector<std::string>& schemaPaths)
+{
+    std::string retval;
+    for (const auto& path : schemaPaths)
+    {
+        retval += path;
+        retval += '\0';
+    }
+    return retval;
+}
+std::string joinSchemaPaths(const std::vector<std::filesystem::path>& schemaPaths)
+{
+    std::string retval;
+    for (const auto& path : schemaPaths)
+    {
+        retval += path.string();
+        retval += '\0';
+    }
+    return retval;
+}
+
+inline uint64_t makeKey(const std::string& xml, const std::string& schemaPaths)
+{
+    return six::DataCache::hash(xml.data(), xml.size()) ^
+        (six::DataCache::hash(schemaPaths.data(), schemaPaths.size()) * 31);
+}
+}
+
+namespace six
+{
+const size_t DataCache::DEFAULT_MAX_ENTRIES = 64;
+const size_t DataCache::DEFAULT_MAX_BYTES = 64 * 1024 * 1024;
+
+DataCache::DataCache(size_t maxEntries, size_t maxBytes) :
+    mMaxEntries(maxEntries),
+    mMaxBytes(maxBytes)
+{
+}
+
+// https://stackoverflow.com/a/11711991/8877
+// "C++11 removes the need for manual locking.
+// Concurrent execution shall wait if a static local variable is already being initialized."
+DataCache& DataCache::getInstance()
+{
+    static DataCache instance;
+    return instance;
+}
+
+uint64_t DataCache::hash(const void* data, size_t numBytes)
+{
+    // A word at a time multiply/xor-shift mix; collisions only cost a
+    // compare since entries also keep the XML they came from.
+    constexpr uint64_t multiplier = 0x9E3779B97F4A7C15ULL;
+    const auto bytes = static_cast<const unsigned char*>(data);
+    uint64_t retval = numBytes * multiplier;
+    size_t ii = 0;
+    for (; ii + sizeof(uint64_t) <= numBytes; ii += sizeof(uint64_t))
+    {
+        uint64_t word;
+        memcpy(&word, bytes + ii, sizeof(word));
+        retval = (retval ^ word) * multiplier;
+        retval ^= retval >> 32;
+    }
+    uint64_t tail = 0;
+    memcpy(&tail, bytes + ii, numBytes - ii);
+    retval = (retval ^ tail) * multiplier;
+    return retval ^ (retval >> 29);
+}
+
+DataCache::EntryList::iterator DataCache::findEntry(uint64_t hash,
+        const std::string& xml, const std::string& schemaPaths)
+{
+    const auto range = mIndex.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        const Entry& entry = *(it->second);
+        if ((entry.xml == xml) && (entry.schemaPaths == schemaPaths))
+        {
+            return it->second;
+        }
+    }
+    return mEntries.end();
+}
+
+std::shared_ptr<const Data> DataCache::find_(const std::string& xml, const std::string& schemaPaths)
+{
+    const auto key = makeKey(xml, schemaPaths);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    const auto it = findEntry(key, xml, schemaPaths);
+    if (it == mEntries.end())
+    {
+        ++mStatistics.misses;
+        return nullptr;
+    }
+
+    ++mStatistics.hits;
+    mEntries.splice(mEntries.begin(), mEntries, it); // now most-recently used
+    return it->data;
+}
+std::shared_ptr<const Data> DataCache::find(const std::string& xml,
+        const std::vector<std::string>& schemaPaths)
+{
+    return find_(xml, joinSchemaPaths(schemaPaths));
+}
+std::shared_ptr<const Data> DataCache::find(const std::string& xml,
+        const std::vector<std::filesystem::path>& schemaPaths)
+{
+    return find_(xml, joinSchemaPaths(schemaPaths));
+}
+
+void DataCache::insert_(const std::string& xml, std::string&& schemaPaths,
+        std::shared_ptr<const Data> data)
+{
+    if (data == nullptr)
+    {
+        throw except::Exception(Ctxt("Can't cache NULL Data"));
+    }
+    const auto key = makeKey(xml, schemaPaths);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    const auto it = findEntry(key, xml, schemaPaths);
+    if (it != mEntries.end())
+    {
+        erase(it);
+    }
+    if ((mMaxEntries == 0) || (xml.size() > mMaxBytes))
+    {
+        return;
+    }
+
+    Entry entry;
+    entry.hash = key;
+    entry.xml = xml;
+    entry.schemaPaths = std::move(schemaPaths);
+    entry.data = std::move(data);
+    mEntries.push_front(std::move(entry));
+    mIndex.emplace(key, mEntries.begin());
+    ++mStatistics.numEntries;
+    mStatistics.numBytes += xml.size();
+
+    evict();
+}
+void DataCache::insert(const std::string& xml,
+        const std::vector<std::string>& schemaPaths,
+        std::shared_ptr<const Data> data)
+{
+    insert_(xml, joinSchemaPaths(schemaPaths), std::move(data));
+}
+void DataCache::insert(const std::string& xml,
+        const std::vector<std::filesystem::path>& schemaPaths,
+        std::shared_ptr<const Data> data)
+{
+    insert_(xml, joinSchemaPaths(schemaPaths), std::move(data));
+}
+
+void DataCache::erase(EntryList::iterator it)
+{
+    const auto range = mIndex.equal_range(it->hash);
+    for (auto indexIt = range.first; indexIt != range.second; ++indexIt)
+    {
+        if (indexIt->second == it)
+        {
+            mIndex.erase(indexIt);
+            break;
+        }
+    }
+    --mStatistics.numEntries;
+    mStatistics.numBytes -= it->xml.size();
+    mEntries.erase(it);
+}
+
+void DataCache::evict()
+{
+    while (!mEntries.empty() &&
+           ((mStatistics.numEntries > mMaxEntries) || (mStatistics.numBytes > mMaxBytes)))
+    {
+        erase(std::prev(mEntries.end()));
+        ++mStatistics.evictions;
+    }
+}
+
+void DataCache::setLimits(size_t maxEntries, size_t maxBytes)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mMaxEntries = maxEntries;
+    mMaxBytes = maxBytes;
+    evict();
+}
+
+void DataCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mIndex.clear();
+    mEntries.clear();
+    mStatistics.numEntries = 0;
+    mStatistics.numBytes = 0;
+}
+
+DataCache::Statistics DataCache::getStatistics() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mStatistics;
+}
+void DataCache::resetStatistics()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mStatistics.hits = 0;
+    mStatistics.misses = 0;
+    mStatistics.evictions = 0;
+}
+}
@@ -0,0 +1,212 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "six/FFT.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <except/Exception.h>
+
+namespace
+{
+// std::complex's operator* checks for infinities and NaNs, which keeps the
+// butterflies from vectorizing
+inline std::complex<float> multiply(const std::complex<float>& lhs,
+                                    const std::complex<float>& rhs)
+{
+    return std::complex<float>(
+            lhs.real() * rhs.real() - lhs.imag() * rhs.imag(),
+            lhs.real() * rhs.imag() + lhs.imag() * rhs.real());
+}
+
+std::complex<float> phasor(double radians)
+{
+    return std::complex<float>(static_cast<float>(std::cos(radians)),
+                               static_cast<float>(std::sin(radians)));
+}
+
+void conjugate(std::complex<float>* data, size_t size)
+{
+    for (size_t ii = 0; ii < size; ++ii)
+    {
+        data[ii] = std::conj(data[ii]);
+    }
+}
+}
+
+namespace six
+{
+FFT::FFT(size_t size) :
+    mSize(size),
+    mPaddedSize(nextPowerOfTwo(size))
+{
+    if (size == 0)
+    {
+        throw except::Exception(Ctxt("An FFT needs at least one point"));
+    }
+
+    const double pi = M_PI;
+    if (mPaddedSize != mSize)
+    {
+        // Bluestein: X[k] = c[k] sum x[n] c[n] conj(c[k - n]) with
+        // c[n] = exp(-j pi n^2 / N), a circular convolution once padded
+        mPaddedSize = nextPowerOfTwo(2 * mSize - 1);
+        mChirp.resize(mSize);
+        for (size_t ii = 0; ii < mSize; ++ii)
+        {
+            // n^2 mod 2N keeps the angle exact for long transforms
+            const uint64_t square = (static_cast<uint64_t>(ii) * ii) %
+                    (2 * static_cast<uint64_t>(mSize));
+            mChirp[ii] = phasor(-pi * static_cast<double>(square) / mSize);
+        }
+    }
+
+    size_t numBits = 0;
+    while ((static_cast<size_t>(1) << numBits) < mPaddedSize)
+    {
+        ++numBits;
+    }
+    mBitReversed.resize(mPaddedSize);
+    for (size_t ii = 0; ii < mPaddedSize; ++ii)
+    {
+        size_t reversed = 0;
+        for (size_t bit = 0; bit < numBits; ++bit)
+        {
+            reversed |= ((ii >> bit) & 1) << (numBits - 1 - bit);
+        }
+        mBitReversed[ii] = reversed;
+    }
+
+    mTwiddles.resize(std::max<size_t>(mPaddedSize / 2, 1));
+    for (size_t ii = 0; ii < mTwiddles.size(); ++ii)
+    {
+        mTwiddles[ii] = phasor(-2.0 * pi * ii / mPaddedSize);
+    }
+
+    if (!mChirp.empty())
+    {
+        mKernel.assign(mPaddedSize, std::complex<float>(0.0f, 0.0f));
+        mKernel[0] = std::conj(mChirp[0]);
+        for (size_t ii = 1; ii < mSize; ++ii)
+        {
+            mKernel[ii] = mKernel[mPaddedSize - ii] = std::conj(mChirp[ii]);
+        }
+        radix2(mKernel.data(), false);
+
+        // Fold in the inverse transform's 1 / M
+        const float scale = 1.0f / mPaddedSize;
+        for (std::complex<float>& value : mKernel)
+        {
+            value *= scale;
+        }
+    }
+}
+
+size_t FFT::nextPowerOfTwo(size_t size)
+{
+    size_t power = 1;
+    while (power < size)
+    {
+        power *= 2;
+    }
+    return power;
+}
+
+void FFT::radix2(std::complex<float>* data, bool conjugateTwiddles) const
+{
+    for (size_t ii = 0; ii < mPaddedSize; ++ii)
+    {
+        const size_t jj = mBitReversed[ii];
+        if (ii < jj)
+        {
+            std::swap(data[ii], data[jj]);
+        }
+    }
+
+    for (size_t half = 1; half < mPaddedSize; half *= 2)
+    {
+        const size_t step = mPaddedSize / (2 * half);
+        for (size_t start = 0; start < mPaddedSize; start += 2 * half)
+        {
+            std::complex<float>* const lower = data + start;
+            std::complex<float>* const upper = lower + half;
+            for (size_t kk = 0; kk < half; ++kk)
+            {
+                const std::complex<float>& twiddle = mTwiddles[kk * step];
+                const std::complex<float> product = multiply(
+                        conjugateTwiddles ? std::conj(twiddle) : twiddle,
+                        upper[kk]);
+                upper[kk] = lower[kk] - product;
+                lower[kk] += product;
+            }
+        }
+    }
+}
+
+void FFT::transform(std::complex<float>* data, FFTSign sign) const
+{
+    const bool positive = (sign == FFTSign::POS);
+    if (mChirp.empty())
+    {
+        radix2(data, positive);
+        return;
+    }
+
+    // A positive transform is the conjugate of a negative one of the
+    // conjugate
+    if (positive)
+    {
+        conjugate(data, mSize);
+    }
+
+    std::vector<std::complex<float> > work(mPaddedSize);
+    for (size_t ii = 0; ii < mSize; ++ii)
+    {
+        work[ii] = multiply(data[ii], mChirp[ii]);
+    }
+    radix2(work.data(), false);
+    for (size_t ii = 0; ii < mPaddedSize; ++ii)
+    {
+        work[ii] = multiply(work[ii], mKernel[ii]);
+    }
+    radix2(work.data(), true);
+    for (size_t ii = 0; ii < mSize; ++ii)
+    {
+        data[ii] = multiply(work[ii], mChirp[ii]);
+    }
+
+    if (positive)
+    {
+        conjugate(data, mSize);
+    }
+}
+
+void FFT::transformCentered(std::complex<float>* data, FFTSign sign) const
+{
+    const size_t middle = mSize / 2;
+    std::rotate(data, data + middle, data + mSize);
+    transform(data, sign);
+    std::rotate(data, data + mSize - middle, data + mSize);
+}
+}
@@ -0,0 +1,367 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+#include <six/CharConv.h>
+#include <six/Instrumentation.h>
+
+namespace
+{
+typedef std::chrono::steady_clock Clock;
+
+// A timing as recorded, before its name is copied
+struct RawEvent
+{
+    const char* name;
+    int64_t startNanoseconds;
+    int64_t durationNanoseconds;
+};
+
+// What one thread has recorded since the last reset
+struct ThreadData
+{
+    explicit ThreadData(uint64_t id) : id(id)
+    {
+    }
+
+    std::mutex mutex;
+    const uint64_t id;
+    std::unordered_map<const char*, uint64_t> counters;
+    std::unordered_map<const char*,
+                       six::Instrumentation::TimerStatistics> timers;
+    std::vector<RawEvent> events;
+};
+
+struct Registry
+{
+    Registry() : epoch(Clock::now()), nextThreadId(0)
+    {
+    }
+
+    std::mutex mutex;
+    const Clock::time_point epoch;
+    uint64_t nextThreadId;
+    std::vector<std::shared_ptr<ThreadData> > threads;
+    std::shared_ptr<six::InstrumentationSink> sink;
+};
+
+// Never destroyed, so threads can still record during static destruction
+Registry& getRegistry()
+{
+    static Registry* const registry = new Registry();
+    return *registry;
+}
+
+ThreadData& getThreadData()
+{
+    thread_local std::shared_ptr<ThreadData> data;
+    if (!data)
+    {
+        Registry& registry = getRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        data = std::make_shared<ThreadData>(registry.nextThreadId++);
+        registry.threads.push_back(data);
+    }
+    return *data;
+}
+
+int64_t toNanoseconds(Clock::duration duration)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            duration).count();
+}
+
+template <typename T>
+void writeNumber(std::ostream& os, T value)
+{
+    os << six::charconv::toString(value);
+}
+
+void writeSeconds(std::ostream& os, int64_t nanoseconds)
+{
+    writeNumber(os, static_cast<double>(nanoseconds) * 1e-9);
+}
+
+void writeMicroseconds(std::ostream& os, int64_t nanoseconds)
+{
+    writeNumber(os, static_cast<double>(nanoseconds) * 1e-3);
+}
+
+void writeString(std::ostream& os, const std::string& str)
+{
+    static const char HEX[] = "0123456789abcdef";
+
+    os << '"';
+    for (char c : str)
+    {
+        switch (c)
+        {
+        case '"':
+            os << "\\\"";
+            break;
+        case '\\':
+            os << "\\\\";
+            break;
+        case '\n':
+            os << "\\n";
+            break;
+        case '\r':
+            os << "\\r";
+            break;
+        case '\t':
+            os << "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+            {
+                os << "\\u00" << HEX[(c >> 4) & 0xF] << HEX[c & 0xF];
+            }
+            else
+            {
+                os << c;
+            }
+        }
+    }
+    os << '"';
+}
+}
+
+namespace six
+{
+std::atomic<bool> Instrumentation::sEnabled(false);
+std::atomic<bool> Instrumentation::sTracing(false);
+
+void Instrumentation::setEnabled(bool enabled, bool tracing)
+{
+    // Start the epoch now rather than at the first event
+    getRegistry();
+    sTracing.store(enabled && tracing, std::memory_order_relaxed);
+    sEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+void Instrumentation::count(const char* name, uint64_t value)
+{
+    ThreadData& data = getThreadData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+    data.counters[name] += value;
+}
+
+void Instrumentation::recordTime(const char* name,
+                                 Clock::time_point start,
+                                 Clock::time_point end)
+{
+    const int64_t duration = toNanoseconds(end - start);
+    ThreadData& data = getThreadData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+
+    TimerStatistics& stats = data.timers[name];
+    if (stats.count == 0)
+    {
+        stats.minNanoseconds = stats.maxNanoseconds = duration;
+    }
+    else
+    {
+        stats.minNanoseconds = std::min(stats.minNanoseconds, duration);
+        stats.maxNanoseconds = std::max(stats.maxNanoseconds, duration);
+    }
+    ++stats.count;
+    stats.totalNanoseconds += duration;
+
+    if (isTracing() && data.events.size() < MAX_EVENTS_PER_THREAD)
+    {
+        RawEvent event;
+        event.name = name;
+        event.startNanoseconds = toNanoseconds(start - getRegistry().epoch);
+        event.durationNanoseconds = duration;
+        data.events.push_back(event);
+    }
+}
+
+Instrumentation::Report Instrumentation::getReport()
+{
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> registryLock(registry.mutex);
+
+    Report report;
+    for (const auto& data : registry.threads)
+    {
+        std::lock_guard<std::mutex> lock(data->mutex);
+        for (const auto& counter : data->counters)
+        {
+            report.counters[counter.first] += counter.second;
+        }
+        for (const auto& timer : data->timers)
+        {
+            TimerStatistics& stats = report.timers[timer.first];
+            if (stats.count == 0)
+            {
+                stats = timer.second;
+                continue;
+            }
+            stats.count += timer.second.count;
+            stats.totalNanoseconds += timer.second.totalNanoseconds;
+            stats.minNanoseconds = std::min(stats.minNanoseconds,
+                                            timer.second.minNanoseconds);
+            stats.maxNanoseconds = std::max(stats.maxNanoseconds,
+                                            timer.second.maxNanoseconds);
+        }
+        for (const auto& raw : data->events)
+        {
+            Event event;
+            event.name = raw.name;
+            event.threadId = data->id;
+            event.startNanoseconds = raw.startNanoseconds;
+            event.durationNanoseconds = raw.durationNanoseconds;
+            report.events.push_back(event);
+        }
+    }
+
+    std::stable_sort(report.events.begin(), report.events.end(),
+                     [](const Event& lhs, const Event& rhs)
+                     {
+                         return lhs.startNanoseconds < rhs.startNanoseconds;
+                     });
+    return report;
+}
+
+void Instrumentation::reset()
+{
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> registryLock(registry.mutex);
+
+    for (const auto& data : registry.threads)
+    {
+        std::lock_guard<std::mutex> lock(data->mutex);
+        data->counters.clear();
+        data->timers.clear();
+        data->events.clear();
+    }
+
+    // Threads that have exited hold no other reference
+    registry.threads.erase(
+            std::remove_if(registry.threads.begin(), registry.threads.end(),
+                           [](const std::shared_ptr<ThreadData>& data)
+                           {
+                               return data.use_count() == 1;
+                           }),
+            registry.threads.end());
+}
+
+void Instrumentation::setSink(std::shared_ptr<InstrumentationSink> sink)
+{
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.sink = sink;
+}
+
+void Instrumentation::flush()
+{
+    std::shared_ptr<InstrumentationSink> sink;
+    {
+        Registry& registry = getRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        sink = registry.sink;
+    }
+
+    const Report report = getReport();
+    reset();
+    if (sink)
+    {
+        sink->write(report);
+    }
+}
+
+void JSONInstrumentationSink::write(const Instrumentation::Report& report)
+{
+    mStream << "{\"counters\": {";
+    const char* separator = "";
+    for (const auto& counter : report.counters)
+    {
+        mStream << separator;
+        writeString(mStream, counter.first);
+        mStream << ": ";
+        writeNumber(mStream, counter.second);
+        separator = ", ";
+    }
+
+    mStream << "}, \"timers\": {";
+    separator = "";
+    for (const auto& timer : report.timers)
+    {
+        mStream << separator;
+        writeString(mStream, timer.first);
+        mStream << ": {\"count\": ";
+        writeNumber(mStream, timer.second.count);
+        mStream << ", \"totalSeconds\": ";
+        writeSeconds(mStream, timer.second.totalNanoseconds);
+        mStream << ", \"minSeconds\": ";
+        writeSeconds(mStream, timer.second.minNanoseconds);
+        mStream << ", \"maxSeconds\": ";
+        writeSeconds(mStream, timer.second.maxNanoseconds);
+        mStream << "}";
+        separator = ", ";
+    }
+    mStream << "}}\n";
+    mStream.flush();
+}
+
+void ChromeTraceSink::write(const Instrumentation::Report& report)
+{
+    mStream << "{\"traceEvents\": [";
+    const char* separator = "\n";
+    int64_t endNanoseconds = 0;
+    for (const auto& event : report.events)
+    {
+        mStream << separator << "{\"name\": ";
+        writeString(mStream, event.name);
+        mStream << ", \"cat\": \"six\", \"ph\": \"X\", \"ts\": ";
+        writeMicroseconds(mStream, event.startNanoseconds);
+        mStream << ", \"dur\": ";
+        writeMicroseconds(mStream, event.durationNanoseconds);
+        mStream << ", \"pid\": 1, \"tid\": ";
+        writeNumber(mStream, event.threadId);
+        mStream << "}";
+        separator = ",\n";
+
+        endNanoseconds = std::max(endNanoseconds, event.startNanoseconds +
+                                  event.durationNanoseconds);
+    }
+
+    // Counters are totals, so they're all shown at the end of the trace
+    for (const auto& counter : report.counters)
+    {
+        mStream << separator << "{\"name\": ";
+        writeString(mStream, counter.first);
+        mStream << ", \"cat\": \"six\", \"ph\": \"C\", \"ts\": ";
+        writeMicroseconds(mStream, endNanoseconds);
+        mStream << ", \"pid\": 1, \"args\": {\"value\": ";
+        writeNumber(mStream, counter.second);
+        mStream << "}}";
+        separator = ",\n";
+    }
+    mStream << "\n], \"displayTimeUnit\": \"ms\"}\n";
+    mStream.flush();
+}
+}
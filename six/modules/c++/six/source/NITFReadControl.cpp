@@ -30,8 +30,11 @@
 #include <gsl/gsl.h>
 
 #include <six/NITFReadControl.h>
+#include <six/BatchInputStream.h>
+#include <six/Instrumentation.h>
 #include <six/XMLControlFactory.h>
 #include <six/Utilities.h>
+#include <io/ByteStream.h>
 
 #undef min
 #undef max
@@ -252,12 +255,13 @@ void NITFReadControl::validateSegment(const nitf::ImageSubheader& subheader,
 
 void NITFReadControl::load(const std::string& fromFile, const std::vector<std::string>* pSchemaPaths)
 {
-    auto handle(std::make_shared<nitf::IOHandle>(fromFile));
+    // Large image segment reads are split up and queued together
+    std::shared_ptr<nitf::IOInterface> handle(std::make_shared<BatchIOInterface>(fromFile));
     load(handle, pSchemaPaths);
 }
 void NITFReadControl::load(const std::filesystem::path& fromFile, const std::vector<std::filesystem::path>* pSchemaPaths)
 {
-    std::shared_ptr<nitf::IOInterface> handle(std::make_shared<nitf::IOHandle>(fromFile.string()));
+    std::shared_ptr<nitf::IOInterface> handle(std::make_shared<BatchIOInterface>(fromFile.string()));
     load(handle, pSchemaPaths);
 }
 
@@ -322,6 +326,7 @@ inline std::unique_ptr<Data> parseData_(const XMLControlRegistry& xmlReg,
 template<typename TSchemaPath>
 void NITFReadControl::load_(std::shared_ptr<nitf::IOInterface> ioInterface, const std::vector<TSchemaPath>* pSchemaPaths)
 {
+    SIX_SCOPED_TIMER("six::NITFReadControl::load");
     reset();
     mInterface = ioInterface;
 
@@ -338,6 +343,7 @@ void NITFReadControl::load_(std::shared_ptr<nitf::IOInterface> ioInterface, cons
         nitf::DESegment segment = (nitf::DESegment) *desIter;
         nitf::DESubheader subheader = segment.getSubheader();
         nitf::SegmentReader deReader = mReader.newDEReader(i);
+        SIX_COUNT("six.nitf.desRead", 1);
 
         if (getDataType(segment) == DataType::NOT_SET)
         {
@@ -345,12 +351,35 @@ void NITFReadControl::load_(std::shared_ptr<nitf::IOInterface> ioInterface, cons
         }
         else
         {
-            SegmentInputStreamAdapter ioAdapter(deReader);
-            std::unique_ptr<Data> data(parseData_(*mXMLRegistry,
-                                               ioAdapter,
-                                               dataType,
-                                               pSchemaPaths,
-                                               *mLog));
+            std::unique_ptr<Data> data;
+            if (mDataCache != nullptr)
+            {
+                std::string xml(gsl::narrow<size_t>(deReader.getSize()), '\0');
+                if (!xml.empty())
+                {
+                    deReader.read(&xml[0], xml.size());
+                }
+                const auto parse = [&]() {
+                    ::io::ByteStream xmlStream;
+                    xmlStream.write(xml.data(), xml.size());
+                    xmlStream.seek(0, ::io::Seekable::START);
+                    return parseData_(*mXMLRegistry, xmlStream, dataType, pSchemaPaths, *mLog);
+                };
+                const auto cached = mDataCache->get(xml, *pSchemaPaths, parse);
+                if (cached != nullptr)
+                {
+                    data = cached->unique_clone();
+                }
+            }
+            else
+            {
+                SegmentInputStreamAdapter ioAdapter(deReader);
+                data = parseData_(*mXMLRegistry,
+                                  ioAdapter,
+                                  dataType,
+                                  pSchemaPaths,
+                                  *mLog);
+            }
             if (data.get() == nullptr)
             {
                 throw except::Exception(Ctxt("Unable to transform XML DES"));
@@ -471,8 +500,10 @@ void NITFReadControl::load(std::shared_ptr<nitf::IOInterface> ioInterface, const
     const std::vector<std::string>* pSchemaPaths = (pSchemaPaths_ != nullptr) ? pSchemaPaths_ : &schemaPaths;
     load_(ioInterface, pSchemaPaths);
 }
-void NITFReadControl::load(std::shared_ptr<nitf::IOInterface> ioInterface, const std::vector<std::filesystem::path>* pSchemaPaths)
+void NITFReadControl::load(std::shared_ptr<nitf::IOInterface> ioInterface, const std::vector<std::filesystem::path>* pSchemaPaths_)
 {
+    const std::vector<std::filesystem::path> schemaPaths;
+    const std::vector<std::filesystem::path>* pSchemaPaths = (pSchemaPaths_ != nullptr) ? pSchemaPaths_ : &schemaPaths;
     load_(ioInterface, pSchemaPaths);
 }
 
@@ -613,6 +644,7 @@ void NITFReadControl::getIndices(const nitf::ImageSubheader& subheader, ImageAnd
 
 UByte* NITFReadControl::interleaved(Region& region, size_t imageNumber)
 {
+    SIX_SCOPED_TIMER("six::NITFReadControl::interleaved");
     const NITFImageInfo& thisImage = *(mInfos[imageNumber]);
 
     const types::RowCol<ptrdiff_t> imageExtent(getExtent(thisImage.getData()));
@@ -713,7 +745,9 @@ UByte* NITFReadControl::interleaved(Region& region, size_t imageNumber)
         totalRead += numColsReq * nbpp * numRowsReqSeg;
         sw.setStartRow(0);
         numRowsLeft -= numRowsReqSeg;
+        SIX_COUNT("six.nitf.imageSegmentsRead", 1);
     }
+    SIX_COUNT("six.nitf.bytesRead", static_cast<uint64_t>(totalRead));
 
     return buffer;
 }
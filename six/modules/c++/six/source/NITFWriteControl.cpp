@@ -36,6 +36,7 @@
 #include <gsl/gsl.h>
 #include <str/EncodedStringView.h>
 
+#include <six/Instrumentation.h>
 #include <six/XMLControlFactory.h>
 #include <nitf/IOStreamWriter.hpp>
 
@@ -581,6 +582,7 @@ void save(NITFWriteControl& writeControl, const std::complex<float>* image, cons
 
 void NITFWriteControl::addDataAndWrite(const std::vector<std::string>& schemaPaths)
 {
+    SIX_SCOPED_TIMER("six::NITFWriteControl::save");
     const auto numDES = getContainer()->size();
 
     // These must stick around until mWriter.write() is called since the
@@ -596,6 +598,7 @@ void NITFWriteControl::addDataAndWrite(const std::vector<std::string>& schemaPat
         nitf::SegmentWriter deWriter = mWriter.newDEWriter(gsl::narrow<int>(ii));
         nitf::SegmentMemorySource segSource(desStrs[ii], 0, 0, false);
         deWriter.attachSource(segSource);
+        SIX_COUNT("six.nitf.desWritten", 1);
     }
 
     auto deWriterIndex = gsl::narrow<int>(numDES);
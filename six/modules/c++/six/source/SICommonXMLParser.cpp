@@ -31,6 +31,7 @@
 #include <six/CollectionInformation.h>
 #include <six/SICommonXMLParser.h>
 #include <six/ParameterCollection.h>
+#include <six/CharConv.h>
 
 namespace
 {
@@ -150,11 +151,11 @@ void SICommonXMLParser::parsePolyXYZ(const xml::lite::Element* polyXML, PolyXYZ&
     // initialize all the coefficients to 0, so we'll get the right behavior
     // if one of these polynomials is lower-order.
     const size_t xOrder =
-            str::toType<size_t>(xXML->getAttributes().getValue("order1"));
+            six::charconv::toType<size_t>(xXML->getAttributes().getValue("order1"));
     const size_t yOrder =
-            str::toType<size_t>(yXML->getAttributes().getValue("order1"));
+            six::charconv::toType<size_t>(yXML->getAttributes().getValue("order1"));
     const size_t zOrder =
-            str::toType<size_t>(zXML->getAttributes().getValue("order1"));
+            six::charconv::toType<size_t>(zXML->getAttributes().getValue("order1"));
     const size_t order =
             std::max<size_t>(std::max<size_t>(xOrder, yOrder), zOrder);
 
@@ -177,7 +178,7 @@ void SICommonXMLParser::parsePoly(const xml::lite::Element* polyXML,
     for (size_t ii = 0; ii < coeffsXML.size(); ++ii)
     {
         // Check the order attr, and use that index
-        const size_t orderIdx = str::toType<size_t>(
+        const size_t orderIdx = six::charconv::toType<size_t>(
             coeffsXML[ii]->getAttributes().getValue("exponent1"));
         if (orderIdx > polyXYZ.order())
         {
@@ -351,7 +352,7 @@ XMLElem SICommonXMLParser::createLatLonFootprint(const std::string& name,
 
 void SICommonXMLParser::parsePoly1D(const xml::lite::Element* polyXML, Poly1D& poly1D) const
 {
-    const auto order1 = str::toType<int>(polyXML->getAttributes().getValue("order1"));
+    const auto order1 = six::charconv::toType<int>(polyXML->getAttributes().getValue("order1"));
     Poly1D p1D(gsl::narrow<size_t>(order1));
 
     std::vector < XMLElem > coeffsXML;
@@ -359,7 +360,7 @@ void SICommonXMLParser::parsePoly1D(const xml::lite::Element* polyXML, Poly1D& p
 
     for (auto element : coeffsXML)
     {
-        const auto exp1 = str::toType<int>(element->getAttributes().getValue("exponent1"));
+        const auto exp1 = six::charconv::toType<int>(element->getAttributes().getValue("exponent1"));
         parseDouble(element, p1D[gsl::narrow<size_t>(exp1)]);
     }
     poly1D = p1D;
@@ -367,8 +368,8 @@ void SICommonXMLParser::parsePoly1D(const xml::lite::Element* polyXML, Poly1D& p
 
 void SICommonXMLParser::parsePoly2D(const xml::lite::Element* polyXML, Poly2D& poly2D) const
 {
-    const auto order1 = str::toType<int>(polyXML->getAttributes().getValue("order1"));
-    const auto order2 = str::toType<int>(polyXML->getAttributes().getValue("order2"));
+    const auto order1 = six::charconv::toType<int>(polyXML->getAttributes().getValue("order1"));
+    const auto order2 = six::charconv::toType<int>(polyXML->getAttributes().getValue("order2"));
     Poly2D p2D(gsl::narrow<size_t>(order1), gsl::narrow<size_t>(order2));
 
     std::vector < XMLElem > coeffsXML;
@@ -376,8 +377,8 @@ void SICommonXMLParser::parsePoly2D(const xml::lite::Element* polyXML, Poly2D& p
 
     for (auto element : coeffsXML)
     {
-        const auto exp1 = str::toType<int>(element->getAttributes().getValue("exponent1"));
-        const auto exp2 = str::toType<int>(element->getAttributes().getValue("exponent2"));
+        const auto exp1 = six::charconv::toType<int>(element->getAttributes().getValue("exponent1"));
+        const auto exp2 = six::charconv::toType<int>(element->getAttributes().getValue("exponent2"));
         parseDouble(element, p2D[gsl::narrow<size_t>(exp1)][exp2]);
     }
     poly2D = p2D;
@@ -678,7 +679,7 @@ void SICommonXMLParser::parseLatLons(const xml::lite::Element* pointsXML,
 
         //! Temporarily store the indices and LatLons in vector, so
         //  validation can be performed
-        size_t index =  str::toType<size_t>((*it)->attribute("index"));
+        size_t index =  six::charconv::toType<size_t>((*it)->attribute("index"));
         tmpll.push_back(ll);
         tmpIndxs.push_back(index);
 
@@ -783,7 +784,7 @@ void SICommonXMLParser::parseRowColInts(
 
         //! Temporarily store the indices and rowCol in vector, so
         //  validation can be performed
-        size_t index =  str::toType<size_t>((*it)->attribute("index"));
+        size_t index =  six::charconv::toType<size_t>((*it)->attribute("index"));
         tmprc.push_back(rc);
         tmpIndxs.push_back(index);
 
@@ -1208,7 +1209,7 @@ void SICommonXMLParser::parseFootprint(const xml::lite::Element& footprint,
         // Check the index attr to know which corner it is
         // This is 1-based
         const size_t idx =
-            str::toType<size_t>(vertex->getAttributes().getValue("index"));
+            six::charconv::toType<size_t>(vertex->getAttributes().getValue("index"));
         indices.insert(idx);
 
         parseLatLon(vertices[ii], corners.getCorner(idx - 1));
@@ -1242,7 +1243,7 @@ void SICommonXMLParser::parseFootprint(const xml::lite::Element* footprint,
         // Check the index attr to know which corner it is
         // This is 1-based
         const size_t idx =
-            str::toType<size_t>(vertex->getAttributes().getValue("index"));
+            six::charconv::toType<size_t>(vertex->getAttributes().getValue("index"));
         indices.insert(idx);
 
         parseLatLonAlt(vertices[ii], corners.getCorner(idx - 1));
@@ -33,6 +33,7 @@
 #include "six/Utilities.h"
 #include "six/XMLControl.h"
 #include "six/Data.h"
+#include "six/Instrumentation.h"
 #include <six/XmlLite.h>
 
 namespace
@@ -604,6 +605,7 @@ TReturn six_parseData(const XMLControlRegistry& xmlReg,
     six::MinidomParser xmlParser;
     try
     {
+        SIX_SCOPED_TIMER("six::parseData");
         xmlParser.parse(xmlStream);
     }
     catch (const except::Throwable& ex)
@@ -31,6 +31,7 @@
 #include <six/Utilities.h>
 #include <six/Types.h>
 #include <six/Data.h>
+#include <six/Instrumentation.h>
 
 namespace fs = std::filesystem;
 
@@ -188,6 +189,8 @@ template<typename TPath>
 static void validate_(const xml::lite::Document& doc,
     std::vector<TPath> paths, logging::Logger* log)
 {
+    SIX_SCOPED_TIMER("six::XMLControl::validate");
+
     // If the paths we have don't exist, throw
     paths = check_whether_paths_exist(paths);
 
@@ -289,7 +292,11 @@ std::unique_ptr<xml::lite::Document> XMLControl::toXMLImpl(const Data& data) con
 xml::lite::Document* XMLControl::toXML(
         const Data* data, const std::vector<std::string>& schemaPaths)
 {
-    xml::lite::Document* doc = toXMLImpl(data);
+    xml::lite::Document* doc = nullptr;
+    {
+        SIX_SCOPED_TIMER("six::XMLControl::toXML");
+        doc = toXMLImpl(data);
+    }
     validate(doc, schemaPaths, mLog);
     return doc;
 }
@@ -301,7 +308,11 @@ std::unique_ptr<xml::lite::Document> XMLControl::toXML(
 std::unique_ptr<xml::lite::Document> XMLControl::toXML(
     const Data& data, const std::vector<std::filesystem::path>* pSchemaPaths)
 {
-    auto doc = toXMLImpl(data);
+    std::unique_ptr<xml::lite::Document> doc;
+    {
+        SIX_SCOPED_TIMER("six::XMLControl::toXML");
+        doc = toXMLImpl(data);
+    }
     validate(*doc, pSchemaPaths, mLog);
     return doc;
 }
@@ -328,7 +339,11 @@ std::unique_ptr<Data> XMLControl::fromXML(const xml::lite::Document& doc,
     const std::vector<std::filesystem::path>* pSchemaPaths)
 {
     validate(doc, pSchemaPaths, mLog);
-    auto data = fromXMLImpl(doc);
+    std::unique_ptr<Data> data;
+    {
+        SIX_SCOPED_TIMER("six::XMLControl::fromXML");
+        data = fromXMLImpl(doc);
+    }
     data->setVersion(getVersionFromURI(&doc));
     return data;
 }
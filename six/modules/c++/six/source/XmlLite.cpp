@@ -32,6 +32,7 @@
 #include <logging/NullLogger.h>
 #include <six/Utilities.h>
 #include <six/Init.h>
+#include <six/CharConv.h>
 
 namespace six
 {
@@ -172,12 +173,28 @@ xml::lite::Element& XmlLite::createString_(const std::string& name,
     return createString(makeQName(name), p, parent);
 }
 
+// Numbers are most of the character data in SICD/SIDD/CPHD XML; format them
+// without going through an ostringstream.
+inline std::string toCharacterData(double v)
+{
+    return charconv::toString(v);
+}
+inline std::string toCharacterData(int v)
+{
+    return charconv::toString(v);
+}
+template<typename T>
+inline std::string toCharacterData(const T& v)
+{
+    return str::toString(v);
+}
+
 template<typename T>
 static std::string toString(const xml::lite::QName& name, const T& p, const xml::lite::Element& parent)
 {
     try
     {
-        return str::toString(p);
+        return toCharacterData(p);
     }
     catch (const except::Exception& ex)
     {
@@ -366,7 +383,7 @@ bool XmlLite::parseDouble(const xml::lite::Element& element, double& value) cons
 {
     value = Init::undefined<double>();
     const auto getValue = [&]() {
-        value = xml::lite::getValue<double>(element);
+        value = castValue(element, charconv::toType<double>);
         assert(Init::isDefined(value)); };
     return parseValue(mLogger.get(), getValue);
 }
@@ -0,0 +1,146 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Times BatchInputStream::readBatch() with the io_uring and synchronous
+// backends on the same random (offset, size) ranges of a file, the access
+// pattern of partial sample CPHD reads. Drop the page cache between runs
+// (echo 3 > /proc/sys/vm/drop_caches) to time the device rather than memory.
+
+#include <stdlib.h>
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <sys/StopWatch.h>
+#include <str/Convert.h>
+#include <six/BatchInputStream.h>
+
+namespace
+{
+double timeBatch(const std::string& pathname,
+                 six::BatchInputStream::Backend backend,
+                 size_t queueDepth,
+                 std::vector<six::BatchInputStream::Request>& requests,
+                 std::vector<std::byte>& buffer)
+{
+    six::BatchInputStream stream(pathname, backend, queueDepth);
+
+    size_t offset = 0;
+    for (auto& request : requests)
+    {
+        request.buffer = &buffer[offset];
+        offset += request.size;
+    }
+
+    sys::RealTimeStopWatch watch;
+    watch.start();
+    stream.readBatch(requests);
+    return watch.stop();
+}
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        if (argc < 2)
+        {
+            std::cerr << "Usage: " << argv[0]
+                      << " <pathname> [read size] [number of reads]"
+                      << " [queue depth]\n";
+            return EXIT_FAILURE;
+        }
+        const std::string pathname(argv[1]);
+        const size_t readSize = (argc > 2) ?
+                str::toType<size_t>(argv[2]) : 4096;
+        const size_t numReads = (argc > 3) ?
+                str::toType<size_t>(argv[3]) : 10000;
+        const size_t queueDepth = (argc > 4) ?
+                str::toType<size_t>(argv[4]) : 64;
+
+        int64_t fileSize = 0;
+        {
+            six::BatchInputStream stream(pathname,
+                    six::BatchInputStream::Backend::SYNCHRONOUS);
+            fileSize = stream.available();
+        }
+        if (fileSize < static_cast<int64_t>(readSize))
+        {
+            std::cerr << pathname << " is smaller than one read\n";
+            return EXIT_FAILURE;
+        }
+
+        std::mt19937_64 generator(42);
+        std::uniform_int_distribution<int64_t> distribution(
+                0, fileSize - static_cast<int64_t>(readSize));
+        std::vector<six::BatchInputStream::Request> requests(numReads);
+        for (auto& request : requests)
+        {
+            request.offset = distribution(generator);
+            request.size = readSize;
+        }
+
+        std::vector<std::byte> synchronous(readSize * numReads);
+        const double synchronousMs = timeBatch(
+                pathname, six::BatchInputStream::Backend::SYNCHRONOUS,
+                queueDepth, requests, synchronous);
+        const double megabytes = readSize * numReads / (1024.0 * 1024.0);
+        std::cout << "synchronous: " << synchronousMs << " ms, "
+                  << (megabytes * 1000.0 / synchronousMs) << " MB/s\n";
+
+        std::vector<std::byte> ioUring(readSize * numReads);
+        double ioUringMs = 0.0;
+        try
+        {
+            ioUringMs = timeBatch(
+                    pathname, six::BatchInputStream::Backend::IO_URING,
+                    queueDepth, requests, ioUring);
+        }
+        catch (const except::Exception& ex)
+        {
+            std::cout << "io_uring: not available (" << ex.getMessage()
+                      << ")\n";
+            return EXIT_SUCCESS;
+        }
+        std::cout << "io_uring (queue depth " << queueDepth << "): "
+                  << ioUringMs << " ms, "
+                  << (megabytes * 1000.0 / ioUringMs) << " MB/s\n";
+
+        if (synchronous != ioUring)
+        {
+            std::cerr << "The backends read different data\n";
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+    }
+    catch (const except::Exception& ex)
+    {
+        std::cerr << ex.toString() << std::endl;
+    }
+    return EXIT_FAILURE;
+}
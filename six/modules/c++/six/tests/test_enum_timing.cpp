@@ -0,0 +1,116 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ * 
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public 
+ * License along with this program; If not, 
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Times string <-> value conversions of six::Enum types, which the XML
+// parsers do thousands of times per document.
+
+#include <stdlib.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <sys/StopWatch.h>
+#include <str/Convert.h>
+#include <six/Enums.h>
+
+namespace
+{
+template <typename TEnum>
+bool timeConversions(const std::string& name, size_t numIterations)
+{
+    std::vector<std::string> strings;
+    for (auto&& kv : TEnum::string_to_value_())
+    {
+        strings.push_back(kv.first);
+    }
+
+    // Time whole loops; a stop watch call costs more than one conversion
+    std::vector<TEnum> values(numIterations);
+    sys::RealTimeStopWatch toTypeWatch;
+    toTypeWatch.start();
+    for (size_t ii = 0; ii < numIterations; ++ii)
+    {
+        values[ii] = TEnum::toType(strings[ii % strings.size()]);
+    }
+    const double toTypeMs = toTypeWatch.stop();
+
+    std::vector<std::string> roundTrips(numIterations);
+    sys::RealTimeStopWatch toStringWatch;
+    toStringWatch.start();
+    for (size_t ii = 0; ii < numIterations; ++ii)
+    {
+        roundTrips[ii] = values[ii].toString();
+    }
+    const double toStringMs = toStringWatch.stop();
+
+    std::cout << name << " (" << strings.size() << " names): toType "
+              << (toTypeMs * 1.0e6 / numIterations) << " ns, toString "
+              << (toStringMs * 1.0e6 / numIterations) << " ns\n";
+
+    size_t numMismatches = 0;
+    for (size_t ii = 0; ii < numIterations; ++ii)
+    {
+        if (TEnum::toType(roundTrips[ii]) != values[ii])
+        {
+            ++numMismatches;
+        }
+    }
+
+    if (TEnum::toType("not a valid name", std::nothrow).has_value())
+    {
+        ++numMismatches;
+    }
+    return numMismatches == 0;
+}
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        const size_t numIterations = (argc > 1) ?
+                str::toType<size_t>(argv[1]) : 1000000;
+
+        bool ok = true;
+        ok = timeConversions<six::BooleanType>("BooleanType", numIterations) && ok;
+        ok = timeConversions<six::PixelType>("PixelType", numIterations) && ok;
+        ok = timeConversions<six::RadarModeType>("RadarModeType", numIterations) && ok;
+        ok = timeConversions<six::DualPolarizationType>("DualPolarizationType", numIterations) && ok;
+
+        if (!ok)
+        {
+            std::cerr << "Round trip mismatch\n";
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+    }
+    catch (const except::Exception& ex)
+    {
+        std::cerr << ex.toString() << std::endl;
+    }
+    return EXIT_FAILURE;
+}
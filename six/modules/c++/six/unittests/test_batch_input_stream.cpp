@@ -0,0 +1,195 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <stdint.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <std/filesystem>
+
+#include <io/FileOutputStream.h>
+#include <six/BatchInputStream.h>
+
+#include "TestCase.h"
+
+namespace
+{
+const char* FILE_NAME = "temp_batch_input_stream.bin";
+
+// A little over three chunks, so reads cross chunk boundaries
+const size_t FILE_SIZE = 3 * six::BatchInputStream::CHUNK_SIZE + 4093;
+
+uint8_t getByte(size_t offset)
+{
+    return static_cast<uint8_t>((offset * 7 + offset / 251) & 0xFF);
+}
+
+void writeFile()
+{
+    std::vector<uint8_t> data(FILE_SIZE);
+    for (size_t ii = 0; ii < data.size(); ++ii)
+    {
+        data[ii] = getByte(ii);
+    }
+    io::FileOutputStream outStream(FILE_NAME);
+    outStream.write(data.data(), data.size());
+    outStream.close();
+}
+
+bool matches(const std::vector<uint8_t>& buffer, size_t offset)
+{
+    for (size_t ii = 0; ii < buffer.size(); ++ii)
+    {
+        if (buffer[ii] != getByte(offset + ii))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void testBackend(const std::string& testName,
+                 six::BatchInputStream::Backend backend)
+{
+    writeFile();
+    six::BatchInputStream stream(FILE_NAME, backend, 8);
+    TEST_ASSERT(stream.getBackend() != six::BatchInputStream::Backend::AUTO);
+
+    // Many small ranges, one spanning every chunk, one at the very end
+    const std::vector<std::pair<size_t, size_t> > ranges = {
+            {0, 1}, {17, 300}, {1000, 5000}, {4093, FILE_SIZE - 4093},
+            {FILE_SIZE - 10, 10}};
+    std::vector<std::vector<uint8_t> > buffers;
+    std::vector<six::BatchInputStream::Request> requests;
+    for (const auto& range : ranges)
+    {
+        buffers.emplace_back(range.second);
+    }
+    for (size_t ii = 0; ii < ranges.size(); ++ii)
+    {
+        requests.push_back({static_cast<int64_t>(ranges[ii].first),
+                            ranges[ii].second,
+                            buffers[ii].data()});
+    }
+
+    stream.seek(123, io::Seekable::START);
+    stream.readBatch(requests);
+    for (size_t ii = 0; ii < ranges.size(); ++ii)
+    {
+        TEST_ASSERT(matches(buffers[ii], ranges[ii].first));
+    }
+
+    // The stream position isn't used or moved
+    TEST_ASSERT_EQ(stream.tell(), 123);
+
+    // Plain reads larger than a chunk
+    std::vector<uint8_t> buffer(2 * six::BatchInputStream::CHUNK_SIZE + 5);
+    const sys::SSize_T numRead = stream.read(buffer.data(), buffer.size());
+    TEST_ASSERT_EQ(numRead, static_cast<sys::SSize_T>(buffer.size()));
+    TEST_ASSERT(matches(buffer, 123));
+    TEST_ASSERT_EQ(stream.tell(),
+                   static_cast<sys::Off_T>(123 + buffer.size()));
+
+    // Short reads at the end of the file stop at the end
+    stream.seek(FILE_SIZE - 3, io::Seekable::START);
+    const sys::SSize_T numReadAtEnd =
+            stream.read(buffer.data(), buffer.size());
+    TEST_ASSERT_EQ(numReadAtEnd, 3);
+
+    // Reading past the end throws
+    std::vector<uint8_t> past(100);
+    TEST_EXCEPTION(stream.readBatch(
+            {{static_cast<int64_t>(FILE_SIZE - 50), past.size(),
+              past.data()}}));
+}
+}
+
+TEST_CASE(testAuto)
+{
+    testBackend(testName, six::BatchInputStream::Backend::AUTO);
+}
+
+TEST_CASE(testSynchronous)
+{
+    testBackend(testName, six::BatchInputStream::Backend::SYNCHRONOUS);
+}
+
+TEST_CASE(testConcurrentBatches)
+{
+    writeFile();
+    six::BatchInputStream stream(FILE_NAME);
+
+    // Every thread reads its own ranges through the same stream at once
+    const size_t numThreads = 4;
+    std::vector<bool> results(numThreads, true);
+    std::vector<std::thread> threads;
+    for (size_t thread = 0; thread < numThreads; ++thread)
+    {
+        threads.emplace_back([&, thread]()
+        {
+            for (size_t ii = 0; ii < 20; ++ii)
+            {
+                const size_t offset = (thread * 20 + ii) * 30011 % (FILE_SIZE / 2);
+                std::vector<uint8_t> first(3000);
+                std::vector<uint8_t> second(six::BatchInputStream::CHUNK_SIZE + 7);
+                stream.readBatch({{static_cast<int64_t>(offset), first.size(), first.data()},
+                                  {static_cast<int64_t>(offset + 5000), second.size(), second.data()}});
+                if (!matches(first, offset) || !matches(second, offset + 5000))
+                {
+                    results[thread] = false;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    for (size_t thread = 0; thread < numThreads; ++thread)
+    {
+        TEST_ASSERT(results[thread]);
+    }
+}
+
+TEST_CASE(testIOInterface)
+{
+    writeFile();
+    six::BatchIOInterface io(FILE_NAME);
+    TEST_ASSERT_EQ(io.getSize(), static_cast<nitf::Off>(FILE_SIZE));
+
+    std::vector<uint8_t> buffer(six::BatchInputStream::CHUNK_SIZE + 1);
+    io.seek(FILE_SIZE - buffer.size(), SEEK_SET);
+    io.read(buffer.data(), buffer.size());
+    TEST_ASSERT(matches(buffer, FILE_SIZE - buffer.size()));
+    TEST_ASSERT_EQ(io.tell(), static_cast<nitf::Off>(FILE_SIZE));
+    TEST_EXCEPTION(io.read(buffer.data(), 1));
+}
+
+TEST_MAIN(
+    TEST_CHECK(testAuto);
+    TEST_CHECK(testSynchronous);
+    TEST_CHECK(testConcurrentBatches);
+    TEST_CHECK(testIOInterface);
+    std::filesystem::remove(FILE_NAME);
+    )
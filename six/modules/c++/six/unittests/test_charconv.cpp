@@ -0,0 +1,161 @@
+/* =========================================================================
+* This file is part of six-c++
+* =========================================================================
+*
+* (C) Copyright 2026, Maxar Technologies, Inc.
+*
+* six-c++ is free software; you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation; either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License along with this program; If not,
+* see <http://www.gnu.org/licenses/>.
+*
+*/
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <limits>
+#include <string>
+#include <random>
+
+#include <str/Convert.h>
+#include <six/CharConv.h>
+
+#include "TestCase.h"
+
+TEST_CASE(testFormatDouble)
+{
+    TEST_ASSERT_EQ(six::charconv::toString(0.0), "0");
+    TEST_ASSERT_EQ(six::charconv::toString(-2.5), "-2.5");
+    TEST_ASSERT_EQ(six::charconv::toString(0.1), "0.1");
+    TEST_ASSERT_EQ(six::charconv::toString(1.0e20), "1e+20");
+    TEST_ASSERT_EQ(six::charconv::toString(1.0e-7), "1e-07");
+    TEST_ASSERT_EQ(six::charconv::toString(123456.789), "123456.789");
+    TEST_ASSERT_EQ(six::charconv::toString(1.0 / 3.0), "0.3333333333333333");
+    TEST_ASSERT_EQ(six::charconv::toString(0.1 + 0.2), "0.30000000000000004");
+
+    // A fixed precision is exactly what str::toString() has always written
+    const double values[] = { 0.1, 1.0 / 3.0, -6378137.0, 5.0e-324, 1.7976931348623157e308 };
+    for (auto v : values)
+    {
+        char buf[32];
+        const auto result = six::charconv::to_chars(buf, buf + sizeof(buf), v, 17);
+        TEST_ASSERT(result.ec == std::errc());
+        TEST_ASSERT_EQ(std::string(buf, result.ptr), str::toString(v));
+    }
+
+    char small[4];
+    const auto result = six::charconv::to_chars(small, small + sizeof(small), 1.0 / 3.0);
+    TEST_ASSERT(result.ec == std::errc::value_too_large);
+}
+
+TEST_CASE(testRoundTripDouble)
+{
+    // Random bit patterns cover every exponent, including denormals
+    std::mt19937_64 generator(0x5158);
+    size_t numMismatches = 0;
+    for (size_t ii = 0; ii < 100000; ++ii)
+    {
+        const uint64_t bits = generator();
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        if (value != value || value - value != 0.0) // NaN or inf
+        {
+            continue;
+        }
+
+        const auto s = six::charconv::toString(value);
+        double parsed;
+        const auto result = six::charconv::from_chars(s.data(), s.data() + s.size(), parsed);
+        if ((result.ec != std::errc()) || (parsed != value) ||
+            (strtod(s.c_str(), nullptr) != value))
+        {
+            ++numMismatches;
+        }
+    }
+    TEST_ASSERT_EQ(numMismatches, static_cast<size_t>(0));
+}
+
+TEST_CASE(testParseDouble)
+{
+    // Long and short mantissas, with and without exponents, all agree with strtod()
+    const char* strings[] = { "0", "-0.0", "1", "+1.5", ".5", "5.", "1e5", "1E-5", "2.5e+3",
+        "0.000123456789012345678901234567890", "123456789012345678901234567890",
+        "9007199254740993", "4.9406564584124654e-324", "1.7976931348623157e308",
+        "-6378137.0", "0.30000000000000004", "1e22", "1e23", "3.14159265358979323846" };
+    for (auto s : strings)
+    {
+        const auto last = s + strlen(s);
+        double value;
+        const auto result = six::charconv::from_chars(s, last, value);
+        TEST_ASSERT(result.ec == std::errc());
+        TEST_ASSERT(result.ptr == last);
+        TEST_ASSERT_EQ(value, strtod(s, nullptr));
+    }
+
+    double value = 42.0;
+    const char bad[] = "abc";
+    auto result = six::charconv::from_chars(bad, bad + 3, value);
+    TEST_ASSERT(result.ec == std::errc::invalid_argument);
+    TEST_ASSERT(result.ptr == bad);
+    TEST_ASSERT_EQ(value, 42.0);
+
+    const char overflow[] = "1e400";
+    result = six::charconv::from_chars(overflow, overflow + 5, value);
+    TEST_ASSERT(result.ec == std::errc::result_out_of_range);
+
+    // Conversion stops at the first character that isn't part of a number
+    const char partial[] = "1.5e";
+    result = six::charconv::from_chars(partial, partial + 4, value);
+    TEST_ASSERT(result.ec == std::errc());
+    TEST_ASSERT(result.ptr == partial + 3);
+    TEST_ASSERT_EQ(value, 1.5);
+}
+
+TEST_CASE(testToType)
+{
+    // Same leniency as str::toType<>()
+    TEST_ASSERT_EQ(six::charconv::toType<double>(" \n\t1.25\n"), 1.25);
+    TEST_ASSERT_EQ(six::charconv::toType<double>("1.25xyz"), 1.25);
+    TEST_ASSERT_EQ(six::charconv::toType<int>("1.25"), 1);
+    TEST_ASSERT_EQ(six::charconv::toType<int>("-17"), -17);
+    TEST_ASSERT_EQ(six::charconv::toType<size_t>("2:FRFC"), static_cast<size_t>(2));
+    TEST_ASSERT_EQ(six::charconv::toType<short>("-32768"), static_cast<short>(-32768));
+    TEST_ASSERT_EQ(six::charconv::toType<int64_t>("-9223372036854775808"), std::numeric_limits<int64_t>::min());
+    TEST_ASSERT_EQ(six::charconv::toType<uint64_t>("18446744073709551615"), std::numeric_limits<uint64_t>::max());
+
+    TEST_EXCEPTION(six::charconv::toType<double>(""));
+    TEST_EXCEPTION(six::charconv::toType<double>("   "));
+    TEST_EXCEPTION(six::charconv::toType<double>("nan"));
+    TEST_EXCEPTION(six::charconv::toType<double>("inf"));
+    TEST_EXCEPTION(six::charconv::toType<int>("x1"));
+    TEST_EXCEPTION(six::charconv::toType<short>("32768"));
+    TEST_EXCEPTION(six::charconv::toType<size_t>("-1"));
+    TEST_EXCEPTION(six::charconv::toType<uint64_t>("18446744073709551616"));
+}
+
+TEST_CASE(testFormatInteger)
+{
+    TEST_ASSERT_EQ(six::charconv::toString(0), "0");
+    TEST_ASSERT_EQ(six::charconv::toString(-17), "-17");
+    TEST_ASSERT_EQ(six::charconv::toString(std::numeric_limits<int64_t>::min()), "-9223372036854775808");
+    TEST_ASSERT_EQ(six::charconv::toString(std::numeric_limits<uint64_t>::max()), "18446744073709551615");
+    TEST_ASSERT_EQ(six::charconv::toString(static_cast<size_t>(12345)), str::toString(static_cast<size_t>(12345)));
+}
+
+TEST_MAIN(
+    TEST_CHECK(testFormatDouble);
+    TEST_CHECK(testRoundTripDouble);
+    TEST_CHECK(testParseDouble);
+    TEST_CHECK(testToType);
+    TEST_CHECK(testFormatInteger);
+    )
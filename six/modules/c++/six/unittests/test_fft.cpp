@@ -0,0 +1,144 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#include <six/FFT.h>
+
+#include "TestCase.h"
+
+namespace
+{
+std::vector<std::complex<float> > makeInput(size_t size)
+{
+    std::vector<std::complex<float> > input(size);
+    for (size_t ii = 0; ii < size; ++ii)
+    {
+        input[ii] = std::complex<float>(
+                static_cast<float>(std::sin(0.7 * ii) + 0.1 * ii),
+                static_cast<float>(std::cos(1.3 * ii * ii)));
+    }
+    return input;
+}
+
+// Direct DFT with n and k running from -offset
+std::vector<std::complex<double> > dft(
+        const std::vector<std::complex<float> >& input,
+        double sign,
+        size_t offset)
+{
+    const size_t size = input.size();
+    std::vector<std::complex<double> > output(size);
+    for (size_t kk = 0; kk < size; ++kk)
+    {
+        for (size_t nn = 0; nn < size; ++nn)
+        {
+            const double n = static_cast<double>(nn) - offset;
+            const double k = static_cast<double>(kk) - offset;
+            output[kk] += std::complex<double>(input[nn]) *
+                    std::polar(1.0, sign * 2.0 * M_PI * n * k / size);
+        }
+    }
+    return output;
+}
+
+double maxError(const std::vector<std::complex<float> >& actual,
+                const std::vector<std::complex<double> >& expected)
+{
+    double error = 0.0;
+    for (size_t ii = 0; ii < actual.size(); ++ii)
+    {
+        error = std::max(error, std::abs(
+                std::complex<double>(actual[ii]) - expected[ii]));
+    }
+    return error;
+}
+}
+
+TEST_CASE(testMatchesDFT)
+{
+    const size_t sizes[] = {1, 2, 8, 64, 3, 15, 100, 257};
+    for (size_t size : sizes)
+    {
+        const six::FFT fft(size);
+        TEST_ASSERT_EQ(fft.size(), size);
+
+        const std::vector<std::complex<float> > input = makeInput(size);
+        const double tolerance = 1e-5 * size * std::sqrt(double(size));
+
+        std::vector<std::complex<float> > output(input);
+        fft.transform(output.data(), six::FFTSign::NEG);
+        TEST_ASSERT_LESSER(maxError(output, dft(input, -1.0, 0)), tolerance);
+
+        output = input;
+        fft.transform(output.data(), six::FFTSign::POS);
+        TEST_ASSERT_LESSER(maxError(output, dft(input, 1.0, 0)), tolerance);
+    }
+}
+
+TEST_CASE(testCentered)
+{
+    const size_t sizes[] = {16, 21};
+    for (size_t size : sizes)
+    {
+        const six::FFT fft(size);
+        const std::vector<std::complex<float> > input = makeInput(size);
+        std::vector<std::complex<float> > output(input);
+        fft.transformCentered(output.data(), six::FFTSign::NEG);
+        TEST_ASSERT_LESSER(maxError(output, dft(input, -1.0, size / 2)),
+                           1e-3);
+    }
+}
+
+TEST_CASE(testRoundTrip)
+{
+    const six::FFT fft(45);
+    const std::vector<std::complex<float> > input = makeInput(fft.size());
+    std::vector<std::complex<float> > output(input);
+    fft.transform(output.data(), six::FFTSign::NEG);
+    fft.transform(output.data(), six::FFTSign::POS);
+
+    std::vector<std::complex<double> > expected(input.size());
+    for (size_t ii = 0; ii < input.size(); ++ii)
+    {
+        expected[ii] = std::complex<double>(input[ii]) *
+                static_cast<double>(fft.size());
+    }
+    TEST_ASSERT_LESSER(maxError(output, expected), 1e-3);
+}
+
+TEST_CASE(testNextPowerOfTwo)
+{
+    TEST_ASSERT_EQ(six::FFT::nextPowerOfTwo(0), static_cast<size_t>(1));
+    TEST_ASSERT_EQ(six::FFT::nextPowerOfTwo(1), static_cast<size_t>(1));
+    TEST_ASSERT_EQ(six::FFT::nextPowerOfTwo(5), static_cast<size_t>(8));
+    TEST_ASSERT_EQ(six::FFT::nextPowerOfTwo(64), static_cast<size_t>(64));
+    TEST_EXCEPTION(six::FFT(0));
+}
+
+TEST_MAIN(
+    TEST_CHECK(testMatchesDFT);
+    TEST_CHECK(testCentered);
+    TEST_CHECK(testRoundTrip);
+    TEST_CHECK(testNextPowerOfTwo);
+    )
@@ -0,0 +1,169 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <six/Instrumentation.h>
+
+#include "TestCase.h"
+
+namespace
+{
+void timedWork(size_t iterations)
+{
+    for (size_t ii = 0; ii < iterations; ++ii)
+    {
+        SIX_SCOPED_TIMER("test::work");
+        SIX_COUNT("test.iterations", 1);
+    }
+    SIX_COUNT("test.items", static_cast<uint64_t>(iterations * 10));
+}
+
+bool contains(const std::string& str, const std::string& substr)
+{
+    return str.find(substr) != std::string::npos;
+}
+}
+
+TEST_CASE(testDisabled)
+{
+    six::Instrumentation::setEnabled(false);
+    six::Instrumentation::reset();
+    timedWork(5);
+
+    const auto report = six::Instrumentation::getReport();
+    TEST_ASSERT(report.counters.empty());
+    TEST_ASSERT(report.timers.empty());
+    TEST_ASSERT(report.events.empty());
+}
+
+TEST_CASE(testThreadsAggregate)
+{
+    six::Instrumentation::setEnabled(true);
+    six::Instrumentation::reset();
+
+    std::vector<std::thread> threads;
+    for (size_t ii = 1; ii <= 4; ++ii)
+    {
+        threads.emplace_back(timedWork, ii * 100);
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    timedWork(3);
+
+    const auto report = six::Instrumentation::getReport();
+    TEST_ASSERT_EQ(report.counters.at("test.iterations"),
+                   static_cast<uint64_t>(1003));
+    TEST_ASSERT_EQ(report.counters.at("test.items"),
+                   static_cast<uint64_t>(10030));
+
+    const auto& timer = report.timers.at("test::work");
+    TEST_ASSERT_EQ(timer.count, static_cast<uint64_t>(1003));
+    TEST_ASSERT(timer.minNanoseconds >= 0);
+    TEST_ASSERT(timer.minNanoseconds <= timer.maxNanoseconds);
+    TEST_ASSERT(timer.maxNanoseconds <= timer.totalNanoseconds);
+
+    // Not tracing
+    TEST_ASSERT(report.events.empty());
+
+    six::Instrumentation::reset();
+    const auto cleared = six::Instrumentation::getReport();
+    TEST_ASSERT(cleared.counters.empty());
+    TEST_ASSERT(cleared.timers.empty());
+    six::Instrumentation::setEnabled(false);
+}
+
+TEST_CASE(testTracing)
+{
+    six::Instrumentation::setEnabled(true, true);
+    six::Instrumentation::reset();
+    TEST_ASSERT(six::Instrumentation::isTracing());
+
+    {
+        SIX_SCOPED_TIMER("test::outer");
+        std::thread(timedWork, 2).join();
+    }
+
+    const auto report = six::Instrumentation::getReport();
+    TEST_ASSERT_EQ(report.events.size(), static_cast<size_t>(3));
+    TEST_ASSERT_EQ(report.events[0].name, std::string("test::outer"));
+    TEST_ASSERT(report.events[1].threadId != report.events[0].threadId);
+    for (const auto& event : report.events)
+    {
+        TEST_ASSERT(event.startNanoseconds >=
+                    report.events[0].startNanoseconds);
+        TEST_ASSERT(event.startNanoseconds + event.durationNanoseconds <=
+                    report.events[0].startNanoseconds +
+                    report.events[0].durationNanoseconds);
+    }
+
+    six::Instrumentation::setEnabled(false);
+    TEST_ASSERT(!six::Instrumentation::isTracing());
+}
+
+TEST_CASE(testSinks)
+{
+    six::Instrumentation::setEnabled(true, true);
+    six::Instrumentation::reset();
+    timedWork(2);
+    SIX_COUNT("test.\"quoted\"", 7);
+    const auto report = six::Instrumentation::getReport();
+    six::Instrumentation::setEnabled(false);
+
+    std::ostringstream json;
+    six::JSONInstrumentationSink(json).write(report);
+    TEST_ASSERT(contains(json.str(), "\"counters\": {"));
+    TEST_ASSERT(contains(json.str(), "\"test.iterations\": 2"));
+    TEST_ASSERT(contains(json.str(), "\"test.\\\"quoted\\\"\": 7"));
+    TEST_ASSERT(contains(json.str(), "\"test::work\": {\"count\": 2"));
+    TEST_ASSERT(contains(json.str(), "\"totalSeconds\": "));
+
+    std::ostringstream trace;
+    six::ChromeTraceSink(trace).write(report);
+    TEST_ASSERT(contains(trace.str(), "{\"traceEvents\": ["));
+    TEST_ASSERT(contains(trace.str(),
+                         "{\"name\": \"test::work\", \"cat\": \"six\", "
+                         "\"ph\": \"X\", \"ts\": "));
+    TEST_ASSERT(contains(trace.str(), "\"ph\": \"C\""));
+    TEST_ASSERT(contains(trace.str(), "\"args\": {\"value\": 20}"));
+
+    // flush() writes to the sink and resets
+    std::ostringstream flushed;
+    six::Instrumentation::setSink(
+            std::make_shared<six::JSONInstrumentationSink>(flushed));
+    six::Instrumentation::flush();
+    six::Instrumentation::setSink(nullptr);
+    TEST_ASSERT(contains(flushed.str(), "\"test.items\": 20"));
+    TEST_ASSERT(six::Instrumentation::getReport().counters.empty());
+}
+
+TEST_MAIN(
+    TEST_CHECK(testDisabled);
+    TEST_CHECK(testThreadsAggregate);
+    TEST_CHECK(testTracing);
+    TEST_CHECK(testSinks);
+    )
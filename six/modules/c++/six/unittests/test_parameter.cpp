@@ -0,0 +1,163 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2026, Maxar Technologies, Inc.
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include <complex>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <str/Convert.h>
+#include <six/Options.h>
+#include <six/Parameter.h>
+
+#include "TestCase.h"
+
+TEST_CASE(testNumbers)
+{
+    const six::Parameter integer(-42);
+    TEST_ASSERT_EQ(static_cast<int>(integer), -42);
+    TEST_ASSERT_EQ(static_cast<int8_t>(integer), -42);
+    TEST_ASSERT_EQ(static_cast<double>(integer), -42.0);
+    TEST_ASSERT_EQ(integer.str(), "-42");
+
+    const uint64_t big = std::numeric_limits<uint64_t>::max();
+    const six::Parameter unsignedInteger(big);
+    TEST_ASSERT_EQ(static_cast<uint64_t>(unsignedInteger), big);
+    TEST_ASSERT_EQ(unsignedInteger.str(), str::toString(big));
+
+    // No rounding through the formatted string
+    const double third = 1.0 / 3.0;
+    const six::Parameter real(third);
+    TEST_ASSERT_EQ(static_cast<double>(real), third);
+    TEST_ASSERT_EQ(real.str(), str::toString(third));
+    TEST_ASSERT_EQ(std::string(static_cast<const char*>(real)),
+                   str::toString(third));
+
+    const six::Parameter single(0.1f);
+    TEST_ASSERT_EQ(static_cast<float>(single), 0.1f);
+    TEST_ASSERT_EQ(single.str(), str::toString(0.1f));
+
+    // Values a type can't hold are converted as before, from the string
+    const six::Parameter half(2.5);
+    TEST_ASSERT_EQ(static_cast<int>(half), 2);
+    TEST_ASSERT_EQ(static_cast<int>(six::Parameter(8.0)), 8);
+    TEST_ASSERT_EQ(static_cast<uint8_t>(six::Parameter(200)), 200);
+    TEST_EXCEPTION(static_cast<int>(six::Parameter("abc")));
+}
+
+TEST_CASE(testComplex)
+{
+    const std::complex<float> value(1.5f, -0.25f);
+    const six::Parameter parameter(value);
+    TEST_ASSERT_EQ(parameter.getComplex<float>(), value);
+    TEST_ASSERT_EQ(parameter.str(), str::toString(value));
+    TEST_ASSERT_EQ(parameter.getComplex<double>(),
+                   std::complex<double>(1.5, -0.25));
+
+    six::Parameter integer;
+    integer.setValue(std::complex<int16_t>(-3, 7));
+    TEST_ASSERT_EQ(integer.getComplex<int16_t>(),
+                   std::complex<int16_t>(-3, 7));
+
+    TEST_ASSERT_EQ(six::Parameter(4).getComplex<double>(),
+                   std::complex<double>(4.0, 0.0));
+}
+
+TEST_CASE(testStrings)
+{
+    six::Parameter parameter("value");
+    TEST_ASSERT_EQ(parameter.str(), "value");
+    TEST_ASSERT_EQ(strcmp(parameter, "value"), 0);
+
+    parameter.setValue(std::string("12.5"));
+    TEST_ASSERT_EQ(static_cast<double>(parameter), 12.5);
+    TEST_ASSERT_EQ(static_cast<int>(parameter), 12);
+
+    parameter.setValue(true);
+    TEST_ASSERT_EQ(parameter.str(), "true");
+    TEST_ASSERT_TRUE(static_cast<bool>(parameter));
+
+    parameter.setValue(7);
+    TEST_ASSERT_EQ(parameter.str(), "7");
+}
+
+TEST_CASE(testEquality)
+{
+    six::Parameter lhs(3);
+    six::Parameter rhs(3);
+    TEST_ASSERT_TRUE(lhs == rhs);
+    rhs.setName("name");
+    TEST_ASSERT_TRUE(lhs != rhs);
+    lhs.setName("name");
+    TEST_ASSERT_TRUE(lhs == rhs);
+
+    // Different types compare by their strings
+    TEST_ASSERT_TRUE(six::Parameter(3) == six::Parameter("3"));
+    TEST_ASSERT_TRUE(six::Parameter(3) != six::Parameter(3.5));
+}
+
+TEST_CASE(testOptions)
+{
+    six::Options options;
+    options.setParameter("cutoff", six::Parameter(static_cast<ptrdiff_t>(-1)));
+    const ptrdiff_t cutoff = options.getParameter("cutoff", six::Parameter(0));
+    TEST_ASSERT_EQ(cutoff, -1);
+    const int missing = options.getParameter("missing", six::Parameter(5));
+    TEST_ASSERT_EQ(missing, 5);
+}
+
+TEST_CASE(testConcurrentReads)
+{
+    // Const access doesn't write, so threads can share a Parameter
+    const six::Parameter real(1.0 / 3.0);
+    std::vector<const char*> values(8);
+    std::vector<std::thread> threads;
+    for (size_t ii = 0; ii < values.size(); ++ii)
+    {
+        threads.emplace_back([&real, &values, ii]()
+        {
+            values[ii] = real;
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    for (const char* value : values)
+    {
+        TEST_ASSERT_EQ(value, static_cast<const char*>(real));
+    }
+    TEST_ASSERT_EQ(std::string(values[0]), str::toString(1.0 / 3.0));
+}
+
+TEST_MAIN(
+    TEST_CHECK(testNumbers);
+    TEST_CHECK(testComplex);
+    TEST_CHECK(testStrings);
+    TEST_CHECK(testEquality);
+    TEST_CHECK(testOptions);
+    TEST_CHECK(testConcurrentReads);
+)
@@ -38,6 +38,9 @@
 %import "scene.i"
 
 %{
+#include <algorithm>
+#include <cstring>
+
 #include "import/types.h"
 #include "import/cphd.h"
 #include "import/six.h"
@@ -46,6 +49,111 @@
 #include <numpyutils/numpyutils.h>
 
 using six::Vector3;
+
+namespace
+{
+void appendPVPField(PyObject* fields,
+                    const std::string& name,
+                    const cphd::PVPType& type)
+{
+    if (six::Init::isUndefined<size_t>(type.getOffset()))
+    {
+        return;
+    }
+    PyObject* const field = Py_BuildValue(
+            "(snns)",
+            name.c_str(),
+            static_cast<Py_ssize_t>(type.getByteOffset()),
+            static_cast<Py_ssize_t>(type.getSize()),
+            type.getFormat().c_str());
+    numpyutils::verifyNewPyObject(field);
+    const int status = PyList_Append(fields, field);
+    Py_DECREF(field);
+    if (status != 0)
+    {
+        throw except::Exception(Ctxt("Couldn't append PVP field " + name));
+    }
+}
+
+// Reads vectors [firstVector, lastVector] of a channel into a new complex64
+// array, scaling and promoting in C++ with the GIL released
+PyObject* readWidebandVectors(const cphd::Wideband& wideband,
+                              size_t channel,
+                              size_t firstVector,
+                              size_t lastVector,
+                              size_t firstSample,
+                              size_t lastSample,
+                              PyObject* vectorScaleFactors,
+                              size_t numThreads)
+{
+    const types::RowCol<size_t> dims = wideband.getBufferDims(
+            channel, firstVector, lastVector, firstSample, lastSample);
+
+    std::vector<double> scaleFactors(dims.row, 1.0);
+    if (vectorScaleFactors != Py_None)
+    {
+        numpyutils::verifyArrayType(vectorScaleFactors, NPY_DOUBLE);
+        if (!PyArray_IS_C_CONTIGUOUS(
+                    reinterpret_cast<PyArrayObject*>(vectorScaleFactors)) ||
+            numpyutils::getNumElements(vectorScaleFactors) != dims.row)
+        {
+            throw except::Exception(Ctxt(
+                    "Expected " + std::to_string(dims.row) +
+                    " contiguous vector scale factors"));
+        }
+        const double* const factors =
+                numpyutils::getBuffer<double>(vectorScaleFactors);
+        std::copy(factors, factors + dims.row, scaleFactors.begin());
+    }
+
+    PyObject* array = Py_None;
+    numpyutils::createOrVerify(array, NPY_COMPLEX64, dims);
+    try
+    {
+        std::complex<float>* const buffer =
+                numpyutils::getBuffer<std::complex<float> >(array);
+
+        numpyutils::ScopedGILRelease release;
+        std::vector<std::byte> scratch;
+        if (wideband.getElementSize() != sizeof(std::complex<float>) ||
+            std::any_of(scaleFactors.begin(), scaleFactors.end(),
+                        [](double factor) { return factor != 1.0; }))
+        {
+            scratch.resize(dims.area() * wideband.getElementSize());
+        }
+        wideband.read(channel,
+                      firstVector,
+                      lastVector,
+                      firstSample,
+                      lastSample,
+                      scaleFactors,
+                      numThreads,
+                      std::span<std::byte>(scratch.data(), scratch.size()),
+                      std::span<std::complex<float> >(buffer, dims.area()));
+    }
+    catch (...)
+    {
+        Py_DECREF(array);
+        throw;
+    }
+    return array;
+}
+
+// Throws unless array is C-contiguous and exactly numBytes long
+void verifyArrayBytes(PyObject* array,
+                      size_t numBytes,
+                      const std::string& name)
+{
+    PyArrayObject* const pyArray = reinterpret_cast<PyArrayObject*>(array);
+    if (!PyArray_IS_C_CONTIGUOUS(pyArray) ||
+        static_cast<size_t>(PyArray_NBYTES(pyArray)) != numBytes)
+    {
+        throw except::Exception(Ctxt(
+                "Expected " + name + " to be a contiguous array of " +
+                std::to_string(numBytes) + " bytes"));
+    }
+}
+}
 %}
 
 %ignore cphd::CPHDXMLControl::toXML(const Metadata& metadata);
@@ -63,6 +171,11 @@ using six::Vector3;
     const std::string& xmlString,
     const std::vector<std::string>& schemaPaths);
 
+// Batched reads into caller buffers aren't exposed to Python
+%ignore cphd::Wideband::ReadRequest;
+%ignore cphd::Wideband::readMany;
+%ignore cphd::CPHDReader::readMany;
+
 // Nested class renames
 %rename(CphdAntenna) cphd::Antenna;
 %rename(DataChannel) cphd::Data::Channel;
@@ -143,6 +256,82 @@ using six::Vector3;
     }
 }
 
+%extend cphd::PVPBlock
+{
+    // A channel's PVP sets as a (numVectors, numBytesPVPSet) uint8 array,
+    // laid out as in the file but in native byte order
+    PyObject* getPVPBytes(size_t channel)
+    {
+        const size_t numBytes = $self->getNumBytesPVPSet();
+        const types::RowCol<size_t> dims(
+                $self->getPVPsize(channel) / numBytes, numBytes);
+
+        PyObject* array = Py_None;
+        numpyutils::createOrVerify(array, NPY_UINT8, dims);
+        try
+        {
+            void* const buffer = numpyutils::getBuffer<sys::ubyte>(array);
+
+            numpyutils::ScopedGILRelease release;
+            std::memset(buffer, 0, dims.area());
+            $self->getPVPdata(channel, buffer);
+        }
+        catch (...)
+        {
+            Py_DECREF(array);
+            throw;
+        }
+        return array;
+    }
+}
+
+%extend cphd::Pvp
+{
+    // (name, byte offset, size in words, format) of each parameter present
+    PyObject* getFields() const
+    {
+        PyObject* const fields = PyList_New(0);
+        numpyutils::verifyNewPyObject(fields);
+        try
+        {
+            appendPVPField(fields, "TxTime", $self->txTime);
+            appendPVPField(fields, "TxPos", $self->txPos);
+            appendPVPField(fields, "TxVel", $self->txVel);
+            appendPVPField(fields, "RcvTime", $self->rcvTime);
+            appendPVPField(fields, "RcvPos", $self->rcvPos);
+            appendPVPField(fields, "RcvVel", $self->rcvVel);
+            appendPVPField(fields, "SRPPos", $self->srpPos);
+            appendPVPField(fields, "AmpSF", $self->ampSF);
+            appendPVPField(fields, "aFDOP", $self->aFDOP);
+            appendPVPField(fields, "aFRR1", $self->aFRR1);
+            appendPVPField(fields, "aFRR2", $self->aFRR2);
+            appendPVPField(fields, "FX1", $self->fx1);
+            appendPVPField(fields, "FX2", $self->fx2);
+            appendPVPField(fields, "FXN1", $self->fxN1);
+            appendPVPField(fields, "FXN2", $self->fxN2);
+            appendPVPField(fields, "TOA1", $self->toa1);
+            appendPVPField(fields, "TOA2", $self->toa2);
+            appendPVPField(fields, "TOAE1", $self->toaE1);
+            appendPVPField(fields, "TOAE2", $self->toaE2);
+            appendPVPField(fields, "TDTropoSRP", $self->tdTropoSRP);
+            appendPVPField(fields, "TDIonoSRP", $self->tdIonoSRP);
+            appendPVPField(fields, "SC0", $self->sc0);
+            appendPVPField(fields, "SCSS", $self->scss);
+            appendPVPField(fields, "SIGNAL", $self->signal);
+            for (const auto& added : $self->addedPVP)
+            {
+                appendPVPField(fields, added.second.getName(), added.second);
+            }
+        }
+        catch (...)
+        {
+            Py_DECREF(fields);
+            throw;
+        }
+        return fields;
+    }
+}
+
 %extend cphd::Wideband
 {
     // We need to expose a way to read into a raw buffer
@@ -164,30 +353,102 @@ using six::Vector3;
                     dims,
                     reinterpret_cast<void*>(data));
     }
+
+    PyObject* readVectors(size_t channel,
+                          size_t firstVector,
+                          size_t lastVector,
+                          size_t firstSample,
+                          size_t lastSample,
+                          PyObject* vectorScaleFactors,
+                          size_t numThreads)
+    {
+        return readWidebandVectors(*$self,
+                                   channel,
+                                   firstVector,
+                                   lastVector,
+                                   firstSample,
+                                   lastSample,
+                                   vectorScaleFactors,
+                                   numThreads);
+    }
 }
 
 %extend cphd::CPHDReader
 {
     PyObject* getPHD(size_t channel)
     {
-        const auto& wb = self->getWideband();
-        const types::RowCol<size_t> dims =
-            wb.getBufferDims(channel,
-                             0,
-                             cphd::Wideband::ALL,
-                             0,
-                             cphd::Wideband::ALL);
-        std::vector<std::complex<float>> buffer(dims.area());
-        wb.read(channel,
-                0,
-                cphd::Wideband::ALL,
-                0,
-                cphd::Wideband::ALL,
-                1,
-                dims,
-                buffer.data());
-        return numpyutils::toNumpyArray(
-            dims.row, dims.col, NPY_COMPLEX64, buffer.data());
+        return readWidebandVectors(self->getWideband(),
+                                   channel,
+                                   0,
+                                   cphd::Wideband::ALL,
+                                   0,
+                                   cphd::Wideband::ALL,
+                                   Py_None,
+                                   1);
+    }
+}
+
+%extend cphd::CPHDReader
+{
+%pythoncode
+%{
+    def getPVPArray(self, channel):
+        return self.getPVPBlock().getPVPArray(channel,
+                                              self.getMetadata().pvp)
+
+    def iterVectors(self, channel = 0, numVectorsPerBlock = 1024,
+                    applyAmpSF = True, **kwargs):
+        """Iterates over blocks of a channel's vectors, scaled by AmpSF if
+        the PVPs have it and applyAmpSF is set.  See Wideband.iterVectors."""
+        scaleFactors = None
+        if applyAmpSF and self.getPVPBlock().hasAmpSF():
+            scaleFactors = self.getPVPArray(channel)['AmpSF']
+        return self.getWideband().iterVectors(channel, numVectorsPerBlock,
+                                              scaleFactors, **kwargs)
+%}
+}
+
+%extend cphd::CPHDWriter
+{
+    // Writes the whole file from a complex64 array holding every channel's
+    // [numVectors, numSamples] signal one after another and, if the
+    // metadata has support arrays, an array holding the whole support block
+    void writeCPHD(const cphd::PVPBlock& pvpBlock,
+                   PyObject* widebandData,
+                   PyObject* supportData = Py_None)
+    {
+        const cphd::Data& data = $self->getMetadata().data;
+
+        size_t numSamples = 0;
+        for (size_t ii = 0; ii < data.getNumChannels(); ++ii)
+        {
+            numSamples += data.getNumVectors(ii) * data.getNumSamples(ii);
+        }
+        numpyutils::verifyArrayType(widebandData, NPY_COMPLEX64);
+        verifyArrayBytes(widebandData,
+                         numSamples * sizeof(std::complex<float>),
+                         "widebandData");
+
+        const sys::ubyte* support = nullptr;
+        const size_t supportSize = data.getAllSupportSize();
+        if (supportSize > 0)
+        {
+            if (supportData == Py_None)
+            {
+                throw except::Exception(Ctxt(
+                        "The metadata has support arrays but no "
+                        "supportData was given"));
+            }
+            numpyutils::verifyArray(supportData);
+            verifyArrayBytes(supportData, supportSize, "supportData");
+            support = numpyutils::getBuffer<sys::ubyte>(supportData);
+        }
+
+        const std::complex<float>* const signal =
+                numpyutils::getBuffer<std::complex<float> >(widebandData);
+
+        numpyutils::ScopedGILRelease release;
+        $self->write(pvpBlock, signal, support);
     }
 }
 
@@ -229,6 +490,56 @@ def read(self,
     return numpyArray
 
 Wideband.read = read
+
+def iterVectors(self,
+                channel = 0,
+                numVectorsPerBlock = 1024,
+                vectorScaleFactors = None,
+                firstSample = 0,
+                lastSample = Wideband.ALL,
+                numThreads = multiprocessing.cpu_count()):
+    """Yields (firstVector, block) for consecutive blocks of up to
+    numVectorsPerBlock vectors as complex64 arrays.  vectorScaleFactors, if
+    given, has one factor per vector in the channel (e.g. the AmpSF PVP)."""
+    numVectors = self.getBufferDims(channel, 0, Wideband.ALL, 0, 0).row
+    if vectorScaleFactors is not None:
+        vectorScaleFactors = numpy.ascontiguousarray(vectorScaleFactors,
+                                                     dtype = 'float64')
+    for firstVector in range(0, numVectors, numVectorsPerBlock):
+        lastVector = min(firstVector + numVectorsPerBlock, numVectors) - 1
+        scaleFactors = None
+        if vectorScaleFactors is not None:
+            scaleFactors = vectorScaleFactors[firstVector:lastVector + 1]
+        yield firstVector, self.readVectors(channel, firstVector, lastVector,
+                                            firstSample, lastSample,
+                                            scaleFactors, numThreads)
+
+Wideband.iterVectors = iterVectors
+
+def _pvpFieldType(size, format):
+    if format.startswith('X=') and size == 3:
+        return (_pvpFieldType(1, format.split(';')[0][2:]), (3,))
+    if format.startswith('S'):
+        return 'S%d' % (size * 8)
+    types = {'F4': 'f4', 'F8': 'f8', 'CF8': 'c8', 'CF16': 'c16',
+             'I1': 'i1', 'I2': 'i2', 'I4': 'i4', 'I8': 'i8',
+             'U1': 'u1', 'U2': 'u2', 'U4': 'u4', 'U8': 'u8'}
+    return types.get(format, 'V%d' % (size * 8))
+
+def getPVPArray(self, channel, pvp):
+    """A channel's PVPs as a structured array with one record per vector.
+    Each field (e.g. pvps['TxPos'], an N x 3 array) is a view of the same
+    buffer, so selecting columns doesn't copy.  pvp is the Metadata's pvp."""
+    raw = self.getPVPBytes(channel)
+    fields = pvp.getFields()
+    dtype = numpy.dtype({'names': [field[0] for field in fields],
+                         'formats': [_pvpFieldType(field[2], field[3])
+                                     for field in fields],
+                         'offsets': [field[1] for field in fields],
+                         'itemsize': raw.shape[1]})
+    return raw.view(dtype).reshape(raw.shape[0])
+
+PVPBlock.getPVPArray = getPVPArray
 %}
 
 %extend cphd::CPHDXMLControl {
@@ -2667,6 +2667,7 @@ class SupportBlock(_object):
     def __init__(self, *args):
         """
         __init__(cphd::SupportBlock self, std::string const & pathname, Data data, sys::Off_T startSupport, sys::Off_T sizeSupport) -> SupportBlock
+        __init__(cphd::SupportBlock self, std::shared_ptr< io::SeekableInputStream > inStream, Data data, sys::Off_T startSupport, sys::Off_T sizeSupport, std::shared_ptr< std::mutex > streamMutex=nullptr) -> SupportBlock
         __init__(cphd::SupportBlock self, std::shared_ptr< io::SeekableInputStream > inStream, Data data, sys::Off_T startSupport, sys::Off_T sizeSupport) -> SupportBlock
         """
         this = _cphd.new_SupportBlock(*args)
@@ -4096,6 +4097,11 @@ class Pvp(_object):
         """appendCustomParameter(Pvp self, size_t size, std::string const & format, std::string const & name)"""
         return _cphd.Pvp_appendCustomParameter(self, size, format, name)
 
+
+    def getFields(self) -> "PyObject *":
+        """getFields(Pvp self) -> PyObject *"""
+        return _cphd.Pvp_getFields(self)
+
     __swig_destroy__ = _cphd.delete_Pvp
     __del__ = lambda self: None
 Pvp_swigregister = _cphd.Pvp_swigregister
@@ -4891,6 +4897,11 @@ class PVPBlock(_object):
         """
         return _cphd.PVPBlock_getPVPdata(self, *args)
 
+
+    def getPVPBytes(self, channel: 'size_t') -> "PyObject *":
+        """getPVPBytes(PVPBlock self, size_t channel) -> PyObject *"""
+        return _cphd.PVPBlock_getPVPBytes(self, channel)
+
     __swig_destroy__ = _cphd.delete_PVPBlock
     __del__ = lambda self: None
 PVPBlock_swigregister = _cphd.PVPBlock_swigregister
@@ -4955,6 +4966,7 @@ class Wideband(_object):
     def __init__(self, *args):
         """
         __init__(cphd::Wideband self, std::string const & pathname, MetadataBase metadata, sys::Off_T startWB, sys::Off_T sizeWB) -> Wideband
+        __init__(cphd::Wideband self, std::shared_ptr< io::SeekableInputStream > inStream, MetadataBase metadata, sys::Off_T startWB, sys::Off_T sizeWB, std::shared_ptr< std::mutex > streamMutex=nullptr) -> Wideband
         __init__(cphd::Wideband self, std::shared_ptr< io::SeekableInputStream > inStream, MetadataBase metadata, sys::Off_T startWB, sys::Off_T sizeWB) -> Wideband
         """
         this = _cphd.new_Wideband(*args)
@@ -5005,6 +5017,11 @@ class Wideband(_object):
         """readImpl(Wideband self, size_t channel, size_t firstVector, size_t lastVector, size_t firstSample, size_t lastSample, size_t numThreads, RowColSizeT dims, long long data)"""
         return _cphd.Wideband_readImpl(self, channel, firstVector, lastVector, firstSample, lastSample, numThreads, dims, data)
 
+
+    def readVectors(self, channel: 'size_t', firstVector: 'size_t', lastVector: 'size_t', firstSample: 'size_t', lastSample: 'size_t', vectorScaleFactors: 'PyObject *', numThreads: 'size_t') -> "PyObject *":
+        """readVectors(Wideband self, size_t channel, size_t firstVector, size_t lastVector, size_t firstSample, size_t lastSample, PyObject * vectorScaleFactors, size_t numThreads) -> PyObject *"""
+        return _cphd.Wideband_readVectors(self, channel, firstVector, lastVector, firstSample, lastSample, vectorScaleFactors, numThreads)
+
     __swig_destroy__ = _cphd.delete_Wideband
     __del__ = lambda self: None
 Wideband_swigregister = _cphd.Wideband_swigregister
@@ -5089,6 +5106,21 @@ class CPHDReader(_object):
         """getPHD(CPHDReader self, size_t channel) -> PyObject *"""
         return _cphd.CPHDReader_getPHD(self, channel)
 
+
+    def getPVPArray(self, channel):
+        return self.getPVPBlock().getPVPArray(channel,
+                                              self.getMetadata().pvp)
+
+    def iterVectors(self, channel = 0, numVectorsPerBlock = 1024,
+                    applyAmpSF = True, **kwargs):
+        """Iterates over blocks of a channel's vectors, scaled by AmpSF if
+        the PVPs have it and applyAmpSF is set.  See Wideband.iterVectors."""
+        scaleFactors = None
+        if applyAmpSF and self.getPVPBlock().hasAmpSF():
+            scaleFactors = self.getPVPArray(channel)['AmpSF']
+        return self.getWideband().iterVectors(channel, numVectorsPerBlock,
+                                              scaleFactors, **kwargs)
+
     __swig_destroy__ = _cphd.delete_CPHDReader
     __del__ = lambda self: None
 CPHDReader_swigregister = _cphd.CPHDReader_swigregister
@@ -5206,9 +5238,12 @@ class CPHDWriter(_object):
         return _cphd.CPHDWriter_writeMetadata(self, pvpBlock)
 
 
-    def writePVPData(self, PVPBlock: 'PVPBlock') -> "void":
-        """writePVPData(CPHDWriter self, PVPBlock PVPBlock)"""
-        return _cphd.CPHDWriter_writePVPData(self, PVPBlock)
+    def writePVPData(self, *args) -> "void":
+        """
+        writePVPData(CPHDWriter self, PVPBlock PVPBlock)
+        writePVPData(CPHDWriter self, PVPBlock pvpBlock, size_t channel, size_t firstVector)
+        """
+        return _cphd.CPHDWriter_writePVPData(self, *args)
 
 
     def close(self) -> "void":
@@ -5216,6 +5251,19 @@ class CPHDWriter(_object):
         return _cphd.CPHDWriter_close(self)
 
 
+    def getMetadata(self) -> "cphd::Metadata const &":
+        """getMetadata(CPHDWriter self) -> Metadata"""
+        return _cphd.CPHDWriter_getMetadata(self)
+
+
+    def writeCPHD(self, *args) -> "void":
+        """
+        writeCPHD(CPHDWriter self, PVPBlock pvpBlock, PyObject * widebandData, PyObject * supportData=Py_None)
+        writeCPHD(CPHDWriter self, PVPBlock pvpBlock, PyObject * widebandData)
+        """
+        return _cphd.CPHDWriter_writeCPHD(self, *args)
+
+
     def __del__(self):
         self.close()
 
@@ -5253,6 +5301,56 @@ def read(self,
 
 Wideband.read = read
 
+def iterVectors(self,
+                channel = 0,
+                numVectorsPerBlock = 1024,
+                vectorScaleFactors = None,
+                firstSample = 0,
+                lastSample = Wideband.ALL,
+                numThreads = multiprocessing.cpu_count()):
+    """Yields (firstVector, block) for consecutive blocks of up to
+    numVectorsPerBlock vectors as complex64 arrays.  vectorScaleFactors, if
+    given, has one factor per vector in the channel (e.g. the AmpSF PVP)."""
+    numVectors = self.getBufferDims(channel, 0, Wideband.ALL, 0, 0).row
+    if vectorScaleFactors is not None:
+        vectorScaleFactors = numpy.ascontiguousarray(vectorScaleFactors,
+                                                     dtype = 'float64')
+    for firstVector in range(0, numVectors, numVectorsPerBlock):
+        lastVector = min(firstVector + numVectorsPerBlock, numVectors) - 1
+        scaleFactors = None
+        if vectorScaleFactors is not None:
+            scaleFactors = vectorScaleFactors[firstVector:lastVector + 1]
+        yield firstVector, self.readVectors(channel, firstVector, lastVector,
+                                            firstSample, lastSample,
+                                            scaleFactors, numThreads)
+
+Wideband.iterVectors = iterVectors
+
+def _pvpFieldType(size, format):
+    if format.startswith('X=') and size == 3:
+        return (_pvpFieldType(1, format.split(';')[0][2:]), (3,))
+    if format.startswith('S'):
+        return 'S%d' % (size * 8)
+    types = {'F4': 'f4', 'F8': 'f8', 'CF8': 'c8', 'CF16': 'c16',
+             'I1': 'i1', 'I2': 'i2', 'I4': 'i4', 'I8': 'i8',
+             'U1': 'u1', 'U2': 'u2', 'U4': 'u4', 'U8': 'u8'}
+    return types.get(format, 'V%d' % (size * 8))
+
+def getPVPArray(self, channel, pvp):
+    """A channel's PVPs as a structured array with one record per vector.
+    Each field (e.g. pvps['TxPos'], an N x 3 array) is a view of the same
+    buffer, so selecting columns doesn't copy.  pvp is the Metadata's pvp."""
+    raw = self.getPVPBytes(channel)
+    fields = pvp.getFields()
+    dtype = numpy.dtype({'names': [field[0] for field in fields],
+                         'formats': [_pvpFieldType(field[2], field[3])
+                                     for field in fields],
+                         'offsets': [field[1] for field in fields],
+                         'itemsize': raw.shape[1]})
+    return raw.view(dtype).reshape(raw.shape[0])
+
+PVPBlock.getPVPArray = getPVPArray
+
 class VectorVector2(_object):
     """Proxy of C++ std::vector<(math::linear::VectorN<(2,double)>)> class."""
 
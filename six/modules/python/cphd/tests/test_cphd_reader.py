@@ -0,0 +1,227 @@
+#!/usr/bin/env python
+
+#
+# =========================================================================
+# This file is part of cphd-python
+# =========================================================================
+#
+# (C) Copyright 2026, Maxar Technologies, Inc.
+#
+# cphd-python is free software; you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation; either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this program; If not,
+# see <http://www.gnu.org/licenses/>.
+#
+
+# Writes a small CPHD and checks the NumPy views of it (getPVPBytes,
+# getPVPArray, readVectors, iterVectors) against the PVPBlock getters and
+# getPHD()
+
+import os
+import sys
+import tempfile
+
+import numpy as np
+
+from pysix import cphd
+from coda.math_linear import Vector3
+
+from test_make_cphd import make_metadata
+
+NUM_VECTORS = 10
+NUM_SAMPLES = 6
+
+# (getPVPArray field name, PVPBlock accessor suffix, Pvp member, size) in
+# the order they're laid out
+PVPS = [('TxTime', 'TxTime', 'txTime', 1),
+        ('TxPos', 'TxPos', 'txPos', 3),
+        ('TxVel', 'TxVel', 'txVel', 3),
+        ('RcvTime', 'RcvTime', 'rcvTime', 1),
+        ('RcvPos', 'RcvPos', 'rcvPos', 3),
+        ('RcvVel', 'RcvVel', 'rcvVel', 3),
+        ('SRPPos', 'SRPPos', 'srpPos', 3),
+        ('AmpSF', 'AmpSF', 'ampSF', 1),
+        ('aFDOP', 'aFDOP', 'aFDOP', 1),
+        ('aFRR1', 'aFRR1', 'aFRR1', 1),
+        ('aFRR2', 'aFRR2', 'aFRR2', 1),
+        ('FX1', 'Fx1', 'fx1', 1),
+        ('FX2', 'Fx2', 'fx2', 1),
+        ('TOA1', 'TOA1', 'toa1', 1),
+        ('TOA2', 'TOA2', 'toa2', 1),
+        ('TDTropoSRP', 'TdTropoSRP', 'tdTropoSRP', 1),
+        ('SC0', 'SC0', 'sc0', 1),
+        ('SCSS', 'SCSS', 'scss', 1)]
+
+
+def pvpValue(index, vector):
+    name, _, _, size = PVPS[index]
+    if name == 'AmpSF':
+        return 1.0 + vector / 4.0
+    if size == 3:
+        return [1000.0 * index + vector + 0.25 * ii for ii in range(3)]
+    return 1000.0 * index + vector + 0.5
+
+
+def makeSignal():
+    values = np.arange(NUM_VECTORS * NUM_SAMPLES, dtype='float32')
+    signal = values + 1j * (values[::-1] - 7)
+    return signal.astype('complex64').reshape(NUM_VECTORS, NUM_SAMPLES)
+
+
+def writeCPHD(pathname, signal):
+    # Everything but the data and PVP layout comes from test_make_cphd
+    metadata = make_metadata()
+
+    data = cphd.Data()
+    data.signalArrayFormat.value = cphd.SignalArrayFormat.CF8
+    channel = cphd.DataChannel(NUM_VECTORS, NUM_SAMPLES)
+    channel.identifier = 'CPI'
+    data.channels.append(channel)
+
+    pvp = cphd.Pvp()
+    for _, _, member, _ in PVPS:
+        pvp.append(getattr(pvp, member))
+    data.numBytesPVP = pvp.getReqSetSize() * 8
+    metadata.data = data
+    metadata.pvp = pvp
+
+    pvpBlock = cphd.PVPBlock(metadata.pvp, metadata.data)
+    for vector in range(NUM_VECTORS):
+        for index, (_, accessor, _, size) in enumerate(PVPS):
+            value = pvpValue(index, vector)
+            if size == 3:
+                value = Vector3(value)
+            getattr(pvpBlock, 'set' + accessor)(value, 0, vector)
+
+    writer = cphd.CPHDWriter(metadata, pathname)
+
+    # Arrays that don't match the metadata are rejected before writing
+    for badSignal in (signal[:-1], np.asfortranarray(signal),
+                      signal.astype('complex128')):
+        try:
+            writer.writeCPHD(pvpBlock, badSignal)
+        except Exception:
+            pass
+        else:
+            raise AssertionError('writeCPHD accepted a mismatched array')
+
+    writer.writeCPHD(pvpBlock, signal)
+    del writer
+
+
+def checkFieldTypes():
+    assert cphd._pvpFieldType(1, 'F8') == 'f8'
+    assert cphd._pvpFieldType(1, 'I4') == 'i4'
+    assert cphd._pvpFieldType(3, 'X=F8;Y=F8;Z=F8;') == ('f8', (3,))
+    assert cphd._pvpFieldType(2, 'S16') == 'S16'
+    # No NumPy equivalent, so just the bytes
+    assert cphd._pvpFieldType(1, 'CI4') == 'V8'
+
+    # Added PVPs come after the standard ones
+    fields = dict((field[0], field[1:])
+                  for field in make_metadata().pvp.getFields())
+    assert fields['TxPos'] == (8, 3, 'X=F8;Y=F8;Z=F8;')
+    assert fields['newParam1'] == (27 * 8, 1, 'F8')
+    assert fields['newParam2'] == (28 * 8, 1, 'F8')
+
+
+def checkPVPs(reader):
+    pvp = reader.getMetadata().pvp
+    pvpBlock = reader.getPVPBlock()
+    fields = dict((field[0], field[1:]) for field in pvp.getFields())
+    assert len(fields) == len(PVPS)
+    offset = 0
+    for name, _, member, size in PVPS:
+        param = getattr(pvp, member)
+        assert param.getByteOffset() == offset
+        assert fields[name] == (offset, size, param.getFormat())
+        offset += size * 8
+
+    raw = pvpBlock.getPVPBytes(0)
+    assert raw.dtype == np.uint8
+    assert raw.shape == (NUM_VECTORS, offset)
+    assert raw.shape[1] == pvpBlock.getNumBytesPVPSet()
+
+    pvps = reader.getPVPArray(0)
+    assert pvps.shape == (NUM_VECTORS,)
+    for name, (offset, _, _) in fields.items():
+        assert pvps.dtype.fields[name][1] == offset
+
+    for vector in range(NUM_VECTORS):
+        for index, (name, accessor, _, size) in enumerate(PVPS):
+            actual = getattr(pvpBlock, 'get' + accessor)(0, vector)
+            expected = pvpValue(index, vector)
+            offset = fields[name][0]
+            if size == 1:
+                assert actual == expected
+                assert pvps[name][vector] == expected
+                assert raw[vector, offset:offset + 8].view('f8')[0] == \
+                    expected
+            else:
+                assert pvps[name].shape == (NUM_VECTORS, 3)
+                for ii in range(3):
+                    assert actual[ii] == expected[ii]
+                    assert pvps[name][vector, ii] == expected[ii]
+                assert (raw[vector, offset:offset + 24].view('f8') ==
+                        expected).all()
+
+
+def checkVectors(reader, signal):
+    phd = reader.getPHD(0)
+    assert phd.dtype == np.complex64
+    assert (phd == signal).all()
+
+    wideband = reader.getWideband()
+    region = wideband.readVectors(0, 2, 5, 1, 3, None, 1)
+    assert (region == signal[2:6, 1:4]).all()
+
+    # Blocks cover the channel, with a short one at the end
+    blocks = list(reader.iterVectors(0, 4, applyAmpSF=False))
+    assert [firstVector for firstVector, _ in blocks] == [0, 4, 8]
+    assert [block.shape[0] for _, block in blocks] == [4, 4, 2]
+    assert (np.concatenate([block for _, block in blocks]) == phd).all()
+
+    # AmpSF scales each vector
+    ampSF = reader.getPVPArray(0)['AmpSF']
+    expected = (phd.astype('complex128') * ampSF[:, np.newaxis]).astype(
+        'complex64')
+    blocks = list(reader.iterVectors(0, 3))
+    assert [firstVector for firstVector, _ in blocks] == [0, 3, 6, 9]
+    assert (np.concatenate([block for _, block in blocks]) == expected).all()
+
+    blocks = wideband.iterVectors(0, 4, ampSF, firstSample=2, lastSample=4)
+    assert (np.concatenate([block for _, block in blocks]) ==
+            expected[:, 2:5]).all()
+
+
+if __name__ == '__main__':
+    handle, pathname = tempfile.mkstemp(suffix='.cphd')
+    os.close(handle)
+    try:
+        checkFieldTypes()
+
+        signal = makeSignal()
+        writeCPHD(pathname, signal)
+        reader = cphd.CPHDReader(pathname, 1)
+        assert reader.getNumVectors(0) == NUM_VECTORS
+        assert reader.getNumSamples(0) == NUM_SAMPLES
+        checkPVPs(reader)
+        checkVectors(reader, signal)
+    except AssertionError:
+        print('NumPy views of the CPHD differ from the C++ API. Test failed')
+        sys.exit(1)
+    except Exception as e:
+        sys.exit(repr(e))
+    finally:
+        os.remove(pathname)
+    print('Test passed')
+    sys.exit(0)
@@ -88,7 +88,7 @@ IMAGE_AREA.polygon.append(Vector2([0.4, 0.2]))
 IMAGE_AREA.polygon.append(Vector2([0.5, 0.9]))
 
 
-if __name__ == '__main__':
+def make_metadata():
     metadata = cphd.Metadata()
 
     # CollectionID block
@@ -725,6 +725,12 @@ if __name__ == '__main__':
 
     # MatchInfo block (TODO)
 
+    return metadata
+
+
+if __name__ == '__main__':
+    metadata = make_metadata()
+
     xml_parser = cphd.CPHDXMLControl()
 
     try:
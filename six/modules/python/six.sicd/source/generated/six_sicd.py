@@ -11253,6 +11253,57 @@ def getWidebandData(sicdPathname: 'std::string', schemaPaths: 'VectorString', co
 def getWidebandRegion(sicdPathname: 'std::string', schemaPaths: 'VectorString', complexData: 'ComplexData', startRow: 'long long', numRows: 'long long', startCol: 'long long', numCols: 'long long', arrayBuffer: 'long long') -> "void":
     """getWidebandRegion(std::string sicdPathname, VectorString schemaPaths, ComplexData complexData, long long startRow, long long numRows, long long startCol, long long numCols, long long arrayBuffer)"""
     return _six_sicd.getWidebandRegion(sicdPathname, schemaPaths, complexData, startRow, numRows, startCol, numCols, arrayBuffer)
+class SICDReader(_object):
+    """Proxy of C++ SICDReader class."""
+
+    __swig_setmethods__ = {}
+    __setattr__ = lambda self, name, value: _swig_setattr(self, SICDReader, name, value)
+    __swig_getmethods__ = {}
+    __getattr__ = lambda self, name: _swig_getattr(self, SICDReader, name)
+    __repr__ = _swig_repr
+
+    def __init__(self, sicdPathname: 'std::string const &', schemaPaths: 'VectorString'):
+        """__init__(SICDReader self, std::string const & sicdPathname, VectorString schemaPaths) -> SICDReader"""
+        this = _six_sicd.new_SICDReader(sicdPathname, schemaPaths)
+        try:
+            self.this.append(this)
+        except __builtin__.Exception:
+            self.this = this
+
+    def getNumRows(self) -> "long long":
+        """getNumRows(SICDReader self) -> long long"""
+        return _six_sicd.SICDReader_getNumRows(self)
+
+
+    def getNumCols(self) -> "long long":
+        """getNumCols(SICDReader self) -> long long"""
+        return _six_sicd.SICDReader_getNumCols(self)
+
+
+    def getComplexData(self) -> "six::sicd::ComplexData *":
+        """getComplexData(SICDReader self) -> ComplexData"""
+        return _six_sicd.SICDReader_getComplexData(self)
+
+
+    def read(self) -> "PyObject *":
+        """read(SICDReader self) -> PyObject *"""
+        return _six_sicd.SICDReader_read(self)
+
+
+    def readRegion(self, startRow: 'long long', numRows: 'long long', startCol: 'long long', numCols: 'long long') -> "PyObject *":
+        """readRegion(SICDReader self, long long startRow, long long numRows, long long startCol, long long numCols) -> PyObject *"""
+        return _six_sicd.SICDReader_readRegion(self, startRow, numRows, startCol, numCols)
+
+
+    def readInto(self, array: 'PyObject *', startRow: 'long long', startCol: 'long long') -> "void":
+        """readInto(SICDReader self, PyObject * array, long long startRow, long long startCol)"""
+        return _six_sicd.SICDReader_readInto(self, array, startRow, startCol)
+
+    __swig_destroy__ = _six_sicd.delete_SICDReader
+    __del__ = lambda self: None
+SICDReader_swigregister = _six_sicd.SICDReader_swigregister
+SICDReader_swigregister(SICDReader)
+
 
 import numpy as np
 from coda.coda_types import VectorString
@@ -11260,25 +11311,15 @@ from coda.coda_io import FileOutputStream
 from coda.xml_lite import *
 
 def read(inputPathname, schemaPaths = VectorString()):
-    complexData = SixSicdUtilities.getComplexData(inputPathname, schemaPaths)
-
 #Numpy has no concept of complex integers, so dtype will always be complex64
-    widebandData = np.empty(shape = (complexData.getNumRows(), complexData.getNumCols()), dtype = "complex64")
-    widebandBuffer, ro = widebandData.__array_interface__["data"]
-
-    getWidebandData(inputPathname, schemaPaths, complexData, widebandBuffer)
-
-    return widebandData, complexData
+    reader = SICDReader(inputPathname, schemaPaths)
+    return reader.read(), reader.getComplexData()
 
 def readRegion(inputPathname, startRow, numRows, startCol, numCols, schemaPaths = VectorString()):
-    complexData = SixSicdUtilities.getComplexData(inputPathname, schemaPaths)
-
-    widebandData = np.empty(shape = (numRows, numCols), dtype = "complex64")
-    widebandBuffer, ro = widebandData.__array_interface__["data"]
-
-    getWidebandRegion(inputPathname, schemaPaths, complexData, startRow, numRows, startCol, numCols, widebandBuffer)
-
-    return widebandData, complexData
+# To read several regions, keep a SICDReader open rather than calling this
+    reader = SICDReader(inputPathname, schemaPaths)
+    return (reader.readRegion(startRow, numRows, startCol, numCols),
+            reader.getComplexData())
 
 def readRecord(pathname):
     record = _readRecord(pathname)
@@ -29,6 +29,8 @@
 %{
 
 #include <complex>
+#include <memory>
+#include <mutex>
 #include <utility>
 
 
@@ -37,6 +39,7 @@
 #include "import/six/sicd.h"
 #include "six/sicd/AreaPlaneUtility.h"
 #include "six/sicd/GeoLocator.h"
+#include "six/sicd/NITFReadComplexXMLControl.h"
 #include "six/sicd/SICDWriteControl.h"
 #include "six/sicd/Utilities.h"
 #include <numpyutils/numpyutils.h>
@@ -367,6 +370,134 @@ SCOPED_COPYABLE(six::sicd, InterPulsePeriod)
 void getWidebandData(std::string sicdPathname, const std::vector<std::string>& schemaPaths, six::sicd::ComplexData* complexData, long long arrayBuffer);
 void getWidebandRegion(std::string sicdPathname, const std::vector<std::string>& schemaPaths, six::sicd::ComplexData* complexData, long long startRow, long long numRows, long long startCol, long long numCols, long long arrayBuffer);
 
+// SICDReader keeps a SICD open between reads, so chipping doesn't re-open
+// and re-parse the file each time.  Pixels are read straight into the NumPy
+// array's buffer with the GIL released, so other Python threads (each with
+// its own reader) can read in parallel.
+%{
+    class SICDReader
+    {
+    public:
+        SICDReader(const std::string& sicdPathname,
+                   const std::vector<std::string>& schemaPaths) :
+            mReader(new six::sicd::NITFReadComplexXMLControl())
+        {
+            numpyutils::ScopedGILRelease release;
+            mReader->load(sicdPathname, schemaPaths);
+            mComplexData = mReader->getComplexData();
+        }
+
+        long long getNumRows() const
+        {
+            return mComplexData->getNumRows();
+        }
+
+        long long getNumCols() const
+        {
+            return mComplexData->getNumCols();
+        }
+
+        six::sicd::ComplexData* getComplexData() const
+        {
+            return static_cast<six::sicd::ComplexData*>(mComplexData->clone());
+        }
+
+        PyObject* read()
+        {
+            return readRegion(0, getNumRows(), 0, getNumCols());
+        }
+
+        PyObject* readRegion(long long startRow, long long numRows,
+                             long long startCol, long long numCols)
+        {
+            checkRegion(startRow, numRows, startCol, numCols);
+
+            PyObject* array = Py_None;
+            numpyutils::createOrVerify(
+                    array, NPY_COMPLEX64,
+                    types::RowCol<size_t>(numRows, numCols));
+            try
+            {
+                readInto(array, startRow, startCol);
+            }
+            catch (...)
+            {
+                Py_DECREF(array);
+                throw;
+            }
+            return array;
+        }
+
+        void readInto(PyObject* array, long long startRow, long long startCol)
+        {
+            numpyutils::verifyArrayType(array, NPY_COMPLEX64);
+            PyArrayObject* const pyArray =
+                    reinterpret_cast<PyArrayObject*>(array);
+            if (!PyArray_IS_C_CONTIGUOUS(pyArray) ||
+                !PyArray_ISWRITEABLE(pyArray))
+            {
+                throw except::Exception(Ctxt(
+                        "Array must be C-contiguous and writeable"));
+            }
+            const types::RowCol<size_t> extent =
+                    numpyutils::getDimensionsRC(array);
+            checkRegion(startRow, extent.row, startCol, extent.col);
+            if (extent.area() == 0)
+            {
+                return;
+            }
+
+            std::complex<float>* const buffer =
+                    numpyutils::getBuffer<std::complex<float> >(array);
+            const types::RowCol<size_t> offset(startRow, startCol);
+
+            // The caller's reference keeps the array alive while the GIL is
+            // released.  Reads through one reader are serialized.
+            numpyutils::ScopedGILRelease release;
+            std::lock_guard<std::mutex> lock(mMutex);
+            mReader->getWidebandData(*mComplexData, offset, extent, buffer);
+        }
+
+    private:
+        void checkRegion(long long startRow, long long numRows,
+                         long long startCol, long long numCols) const
+        {
+            if (startRow < 0 || numRows < 0 || startCol < 0 || numCols < 0 ||
+                startRow + numRows > getNumRows() ||
+                startCol + numCols > getNumCols())
+            {
+                throw except::Exception(Ctxt(
+                        "Region of " + std::to_string(numRows) + " x " +
+                        std::to_string(numCols) + " pixels at (" +
+                        std::to_string(startRow) + ", " +
+                        std::to_string(startCol) + ") isn't inside the " +
+                        std::to_string(getNumRows()) + " x " +
+                        std::to_string(getNumCols()) + " image"));
+            }
+        }
+
+        std::unique_ptr<six::sicd::NITFReadComplexXMLControl> mReader;
+        std::unique_ptr<six::sicd::ComplexData> mComplexData;
+        std::mutex mMutex;
+    };
+%}
+
+%newobject SICDReader::getComplexData;
+
+class SICDReader
+{
+public:
+    SICDReader(const std::string& sicdPathname,
+               const std::vector<std::string>& schemaPaths);
+    long long getNumRows() const;
+    long long getNumCols() const;
+    six::sicd::ComplexData* getComplexData() const;
+    PyObject* read();
+    PyObject* readRegion(long long startRow, long long numRows,
+                         long long startCol, long long numCols);
+    void readInto(PyObject* array, long long startRow, long long startCol);
+};
+
 %pythoncode %{
 import numpy as np
 from coda.coda_types import VectorString
@@ -374,25 +505,15 @@ from coda.coda_io import FileOutputStream
 from coda.xml_lite import *
 
 def read(inputPathname, schemaPaths = VectorString()):
-    complexData = SixSicdUtilities.getComplexData(inputPathname, schemaPaths)
-
     #Numpy has no concept of complex integers, so dtype will always be complex64
-    widebandData = np.empty(shape = (complexData.getNumRows(), complexData.getNumCols()), dtype = "complex64")
-    widebandBuffer, ro = widebandData.__array_interface__["data"]
-
-    getWidebandData(inputPathname, schemaPaths, complexData, widebandBuffer)
-
-    return widebandData, complexData
+    reader = SICDReader(inputPathname, schemaPaths)
+    return reader.read(), reader.getComplexData()
 
 def readRegion(inputPathname, startRow, numRows, startCol, numCols, schemaPaths = VectorString()):
-    complexData = SixSicdUtilities.getComplexData(inputPathname, schemaPaths)
-
-    widebandData = np.empty(shape = (numRows, numCols), dtype = "complex64")
-    widebandBuffer, ro = widebandData.__array_interface__["data"]
-
-    getWidebandRegion(inputPathname, schemaPaths, complexData, startRow, numRows, startCol, numCols, widebandBuffer)
-
-    return widebandData, complexData
+    # To read several regions, keep a SICDReader open rather than calling this
+    reader = SICDReader(inputPathname, schemaPaths)
+    return (reader.readRegion(startRow, numRows, startCol, numCols),
+            reader.getComplexData())
 
 def readRecord(pathname):
     record = _readRecord(pathname)
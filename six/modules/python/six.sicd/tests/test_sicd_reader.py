@@ -0,0 +1,89 @@
+#!/user/bin/env/python
+#
+# =========================================================================
+# This file is part of six.sicd-python
+# =========================================================================
+#
+# (C) Copyright 2026, Maxar Technologies, Inc.
+#
+# six.sicd-python is free software; you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation; either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this program; If not,
+# see <http://www.gnu.org/licenses/>.
+#
+
+import os
+import subprocess
+import sys
+import threading
+
+import numpy as np
+
+from pysix.six_sicd import SICDReader, read
+
+
+def createNITF():
+    location = os.path.split(os.path.realpath(__file__))[0]
+    testPath = os.path.join(location, 'test_create_sicd_xml.py')
+    subprocess.call(['python', testPath, '--includeNITF'])
+    return os.path.join(os.getcwd(), 'test_create_sicd.nitf')
+
+
+def readChips(pathname, expectedArray, startRows, failures):
+    # One reader per thread, reused for every chip
+    reader = SICDReader(pathname, [])
+    numCols = reader.getNumCols()
+    chip = np.empty((2, numCols), dtype='complex64')
+    for startRow in startRows:
+        reader.readInto(chip, startRow, 0)
+        if not (chip == expectedArray[startRow:startRow + 2]).all():
+            failures.append(startRow)
+
+
+if __name__ == '__main__':
+    pathname = createNITF()
+    assert os.path.exists(pathname)
+    expectedArray, expectedData = read(pathname)
+    numRows, numCols = expectedArray.shape
+    try:
+        reader = SICDReader(pathname, [])
+        assert reader.getNumRows() == numRows
+        assert reader.getNumCols() == numCols
+        assert reader.getComplexData() == expectedData
+
+        region = reader.readRegion(1, numRows - 1, 1, numCols - 2)
+        assert region.dtype == np.complex64
+        assert (region == expectedArray[1:, 1:-1]).all()
+
+        try:
+            reader.readRegion(1, numRows, 0, numCols)
+            raise AssertionError('Read past the end of the image')
+        except RuntimeError:
+            pass
+
+        failures = []
+        threads = [threading.Thread(target=readChips,
+                                    args=(pathname, expectedArray,
+                                          range(ii, numRows - 1, 4), failures))
+                   for ii in range(4)]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        assert not failures
+    except AssertionError:
+        print('SICDReader and read() differ. Test failed')
+        sys.exit(1)
+    except Exception as e:
+        sys.exit(repr(e))
+    print('Test passed')
+    sys.exit(0)
@@ -64,6 +64,7 @@ def run():
     sicdRunner = PythonTestRunner(testsDir)
     result = (result and sicdRunner.run('test_streaming_sicd_write.py') and
         sicdRunner.run('test_read_region.py') and
+        sicdRunner.run('test_sicd_reader.py') and
         sicdRunner.run('test_read_sicd_xml.py', sampleNITF) and
         sicdRunner.run('test_six_sicd.py', sampleNITF) and
         sicdRunner.run('test_create_sicd_xml.py', '-v', '1.2.0') and
@@ -79,6 +80,11 @@ def run():
             'out.cphd')
     os.remove(cphd03Pathname)
 
+    testsDir = os.path.join(utils.findSixHome(), 'six',
+            'modules', 'python', 'cphd', 'tests')
+    cphdRunner = PythonTestRunner(testsDir)
+    result = result and cphdRunner.run('test_cphd_reader.py')
+
     return result
 
 
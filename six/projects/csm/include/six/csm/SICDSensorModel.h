@@ -168,6 +168,8 @@ public: // RasterGM methods
      */
     std::vector<double> getSIXUnmodeledError() const override;
 
+    std::string getBinaryModelState() const override;
+
 protected:
     virtual six::DateTime getReferenceDateAndTimeImpl() const;
 
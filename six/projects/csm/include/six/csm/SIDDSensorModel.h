@@ -165,6 +165,8 @@ public: // RasterGM methods
      */
     std::vector<double> getSIXUnmodeledError() const override;
 
+    std::string getBinaryModelState() const override;
+
 protected:
     virtual six::DateTime getReferenceDateAndTimeImpl() const;
 
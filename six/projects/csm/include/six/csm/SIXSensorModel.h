@@ -24,6 +24,7 @@
 #define __SIX_CSM_SIX_SENSOR_MODEL_H__
 
 #include <memory>
+#include <vector>
 
 #include "RasterGM.h"
 #include "CorrelationModel.h"
@@ -66,16 +67,28 @@ public: // Model methods
     /**
      * Returns a string representing the state of the sensor model.  The state
      * string is made up of the sensor model name, followed by a space, then
-     * the SICD XML as a string.
+     * the SICD XML as a string.  This is XML even if the model was restored
+     * from getBinaryModelState().
      *
      * \return State of the sensor model
      */
     virtual std::string getModelState() const;
 
+    /**
+     * Returns the state of the sensor model with the metadata in
+     * six::binary format (see six/BinaryXML.h) instead of XML.  This is
+     * accepted anywhere getModelState() is and is much faster to restore,
+     * but isn't text: it contains NUL and other non-printable characters.
+     *
+     * \return State of the sensor model
+     */
+    virtual std::string getBinaryModelState() const = 0;
+
     /**
      * Initialize the current model with argState
      *
-     * \param[in] argState The sensor model state to update to.  If the string
+     * \param[in] argState The sensor model state to update to, from
+     *     either getModelState() or getBinaryModelState().  If the string
      *     is empty, the model is unchanged.
      */
     virtual void replaceModelState(const std::string& argState);
@@ -453,6 +466,83 @@ public: // RasterGM methods
             double desiredPrecision,
             double* achievedPrecision,
             csm::WarningList* warnings) const;
+
+public: // Batch methods (SIX extensions to RasterGM)
+    /*
+     * These are the vector forms of groundToImage() and imageToGround() for
+     * projecting many points (e.g. a DEM grid) at once.  The setup and error
+     * handling is done once for the batch, and the points are projected in
+     * parallel.  They're virtual so that callers that load the plugin
+     * dynamically can reach them through a SIXSensorModel pointer.
+     *
+     * On error, they throw csm::Error and no points are returned.
+     */
+
+    /**
+     * Converts groundPts in ground space (ECEF) to image space.
+     *
+     * \param[in] groundPts Ground coordinates in meters
+     * \param[in] numThreads Number of threads to use; 0 means one per core
+     *
+     * \return Image coordinates in pixels, one per ground point
+     */
+    virtual std::vector<csm::ImageCoord> groundToImage(
+            const std::vector<csm::EcefCoord>& groundPts,
+            size_t numThreads = 0) const;
+
+    /**
+     * Converts groundPts with covariance in ground space (ECEF) to image
+     * space.
+     *
+     * \param[in] groundPts Ground coordinates in ECEF meters and
+     *     corresponding 3x3 covariances in ECEF meters squared
+     * \param[in] numThreads Number of threads to use; 0 means one per core
+     *
+     * \return Image coordinates in pixels and corresponding 2x2 covariances
+     * in pixels squared, one per ground point
+     */
+    virtual std::vector<csm::ImageCoordCovar> groundToImage(
+            const std::vector<csm::EcefCoordCovar>& groundPts,
+            size_t numThreads = 0) const;
+
+    /**
+     * Converts imagePts in image space to ground space (ECEF).
+     *
+     * \param[in] imagePts Image lines and samples in pixels
+     * \param[in] heights Height in meters measured with respect to the
+     *     WGS-84 ellipsoid for each image point
+     * \param[in] numThreads Number of threads to use; 0 means one per core
+     *
+     * \return Ground coordinates in meters, one per image point
+     */
+    virtual std::vector<csm::EcefCoord> imageToGround(
+            const std::vector<csm::ImageCoord>& imagePts,
+            const std::vector<double>& heights,
+            size_t numThreads = 0) const;
+
+    /**
+     * Converts imagePts with covariance in image space to ground space
+     * (ECEF) with covariance.
+     *
+     * \param[in] imagePts Image lines and samples in pixels and
+     *     covariances in pixels squared
+     * \param[in] heights Height in meters measured with respect to the
+     *     WGS-84 ellipsoid for each image point
+     * \param[in] heightVariances Height variance in meters squared for each
+     *     image point
+     * \param[in] numThreads Number of threads to use; 0 means one per core
+     *
+     * \return Ground coordinates with covariance (x, y, z in ECEF meters
+     * and corresponding 3x3 covariance in ECEF meters squared), one per
+     * image point
+     */
+    virtual std::vector<csm::EcefCoordCovar> imageToGround(
+            const std::vector<csm::ImageCoordCovar>& imagePts,
+            const std::vector<double>& heights,
+            const std::vector<double>& heightVariances,
+            size_t numThreads = 0) const;
+
+public: // RasterGM methods
     /**
      * Calculates the direction of illumination at the given ground position
      * groundPt.  The returned values define a direction vector that points
@@ -646,6 +736,24 @@ protected:
                                       double desiredPrecision,
                                       double* achievedPrecision) const;
 
+    /*
+     * The covariance parts of groundToImage() and imageToGround(), given
+     * the projected point (imagePt is in meters from the SCP and the sample
+     * spacing is passed in so batches only look it up once)
+     */
+    csm::ImageCoordCovar computeImageCovariance(
+            const csm::EcefCoordCovar& groundPt,
+            const csm::ImageCoord& pixelPt,
+            const types::RowCol<double>& imagePt,
+            const types::RowCol<double>& sampleSpacing) const;
+
+    csm::EcefCoordCovar computeGroundCovariance(
+            const csm::ImageCoordCovar& imagePt,
+            const csm::EcefCoord& groundPt,
+            double height,
+            double heightVariance,
+            const types::RowCol<double>& sampleSpacing) const;
+
     static
     scene::Vector3 toVector3(const csm::EcefCoord& pt)
     {
@@ -34,6 +34,7 @@
 #include <six/sicd/ComplexXMLControl.h>
 #include <six/sicd/Utilities.h>
 #include <six/XmlLite.h>
+#include <six/BinaryXML.h>
 #include <six/ErrorStatistics.h>
 
 namespace six
@@ -403,6 +404,13 @@ SICDSensorModel::getSIXUnmodeledError() const
     return SIXSensorModel::getSIXUnmodeledError_(mData->errorStatistics.get());
 }
 
+std::string SICDSensorModel::getBinaryModelState() const
+{
+    const auto bytes = six::sicd::Utilities::toBinary(*mData);
+    return NAME + std::string(" ") +
+        std::string(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+}
+
 void SICDSensorModel::replaceModelStateImpl(const std::string& sensorModelState)
 {
     const size_t idx = sensorModelState.find(' ');
@@ -421,15 +429,29 @@ void SICDSensorModel::replaceModelStateImpl(const std::string& sensorModelState)
                            "SICDSensorModel::replaceModelStateImpl");
     }
 
-    const std::string sensorModelXML = sensorModelState.substr(idx + 1);
+    const std::string sensorModelData = sensorModelState.substr(idx + 1);
 
     try
     {
-        io::StringStream stream;
-        stream.write(sensorModelXML);
-
+        // The metadata is either XML or, from getBinaryModelState(),
+        // six::binary which doesn't need to be parsed.
         six::MinidomParser domParser;
-        domParser.parse(stream);
+        std::unique_ptr<xml::lite::Document> binaryDocument;
+        const xml::lite::Document* pDocument = nullptr;
+        if (six::binary::isBinary(sensorModelData))
+        {
+            binaryDocument = six::binary::decode(std::span<const std::byte>(
+                    reinterpret_cast<const std::byte*>(sensorModelData.data()),
+                    sensorModelData.size()));
+            pDocument = binaryDocument.get();
+        }
+        else
+        {
+            io::StringStream stream;
+            stream.write(sensorModelData);
+            domParser.parse(stream);
+            pDocument = &domParser.getDocument();
+        }
 
         six::XMLControlRegistry xmlRegistry;
         xmlRegistry.addCreator<six::sicd::ComplexXMLControl>();
@@ -438,11 +460,21 @@ void SICDSensorModel::replaceModelStateImpl(const std::string& sensorModelState)
         std::unique_ptr<six::XMLControl> control(
                 xmlRegistry.newXMLControl(six::DataType::COMPLEX, &logger));
 
-        // get xml as string for sensor model state
-        mSensorModelState = sensorModelState;
+        // get xml as string for sensor model state; getModelState() is
+        // always XML, even when given a binary state
+        if (binaryDocument.get())
+        {
+            io::StringStream stringStream;
+            binaryDocument->getRootElement()->print(stringStream);
+            mSensorModelState = NAME + std::string(" ") + stringStream.stream().str();
+        }
+        else
+        {
+            mSensorModelState = sensorModelState;
+        }
 
         mData.reset(reinterpret_cast<six::sicd::ComplexData*>(control->fromXML(
-                &domParser.getDocument(), mSchemaDirs)));
+                pDocument, mSchemaDirs)));
         reinitialize();
     }
     catch (const except::Exception& ex)
@@ -33,6 +33,7 @@
 #include <six/sidd/DerivedXMLControl.h>
 #include <six/sidd/Utilities.h>
 #include <six/XmlLite.h>
+#include <six/BinaryXML.h>
 #include <six/ErrorStatistics.h>
 
 namespace six
@@ -386,6 +387,13 @@ csm::ImageCoord SIDDSensorModel::getImageStart() const
     return csm::ImageCoord(imageStart.row, imageStart.col);
 }
 
+std::string SIDDSensorModel::getBinaryModelState() const
+{
+    const auto bytes = six::sidd::Utilities::toBinary(*mData);
+    return NAME + std::string(" ") +
+        std::string(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+}
+
 void SIDDSensorModel::replaceModelStateImpl(const std::string& sensorModelState)
 {
     const size_t idx = sensorModelState.find(' ');
@@ -404,15 +412,29 @@ void SIDDSensorModel::replaceModelStateImpl(const std::string& sensorModelState)
                            "SIDDSensorModel::replaceModelStateImpl");
     }
 
-    const std::string sensorModelXML = sensorModelState.substr(idx + 1);
+    const std::string sensorModelData = sensorModelState.substr(idx + 1);
 
     try
     {
-        io::StringStream stream;
-        stream.write(sensorModelXML);
-
+        // The metadata is either XML or, from getBinaryModelState(),
+        // six::binary which doesn't need to be parsed.
         six::MinidomParser domParser;
-        domParser.parse(stream);
+        std::unique_ptr<xml::lite::Document> binaryDocument;
+        const xml::lite::Document* pDocument = nullptr;
+        if (six::binary::isBinary(sensorModelData))
+        {
+            binaryDocument = six::binary::decode(std::span<const std::byte>(
+                    reinterpret_cast<const std::byte*>(sensorModelData.data()),
+                    sensorModelData.size()));
+            pDocument = binaryDocument.get();
+        }
+        else
+        {
+            io::StringStream stream;
+            stream.write(sensorModelData);
+            domParser.parse(stream);
+            pDocument = &domParser.getDocument();
+        }
 
         six::XMLControlRegistry xmlRegistry;
         xmlRegistry.addCreator<six::sidd::DerivedXMLControl>();
@@ -421,11 +443,21 @@ void SIDDSensorModel::replaceModelStateImpl(const std::string& sensorModelState)
         std::unique_ptr<six::XMLControl> control(xmlRegistry.newXMLControl(
                 six::DataType::DERIVED, &logger));
 
-        // get xml as string for sensor model state
-        mSensorModelState = sensorModelState;
+        // get xml as string for sensor model state; getModelState() is
+        // always XML, even when given a binary state
+        if (binaryDocument.get())
+        {
+            io::StringStream stringStream;
+            binaryDocument->getRootElement()->print(stringStream);
+            mSensorModelState = NAME + std::string(" ") + stringStream.stream().str();
+        }
+        else
+        {
+            mSensorModelState = sensorModelState;
+        }
 
         mData.reset(reinterpret_cast<six::sidd::DerivedData*>(control->fromXML(
-                &domParser.getDocument(), mSchemaDirs)));
+                pDocument, mSchemaDirs)));
         reinitialize();
     }
     catch (const except::Exception& ex)
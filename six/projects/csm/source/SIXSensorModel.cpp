@@ -25,6 +25,10 @@
 #include <cmath>
 #include <limits>
 #include <std/filesystem>
+#include <std/span>
+#include <thread>
+
+#include <mt/Runnable1D.h>
 
 #include "Error.h"
 #include <six/NITFReadControl.h>
@@ -39,6 +43,15 @@ namespace fs = std::filesystem;
 
 namespace
 {
+size_t getNumThreads(size_t numThreads)
+{
+    if (numThreads == 0)
+    {
+        numThreads = std::thread::hardware_concurrency();
+    }
+    return numThreads == 0 ? 1 : numThreads;
+}
+
 inline
 double square(double val)
 {
@@ -675,6 +688,48 @@ csm::ImageCoord SIXSensorModel::groundToImage(
     }
 }
 
+csm::ImageCoordCovar SIXSensorModel::computeImageCovariance(
+        const csm::EcefCoordCovar& groundPt,
+        const csm::ImageCoord& pixelPt,
+        const types::RowCol<double>& imagePt,
+        const types::RowCol<double>& sampleSpacing) const
+{
+    const scene::Vector3 scenePt(toVector3(groundPt));
+    // m^2
+    // NOTE: See mSensorCovariance member variable definition in header
+    //       for why we're not computing the sensor covariance for this
+    //       point
+    const math::linear::MatrixMxN<3, 3> userCovar(groundPt.covariance);
+    const math::linear::MatrixMxN<2, 7> sensorPartials =
+            mProjection->sceneToImageSensorPartials(scenePt, imagePt);
+    const math::linear::MatrixMxN<2, 3> imagePartials =
+            mProjection->sceneToImagePartials(scenePt, imagePt);
+    const math::linear::MatrixMxN<2, 2> unmodeledCovar =
+            mProjection->getUnmodeledErrorCovariance(imagePt);
+    const math::linear::MatrixMxN<2, 2> errorCovar =
+            unmodeledCovar +
+            (imagePartials * userCovar * imagePartials.transpose()) +
+            (sensorPartials * mSensorCovariance *
+             sensorPartials.transpose());
+    csm::ImageCoordCovar csmErrorCovar;
+    const types::RowCol<double>& ss = sampleSpacing;
+    csmErrorCovar.line = pixelPt.line;
+    csmErrorCovar.samp = pixelPt.samp;
+    csmErrorCovar.covariance[0] =
+            errorCovar[0][0] / (ss.row * ss.row);
+    csmErrorCovar.covariance[1] =
+            errorCovar[0][1] /
+            (ss.row *
+             ss.col);
+    csmErrorCovar.covariance[2] =
+            errorCovar[1][0] /
+            (ss.row *
+             ss.col);
+    csmErrorCovar.covariance[3] =
+            errorCovar[1][1] / (ss.col * ss.col);
+    return csmErrorCovar;
+}
+
 csm::ImageCoordCovar SIXSensorModel::groundToImage(
         const csm::EcefCoordCovar& groundPt,
         double desiredPrecision,
@@ -686,41 +741,8 @@ csm::ImageCoordCovar SIXSensorModel::groundToImage(
         const csm::ImageCoord imagePt = groundToImageImpl(groundPt,
                                                           desiredPrecision,
                                                           achievedPrecision);
-        const scene::Vector3 scenePt(toVector3(groundPt));
-        types::RowCol<double> pixelPt(fromPixel(imagePt));
-        // m^2
-        // NOTE: See mSensorCovariance member variable definition in header
-        //       for why we're not computing the sensor covariance for this
-        //       point
-        const math::linear::MatrixMxN<3, 3> userCovar(groundPt.covariance);
-        const math::linear::MatrixMxN<2, 7> sensorPartials =
-                mProjection->sceneToImageSensorPartials(scenePt);
-        const math::linear::MatrixMxN<2, 3> imagePartials =
-                mProjection->sceneToImagePartials(scenePt);
-        const math::linear::MatrixMxN<2, 2> unmodeledCovar =
-                mProjection->getUnmodeledErrorCovariance(pixelPt);
-        const math::linear::MatrixMxN<2, 2> errorCovar =
-                unmodeledCovar +
-                (imagePartials * userCovar * imagePartials.transpose()) +
-                (sensorPartials * mSensorCovariance *
-                 sensorPartials.transpose());
-        csm::ImageCoordCovar csmErrorCovar;
-        types::RowCol<double> ss = getSampleSpacing();
-        csmErrorCovar.line = imagePt.line;
-        csmErrorCovar.samp = imagePt.samp;
-        csmErrorCovar.covariance[0] =
-                errorCovar[0][0] / (ss.row * ss.row);
-        csmErrorCovar.covariance[1] =
-                errorCovar[0][1] /
-                (ss.row *
-                 ss.col);
-        csmErrorCovar.covariance[2] =
-                errorCovar[1][0] /
-                (ss.row *
-                 ss.col);
-        csmErrorCovar.covariance[3] =
-                errorCovar[1][1] / (ss.col * ss.col);
-        return csmErrorCovar;
+        return computeImageCovariance(groundPt, imagePt, fromPixel(imagePt),
+                                      getSampleSpacing());
     }
     catch (const except::Exception& ex)
     {
@@ -763,6 +785,85 @@ csm::EcefCoord SIXSensorModel::imageToGround(
     }
 }
 
+csm::EcefCoordCovar SIXSensorModel::computeGroundCovariance(
+        const csm::ImageCoordCovar& imagePt,
+        const csm::EcefCoord& groundPt,
+        double height,
+        double heightVariance,
+        const types::RowCol<double>& sampleSpacing) const
+{
+    const double a = scene::WGS84EllipsoidModel::EQUATORIAL_RADIUS_METERS;
+    const double b = scene::WGS84EllipsoidModel::POLAR_RADIUS_METERS;
+    const scene::Vector3 scenePt(toVector3(groundPt));
+    const types::RowCol<double> pixelPt(fromPixel(imagePt));
+
+    // NOTE: See mSensorCovariance member variable definition in header
+    //       for why we're not computing the sensor covariance for this
+    //       point
+    const math::linear::MatrixMxN<2, 2> userCovar(imagePt.covariance);
+    math::linear::MatrixMxN<2, 2> unmodeledCovar =
+            mProjection->getUnmodeledErrorCovariance(pixelPt);
+    math::linear::MatrixMxN<2, 3> groundPartials =
+            mProjection->sceneToImagePartials(scenePt, pixelPt);
+    math::linear::MatrixMxN<2, 7> sensorPartials =
+            mProjection->sceneToImageSensorPartials(scenePt, pixelPt);
+
+    math::linear::MatrixMxN<10, 10> fullCovar(0.0);
+    unmodeledCovar = unmodeledCovar + userCovar;
+    fullCovar.addInPlace(unmodeledCovar, 0, 0);
+    fullCovar[2][2] = heightVariance;
+    fullCovar.addInPlace(mSensorCovariance, 3, 3);
+    const types::RowCol<double>& ss = sampleSpacing;
+    for (size_t ii = 0; ii < 3; ++ii)
+    {
+        groundPartials[0][ii] /= ss.row;
+        groundPartials[1][ii] /= ss.col;
+    }
+
+    for (size_t ii = 0; ii < 7; ++ii)
+    {
+        sensorPartials[0][ii] /= ss.row;
+        sensorPartials[1][ii] /= ss.col;
+    }
+
+    math::linear::MatrixMxN<3, 3> B(0.0);
+    B.addInPlace(groundPartials, 0, 0);
+    B[2][0] = 2 * groundPt.x / square(a + height);
+    B[2][1] = 2 * groundPt.y / square(a + height);
+    B[2][2] = 2 * groundPt.z / square(b + height);
+
+    math::linear::MatrixMxN<3, 10> A(0.0);
+    A[2][2] = -2.0 * ((square(groundPt.x) + square(groundPt.y)) /
+                      cube(a + height) +
+              square(groundPt.z) / cube(b + height));
+    A.addInPlace(sensorPartials, 0, 3);
+    A[0][0] = A[1][1] = 1.0;
+
+    const math::linear::MatrixMxN<3, 3> Q = A * fullCovar * A.transpose();
+
+    const math::linear::MatrixMxN<3, 3> Qinv = inverse(Q);
+
+    const math::linear::MatrixMxN<3, 3> imageToGroundCovarInv =
+            B.transpose() * Qinv * B;
+
+    const math::linear::MatrixMxN<3, 3> errorCovar =
+            inverse(imageToGroundCovarInv);
+
+    csm::EcefCoordCovar csmErrorCovar;
+    csmErrorCovar.x = groundPt.x;
+    csmErrorCovar.y = groundPt.y;
+    csmErrorCovar.z = groundPt.z;
+    for (size_t ii = 0; ii < 3; ++ii)
+    {
+        for (size_t jj = 0; jj < 3; ++jj)
+        {
+            csmErrorCovar.covariance[ii * 3 + jj] = errorCovar[ii][jj];
+        }
+    }
+
+    return csmErrorCovar;
+}
+
 csm::EcefCoordCovar SIXSensorModel::imageToGround(
         const csm::ImageCoordCovar& imagePt,
         double height,
@@ -778,77 +879,159 @@ csm::EcefCoordCovar SIXSensorModel::imageToGround(
                                                       desiredPrecision,
                                                       achievedPrecision,
                                                       warnings);
+        return computeGroundCovariance(imagePt, groundPt, height,
+                                       heightVariance, getSampleSpacing());
+    }
+    catch (const except::Exception& ex)
+    {
+        throw csm::Error(csm::Error::UNKNOWN_ERROR,
+                           ex.getMessage(),
+                           "SIXSensorModel::imageToGround");
+    }
+}
 
-        const double a = scene::WGS84EllipsoidModel::EQUATORIAL_RADIUS_METERS;
-        const double b = scene::WGS84EllipsoidModel::POLAR_RADIUS_METERS;
-        const scene::Vector3 scenePt(toVector3(groundPt));
-        types::RowCol<double> pixelPt(fromPixel((csm::ImageCoord&) imagePt));
-
-        // NOTE: See mSensorCovariance member variable definition in header
-        //       for why we're not computing the sensor covariance for this
-        //       point
-        const math::linear::MatrixMxN<2, 2> userCovar(imagePt.covariance);
-        math::linear::MatrixMxN<2, 2> unmodeledCovar =
-                mProjection->getUnmodeledErrorCovariance(pixelPt);
-        math::linear::MatrixMxN<2, 3> groundPartials =
-                mProjection->sceneToImagePartials(scenePt);
-        math::linear::MatrixMxN<2, 7> sensorPartials =
-                mProjection->sceneToImageSensorPartials(scenePt);
-
-        math::linear::MatrixMxN<10, 10> fullCovar(0.0);
-        unmodeledCovar = unmodeledCovar + userCovar;
-        fullCovar.addInPlace(unmodeledCovar, 0, 0);
-        fullCovar[2][2] = heightVariance;
-        fullCovar.addInPlace(mSensorCovariance, 3, 3);
-        types::RowCol<double> ss = getSampleSpacing();
-        for (size_t ii = 0; ii < 3; ++ii)
+std::vector<csm::ImageCoord> SIXSensorModel::groundToImage(
+        const std::vector<csm::EcefCoord>& groundPts,
+        size_t numThreads) const
+{
+    try
+    {
+        std::vector<scene::Vector3> scenePts(groundPts.size());
+        for (size_t ii = 0; ii < groundPts.size(); ++ii)
         {
-            groundPartials[0][ii] /= ss.row;
-            groundPartials[1][ii] /= ss.col;
+            scenePts[ii] = toVector3(groundPts[ii]);
         }
 
-        for (size_t ii = 0; ii < 7; ++ii)
+        std::vector<types::RowCol<double> > imagePts(scenePts.size());
+        mProjection->sceneToImage(
+                std::span<const scene::Vector3>(scenePts.data(),
+                                                scenePts.size()),
+                std::span<types::RowCol<double> >(imagePts.data(),
+                                                  imagePts.size()),
+                numThreads);
+
+        std::vector<csm::ImageCoord> pixelPts(imagePts.size());
+        for (size_t ii = 0; ii < imagePts.size(); ++ii)
         {
-            sensorPartials[0][ii] /= ss.row;
-            sensorPartials[1][ii] /= ss.col;
+            pixelPts[ii] = toImageCoord(toPixel(imagePts[ii]));
         }
+        return pixelPts;
+    }
+    catch (const except::Exception& ex)
+    {
+        throw csm::Error(csm::Error::UNKNOWN_ERROR,
+                           ex.getMessage(),
+                           "SIXSensorModel::groundToImage");
+    }
+}
 
-        math::linear::MatrixMxN<3, 3> B(0.0);
-        B.addInPlace(groundPartials, 0, 0);
-        B[2][0] = 2 * groundPt.x / square(a + height);
-        B[2][1] = 2 * groundPt.y / square(a + height);
-        B[2][2] = 2 * groundPt.z / square(b + height);
-
-        math::linear::MatrixMxN<3, 10> A(0.0);
-        A[2][2] = -2.0 * ((square(groundPt.x) + square(groundPt.y)) /
-                          cube(a + height) +
-                  square(groundPt.z) / cube(b + height));
-        A.addInPlace(sensorPartials, 0, 3);
-        A[0][0] = A[1][1] = 1.0;
+std::vector<csm::ImageCoordCovar> SIXSensorModel::groundToImage(
+        const std::vector<csm::EcefCoordCovar>& groundPts,
+        size_t numThreads) const
+{
+    try
+    {
+        std::vector<scene::Vector3> scenePts(groundPts.size());
+        for (size_t ii = 0; ii < groundPts.size(); ++ii)
+        {
+            scenePts[ii] = toVector3(groundPts[ii]);
+        }
 
-        const math::linear::MatrixMxN<3, 3> Q = A * fullCovar * A.transpose();
+        std::vector<types::RowCol<double> > imagePts(scenePts.size());
+        mProjection->sceneToImage(
+                std::span<const scene::Vector3>(scenePts.data(),
+                                                scenePts.size()),
+                std::span<types::RowCol<double> >(imagePts.data(),
+                                                  imagePts.size()),
+                numThreads);
+
+        const types::RowCol<double> sampleSpacing = getSampleSpacing();
+        std::vector<csm::ImageCoordCovar> results(imagePts.size());
+        mt::run1D(results.size(), getNumThreads(numThreads),
+                  [&](size_t ii)
+        {
+            const csm::ImageCoord pixelPt = toImageCoord(toPixel(imagePts[ii]));
+            results[ii] = computeImageCovariance(groundPts[ii], pixelPt,
+                                                 imagePts[ii], sampleSpacing);
+        });
+        return results;
+    }
+    catch (const except::Exception& ex)
+    {
+        throw csm::Error(csm::Error::UNKNOWN_ERROR,
+                           ex.getMessage(),
+                           "SIXSensorModel::groundToImage");
+    }
+}
 
-        const math::linear::MatrixMxN<3, 3> Qinv = inverse(Q);
+std::vector<csm::EcefCoord> SIXSensorModel::imageToGround(
+        const std::vector<csm::ImageCoord>& imagePts,
+        const std::vector<double>& heights,
+        size_t numThreads) const
+{
+    try
+    {
+        std::vector<types::RowCol<double> > imagePtsMeters(imagePts.size());
+        for (size_t ii = 0; ii < imagePts.size(); ++ii)
+        {
+            imagePtsMeters[ii] = fromPixel(imagePts[ii]);
+        }
 
-        const math::linear::MatrixMxN<3, 3> imageToGroundCovarInv =
-                B.transpose() * Qinv * B;
+        std::vector<scene::Vector3> groundPts(imagePts.size());
+        mProjection->imageToScene(
+                std::span<const types::RowCol<double> >(
+                        imagePtsMeters.data(), imagePtsMeters.size()),
+                std::span<const double>(heights.data(), heights.size()),
+                std::span<scene::Vector3>(groundPts.data(), groundPts.size()),
+                numThreads);
 
-        const math::linear::MatrixMxN<3, 3> errorCovar =
-                inverse(imageToGroundCovarInv);
+        std::vector<csm::EcefCoord> results(groundPts.size());
+        for (size_t ii = 0; ii < groundPts.size(); ++ii)
+        {
+            results[ii] = toEcefCoord(groundPts[ii]);
+        }
+        return results;
+    }
+    catch (const except::Exception& ex)
+    {
+        throw csm::Error(csm::Error::UNKNOWN_ERROR,
+                           ex.getMessage(),
+                           "SIXSensorModel::imageToGround");
+    }
+}
 
-        csm::EcefCoordCovar csmErrorCovar;
-        csmErrorCovar.x = groundPt.x;
-        csmErrorCovar.y = groundPt.y;
-        csmErrorCovar.z = groundPt.z;
-        for (size_t ii = 0; ii < 3; ++ii)
+std::vector<csm::EcefCoordCovar> SIXSensorModel::imageToGround(
+        const std::vector<csm::ImageCoordCovar>& imagePts,
+        const std::vector<double>& heights,
+        const std::vector<double>& heightVariances,
+        size_t numThreads) const
+{
+    try
+    {
+        if (heightVariances.size() != imagePts.size())
         {
-            for (size_t jj = 0; jj < 3; ++jj)
-            {
-                csmErrorCovar.covariance[ii * 3 + jj] = errorCovar[ii][jj];
-            }
+            throw except::Exception(Ctxt(
+                    "Expected " + std::to_string(imagePts.size()) +
+                    " height variances but got " +
+                    std::to_string(heightVariances.size())));
         }
 
-        return csmErrorCovar;
+        const std::vector<csm::ImageCoord> pixelPts(imagePts.begin(),
+                                                    imagePts.end());
+        const std::vector<csm::EcefCoord> groundPts =
+                imageToGround(pixelPts, heights, numThreads);
+
+        const types::RowCol<double> sampleSpacing = getSampleSpacing();
+        std::vector<csm::EcefCoordCovar> results(groundPts.size());
+        mt::run1D(results.size(), getNumThreads(numThreads),
+                  [&](size_t ii)
+        {
+            results[ii] = computeGroundCovariance(imagePts[ii], groundPts[ii],
+                                                  heights[ii],
+                                                  heightVariances[ii],
+                                                  sampleSpacing);
+        });
+        return results;
     }
     catch (const except::Exception& ex)
     {
@@ -20,6 +20,7 @@
  *
  */
 #include <iostream>
+#include <memory>
 #include <sstream>
 
 #include <std/filesystem>
@@ -71,6 +72,30 @@ public:
                 mComplexData.get(), mXmlRegistry));
     }
 
+    bool testBinaryModelState()
+    {
+        // A binary state goes in, but the model state comes back as XML
+        const auto bytes = six::sicd::Utilities::toBinary(*mComplexData);
+        const std::string binaryState = MODEL_NAME + std::string(" ") +
+                std::string(reinterpret_cast<const char*>(bytes.data()),
+                            bytes.size());
+        std::unique_ptr<csm::Model> model(
+                mPlugin.constructModelFromState(binaryState));
+
+        const std::string state = model->getModelState();
+        const std::string prefix = MODEL_NAME + std::string(" <");
+        if (state.compare(0, prefix.size(), prefix) != 0 ||
+            state.find('\0') != std::string::npos)
+        {
+            std::cerr << "getModelState() didn't return XML\n";
+            return false;
+        }
+
+        std::unique_ptr<csm::Model> roundTrip(
+                mPlugin.constructModelFromState(state));
+        return roundTrip->getModelState() == state;
+    }
+
 private:
     scene::Vector3 imageToGround(const csm::RasterGM& model,
             const six::RowColInt& scpPixel, double height, double offset)
@@ -247,7 +272,8 @@ int main(int argc, char** argv)
         }
 
         Test test(sicdPathname, confDir, plugin);
-        const bool testPassed = test.testFileISD() && test.testNitfISD();
+        const bool testPassed = test.testFileISD() && test.testNitfISD() &&
+                test.testBinaryModelState();
         return testPassed ? 0 : 1;
     }
 